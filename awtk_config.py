@@ -152,7 +152,7 @@ else:
 COMMON_CCFLAGS = COMMON_CCFLAGS+' -DWITH_DATA_READER_WRITER=1 '
 COMMON_CCFLAGS = COMMON_CCFLAGS+' -DWITH_EVENT_RECORDER_PLAYER=1 '
 COMMON_CCFLAGS = COMMON_CCFLAGS + \
-    ' -DWITH_ASSET_LOADER -DWITH_FS_RES -DWITH_ASSET_LOADER_ZIP '
+    ' -DWITH_ASSET_LOADER -DWITH_FS_RES -DWITH_ASSET_LOADER_ZIP -DWITH_ASSET_LOADER_PACK -DWITH_IMAGE_DISK_CACHE '
 COMMON_CCFLAGS = COMMON_CCFLAGS + \
     ' -DSTBTT_STATIC -DSTB_IMAGE_STATIC -DWITH_STB_IMAGE '
 COMMON_CCFLAGS = COMMON_CCFLAGS + \
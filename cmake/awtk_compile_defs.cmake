@@ -24,6 +24,8 @@ function(awtk_apply_common_compile_definitions _target)
     WITH_ASSET_LOADER
     WITH_FS_RES
     WITH_ASSET_LOADER_ZIP
+    WITH_ASSET_LOADER_PACK
+    WITH_IMAGE_DISK_CACHE
     STBTT_STATIC
     STB_IMAGE_STATIC
     WITH_STB_IMAGE
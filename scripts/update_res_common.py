@@ -435,6 +435,12 @@ def svggen_bin(raw, bin, sources_file = ' '):
     exec_cmd('\"' + to_exe('bsvggen') + '\" \"' + raw + '\" \"' + bin + '\" bin' + ' \"' + sources_file + '\"')
 
 
+def manifestgen(assets_root):
+    exe = to_exe('manifestgen')
+    if os.path.exists(exe):
+        exec_cmd('\"' + exe + '\" \"' + assets_root + '\"')
+
+
 def xml_to_ui(raw, inc, theme, sources_file = ' '):
     exec_cmd('\"' + to_exe('xml_to_ui') + '\" \"' + raw + '\" \"' + inc  + '\" data \"\" ' + theme + ' \"' + sources_file + '\"')
 
@@ -900,6 +906,13 @@ def gen_res_all():
     print('=========================================================')
 
 
+def gen_res_manifest():
+    if not IS_GENERATE_RAW:
+        return
+
+    manifestgen(OUTPUT_ROOT)
+
+
 def gen_includes(files, inherited, with_multi_theme):
     result = ""
 
@@ -1290,6 +1303,9 @@ def update_res():
     elif ACTION == 'assets.c':
         gen_res_c()
 
+    if ACTION not in ['clean', 'web', 'json', 'pinyin', 'assets.c']:
+        gen_res_manifest()
+
     dump_args()
 
 
@@ -1322,6 +1338,8 @@ def clean_res():
     else:
         theme_foreach(clean_res_of_one_theme)
         remove_dir(ASSET_C)
+        if os.path.exists(join_path(OUTPUT_ROOT, 'manifest.bin')):
+            remove_dir(join_path(OUTPUT_ROOT, 'manifest.bin'))
     print('=========================================================')
 
 def get_args(args) :
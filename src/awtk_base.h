@@ -41,6 +41,9 @@
 #include "base/font_manager.h"
 #include "base/g2d.h"
 #include "base/glyph_cache.h"
+#include "base/glyph_atlas.h"
+#include "base/tile_painter.h"
+#include "base/layer_cache.h"
 #include "base/idle.h"
 #include "base/image_base.h"
 #include "base/image_loader.h"
@@ -31,6 +31,9 @@
 #include "tkc/platform.h"
 #include "base/main_loop.h"
 #include "base/font_manager.h"
+#include "base/glyph_atlas.h"
+#include "base/tile_painter.h"
+#include "base/layer_cache.h"
 #include "base/input_method.h"
 #include "base/image_manager.h"
 #include "base/window_manager.h"
@@ -248,10 +251,20 @@ ret_t tk_init_internal(void) {
                        RET_FAIL);
 #endif
   return_value_if_fail(locale_info_set(locale_info_create(NULL, NULL)) == RET_OK, RET_FAIL);
+#ifdef WITH_GLYPH_ATLAS
+  return_value_if_fail(glyph_atlas_set(glyph_atlas_create(TK_GLYPH_ATLAS_PAGE_W,
+                                                          TK_GLYPH_ATLAS_PAGE_H,
+                                                          TK_GLYPH_ATLAS_PAGE_NR)) == RET_OK,
+                       RET_FAIL);
+#endif /*WITH_GLYPH_ATLAS*/
   return_value_if_fail(font_manager_set(font_manager_create(font_loader)) == RET_OK, RET_FAIL);
   return_value_if_fail(font_manager_set_assets_manager(font_manager(), assets_manager()) == RET_OK,
                        RET_FAIL);
   return_value_if_fail(image_manager_set(image_manager_create()) == RET_OK, RET_FAIL);
+#ifdef WITH_TILE_PAINTER
+  tile_painter_set(tile_painter_create(TK_TILE_PAINTER_THREADS));
+#endif /*WITH_TILE_PAINTER*/
+  return_value_if_fail(layer_cache_set(layer_cache_create()) == RET_OK, RET_FAIL);
 #ifndef WITHOUT_WINDOW_ANIMATORS
   return_value_if_fail(window_animator_factory_set(window_animator_factory_create()) == RET_OK,
                        RET_FAIL);
@@ -367,6 +380,16 @@ ret_t tk_deinit_internal(void) {
   self_layouter_factory_set(NULL);
 #endif /*WITHOUT_LAYOUT*/
 
+  if (tile_painter() != NULL) {
+    tile_painter_destroy(tile_painter());
+    tile_painter_set(NULL);
+  }
+
+  if (layer_cache() != NULL) {
+    layer_cache_destroy(layer_cache());
+    layer_cache_set(NULL);
+  }
+
   image_manager_destroy(image_manager());
   image_manager_set(NULL);
 
@@ -413,6 +436,11 @@ ret_t tk_deinit_internal(void) {
   font_manager_destroy(font_manager());
   font_manager_set(NULL);
 
+#ifdef WITH_GLYPH_ATLAS
+  glyph_atlas_destroy(glyph_atlas());
+  glyph_atlas_set(NULL);
+#endif /*WITH_GLYPH_ATLAS*/
+
   locale_info_destroy(locale_info());
   locale_info_set(NULL);
 
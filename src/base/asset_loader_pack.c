@@ -0,0 +1,267 @@
+﻿/**
+ * File:   asset_loader_pack.c
+ * Author: AWTK Develop Team
+ * Brief:  load assets from a mmapped asset pack
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/fs.h"
+#include "tkc/mem.h"
+#include "tkc/path.h"
+#include "tkc/utils.h"
+#include "tkc/buffer.h"
+#include "base/assets_manifest.h"
+#include "base/asset_loader_pack.h"
+
+#define ASSET_PACK_HEADER_SIZE 16
+#define ASSET_PACK_PAGE_SIZE 4096
+#define ASSET_PACK_ALIGN 16
+
+#define ASSET_PACK_ALIGN_UP(v, a) ((((v) + (a)-1) / (a)) * (a))
+
+#ifdef WITH_ASSET_LOADER_PACK
+#include "tkc/mmap.h"
+#include "base/assets_manager.h"
+
+typedef struct _asset_loader_pack_t {
+  asset_loader_t asset_loader;
+  mmap_t* map;
+  assets_manifest_t* index;
+} asset_loader_pack_t;
+
+static const char* asset_loader_pack_rel_path(const char* path) {
+  const char* p = path;
+  const char* res_root = assets_manager_get_res_root(assets_manager());
+  uint32_t res_root_len = res_root == NULL ? 0 : strlen(res_root);
+
+  if (res_root_len > 0 && strncmp(p, res_root, res_root_len) == 0) {
+    p += res_root_len;
+  }
+
+  while (*p == '/' || *p == '\\') p++;
+  if (strncmp(p, "assets", 6) == 0 && (p[6] == '/' || p[6] == '\\')) {
+    p += 7;
+  }
+
+  return p;
+}
+
+static bool_t asset_loader_pack_exist(asset_loader_t* loader, const char* path) {
+  asset_loader_pack_t* pack = (asset_loader_pack_t*)loader;
+
+  return assets_manifest_has(pack->index, asset_loader_pack_rel_path(path));
+}
+
+static asset_info_t* asset_loader_pack_load(asset_loader_t* loader, uint16_t type,
+                                            uint16_t subtype, const char* path,
+                                            const char* name) {
+  asset_info_t* info = NULL;
+  const uint8_t* data = NULL;
+  asset_loader_pack_t* pack = (asset_loader_pack_t*)loader;
+  const assets_manifest_entry_t* entry =
+      assets_manifest_find(pack->index, asset_loader_pack_rel_path(path));
+
+  if (entry == NULL) {
+    return NULL;
+  }
+
+  data = (const uint8_t*)(pack->map->data) + entry->offset;
+#ifdef LOAD_ASSET_WITH_MMAP
+  info = asset_info_create(type, subtype, name, 0);
+  return_value_if_fail(info != NULL, NULL);
+
+  info->map = mmap_ref(pack->map);
+  info->data = (uint8_t*)data;
+  info->size = entry->size;
+#else
+  info = asset_info_create(type, subtype, name, entry->size);
+  return_value_if_fail(info != NULL, NULL);
+
+  memcpy(info->data, data, entry->size);
+#endif /*LOAD_ASSET_WITH_MMAP*/
+
+  return info;
+}
+
+static ret_t asset_loader_pack_destroy(asset_loader_t* loader) {
+  asset_loader_pack_t* pack = (asset_loader_pack_t*)loader;
+
+  if (pack->index != NULL) {
+    assets_manifest_destroy(pack->index);
+  }
+
+  /*已加载的资源还持有mmap的引用，映射在它们都释放后才解除。*/
+  if (pack->map != NULL) {
+    mmap_destroy(pack->map);
+  }
+
+  TKMEM_FREE(loader);
+
+  return RET_OK;
+}
+
+static const asset_loader_vtable_t s_asset_loader_pack_vtable = {
+    .load = asset_loader_pack_load,
+    .exist = asset_loader_pack_exist,
+    .destroy = asset_loader_pack_destroy};
+
+asset_loader_t* asset_loader_pack_create(const char* packfile) {
+  uint32_t i = 0;
+  const uint32_t* header = NULL;
+  asset_loader_pack_t* pack = NULL;
+  return_value_if_fail(packfile != NULL, NULL);
+
+  pack = TKMEM_ZALLOC(asset_loader_pack_t);
+  return_value_if_fail(pack != NULL, NULL);
+
+  pack->asset_loader.vt = &s_asset_loader_pack_vtable;
+  pack->map = mmap_create(packfile, FALSE, FALSE);
+  goto_error_if_fail(pack->map != NULL);
+  goto_error_if_fail(pack->map->size >= ASSET_PACK_HEADER_SIZE);
+
+  header = (const uint32_t*)(pack->map->data);
+  goto_error_if_fail(header[0] == ASSET_PACK_MAGIC);
+  goto_error_if_fail(header[1] == ASSET_PACK_VERSION);
+  goto_error_if_fail(header[2] <= pack->map->size - ASSET_PACK_HEADER_SIZE);
+
+  pack->index = assets_manifest_create_ex((const uint8_t*)(header) + ASSET_PACK_HEADER_SIZE,
+                                          header[2], FALSE);
+  goto_error_if_fail(pack->index != NULL);
+
+  /*每个资源后面至少有一个'\0'，这样零拷贝的视图和堆上分配的资源一样，可以当字符串使用*/
+  for (i = 0; i < pack->index->nr; i++) {
+    const assets_manifest_entry_t* iter = pack->index->entries + i;
+    uint64_t end = (uint64_t)(iter->offset) + iter->size;
+
+    goto_error_if_fail(end < pack->map->size);
+    goto_error_if_fail(((const uint8_t*)(pack->map->data))[end] == 0);
+  }
+
+  return (asset_loader_t*)pack;
+error:
+  log_warn("invalid asset pack: %s\n", packfile);
+  asset_loader_pack_destroy((asset_loader_t*)pack);
+  return NULL;
+}
+#endif /*WITH_ASSET_LOADER_PACK*/
+
+static ret_t asset_pack_write_zeros(fs_file_t* f, uint32_t size) {
+  static const uint8_t s_zeros[256] = {0};
+
+  while (size > 0) {
+    uint32_t n = tk_min(size, sizeof(s_zeros));
+    return_value_if_fail(fs_file_write(f, s_zeros, n) == (int32_t)n, RET_IO);
+    size -= n;
+  }
+
+  return RET_OK;
+}
+
+static ret_t asset_pack_write_data(fs_file_t* f, assets_manifest_t* index, const char* assets_dir) {
+  uint32_t i = 0;
+  uint32_t offset = 0;
+  ret_t ret = RET_OK;
+  char path[MAX_PATH + 1];
+  const assets_manifest_entry_t* iter = NULL;
+
+  offset = fs_file_tell(f);
+
+  for (i = 0; i < index->nr && ret == RET_OK; i++) {
+    uint32_t size = 0;
+    uint8_t* data = NULL;
+
+    iter = index->entries + i;
+    path_build(path, MAX_PATH, assets_dir, index->names + iter->name, NULL);
+    data = (uint8_t*)file_read(path, &size);
+    if (data == NULL || size != iter->size) {
+      log_warn("read %s failed\n", path);
+      TKMEM_FREE(data);
+      return RET_IO;
+    }
+
+    ret = asset_pack_write_zeros(f, iter->offset - offset);
+    if (ret == RET_OK && fs_file_write(f, data, size) != (int32_t)size) {
+      ret = RET_IO;
+    }
+    offset = iter->offset + size;
+    TKMEM_FREE(data);
+  }
+
+  return ret;
+}
+
+ret_t asset_loader_pack_save(const char* assets_dir, const char* filename) {
+  uint32_t i = 0;
+  uint32_t offset = 0;
+  fs_file_t* f = NULL;
+  ret_t ret = RET_OK;
+  wbuffer_t wbuffer;
+  assets_manifest_t* index = NULL;
+  assets_manifest_entry_t* entries = NULL;
+  return_value_if_fail(assets_dir != NULL && filename != NULL, RET_BAD_PARAMS);
+
+  wbuffer_init_extendable(&wbuffer);
+  ret = assets_manifest_build(assets_dir, &wbuffer);
+  goto_error_if_fail(ret == RET_OK);
+
+  index = assets_manifest_create_ex(wbuffer.data, wbuffer.cursor, FALSE);
+  goto_error_if_fail(index != NULL);
+
+  /*按写入顺序(与索引顺序相同)分配偏移，数据后至少留一个\0。*/
+  offset = ASSET_PACK_ALIGN_UP(ASSET_PACK_HEADER_SIZE + wbuffer.cursor, ASSET_PACK_PAGE_SIZE);
+  entries = (assets_manifest_entry_t*)(index->entries);
+  for (i = 0; i < index->nr; i++) {
+    assets_manifest_entry_t* iter = entries + i;
+    uint32_t align = iter->size >= ASSET_PACK_PAGE_SIZE ? ASSET_PACK_PAGE_SIZE : ASSET_PACK_ALIGN;
+
+    iter->offset = ASSET_PACK_ALIGN_UP(offset, align);
+    offset = iter->offset + iter->size + 1;
+  }
+
+  f = fs_open_file(os_fs(), filename, "wb");
+  goto_error_if_fail(f != NULL);
+
+  {
+    uint32_t header[4] = {ASSET_PACK_MAGIC, ASSET_PACK_VERSION, 0, 0};
+    header[2] = wbuffer.cursor;
+    goto_error_if_fail(fs_file_write(f, header, sizeof(header)) == (int32_t)sizeof(header));
+    goto_error_if_fail(fs_file_write(f, wbuffer.data, wbuffer.cursor) == (int32_t)wbuffer.cursor);
+  }
+
+  ret = asset_pack_write_data(f, index, assets_dir);
+  goto_error_if_fail(ret == RET_OK);
+
+  i = fs_file_tell(f);
+  ret = asset_pack_write_zeros(f, ASSET_PACK_ALIGN_UP(i + 1, ASSET_PACK_ALIGN) - i);
+  goto_error_if_fail(ret == RET_OK);
+
+  fs_file_close(f);
+  assets_manifest_destroy(index);
+  wbuffer_deinit(&wbuffer);
+
+  return RET_OK;
+error:
+  if (f != NULL) {
+    fs_file_close(f);
+  }
+  if (index != NULL) {
+    assets_manifest_destroy(index);
+  }
+  wbuffer_deinit(&wbuffer);
+
+  return ret == RET_OK ? RET_FAIL : ret;
+}
@@ -0,0 +1,79 @@
+﻿/**
+ * File:   asset_loader_pack.h
+ * Author: AWTK Develop Team
+ * Brief:  load assets from a mmapped asset pack
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_ASSET_LOADER_PACK_H
+#define TK_ASSET_LOADER_PACK_H
+
+#include "base/asset_loader.h"
+
+BEGIN_C_DECLS
+
+#define ASSET_PACK_MAGIC 0x504b5441 /*ATKP*/
+#define ASSET_PACK_VERSION 1
+
+/**
+ * @class asset_loader_pack_t
+ * @parent asset_loader_t
+ * 资源包加载器。
+ *
+ * 资源包把assets目录下各个主题raw目录中的文件不压缩地存放在一个文件中。
+ * 加载器只mmap整个资源包一次，加载资源时直接查索引，不访问文件系统。
+ *
+ * 定义了LOAD\_ASSET\_WITH\_MMAP时，加载的资源直接指向映射的内存(共享同一个mmap对象，通过引用计数管理)，
+ * 字体、UI、主题和字符串等数据都不会被拷贝。多个进程使用同一个资源包时，这些只读页面由系统共享。
+ * 没有定义LOAD\_ASSET\_WITH\_MMAP时，资源数据从映射的内存中拷贝一份。
+ *
+ * 文件格式(小端)：
+ *
+ * ```
+ * magic(4) version(4) index_size(4) reserved(4)
+ * index[index_size]：格式与资源清单(assets\_manifest\_t)相同，offset为数据在资源包中的偏移。
+ * data：不小于一页(4K)的文件按页对齐，其它文件按16字节对齐。每个文件的数据后至少有一个\0。
+ * ```
+ *
+ * 资源路径是相对于assets目录的路径，与资源管理器的res\_root无关。
+ *
+ * > 需要定义WITH\_ASSET\_LOADER\_PACK，且平台支持mmap。
+ */
+
+/**
+ * @method asset_loader_pack_create
+ * 创建资源包加载器。
+ * @annotation ["constructor"]
+ * @param {const char*} packfile 资源包文件名。
+ *
+ * @return {asset_loader_t*} 返回loader对象，失败返回NULL。
+ */
+asset_loader_t* asset_loader_pack_create(const char* packfile);
+
+/**
+ * @method asset_loader_pack_save
+ * 扫描assets目录，生成资源包文件。
+ * @param {const char*} assets_dir assets目录。
+ * @param {const char*} filename 资源包文件名。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t asset_loader_pack_save(const char* assets_dir, const char* filename);
+
+END_C_DECLS
+
+#endif /*TK_ASSET_LOADER_PACK_H*/
@@ -211,6 +211,88 @@ ret_t assets_manager_build_asset_filename(assets_manager_t* am, char* path, uint
   }
 }
 
+static ret_t assets_manager_load_manifest(assets_manager_t* am, const char* res_root) {
+  char path[MAX_PATH + 1];
+  asset_info_t* info = NULL;
+  return_value_if_fail(path_build(path, MAX_PATH, res_root, ASSETS_DIR, ASSETS_MANIFEST_FILENAME,
+                                  NULL) == RET_OK,
+                       RET_FAIL);
+
+  if (am->manifest != NULL) {
+    assets_manifest_destroy(am->manifest);
+    am->manifest = NULL;
+  }
+
+  info = asset_loader_load(am->loader, ASSET_TYPE_DATA, ASSET_TYPE_DATA_BIN, path,
+                           ASSETS_MANIFEST_FILENAME);
+  if (info != NULL) {
+    am->manifest = assets_manifest_create(info->data, info->size);
+    asset_info_destroy(info);
+  }
+
+  return RET_OK;
+}
+
+/*res_root变化时重新读取清单。清单存在时，manifest_dir为assets目录。*/
+static assets_manifest_t* assets_manager_ensure_manifest(assets_manager_t* am) {
+  char dir[MAX_PATH + 1];
+  const char* res_root = assets_manager_get_res_root(am);
+
+  if (am->manifest_fixed || res_root == NULL) {
+    return am->manifest;
+  }
+
+  return_value_if_fail(path_build(dir, MAX_PATH, res_root, ASSETS_DIR, NULL) == RET_OK, NULL);
+  if (am->manifest_dir == NULL || !tk_str_eq(am->manifest_dir, dir)) {
+    assets_manager_load_manifest(am, res_root);
+    am->manifest_dir = tk_str_copy(am->manifest_dir, dir);
+  }
+
+  return am->manifest;
+}
+
+/*返回TRUE表示清单覆盖了该路径，exist为是否存在，此时不需要再访问文件系统。*/
+static bool_t assets_manager_check_manifest(assets_manager_t* am, const char* path,
+                                            bool_t* exist) {
+  uint32_t len = 0;
+
+  if (am->manifest == NULL || am->manifest_dir == NULL) {
+    return FALSE;
+  }
+
+  len = strlen(am->manifest_dir);
+  if (strncmp(path, am->manifest_dir, len) != 0 || (path[len] != '/' && path[len] != '\\')) {
+    /*自定义目录中的资源不在清单中*/
+    return FALSE;
+  }
+
+  *exist = assets_manifest_has(am->manifest, path + len + 1);
+
+  return TRUE;
+}
+
+static bool_t assets_manager_exist(assets_manager_t* am, const char* path) {
+  bool_t exist = FALSE;
+
+  if (assets_manager_check_manifest(am, path, &exist)) {
+    return exist;
+  }
+
+  return asset_loader_exist(am->loader, path);
+}
+
+static asset_info_t* assets_manager_try_load(assets_manager_t* am, uint16_t type,
+                                             uint16_t subtype, const char* path,
+                                             const char* name) {
+  bool_t exist = TRUE;
+
+  if (assets_manager_check_manifest(am, path, &exist) && !exist) {
+    return NULL;
+  }
+
+  return asset_loader_load(am->loader, type, subtype, path, name);
+}
+
 static asset_info_t* try_load_image(assets_manager_t* am, const char* theme, const char* name,
                                     asset_image_type_t subtype, bool_t ratio) {
   char path[MAX_PATH + 1];
@@ -252,14 +334,14 @@ static asset_info_t* try_load_image(assets_manager_t* am, const char* theme, con
                                                            subpath, name, extname) == RET_OK,
                        NULL);
 
-  if (subtype == ASSET_TYPE_IMAGE_JPG && !asset_loader_exist(am->loader, path)) {
+  if (subtype == ASSET_TYPE_IMAGE_JPG && !assets_manager_exist(am, path)) {
     uint32_t len = strlen(path);
     return_value_if_fail(MAX_PATH > len, NULL);
     memcpy(path + len - 4, ".jpeg", 5);
     path[len + 1] = '\0';
   }
 
-  return asset_loader_load(am->loader, ASSET_TYPE_IMAGE, subtype, path, name);
+  return assets_manager_try_load(am, ASSET_TYPE_IMAGE, subtype, path, name);
 }
 
 static asset_info_t* try_load_assets(assets_manager_t* am, const char* theme, const char* name,
@@ -308,7 +390,7 @@ static asset_info_t* try_load_assets(assets_manager_t* am, const char* theme, co
                                                            subpath, name, extname) == RET_OK,
                        NULL);
 
-  return asset_loader_load(am->loader, type, subtype, path, name);
+  return assets_manager_try_load(am, type, subtype, path, name);
 }
 
 static uint16_t subtype_from_extname(const char* extname) {
@@ -535,6 +617,7 @@ static asset_info_t* assets_manager_load_impl(assets_manager_t* am, asset_type_t
     return info;
   } else {
     const char* theme = am->theme ? am->theme : THEME_DEFAULT;
+    assets_manager_ensure_manifest(am);
     info = assets_manager_load_asset(am, type, subtype, theme, name);
     if (info == NULL && !tk_str_eq(theme, THEME_DEFAULT)) {
       info = assets_manager_load_asset(am, type, subtype, THEME_DEFAULT, name);
@@ -890,6 +973,11 @@ ret_t assets_manager_deinit(assets_manager_t* am) {
   asset_loader_destroy(am->loader);
   darray_deinit(&(am->assets));
   TKMEM_FREE(am->name);
+  if (am->manifest != NULL) {
+    assets_manifest_destroy(am->manifest);
+    am->manifest = NULL;
+  }
+  TKMEM_FREE(am->manifest_dir);
 
   return RET_OK;
 }
@@ -945,6 +1033,41 @@ ret_t assets_manager_set_loader(assets_manager_t* am, asset_loader_t* loader) {
     asset_loader_destroy(am->loader);
   }
   am->loader = loader;
+  assets_manager_reload_manifest(am);
+
+  return RET_OK;
+}
+
+ret_t assets_manager_set_manifest(assets_manager_t* am, assets_manifest_t* manifest) {
+  return_value_if_fail(am != NULL, RET_BAD_PARAMS);
+
+  if (am->manifest != NULL && am->manifest != manifest) {
+    assets_manifest_destroy(am->manifest);
+  }
+  am->manifest = manifest;
+  am->manifest_fixed = TRUE;
+#ifndef AWTK_WEB
+  {
+    char dir[MAX_PATH + 1];
+    const char* res_root = assets_manager_get_res_root(am);
+    if (res_root != NULL && path_build(dir, MAX_PATH, res_root, ASSETS_DIR, NULL) == RET_OK) {
+      am->manifest_dir = tk_str_copy(am->manifest_dir, dir);
+    }
+  }
+#endif /*AWTK_WEB*/
+
+  return RET_OK;
+}
+
+ret_t assets_manager_reload_manifest(assets_manager_t* am) {
+  return_value_if_fail(am != NULL, RET_BAD_PARAMS);
+
+  if (am->manifest != NULL) {
+    assets_manifest_destroy(am->manifest);
+    am->manifest = NULL;
+  }
+  TKMEM_FREE(am->manifest_dir);
+  am->manifest_fixed = FALSE;
 
   return RET_OK;
 }
@@ -28,6 +28,7 @@
 #include "tkc/asset_info.h"
 #include "base/types_def.h"
 #include "base/asset_loader.h"
+#include "base/assets_manifest.h"
 
 BEGIN_C_DECLS
 
@@ -72,6 +73,9 @@ typedef asset_info_t* (*assets_manager_load_asset_t)(void* ctx, asset_type_t typ
  *  ui      UI描述数据。
  * ```
  *
+ * 如果assets目录下有资源清单文件manifest.bin(请参考[assets\_manifest\_t](assets_manifest_t.md))，
+ * 从文件系统加载资源时会先查清单，跳过不存在的路径。
+ *
  */
 struct _assets_manager_t {
   emitter_t emitter;
@@ -95,6 +99,10 @@ struct _assets_manager_t {
   assets_manager_build_asset_dir_t custom_build_asset_dir;
 
   asset_loader_t* loader;
+
+  assets_manifest_t* manifest;
+  char* manifest_dir;
+  bool_t manifest_fixed;
 };
 
 /**
@@ -315,6 +323,31 @@ ret_t assets_manager_preload(assets_manager_t* am, asset_type_t type, const char
  */
 ret_t assets_manager_set_loader(assets_manager_t* am, asset_loader_t* loader);
 
+/**
+ * @method assets_manager_set_manifest
+ * 设置资源清单。
+ *
+ * > 缺省情况下，首次从文件系统加载资源时，自动读取assets目录下的manifest.bin。
+ *
+ * @param {assets_manager_t*} am asset manager对象。
+ * @param {assets_manifest_t*} manifest 资源清单(由assets manager销毁)。为NULL时不使用资源清单。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t assets_manager_set_manifest(assets_manager_t* am, assets_manifest_t* manifest);
+
+/**
+ * @method assets_manager_reload_manifest
+ * 丢弃当前的资源清单，下次加载资源时重新读取assets目录下的manifest.bin。
+ *
+ * > 运行时增加或删除了资源文件，并重新生成了清单后调用。
+ *
+ * @param {assets_manager_t*} am asset manager对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t assets_manager_reload_manifest(assets_manager_t* am);
+
 /**
  * @method assets_manager_set_custom_build_asset_dir
  * 设置一个函数，该函数用于生成资源路径。
@@ -0,0 +1,272 @@
+﻿/**
+ * File:   assets_manifest.c
+ * Author: AWTK Develop Team
+ * Brief:  prebuilt index of asset files
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/fs.h"
+#include "tkc/mem.h"
+#include "tkc/path.h"
+#include "tkc/utils.h"
+#include "tkc/darray.h"
+#include "base/assets_manifest.h"
+
+#define ASSETS_MANIFEST_HEADER_SIZE 16
+
+static uint32_t assets_manifest_hash(const char* path) {
+  /*FNV-1a，把\\当作/处理*/
+  uint32_t hash = 2166136261u;
+  const uint8_t* p = (const uint8_t*)path;
+
+  while (*p) {
+    hash ^= (*p == '\\') ? '/' : *p;
+    hash *= 16777619u;
+    p++;
+  }
+
+  return hash;
+}
+
+static bool_t assets_manifest_path_eq(const char* name, const char* path) {
+  while (*name && *path) {
+    char c = (*path == '\\') ? '/' : *path;
+    if (*name != c) {
+      return FALSE;
+    }
+    name++;
+    path++;
+  }
+
+  return *name == *path;
+}
+
+assets_manifest_t* assets_manifest_create(const uint8_t* data, uint32_t size) {
+  return assets_manifest_create_ex(data, size, TRUE);
+}
+
+assets_manifest_t* assets_manifest_create_ex(const uint8_t* data, uint32_t size, bool_t copy) {
+  uint32_t i = 0;
+  uint32_t nr = 0;
+  uint32_t names_size = 0;
+  const uint32_t* header = (const uint32_t*)data;
+  assets_manifest_t* manifest = NULL;
+  return_value_if_fail(data != NULL && size >= ASSETS_MANIFEST_HEADER_SIZE, NULL);
+  return_value_if_fail(header[0] == ASSETS_MANIFEST_MAGIC, NULL);
+  return_value_if_fail(header[1] == ASSETS_MANIFEST_VERSION, NULL);
+
+  nr = header[2];
+  names_size = header[3];
+  return_value_if_fail(names_size > 0, NULL);
+  return_value_if_fail(ASSETS_MANIFEST_HEADER_SIZE + (uint64_t)nr * sizeof(assets_manifest_entry_t) +
+                               names_size ==
+                           size,
+                       NULL);
+
+  manifest = TKMEM_ZALLOC(assets_manifest_t);
+  return_value_if_fail(manifest != NULL, NULL);
+
+  if (copy) {
+    manifest->data = (uint8_t*)TKMEM_ALLOC(size);
+    goto_error_if_fail(manifest->data != NULL);
+    memcpy(manifest->data, data, size);
+    manifest->own_data = TRUE;
+  } else {
+    manifest->data = (uint8_t*)data;
+  }
+
+  manifest->nr = nr;
+  manifest->names_size = names_size;
+  manifest->entries = (const assets_manifest_entry_t*)(manifest->data + ASSETS_MANIFEST_HEADER_SIZE);
+  manifest->names = (const char*)(manifest->entries + nr);
+  goto_error_if_fail(manifest->names[names_size - 1] == '\0');
+
+  for (i = 0; i < nr; i++) {
+    goto_error_if_fail(manifest->entries[i].name < names_size);
+  }
+
+  return manifest;
+error:
+  assets_manifest_destroy(manifest);
+  return NULL;
+}
+
+const assets_manifest_entry_t* assets_manifest_find(assets_manifest_t* manifest, const char* path) {
+  uint32_t low = 0;
+  uint32_t high = 0;
+  uint32_t hash = 0;
+  return_value_if_fail(manifest != NULL && path != NULL, NULL);
+
+  hash = assets_manifest_hash(path);
+  high = manifest->nr;
+  while (low < high) {
+    uint32_t mid = low + (high - low) / 2;
+    if (manifest->entries[mid].hash < hash) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  for (; low < manifest->nr && manifest->entries[low].hash == hash; low++) {
+    const assets_manifest_entry_t* iter = manifest->entries + low;
+    if (assets_manifest_path_eq(manifest->names + iter->name, path)) {
+      return iter;
+    }
+  }
+
+  return NULL;
+}
+
+bool_t assets_manifest_has(assets_manifest_t* manifest, const char* path) {
+  return assets_manifest_find(manifest, path) != NULL;
+}
+
+ret_t assets_manifest_destroy(assets_manifest_t* manifest) {
+  return_value_if_fail(manifest != NULL, RET_BAD_PARAMS);
+
+  if (manifest->own_data) {
+    TKMEM_FREE(manifest->data);
+  }
+  TKMEM_FREE(manifest);
+
+  return RET_OK;
+}
+
+typedef struct _manifest_item_t {
+  uint32_t hash;
+  uint32_t size;
+  char* path;
+} manifest_item_t;
+
+static ret_t manifest_item_destroy(manifest_item_t* item) {
+  TKMEM_FREE(item->path);
+  TKMEM_FREE(item);
+
+  return RET_OK;
+}
+
+static int manifest_item_cmp(manifest_item_t* a, manifest_item_t* b) {
+  if (a->hash != b->hash) {
+    return a->hash < b->hash ? -1 : 1;
+  }
+
+  return strcmp(a->path, b->path);
+}
+
+/*只收录{theme}/raw下的文件，inc等目录中的文件运行时不会用到。*/
+static ret_t assets_manifest_scan(darray_t* items, const char* dir, const char* prefix,
+                                  uint32_t depth) {
+  fs_item_t item;
+  ret_t ret = RET_OK;
+  char path[MAX_PATH + 1];
+  char name[MAX_PATH + 1];
+  fs_dir_t* d = fs_open_dir(os_fs(), dir);
+  return_value_if_fail(d != NULL, RET_FAIL);
+
+  while (ret == RET_OK && fs_dir_read(d, &item) == RET_OK) {
+    if (tk_str_eq(item.name, ".") || tk_str_eq(item.name, "..")) {
+      continue;
+    }
+
+    if ((depth < 2 && !item.is_dir) || (depth == 1 && !tk_str_eq(item.name, "raw"))) {
+      continue;
+    }
+
+    path_build(path, MAX_PATH, dir, item.name, NULL);
+    tk_snprintf(name, MAX_PATH, "%s%s%s", prefix, *prefix ? "/" : "", item.name);
+
+    if (item.is_dir) {
+      ret = assets_manifest_scan(items, path, name, depth + 1);
+    } else if (item.is_reg_file) {
+      manifest_item_t* iter = TKMEM_ZALLOC(manifest_item_t);
+      if (iter == NULL) {
+        ret = RET_OOM;
+        break;
+      }
+
+      iter->path = tk_strdup(name);
+      iter->hash = assets_manifest_hash(name);
+      iter->size = file_get_size(path);
+      ret = darray_push(items, iter);
+    }
+  }
+  fs_dir_close(d);
+
+  return ret;
+}
+
+ret_t assets_manifest_build(const char* assets_dir, wbuffer_t* wbuffer) {
+  darray_t items;
+  uint32_t i = 0;
+  uint32_t offset = 0;
+  ret_t ret = RET_OK;
+  return_value_if_fail(assets_dir != NULL && wbuffer != NULL, RET_BAD_PARAMS);
+
+  darray_init(&items, 128, (tk_destroy_t)manifest_item_destroy, NULL);
+  ret = assets_manifest_scan(&items, assets_dir, "", 0);
+  if (ret == RET_OK) {
+    darray_sort(&items, (tk_compare_t)manifest_item_cmp);
+
+    for (i = 0; i < items.size; i++) {
+      manifest_item_t* iter = (manifest_item_t*)darray_get(&items, i);
+      offset += strlen(iter->path) + 1;
+    }
+
+    wbuffer_write_uint32(wbuffer, ASSETS_MANIFEST_MAGIC);
+    wbuffer_write_uint32(wbuffer, ASSETS_MANIFEST_VERSION);
+    wbuffer_write_uint32(wbuffer, items.size);
+    wbuffer_write_uint32(wbuffer, offset > 0 ? offset : 1);
+
+    offset = 0;
+    for (i = 0; i < items.size; i++) {
+      manifest_item_t* iter = (manifest_item_t*)darray_get(&items, i);
+      wbuffer_write_uint32(wbuffer, iter->hash);
+      wbuffer_write_uint32(wbuffer, offset);
+      wbuffer_write_uint32(wbuffer, iter->size);
+      wbuffer_write_uint32(wbuffer, 0);
+      offset += strlen(iter->path) + 1;
+    }
+
+    for (i = 0; i < items.size; i++) {
+      manifest_item_t* iter = (manifest_item_t*)darray_get(&items, i);
+      wbuffer_write_string(wbuffer, iter->path);
+    }
+
+    if (items.size == 0) {
+      wbuffer_write_uint8(wbuffer, 0);
+    }
+  }
+  darray_deinit(&items);
+
+  return ret;
+}
+
+ret_t assets_manifest_save(const char* assets_dir, const char* filename) {
+  ret_t ret = RET_OK;
+  wbuffer_t wbuffer;
+  return_value_if_fail(assets_dir != NULL && filename != NULL, RET_BAD_PARAMS);
+
+  wbuffer_init_extendable(&wbuffer);
+  ret = assets_manifest_build(assets_dir, &wbuffer);
+  if (ret == RET_OK) {
+    ret = file_write(filename, wbuffer.data, wbuffer.cursor);
+  }
+  wbuffer_deinit(&wbuffer);
+
+  return ret;
+}
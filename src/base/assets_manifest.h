@@ -0,0 +1,176 @@
+﻿/**
+ * File:   assets_manifest.h
+ * Author: AWTK Develop Team
+ * Brief:  prebuilt index of asset files
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_ASSETS_MANIFEST_H
+#define TK_ASSETS_MANIFEST_H
+
+#include "tkc/buffer.h"
+
+BEGIN_C_DECLS
+
+#define ASSETS_MANIFEST_MAGIC 0x4d4b5441 /*ATKM*/
+#define ASSETS_MANIFEST_VERSION 2
+#define ASSETS_MANIFEST_FILENAME "manifest.bin"
+
+/**
+ * @class assets_manifest_entry_t
+ * 资源清单中的一项。
+ */
+typedef struct _assets_manifest_entry_t {
+  /**
+   * @property {uint32_t} hash
+   * @annotation ["readable"]
+   * 路径的哈希值。
+   */
+  uint32_t hash;
+  /**
+   * @property {uint32_t} name
+   * @annotation ["readable"]
+   * 路径在字符串区中的偏移。
+   */
+  uint32_t name;
+  /**
+   * @property {uint32_t} size
+   * @annotation ["readable"]
+   * 文件的大小。
+   */
+  uint32_t size;
+  /**
+   * @property {uint32_t} offset
+   * @annotation ["readable"]
+   * 文件数据在资源包中的偏移(仅用于资源包，清单文件中为0)。
+   */
+  uint32_t offset;
+} assets_manifest_entry_t;
+
+/**
+ * @class assets_manifest_t
+ * 资源清单。
+ *
+ * 记录assets目录下各个主题raw目录中资源文件的相对路径(以/分隔)和大小，由update\_res.py调用manifestgen生成，
+ * 保存为assets/manifest.bin。
+ *
+ * 资源管理器从文件系统加载资源时，需要按主题、屏幕密度和扩展名依次尝试多个路径，每次尝试都要访问文件系统。
+ * 有清单时，不在清单中的路径直接跳过，每个资源只需打开一次文件。
+ *
+ * 文件格式(小端)：
+ *
+ * ```
+ * magic(4) version(4) nr(4) names_size(4)
+ * entries[nr]：hash(4) name(4) size(4) offset(4)，按hash排序。
+ * names[names_size]：以\0结尾的路径。
+ * ```
+ *
+ * > 资源有变化时需要重新生成清单，否则不在清单中的资源将无法加载。
+ *
+ * 资源包(参考asset\_loader\_pack)也使用同样的格式作为索引。
+ */
+typedef struct _assets_manifest_t {
+  /**
+   * @property {uint32_t} nr
+   * @annotation ["readable"]
+   * 清单中的文件数。
+   */
+  uint32_t nr;
+
+  /*private*/
+  uint8_t* data;
+  const char* names;
+  uint32_t names_size;
+  bool_t own_data;
+  const assets_manifest_entry_t* entries;
+} assets_manifest_t;
+
+/**
+ * @method assets_manifest_create
+ * @annotation ["constructor"]
+ * 从清单数据创建资源清单对象(数据会被拷贝)。
+ * @param {const uint8_t*} data 清单数据。
+ * @param {uint32_t} size 清单数据的长度。
+ *
+ * @return {assets_manifest_t*} 返回资源清单对象，数据无效时返回NULL。
+ */
+assets_manifest_t* assets_manifest_create(const uint8_t* data, uint32_t size);
+
+/**
+ * @method assets_manifest_create_ex
+ * @annotation ["constructor"]
+ * 从清单数据创建资源清单对象。
+ * @param {const uint8_t*} data 清单数据(需4字节对齐)。
+ * @param {uint32_t} size 清单数据的长度。
+ * @param {bool_t} copy 是否拷贝数据。为FALSE时直接引用data，调用者需保证data在清单对象销毁前有效。
+ *
+ * @return {assets_manifest_t*} 返回资源清单对象，数据无效时返回NULL。
+ */
+assets_manifest_t* assets_manifest_create_ex(const uint8_t* data, uint32_t size, bool_t copy);
+
+/**
+ * @method assets_manifest_find
+ * 查找指定的文件。
+ * @param {assets_manifest_t*} manifest 资源清单对象。
+ * @param {const char*} path 相对于assets目录的路径(\\和/都可以作为分隔符)。
+ *
+ * @return {const assets_manifest_entry_t*} 返回清单项，不存在时返回NULL。
+ */
+const assets_manifest_entry_t* assets_manifest_find(assets_manifest_t* manifest, const char* path);
+
+/**
+ * @method assets_manifest_has
+ * 判断指定的文件是否在清单中。
+ * @param {assets_manifest_t*} manifest 资源清单对象。
+ * @param {const char*} path 相对于assets目录的路径(\\和/都可以作为分隔符)。
+ *
+ * @return {bool_t} 返回TRUE表示存在，否则表示不存在。
+ */
+bool_t assets_manifest_has(assets_manifest_t* manifest, const char* path);
+
+/**
+ * @method assets_manifest_destroy
+ * 销毁资源清单对象。
+ * @param {assets_manifest_t*} manifest 资源清单对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t assets_manifest_destroy(assets_manifest_t* manifest);
+
+/**
+ * @method assets_manifest_build
+ * 扫描assets目录，生成清单数据。
+ * @param {const char*} assets_dir assets目录。
+ * @param {wbuffer_t*} wbuffer 用于保存清单数据。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t assets_manifest_build(const char* assets_dir, wbuffer_t* wbuffer);
+
+/**
+ * @method assets_manifest_save
+ * 扫描assets目录，生成清单文件。
+ * @param {const char*} assets_dir assets目录。
+ * @param {const char*} filename 清单文件名(通常为assets目录下的manifest.bin)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t assets_manifest_save(const char* assets_dir, const char* filename);
+
+END_C_DECLS
+
+#endif /*TK_ASSETS_MANIFEST_H*/
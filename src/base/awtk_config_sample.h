@@ -52,6 +52,53 @@
  * #define WITH_FT_FONT 1
  */
 
+/**
+ * 如果定义本宏，Truetype字体光栅化后的A8字模打包到共享的字模图集中，减少内存分配和碎片。
+ * 可用TK_GLYPH_ATLAS_PAGE_W/TK_GLYPH_ATLAS_PAGE_H/TK_GLYPH_ATLAS_PAGE_NR设置页面大小和页数。
+ *
+ * #define WITH_GLYPH_ATLAS 1
+ */
+
+/**
+ * 如果定义本宏，软件渲染(lcd_mem)时较大的脏矩形切分成条带由多个线程并行绘制(参考tile_painter_t)。
+ * 可用TK_TILE_PAINTER_THREADS设置参与绘制的线程数(包括UI线程)。
+ *
+ * #define WITH_TILE_PAINTER 1
+ * #define TK_TILE_PAINTER_THREADS 4
+ */
+
+/**
+ * 异步解码图片(参考image_manager_get_bitmap_async)的后台线程数，缺省为2。
+ *
+ * #define TK_IMAGE_ASYNC_THREADS 2
+ */
+
+/**
+ * 如果定义本宏，主循环缺省启用tickless模式(参考main_loop_set_tickless)：
+ * 没有定时器、idle、动画和待绘制的内容时不再按固定频率唤醒，而是等待输入事件。
+ * 可用TK_MAX_TICKLESS_SLEEP_TIME设置一次最长的睡眠时间(毫秒)。
+ *
+ * #define WITH_MAIN_LOOP_TICKLESS 1
+ * #define TK_MAX_TICKLESS_SLEEP_TIME 1000
+ */
+
+/**
+ * 如果定义本宏，main_loop_simple使用无锁队列保存其它线程投递的事件(PC上缺省启用)，
+ * 定义WITHOUT_MAIN_LOOP_LF_QUEUE可以禁用，继续使用互斥锁保护的事件队列。
+ * 队列满时的处理策略参考main_loop_simple_set_queue_overflow。
+ *
+ * #define WITH_MAIN_LOOP_LF_QUEUE 1
+ * #define MAIN_LOOP_QUEUE_SIZE 64
+ * #define MAIN_LOOP_QUEUE_BLOCK_TIMEOUT 1000
+ */
+
+/**
+ * 主循环缺省会合并同一帧内连续的pointer/touch move、wheel和resize事件，如果不需要，请定义本宏。
+ * 也可以用main_loop_simple_set_coalesce_events在运行时开关。
+ *
+ * #define WITHOUT_MAIN_LOOP_COALESCE_EVENTS 1
+ */
+
 /**
  * 如果支持从文件系统加载资源，请定义本宏
  *
@@ -154,6 +201,12 @@
  * #define ENABLE_CURSOR 1
  */
 
+/**
+ * 如果不希望贴图/填充使用SIMD(SSE2/NEON)加速，请定义本宏。
+ *
+ * #define WITHOUT_BLEND_SIMD 1
+ */
+
 /**
  * 对于低端平台，如果不使用控件动画，请定义本宏。
  *
@@ -196,6 +249,20 @@
  * #define WITH_ASSET_LOADER_ZIP 1
  */
 
+/**
+ * 如果需要从资源包(mmap)中加载资源，请定义本宏(需要平台支持mmap)。
+ * 同时定义LOAD\_ASSET\_WITH\_MMAP时，资源数据直接指向映射的内存，不再拷贝。
+ *
+ * #define WITH_ASSET_LOADER_PACK 1
+ */
+
+/**
+ * 如果需要把解码后的图片缓存到磁盘中(需要平台支持mmap)，请定义本宏。
+ * 参考：image\_disk\_cache\_t。
+ *
+ * #define WITH_IMAGE_DISK_CACHE 1
+ */
+
 /**
  * 对于只有512K flash的平台，而且LCD格式是BGR565。如果希望进一步优化空间，去掉多余的bitmap格式支持代码。请定义本宏。
  * 其它LCD格式，可以自行修改：src/blend/soft_g2d.c 保留需要的格式即可。
@@ -254,6 +321,12 @@
  * #define WITHOUT_FSCRIPT 1
  */
 
+/**
+ * 对于 ROM/RAM 紧张的平台，如果不需要 fscript 字节码执行器(只用语法树解释执行)，请定义本宏。
+ *
+ * #define WITHOUT_FSCRIPT_VM 1
+ */
+
 /**
  * 对于极简键盘(3keys/5keys)，如果希望激活状态呈现不同的外观效果，请定义本宏。 
  *
@@ -31,6 +31,7 @@
 #include "base/system_info.h"
 #include "base/events.h"
 #include "base/lcd_profile.h"
+#include "base/tile_painter.h"
 
 #ifndef CANVAS_MEASURE_TEXT_CACHE_MAX_LENGTH
 #define CANVAS_MEASURE_TEXT_CACHE_MAX_LENGTH 127
@@ -757,15 +758,24 @@ static ret_t canvas_draw_glyph(canvas_t* c, glyph_t* g, xy_t x, xy_t y) {
 }
 
 static ret_t canvas_draw_char_impl(canvas_t* c, wchar_t chr, xy_t x, xy_t y) {
-  glyph_t g;
+  glyph_t g = {0};
+  ret_t ret = RET_OK;
   font_size_t font_size = c->font_size;
   font_vmetrics_t vmetrics = font_get_vmetrics(c->font, c->font_size);
-  return_value_if_fail(font_get_glyph(c->font, chr, font_size, &g) == RET_OK, RET_BAD_PARAMS);
 
-  x += g.x;
-  y += vmetrics.ascent + g.y;
+  /*并行绘制时，字模可能被其它线程从缓存中淘汰，取字模到绘制完成之间需要加锁*/
+  tile_painter_lock();
+  ret = font_get_glyph(c->font, chr, font_size, &g);
+  if (ret == RET_OK) {
+    x += g.x;
+    y += vmetrics.ascent + g.y;
+    ret = canvas_draw_glyph(c, &g, x, y);
+  } else {
+    ret = RET_BAD_PARAMS;
+  }
+  tile_painter_unlock();
 
-  return canvas_draw_glyph(c, &g, x, y);
+  return ret;
 }
 
 ret_t canvas_draw_char(canvas_t* c, wchar_t chr, xy_t x, xy_t y) {
@@ -776,13 +786,15 @@ ret_t canvas_draw_char(canvas_t* c, wchar_t chr, xy_t x, xy_t y) {
 
 static ret_t canvas_draw_text_impl(canvas_t* c, const wchar_t* str, uint32_t nr, xy_t x, xy_t y,
                                    bool_t line_breaker) {
-  glyph_t g;
+  glyph_t g = {0};
   uint32_t i = 0;
   xy_t left = x;
   font_vmetrics_t vmetrics = font_get_vmetrics(c->font, c->font_size);
   font_size_t font_size = c->font_size;
   int32_t baseline = vmetrics.ascent;
   return_value_if_fail(c->font != NULL, RET_BAD_PARAMS);
+
+  tile_painter_lock();
   for (i = 0; i < nr; i++) {
     wchar_t chr = str[i];
 
@@ -814,6 +826,7 @@ static ret_t canvas_draw_text_impl(canvas_t* c, const wchar_t* str, uint32_t nr,
       x += 4;
     }
   }
+  tile_painter_unlock();
 
   return RET_OK;
 }
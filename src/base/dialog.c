@@ -103,6 +103,7 @@ static ret_t dialog_on_copy(widget_t* widget, widget_t* other) {
 }
 
 TK_DECL_VTABLE(dialog) = {.size = sizeof(dialog_t),
+                          .paint_thread_safe = TRUE,
                           .type = WIDGET_TYPE_DIALOG,
                           .is_window = TRUE,
                           .clone_properties = s_dialog_properties,
@@ -0,0 +1,568 @@
+﻿/**
+ * File:   display_list.c
+ * Author: AWTK Develop Team
+ * Brief:  record canvas draw ops and replay them later
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "base/image_manager.h"
+#include "base/display_list.h"
+
+#define DISPLAY_LIST_POINTS_BATCH 64
+
+typedef enum _display_list_op_type_t {
+  DISPLAY_LIST_OP_SET_GLOBAL_ALPHA = 1,
+  DISPLAY_LIST_OP_SET_TEXT_COLOR,
+  DISPLAY_LIST_OP_SET_STROKE_COLOR,
+  DISPLAY_LIST_OP_SET_FILL_COLOR,
+  DISPLAY_LIST_OP_DRAW_VLINE,
+  DISPLAY_LIST_OP_DRAW_HLINE,
+  DISPLAY_LIST_OP_FILL_RECT,
+  DISPLAY_LIST_OP_CLEAR_RECT,
+  DISPLAY_LIST_OP_DRAW_POINTS,
+  DISPLAY_LIST_OP_DRAW_GLYPH,
+  DISPLAY_LIST_OP_DRAW_IMAGE
+} display_list_op_type_t;
+
+/*
+ * 每条命令由1个字节的类型和紧随其后的参数组成：
+ *
+ * * 颜色：color_t。
+ * * 透明度：uint8_t。
+ * * 线和矩形：rect_t(线的宽或者高为1)。
+ * * 点：uint32_t个数 + point_t数组。
+ * * 字模：rect_t目标区域 + w*h字节的alpha。
+ * * 图片：rectf_t src + rectf_t dst + 以'\0'结束的图片名。
+ */
+
+static ret_t display_list_write(display_list_t* dl, uint8_t type, const void* data,
+                                uint32_t size) {
+  wbuffer_t* wb = &(dl->ops);
+
+  if (!dl->recordable) {
+    return RET_FAIL;
+  }
+
+  if (wbuffer_write_uint8(wb, type) != RET_OK ||
+      (size > 0 && wbuffer_write_binary(wb, data, size) != RET_OK)) {
+    dl->recordable = FALSE;
+    return RET_OOM;
+  }
+  dl->nr++;
+
+  return RET_OK;
+}
+
+static ret_t display_list_write_rect(display_list_t* dl, uint8_t type, xy_t x, xy_t y, wh_t w,
+                                     wh_t h) {
+  rect_t r = rect_init(x, y, w, h);
+
+  return display_list_write(dl, type, &r, sizeof(r));
+}
+
+static ret_t display_list_write_color(display_list_t* dl, uint8_t type, color_t color) {
+  return display_list_write(dl, type, &color, sizeof(color));
+}
+
+static ret_t display_list_unrecordable(display_list_t* dl) {
+  dl->recordable = FALSE;
+
+  return RET_OK;
+}
+
+#define DISPLAY_LIST(lcd) ((display_list_t*)((lcd)->impl_data))
+
+static ret_t display_list_lcd_set_global_alpha(lcd_t* lcd, uint8_t alpha) {
+  return display_list_write(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_SET_GLOBAL_ALPHA, &alpha,
+                            sizeof(alpha));
+}
+
+static ret_t display_list_lcd_set_text_color(lcd_t* lcd, color_t color) {
+  return display_list_write_color(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_SET_TEXT_COLOR, color);
+}
+
+static ret_t display_list_lcd_set_stroke_color(lcd_t* lcd, color_t color) {
+  return display_list_write_color(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_SET_STROKE_COLOR, color);
+}
+
+static ret_t display_list_lcd_set_fill_color(lcd_t* lcd, color_t color) {
+  return display_list_write_color(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_SET_FILL_COLOR, color);
+}
+
+static ret_t display_list_lcd_draw_vline(lcd_t* lcd, xy_t x, xy_t y, wh_t h) {
+  return display_list_write_rect(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_DRAW_VLINE, x, y, 1, h);
+}
+
+static ret_t display_list_lcd_draw_hline(lcd_t* lcd, xy_t x, xy_t y, wh_t w) {
+  return display_list_write_rect(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_DRAW_HLINE, x, y, w, 1);
+}
+
+static ret_t display_list_lcd_fill_rect(lcd_t* lcd, xy_t x, xy_t y, wh_t w, wh_t h) {
+  return display_list_write_rect(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_FILL_RECT, x, y, w, h);
+}
+
+static ret_t display_list_lcd_clear_rect(lcd_t* lcd, xy_t x, xy_t y, wh_t w, wh_t h) {
+  return display_list_write_rect(DISPLAY_LIST(lcd), DISPLAY_LIST_OP_CLEAR_RECT, x, y, w, h);
+}
+
+static ret_t display_list_lcd_draw_points(lcd_t* lcd, point_t* points, uint32_t nr) {
+  display_list_t* dl = DISPLAY_LIST(lcd);
+
+  if (display_list_write(dl, DISPLAY_LIST_OP_DRAW_POINTS, &nr, sizeof(nr)) != RET_OK) {
+    return RET_FAIL;
+  }
+
+  if (wbuffer_write_binary(&(dl->ops), points, nr * sizeof(point_t)) != RET_OK) {
+    dl->recordable = FALSE;
+    return RET_OOM;
+  }
+
+  return RET_OK;
+}
+
+static ret_t display_list_lcd_draw_glyph(lcd_t* lcd, glyph_t* glyph, const rect_t* src, xy_t x,
+                                         xy_t y) {
+  wh_t i = 0;
+  display_list_t* dl = DISPLAY_LIST(lcd);
+  uint32_t glyph_w = glyph->pitch > 0 ? glyph->pitch : glyph->w;
+  const uint8_t* src_p = glyph->data + glyph_w * src->y + src->x;
+
+  if (glyph->format != GLYPH_FMT_ALPHA) {
+    return display_list_unrecordable(dl);
+  }
+
+  if (display_list_write_rect(dl, DISPLAY_LIST_OP_DRAW_GLYPH, x, y, src->w, src->h) != RET_OK) {
+    return RET_FAIL;
+  }
+
+  /*字模缓存可能被淘汰，所以复制像素*/
+  for (i = 0; i < src->h; i++) {
+    if (wbuffer_write_binary(&(dl->ops), src_p, src->w) != RET_OK) {
+      dl->recordable = FALSE;
+      return RET_OOM;
+    }
+    src_p += glyph_w;
+  }
+
+  return RET_OK;
+}
+
+static ret_t display_list_lcd_draw_image(lcd_t* lcd, bitmap_t* img, const rectf_t* src,
+                                         const rectf_t* dst) {
+  bitmap_t cached;
+  rectf_t rects[2];
+  display_list_t* dl = DISPLAY_LIST(lcd);
+  image_manager_t* imm = image_manager();
+
+  /*只记录image_manager管理的图片，回放时按名称重新获取*/
+  if (img->name == NULL || imm == NULL || image_manager_lookup(imm, img->name, &cached) != RET_OK ||
+      cached.buffer != img->buffer) {
+    return display_list_unrecordable(dl);
+  }
+
+  rects[0] = *src;
+  rects[1] = *dst;
+  if (display_list_write(dl, DISPLAY_LIST_OP_DRAW_IMAGE, rects, sizeof(rects)) != RET_OK) {
+    return RET_FAIL;
+  }
+
+  if (wbuffer_write_string(&(dl->ops), img->name) != RET_OK) {
+    dl->recordable = FALSE;
+    return RET_OOM;
+  }
+
+  return RET_OK;
+}
+
+static ret_t display_list_lcd_draw_image_matrix(lcd_t* lcd, draw_image_info_t* info) {
+  (void)info;
+
+  return display_list_unrecordable(DISPLAY_LIST(lcd));
+}
+
+static color_t display_list_lcd_get_point_color(lcd_t* lcd, xy_t x, xy_t y) {
+  display_list_t* dl = DISPLAY_LIST(lcd);
+
+  display_list_unrecordable(dl);
+
+  return lcd_get_point_color(dl->target, x, y);
+}
+
+static vgcanvas_t* display_list_lcd_get_vgcanvas(lcd_t* lcd) {
+  display_list_unrecordable(DISPLAY_LIST(lcd));
+
+  return NULL;
+}
+
+static bitmap_format_t display_list_lcd_get_desired_bitmap_format(lcd_t* lcd) {
+  return lcd_get_desired_bitmap_format(DISPLAY_LIST(lcd)->target);
+}
+
+static ret_t display_list_init_lcd(display_list_t* dl, lcd_t* target) {
+  lcd_t* lcd = &(dl->lcd);
+
+  memset(lcd, 0x00, sizeof(lcd_t));
+  lcd->set_global_alpha = display_list_lcd_set_global_alpha;
+  lcd->set_text_color = display_list_lcd_set_text_color;
+  lcd->set_stroke_color = display_list_lcd_set_stroke_color;
+  lcd->set_fill_color = display_list_lcd_set_fill_color;
+  lcd->draw_vline = display_list_lcd_draw_vline;
+  lcd->draw_hline = display_list_lcd_draw_hline;
+  lcd->fill_rect = display_list_lcd_fill_rect;
+  lcd->clear_rect = display_list_lcd_clear_rect;
+  lcd->draw_image = display_list_lcd_draw_image;
+  lcd->draw_image_matrix = display_list_lcd_draw_image_matrix;
+  lcd->draw_glyph = display_list_lcd_draw_glyph;
+  lcd->draw_points = display_list_lcd_draw_points;
+  lcd->get_point_color = display_list_lcd_get_point_color;
+  lcd->get_vgcanvas = display_list_lcd_get_vgcanvas;
+  lcd->get_desired_bitmap_format = display_list_lcd_get_desired_bitmap_format;
+
+  lcd->w = lcd_get_width(target);
+  lcd->h = lcd_get_height(target);
+  lcd->type = lcd_get_type(target);
+  lcd->ratio = target->ratio;
+  lcd->draw_mode = target->draw_mode;
+  lcd->font_size = target->font_size;
+  lcd->text_color = target->text_color;
+  lcd->fill_color = target->fill_color;
+  lcd->stroke_color = target->stroke_color;
+  lcd->global_alpha = 0xff;
+  lcd->impl_data = dl;
+
+  return RET_OK;
+}
+
+display_list_t* display_list_create(void) {
+  display_list_t* dl = TKMEM_ZALLOC(display_list_t);
+  return_value_if_fail(dl != NULL, NULL);
+
+  dl->dirty = TRUE;
+  wbuffer_init_extendable(&(dl->ops));
+
+  return dl;
+}
+
+bool_t display_list_is_recording(canvas_t* c) {
+  return c != NULL && c->lcd != NULL &&
+         c->lcd->get_vgcanvas == display_list_lcd_get_vgcanvas;
+}
+
+bool_t display_list_is_supported(canvas_t* c) {
+  return_value_if_fail(c != NULL && c->lcd != NULL, FALSE);
+
+  /*裁剪由lcd完成时，canvas不会裁剪绘制命令*/
+  return c->lcd->set_clip_rect == NULL && lcd_get_type(c->lcd) != LCD_VGCANVAS &&
+         !display_list_is_recording(c);
+}
+
+ret_t display_list_begin_record(display_list_t* dl, canvas_t* c, const rect_t* bounds) {
+  rect_t r;
+  xy_t ox = 0;
+  xy_t oy = 0;
+  wh_t lcd_w = 0;
+  wh_t lcd_h = 0;
+  return_value_if_fail(dl != NULL && c != NULL && bounds != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(dl->target == NULL, RET_BUSY);
+
+  if (!display_list_is_supported(c)) {
+    return RET_NOT_IMPL;
+  }
+
+  lcd_w = lcd_get_width(c->lcd);
+  lcd_h = lcd_get_height(c->lcd);
+  if (bounds->w <= 0 || bounds->h <= 0 || bounds->w > lcd_w || bounds->h > lcd_h) {
+    return RET_NOT_IMPL;
+  }
+
+  /*canvas的裁剪区不能超出lcd，区域在lcd之外时移动原点，保证录制到完整的内容*/
+  ox = c->ox;
+  oy = c->oy;
+  if (ox + bounds->x < 0 || ox + bounds->x + bounds->w > lcd_w) {
+    ox = -bounds->x;
+  }
+  if (oy + bounds->y < 0 || oy + bounds->y + bounds->h > lcd_h) {
+    oy = -bounds->y;
+  }
+
+  dl->save_ox = c->ox;
+  dl->save_oy = c->oy;
+  dl->save_alpha = c->global_alpha;
+  canvas_get_clip_rect(c, &(dl->save_clip));
+
+  dl->nr = 0;
+  dl->size = 0;
+  dl->ox = ox;
+  dl->oy = oy;
+  dl->canvas = c;
+  dl->valid = FALSE;
+  dl->dirty = FALSE;
+  dl->bounds = *bounds;
+  dl->recordable = TRUE;
+  dl->target = c->lcd;
+  wbuffer_rewind(&(dl->ops));
+  display_list_init_lcd(dl, c->lcd);
+
+  c->ox = ox;
+  c->oy = oy;
+  c->lcd = &(dl->lcd);
+  c->global_alpha = 0xff;
+  r = rect_init(ox + bounds->x, oy + bounds->y, bounds->w, bounds->h);
+  canvas_set_clip_rect(c, &r);
+
+  /*控件可能不设置颜色就直接绘制，先记录当前的颜色*/
+  display_list_write_color(dl, DISPLAY_LIST_OP_SET_TEXT_COLOR, dl->lcd.text_color);
+  display_list_write_color(dl, DISPLAY_LIST_OP_SET_FILL_COLOR, dl->lcd.fill_color);
+  display_list_write_color(dl, DISPLAY_LIST_OP_SET_STROKE_COLOR, dl->lcd.stroke_color);
+
+  return RET_OK;
+}
+
+ret_t display_list_end_record(display_list_t* dl) {
+  canvas_t* c = NULL;
+  return_value_if_fail(dl != NULL && dl->target != NULL && dl->canvas != NULL, RET_BAD_PARAMS);
+
+  c = dl->canvas;
+  c->lcd = dl->target;
+  c->ox = dl->save_ox;
+  c->oy = dl->save_oy;
+  c->global_alpha = dl->save_alpha;
+  canvas_set_clip_rect(c, &(dl->save_clip));
+
+  TKMEM_FREE(dl->lcd.font_name);
+  dl->target = NULL;
+  dl->canvas = NULL;
+  dl->valid = dl->recordable;
+  if (!dl->valid) {
+    dl->nr = 0;
+    wbuffer_rewind(&(dl->ops));
+  }
+  dl->size = dl->ops.cursor;
+
+  return dl->valid ? RET_OK : RET_FAIL;
+}
+
+static const uint8_t* display_list_read(const uint8_t* p, void* data, uint32_t size) {
+  memcpy(data, p, size);
+
+  return p + size;
+}
+
+static ret_t display_list_replay_points(lcd_t* lcd, const uint8_t* p, uint32_t nr,
+                                        const rect_t* clip, xy_t dx, xy_t dy) {
+  uint32_t i = 0;
+  uint32_t n = 0;
+  point_t batch[DISPLAY_LIST_POINTS_BATCH];
+
+  for (i = 0; i < nr; i++) {
+    point_t pt;
+    p = display_list_read(p, &pt, sizeof(pt));
+    pt.x += dx;
+    pt.y += dy;
+
+    if (pt.x >= clip->x && pt.y >= clip->y && pt.x < clip->x + clip->w &&
+        pt.y < clip->y + clip->h) {
+      batch[n++] = pt;
+      if (n == ARRAY_SIZE(batch)) {
+        lcd_draw_points(lcd, batch, n);
+        n = 0;
+      }
+    }
+  }
+
+  if (n > 0) {
+    lcd_draw_points(lcd, batch, n);
+  }
+
+  return RET_OK;
+}
+
+static ret_t display_list_replay_glyph(lcd_t* lcd, const uint8_t* data, const rect_t* r,
+                                       const rect_t* clip) {
+  rect_t src;
+  glyph_t glyph;
+  rect_t d = rect_intersect(r, clip);
+
+  if (d.w <= 0 || d.h <= 0) {
+    return RET_OK;
+  }
+
+  memset(&glyph, 0x00, sizeof(glyph));
+  glyph.w = r->w;
+  glyph.h = r->h;
+  glyph.data = data;
+  glyph.format = GLYPH_FMT_ALPHA;
+  src = rect_init(d.x - r->x, d.y - r->y, d.w, d.h);
+
+  return lcd_draw_glyph(lcd, &glyph, &src, d.x, d.y);
+}
+
+static ret_t display_list_replay_image(lcd_t* lcd, const char* name, rectf_t* src, rectf_t* dst,
+                                       const rect_t* clip) {
+  bitmap_t img;
+  rectf_t rclip = rectf_init(clip->x, clip->y, clip->w, clip->h);
+  rectf_t d = rectf_intersect(dst, &rclip);
+
+  if (d.w <= 0 || d.h <= 0 || dst->w <= 0 || dst->h <= 0) {
+    return RET_OK;
+  }
+
+  if (d.w != dst->w || d.h != dst->h) {
+    float_t sx = src->w / dst->w;
+    float_t sy = src->h / dst->h;
+
+    src->x += (d.x - dst->x) * sx;
+    src->y += (d.y - dst->y) * sy;
+    src->w = d.w * sx;
+    src->h = d.h * sy;
+  }
+
+  if (image_manager_get_bitmap(image_manager(), name, &img) != RET_OK) {
+    return RET_NOT_FOUND;
+  }
+
+  return lcd_draw_image(lcd, &img, src, &d);
+}
+
+ret_t display_list_replay(display_list_t* dl, canvas_t* c) {
+  rect_t clip;
+  xy_t dx = 0;
+  xy_t dy = 0;
+  uint8_t alpha = 0;
+  lcd_t* lcd = NULL;
+  const uint8_t* p = NULL;
+  const uint8_t* end = NULL;
+  return_value_if_fail(dl != NULL && c != NULL && c->lcd != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(dl->valid && dl->target == NULL, RET_BAD_PARAMS);
+
+  lcd = c->lcd;
+  dx = c->ox - dl->ox;
+  dy = c->oy - dl->oy;
+  alpha = lcd->global_alpha;
+  clip = rect_init(c->clip_left, c->clip_top, c->clip_right - c->clip_left + 1,
+                   c->clip_bottom - c->clip_top + 1);
+  if (clip.w <= 0 || clip.h <= 0) {
+    return RET_OK;
+  }
+
+  p = dl->ops.data;
+  end = p + dl->size;
+  while (p < end) {
+    uint8_t type = *p++;
+
+    switch (type) {
+      case DISPLAY_LIST_OP_SET_GLOBAL_ALPHA: {
+        uint8_t a = *p++;
+        lcd_set_global_alpha(lcd, (a * alpha) / 0xff);
+        break;
+      }
+      case DISPLAY_LIST_OP_SET_TEXT_COLOR:
+      case DISPLAY_LIST_OP_SET_STROKE_COLOR:
+      case DISPLAY_LIST_OP_SET_FILL_COLOR: {
+        color_t color;
+        p = display_list_read(p, &color, sizeof(color));
+        if (type == DISPLAY_LIST_OP_SET_TEXT_COLOR) {
+          lcd_set_text_color(lcd, color);
+        } else if (type == DISPLAY_LIST_OP_SET_STROKE_COLOR) {
+          lcd_set_stroke_color(lcd, color);
+        } else {
+          lcd_set_fill_color(lcd, color);
+        }
+        break;
+      }
+      case DISPLAY_LIST_OP_DRAW_VLINE:
+      case DISPLAY_LIST_OP_DRAW_HLINE:
+      case DISPLAY_LIST_OP_FILL_RECT:
+      case DISPLAY_LIST_OP_CLEAR_RECT: {
+        rect_t r;
+        p = display_list_read(p, &r, sizeof(r));
+        r.x += dx;
+        r.y += dy;
+        r = rect_intersect(&r, &clip);
+        if (r.w <= 0 || r.h <= 0) {
+          break;
+        }
+
+        if (type == DISPLAY_LIST_OP_DRAW_VLINE) {
+          lcd_draw_vline(lcd, r.x, r.y, r.h);
+        } else if (type == DISPLAY_LIST_OP_DRAW_HLINE) {
+          lcd_draw_hline(lcd, r.x, r.y, r.w);
+        } else if (type == DISPLAY_LIST_OP_FILL_RECT) {
+          lcd_fill_rect(lcd, r.x, r.y, r.w, r.h);
+        } else {
+          lcd_clear_rect(lcd, r.x, r.y, r.w, r.h);
+        }
+        break;
+      }
+      case DISPLAY_LIST_OP_DRAW_POINTS: {
+        uint32_t nr = 0;
+        p = display_list_read(p, &nr, sizeof(nr));
+        display_list_replay_points(lcd, p, nr, &clip, dx, dy);
+        p += nr * sizeof(point_t);
+        break;
+      }
+      case DISPLAY_LIST_OP_DRAW_GLYPH: {
+        rect_t r;
+        p = display_list_read(p, &r, sizeof(r));
+        r.x += dx;
+        r.y += dy;
+        display_list_replay_glyph(lcd, p, &r, &clip);
+        p += r.w * r.h;
+        break;
+      }
+      case DISPLAY_LIST_OP_DRAW_IMAGE: {
+        rectf_t rects[2];
+        const char* name = NULL;
+        p = display_list_read(p, rects, sizeof(rects));
+        name = (const char*)p;
+        p += strlen(name) + 1;
+        rects[1].x += dx;
+        rects[1].y += dy;
+        display_list_replay_image(lcd, name, rects, rects + 1, &clip);
+        break;
+      }
+      default: {
+        assert(!"invalid display list op");
+        p = end;
+        break;
+      }
+    }
+  }
+
+  lcd_set_global_alpha(lcd, alpha);
+
+  return RET_OK;
+}
+
+ret_t display_list_invalidate(display_list_t* dl) {
+  return_value_if_fail(dl != NULL, RET_BAD_PARAMS);
+
+  dl->dirty = TRUE;
+
+  return RET_OK;
+}
+
+ret_t display_list_destroy(display_list_t* dl) {
+  return_value_if_fail(dl != NULL && dl->target == NULL, RET_BAD_PARAMS);
+
+  wbuffer_deinit(&(dl->ops));
+  TKMEM_FREE(dl);
+
+  return RET_OK;
+}
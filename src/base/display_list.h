@@ -0,0 +1,181 @@
+﻿/**
+ * File:   display_list.h
+ * Author: AWTK Develop Team
+ * Brief:  record canvas draw ops and replay them later
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_DISPLAY_LIST_H
+#define TK_DISPLAY_LIST_H
+
+#include "tkc/buffer.h"
+#include "base/lcd.h"
+#include "base/canvas.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class display_list_t
+ * 绘制命令列表。
+ *
+ * 录制时把canvas的lcd临时替换为一个只记录命令的lcd，控件绘制产生的填充矩形、画线、
+ * 画点、贴图、字模以及颜色和透明度的变化被记录到一个紧凑的缓冲区中。
+ * 之后可以在不同的位置回放，回放时不再遍历控件树、计算样式和排版文字。
+ *
+ * * 裁剪由canvas在录制时完成，列表中保存的是裁剪后的命令，回放时再按当前的裁剪区裁剪。
+ * * 字模的像素会被复制，图片只保存名称，回放时从image\_manager获取。
+ * * 用到vgcanvas、读取像素或者非image\_manager管理的图片时，本次录制无效，调用者需要直接绘制。
+ * * 仅支持由canvas负责裁剪的lcd(如lcd\_mem)，GPU和FRAGMENT\_FRAME\_BUFFER\_SIZE时不可用。
+ *
+ * 控件一般通过widget\_paint\_with\_display\_list使用，控件调用widget\_invalidate时，
+ * 自己和祖先控件的绘制命令列表失效，下次绘制时重新录制。
+ */
+typedef struct _display_list_t {
+  /**
+   * @property {uint32_t} nr
+   * @annotation ["readable"]
+   * 命令的个数。
+   */
+  uint32_t nr;
+  /**
+   * @property {uint32_t} size
+   * @annotation ["readable"]
+   * 命令占用的字节数。
+   */
+  uint32_t size;
+  /**
+   * @property {bool_t} valid
+   * @annotation ["readable"]
+   * 最近一次录制是否可以回放。
+   */
+  bool_t valid;
+  /**
+   * @property {bool_t} dirty
+   * @annotation ["readable"]
+   * 是否需要重新录制。
+   */
+  bool_t dirty;
+  /**
+   * @property {rect_t} bounds
+   * @annotation ["readable"]
+   * 录制时的区域(相对于录制时canvas的原点)。
+   */
+  rect_t bounds;
+
+  /*private*/
+  xy_t ox;
+  xy_t oy;
+  lcd_t lcd;
+  lcd_t* target;
+  canvas_t* canvas;
+  wbuffer_t ops;
+  bool_t recordable;
+
+  xy_t save_ox;
+  xy_t save_oy;
+  rect_t save_clip;
+  uint8_t save_alpha;
+} display_list_t;
+
+/**
+ * @method display_list_create
+ * @annotation ["constructor"]
+ * 创建display_list对象。
+ *
+ * @return {display_list_t*} 返回display_list对象。
+ */
+display_list_t* display_list_create(void);
+
+/**
+ * @method display_list_is_supported
+ * 检查canvas是否支持录制。
+ * @annotation ["static"]
+ * @param {canvas_t*} c 画布对象。
+ *
+ * @return {bool_t} 返回TRUE表示支持，否则表示不支持。
+ */
+bool_t display_list_is_supported(canvas_t* c);
+
+/**
+ * @method display_list_is_recording
+ * 检查canvas是否处于录制状态。
+ * @annotation ["static"]
+ * @param {canvas_t*} c 画布对象。
+ *
+ * @return {bool_t} 返回TRUE表示正在录制，否则表示没有录制。
+ */
+bool_t display_list_is_recording(canvas_t* c);
+
+/**
+ * @method display_list_begin_record
+ * 开始录制。
+ *
+ * > 录制期间canvas上的绘制只会被记录，不会输出到lcd上，超出bounds的部分被裁剪掉。
+ * > bounds超出lcd时，录制期间会临时移动canvas的原点，bounds比lcd大时返回RET_NOT_IMPL。
+ *
+ * @param {display_list_t*} dl display_list对象。
+ * @param {canvas_t*} c 画布对象。
+ * @param {const rect_t*} bounds 录制的区域(相对于canvas当前的原点)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t display_list_begin_record(display_list_t* dl, canvas_t* c, const rect_t* bounds);
+
+/**
+ * @method display_list_end_record
+ * 结束录制，恢复canvas的状态。
+ * @param {display_list_t*} dl display_list对象。
+ *
+ * @return {ret_t} 返回RET_OK表示录制的结果可以回放，否则表示不能回放。
+ */
+ret_t display_list_end_record(display_list_t* dl);
+
+/**
+ * @method display_list_replay
+ * 回放。
+ *
+ * > 命令按canvas当前原点相对于录制时原点的偏移平移，并按canvas当前的裁剪区裁剪，
+ * > 透明度与canvas当前的透明度相乘。
+ *
+ * @param {display_list_t*} dl display_list对象。
+ * @param {canvas_t*} c 画布对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t display_list_replay(display_list_t* dl, canvas_t* c);
+
+/**
+ * @method display_list_invalidate
+ * 标识需要重新录制。
+ * @param {display_list_t*} dl display_list对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t display_list_invalidate(display_list_t* dl);
+
+/**
+ * @method display_list_destroy
+ * 销毁display_list对象。
+ * @param {display_list_t*} dl display_list对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t display_list_destroy(display_list_t* dl);
+
+END_C_DECLS
+
+#endif /*TK_DISPLAY_LIST_H*/
@@ -21,6 +21,7 @@
 
 #include "tkc/mem.h"
 #include "base/event_queue.h"
+#include "base/native_window.h"
 
 event_queue_t* event_queue_create(uint16_t capacity) {
   uint32_t size = 0;
@@ -84,6 +85,59 @@ ret_t event_queue_replace_last(event_queue_t* q, const event_queue_req_t* r) {
   return RET_OK;
 }
 
+static bool_t event_queue_req_same_pointer(const pointer_event_t* a, const pointer_event_t* b) {
+  return a->button == b->button && a->pressed == b->pressed && a->alt == b->alt &&
+         a->ctrl == b->ctrl && a->cmd == b->cmd && a->menu == b->menu && a->shift == b->shift &&
+         a->finger_id == b->finger_id;
+}
+
+ret_t event_queue_req_coalesce(event_queue_req_t* last, const event_queue_req_t* r) {
+  return_value_if_fail(last != NULL && r != NULL, RET_BAD_PARAMS);
+
+  if (last->event.type != r->event.type || last->event.target != r->event.target) {
+    return RET_FAIL;
+  }
+
+  switch (r->event.type) {
+    case EVT_POINTER_MOVE: {
+      if (!event_queue_req_same_pointer(&(last->pointer_event), &(r->pointer_event))) {
+        return RET_FAIL;
+      }
+      last->pointer_event = r->pointer_event;
+      break;
+    }
+    case EVT_TOUCH_MOVE: {
+      if (last->touch_event.touch_id != r->touch_event.touch_id ||
+          last->touch_event.finger_id != r->touch_event.finger_id) {
+        return RET_FAIL;
+      }
+      last->touch_event = r->touch_event;
+      break;
+    }
+    case EVT_WHEEL: {
+      int32_t dy = last->wheel_event.dy + r->wheel_event.dy;
+      if (last->wheel_event.alt != r->wheel_event.alt ||
+          last->wheel_event.ctrl != r->wheel_event.ctrl ||
+          last->wheel_event.shift != r->wheel_event.shift) {
+        return RET_FAIL;
+      }
+      last->wheel_event = r->wheel_event;
+      last->wheel_event.dy = dy;
+      break;
+    }
+    case EVT_RESIZE:
+    case EVT_NATIVE_WINDOW_RESIZED: {
+      memcpy(last, r, sizeof(*r));
+      break;
+    }
+    default: {
+      return RET_FAIL;
+    }
+  }
+
+  return RET_OK;
+}
+
 ret_t event_queue_destroy(event_queue_t* q) {
   return_value_if_fail(q != NULL, RET_BAD_PARAMS);
   TKMEM_FREE(q);
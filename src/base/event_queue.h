@@ -85,6 +85,8 @@ event_queue_t* event_queue_create(uint16_t capacity);
 ret_t event_queue_recv(event_queue_t* q, event_queue_req_t* r);
 ret_t event_queue_send(event_queue_t* q, const event_queue_req_t* r);
 ret_t event_queue_replace_last(event_queue_t* q, const event_queue_req_t* r);
+/*把r合并到last中(pointer/touch move、wheel和resize)，不能合并时返回RET_FAIL*/
+ret_t event_queue_req_coalesce(event_queue_req_t* last, const event_queue_req_t* r);
 ret_t event_queue_destroy(event_queue_t* q);
 
 END_C_DECLS
@@ -21,11 +21,17 @@
 
 #include "tkc/mem.h"
 #include "base/font.h"
+#include "base/tile_painter.h"
 
 ret_t font_get_glyph(font_t* f, wchar_t chr, font_size_t font_size, glyph_t* g) {
+  ret_t ret = RET_OK;
   return_value_if_fail(f != NULL && f->get_glyph != NULL && g != NULL, RET_BAD_PARAMS);
 
-  return f->get_glyph(f, chr, font_size, g);
+  tile_painter_lock();
+  ret = f->get_glyph(f, chr, font_size, g);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t font_shrink_cache(font_t* f, uint32_t cache_size) {
@@ -38,10 +44,24 @@ ret_t font_shrink_cache(font_t* f, uint32_t cache_size) {
   return RET_OK;
 }
 
+ret_t font_get_cache_stats(font_t* f, font_cache_stats_t* stats) {
+  return_value_if_fail(f != NULL && stats != NULL, RET_BAD_PARAMS);
+
+  if (f->get_cache_stats != NULL) {
+    return f->get_cache_stats(f, stats);
+  }
+
+  return RET_NOT_IMPL;
+}
+
 font_vmetrics_t font_get_vmetrics(font_t* f, font_size_t font_size) {
   font_vmetrics_t vmetrics = {font_size, 0, 0};
   if (f != NULL && f->get_vmetrics != NULL) {
-    return f->get_vmetrics(f, font_size);
+    tile_painter_lock();
+    vmetrics = f->get_vmetrics(f, font_size);
+    tile_painter_unlock();
+
+    return vmetrics;
   } else {
     return vmetrics;
   }
@@ -159,10 +159,49 @@ typedef struct _font_vmetrics_t {
   int16_t font_descender;
 } font_vmetrics_t;
 
+/**
+ * @class font_cache_stats_t
+ * 字模缓存的统计信息。
+ *
+ */
+typedef struct _font_cache_stats_t {
+  /**
+   * @property {uint32_t} size
+   * @annotation ["readable"]
+   * 当前缓存的字模个数。
+   */
+  uint32_t size;
+  /**
+   * @property {uint32_t} capacity
+   * @annotation ["readable"]
+   * 最多可缓存的字模个数。
+   */
+  uint32_t capacity;
+  /**
+   * @property {uint32_t} hits
+   * @annotation ["readable"]
+   * 命中次数。
+   */
+  uint32_t hits;
+  /**
+   * @property {uint32_t} misses
+   * @annotation ["readable"]
+   * 未命中次数。
+   */
+  uint32_t misses;
+  /**
+   * @property {uint32_t} evictions
+   * @annotation ["readable"]
+   * 因缓存已满而被淘汰的字模个数。
+   */
+  uint32_t evictions;
+} font_cache_stats_t;
+
 typedef font_vmetrics_t (*font_get_vmetrics_t)(font_t* f, font_size_t font_size);
 typedef bool_t (*font_match_t)(font_t* f, const char* name, font_size_t font_size);
 typedef ret_t (*font_get_glyph_t)(font_t* f, wchar_t chr, font_size_t font_size, glyph_t* g);
 typedef ret_t (*font_shrink_cache_t)(font_t* f, uint32_t cache_size);
+typedef ret_t (*font_get_cache_stats_t)(font_t* f, font_cache_stats_t* stats);
 
 typedef ret_t (*font_destroy_t)(font_t* f);
 
@@ -181,6 +220,7 @@ struct _font_t {
   const char* desc;
 
   font_manager_t* fm;
+  font_get_cache_stats_t get_cache_stats;
 };
 
 /**
@@ -229,6 +269,17 @@ ret_t font_get_glyph(font_t* font, wchar_t chr, font_size_t font_size, glyph_t*
  */
 ret_t font_shrink_cache(font_t* font, uint32_t cache_size);
 
+/**
+ * @method font_get_cache_stats
+ * 获取字模缓存的统计信息(累加到stats中)。
+ *
+ * @param {font_t*} font font对象。
+ * @param {font_cache_stats_t*} stats 用于返回统计信息。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t font_get_cache_stats(font_t* font, font_cache_stats_t* stats);
+
 /**
  * @method font_destroy
  * 销毁font对象。
@@ -24,6 +24,7 @@
 #include "base/events.h"
 #include "base/system_info.h"
 #include "base/font_manager.h"
+#include "base/tile_painter.h"
 
 static font_manager_t* s_font_manager = NULL;
 
@@ -184,6 +185,7 @@ font_t* font_manager_get_font(font_manager_t* fm, const char* name, font_size_t
   name = system_info_fix_font_name(name);
   return_value_if_fail(fm != NULL, NULL);
 
+  tile_painter_lock();
   font = font_manager_lookup(fm, name, size);
   if (font == NULL) {
     font = font_manager_load(fm, name, size);
@@ -193,6 +195,7 @@ font_t* font_manager_get_font(font_manager_t* fm, const char* name, font_size_t
       font = font_manager_get_font(fm, default_font, size);
     }
   }
+  tile_painter_unlock();
 
   return font;
 }
@@ -287,6 +290,20 @@ ret_t font_manager_shrink_cache(font_manager_t* fm, uint32_t cache_size) {
   return RET_OK;
 }
 
+ret_t font_manager_get_cache_stats(font_manager_t* fm, font_cache_stats_t* stats) {
+  uint32_t i = 0;
+  font_t* font = NULL;
+  return_value_if_fail(fm != NULL && stats != NULL, RET_BAD_PARAMS);
+
+  memset(stats, 0x00, sizeof(*stats));
+  for (i = 0; i < fm->fonts.size; i++) {
+    font = (font_t*)darray_get(&(fm->fonts), i);
+    font_get_cache_stats(font, stats);
+  }
+
+  return RET_OK;
+}
+
 ret_t font_manager_set_fallback_get_font(font_manager_t* fm,
                                          font_manager_get_font_t fallback_get_font, void* ctx) {
   return_value_if_fail(fm != NULL, RET_BAD_PARAMS);
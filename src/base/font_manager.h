@@ -206,6 +206,19 @@ ret_t font_manager_unload_font(font_manager_t* fm, const char* name, font_size_t
  */
 ret_t font_manager_shrink_cache(font_manager_t* fm, uint32_t cache_size);
 
+/**
+ * @method font_manager_get_cache_stats
+ * 获取全部字体的字模缓存统计信息(汇总)。
+ *
+ * > 可根据命中率和淘汰次数调整TK\_GLYPH\_CACHE\_NR。
+ *
+ * @param {font_manager_t*} fm 字体管理器对象。
+ * @param {font_cache_stats_t*} stats 用于返回统计信息。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t font_manager_get_cache_stats(font_manager_t* fm, font_cache_stats_t* stats);
+
 /**
  * @method font_manager_unload_all
  * 卸载全部字体。
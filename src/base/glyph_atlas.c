@@ -0,0 +1,270 @@
+﻿/**
+ * File:   glyph_atlas.c
+ * Author: AWTK Develop Team
+ * Brief:  glyph atlas
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "base/glyph_atlas.h"
+
+/*shelf的高度按4对齐，让高度相近的字模共用一个shelf*/
+#define GLYPH_ATLAS_SHELF_ALIGN 4
+
+#define SHELF_Y(shelves, i) shelves[(i)*3]
+#define SHELF_H(shelves, i) shelves[(i)*3 + 1]
+#define SHELF_X(shelves, i) shelves[(i)*3 + 2]
+
+typedef struct _glyph_atlas_listener_t {
+  glyph_atlas_on_evict_t on_evict;
+  void* ctx;
+} glyph_atlas_listener_t;
+
+static glyph_atlas_t* s_glyph_atlas = NULL;
+
+glyph_atlas_t* glyph_atlas(void) {
+  return s_glyph_atlas;
+}
+
+ret_t glyph_atlas_set(glyph_atlas_t* atlas) {
+  s_glyph_atlas = atlas;
+
+  return RET_OK;
+}
+
+static int glyph_atlas_listener_compare_by_ctx(const void* a, const void* b) {
+  const glyph_atlas_listener_t* listener = (const glyph_atlas_listener_t*)a;
+
+  return listener->ctx == b ? 0 : -1;
+}
+
+glyph_atlas_t* glyph_atlas_create(uint32_t page_w, uint32_t page_h, uint32_t max_pages) {
+  glyph_atlas_t* atlas = NULL;
+  return_value_if_fail(page_w > 0 && page_w <= 0xff, NULL);
+  return_value_if_fail(page_h > 0 && page_h <= 0xffff && max_pages > 0, NULL);
+
+  atlas = TKMEM_ZALLOC(glyph_atlas_t);
+  return_value_if_fail(atlas != NULL, NULL);
+
+  atlas->pages = TKMEM_ZALLOCN(glyph_atlas_page_t, max_pages);
+  if (atlas->pages == NULL) {
+    TKMEM_FREE(atlas);
+    return NULL;
+  }
+
+  atlas->page_w = page_w;
+  atlas->page_h = page_h;
+  atlas->max_pages = max_pages;
+  darray_init(&(atlas->listeners), 4, default_destroy, glyph_atlas_listener_compare_by_ctx);
+
+  return atlas;
+}
+
+ret_t glyph_atlas_on_evict(glyph_atlas_t* atlas, glyph_atlas_on_evict_t on_evict, void* ctx) {
+  glyph_atlas_listener_t* listener = NULL;
+  return_value_if_fail(atlas != NULL && on_evict != NULL, RET_BAD_PARAMS);
+
+  listener = TKMEM_ZALLOC(glyph_atlas_listener_t);
+  return_value_if_fail(listener != NULL, RET_OOM);
+
+  listener->on_evict = on_evict;
+  listener->ctx = ctx;
+
+  return darray_push(&(atlas->listeners), listener);
+}
+
+ret_t glyph_atlas_off_evict(glyph_atlas_t* atlas, void* ctx) {
+  return_value_if_fail(atlas != NULL, RET_BAD_PARAMS);
+
+  return darray_remove_all(&(atlas->listeners), NULL, ctx);
+}
+
+static glyph_atlas_page_t* glyph_atlas_add_page(glyph_atlas_t* atlas) {
+  uint32_t size = atlas->page_w * atlas->page_h;
+  glyph_atlas_page_t* page = atlas->pages + atlas->pages_nr;
+
+  page->data = TKMEM_ZALLOCN(uint8_t, size);
+  return_value_if_fail(page->data != NULL, NULL);
+
+  page->shelves = TKMEM_ZALLOCN(uint16_t, (atlas->page_h / GLYPH_ATLAS_SHELF_ALIGN) * 3);
+  if (page->shelves == NULL) {
+    TKMEM_FREE(page->data);
+    return NULL;
+  }
+
+  page->shelves_nr = 0;
+  atlas->pages_nr++;
+
+  return page;
+}
+
+static ret_t glyph_atlas_evict_page(glyph_atlas_t* atlas, glyph_atlas_page_t* page) {
+  uint32_t i = 0;
+  uint32_t size = atlas->page_w * atlas->page_h;
+
+  for (i = 0; i < atlas->listeners.size; i++) {
+    glyph_atlas_listener_t* iter = (glyph_atlas_listener_t*)darray_get(&(atlas->listeners), i);
+    iter->on_evict(iter->ctx, page->data, page->data + size);
+  }
+
+  memset(page->data, 0x00, size);
+  page->shelves_nr = 0;
+  page->generation++;
+  atlas->evictions++;
+
+  return RET_OK;
+}
+
+static bool_t glyph_atlas_page_alloc(glyph_atlas_t* atlas, glyph_atlas_page_t* page, glyph_t* g) {
+  uint32_t i = 0;
+  uint32_t best = 0xffff;
+  uint32_t next_y = 0;
+  uint32_t w = g->w;
+  uint32_t h = g->h;
+  uint16_t* shelves = page->shelves;
+
+  for (i = 0; i < page->shelves_nr; i++) {
+    if (SHELF_H(shelves, i) >= h && SHELF_X(shelves, i) + w <= atlas->page_w) {
+      if (best == 0xffff || SHELF_H(shelves, i) < SHELF_H(shelves, best)) {
+        best = i;
+      }
+    }
+  }
+
+  /*避免矮的字模占用太高的shelf，宁可新开一个shelf*/
+  if (best != 0xffff && SHELF_H(shelves, best) > h * 2 && page->shelves_nr > 0) {
+    uint32_t last = page->shelves_nr - 1;
+    uint32_t sh = TK_ROUND_TO(h, GLYPH_ATLAS_SHELF_ALIGN);
+    if (SHELF_Y(shelves, last) + SHELF_H(shelves, last) + sh <= atlas->page_h) {
+      best = 0xffff;
+    }
+  }
+
+  if (best == 0xffff) {
+    uint32_t sh = TK_ROUND_TO(h, GLYPH_ATLAS_SHELF_ALIGN);
+
+    if (page->shelves_nr > 0) {
+      uint32_t last = page->shelves_nr - 1;
+      next_y = SHELF_Y(shelves, last) + SHELF_H(shelves, last);
+    }
+
+    if (next_y + sh > atlas->page_h || page->shelves_nr >= atlas->page_h / GLYPH_ATLAS_SHELF_ALIGN) {
+      return FALSE;
+    }
+
+    best = page->shelves_nr++;
+    SHELF_Y(shelves, best) = next_y;
+    SHELF_H(shelves, best) = sh;
+    SHELF_X(shelves, best) = 0;
+  }
+
+  g->data = page->data + SHELF_Y(shelves, best) * atlas->page_w + SHELF_X(shelves, best);
+  g->pitch = atlas->page_w;
+  SHELF_X(shelves, best) += w;
+
+  page->generation++;
+  page->last_alloc_seq = ++atlas->alloc_seq;
+
+  return TRUE;
+}
+
+ret_t glyph_atlas_alloc(glyph_atlas_t* atlas, glyph_t* g) {
+  uint32_t i = 0;
+  glyph_atlas_page_t* page = NULL;
+  return_value_if_fail(atlas != NULL && g != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(g->w > 0 && g->h > 0, RET_BAD_PARAMS);
+
+  if (g->w > atlas->page_w || g->h > atlas->page_h) {
+    return RET_NOT_FOUND;
+  }
+
+  /*先在最近使用的页面中分配*/
+  for (i = atlas->pages_nr; i > 0; i--) {
+    if (glyph_atlas_page_alloc(atlas, atlas->pages + i - 1, g)) {
+      return RET_OK;
+    }
+  }
+
+  if (atlas->pages_nr < atlas->max_pages) {
+    page = glyph_atlas_add_page(atlas);
+  }
+
+  if (page == NULL) {
+    page = atlas->pages;
+    for (i = 1; i < atlas->pages_nr; i++) {
+      if (atlas->pages[i].last_alloc_seq < page->last_alloc_seq) {
+        page = atlas->pages + i;
+      }
+    }
+    return_value_if_fail(page->data != NULL, RET_OOM);
+
+    glyph_atlas_evict_page(atlas, page);
+  }
+
+  return glyph_atlas_page_alloc(atlas, page, g) ? RET_OK : RET_FAIL;
+}
+
+bool_t glyph_atlas_has(glyph_atlas_t* atlas, const uint8_t* data) {
+  uint32_t i = 0;
+  uint32_t size = 0;
+  return_value_if_fail(atlas != NULL, FALSE);
+
+  size = atlas->page_w * atlas->page_h;
+  for (i = 0; i < atlas->pages_nr; i++) {
+    const uint8_t* start = atlas->pages[i].data;
+    if (data >= start && data < start + size) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+const glyph_atlas_page_t* glyph_atlas_get_page(glyph_atlas_t* atlas, uint32_t index) {
+  return_value_if_fail(atlas != NULL && index < atlas->pages_nr, NULL);
+
+  return atlas->pages + index;
+}
+
+ret_t glyph_atlas_reset(glyph_atlas_t* atlas) {
+  uint32_t i = 0;
+  return_value_if_fail(atlas != NULL, RET_BAD_PARAMS);
+
+  for (i = 0; i < atlas->pages_nr; i++) {
+    glyph_atlas_evict_page(atlas, atlas->pages + i);
+  }
+
+  return RET_OK;
+}
+
+ret_t glyph_atlas_destroy(glyph_atlas_t* atlas) {
+  uint32_t i = 0;
+  return_value_if_fail(atlas != NULL, RET_BAD_PARAMS);
+
+  glyph_atlas_reset(atlas);
+  for (i = 0; i < atlas->pages_nr; i++) {
+    TKMEM_FREE(atlas->pages[i].data);
+    TKMEM_FREE(atlas->pages[i].shelves);
+  }
+
+  darray_deinit(&(atlas->listeners));
+  TKMEM_FREE(atlas->pages);
+  TKMEM_FREE(atlas);
+
+  return RET_OK;
+}
@@ -0,0 +1,208 @@
+﻿/**
+ * File:   glyph_atlas.h
+ * Author: AWTK Develop Team
+ * Brief:  glyph atlas
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_GLYPH_ATLAS_H
+#define TK_GLYPH_ATLAS_H
+
+#include "tkc/darray.h"
+#include "base/font.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class glyph_atlas_page_t
+ * 字模图集中的一页(A8格式)。
+ */
+typedef struct _glyph_atlas_page_t {
+  /**
+   * @property {uint8_t*} data
+   * @annotation ["readable"]
+   * 页面数据(每行glyph_atlas_t.page_w个字节)。
+   */
+  uint8_t* data;
+  /**
+   * @property {uint32_t} generation
+   * @annotation ["readable"]
+   * 页面内容的版本号，每次有新的字模写入或者页面被回收时递增(GPU可据此决定是否重新上传纹理)。
+   */
+  uint32_t generation;
+
+  /*private*/
+  uint64_t last_alloc_seq;
+  uint16_t shelves_nr;
+  uint16_t* shelves;
+} glyph_atlas_page_t;
+
+/**
+ * @class glyph_atlas_t
+ * 字模图集。
+ *
+ * 把光栅化后的A8字模打包到少数几个大的页面中(shelf算法)，以减少内存分配次数和内存碎片。
+ * 页面满了之后，以页为单位回收最早使用的页面，并通知使用者(一般是字体)删除引用该页面的字模。
+ *
+ * > 页面宽度不能超过255，因为glyph\_t的pitch只有8位。
+ */
+typedef struct _glyph_atlas_t {
+  /**
+   * @property {uint16_t} page_w
+   * @annotation ["readable"]
+   * 页面宽度。
+   */
+  uint16_t page_w;
+  /**
+   * @property {uint16_t} page_h
+   * @annotation ["readable"]
+   * 页面高度。
+   */
+  uint16_t page_h;
+  /**
+   * @property {uint32_t} max_pages
+   * @annotation ["readable"]
+   * 最大页数。
+   */
+  uint32_t max_pages;
+  /**
+   * @property {uint32_t} pages_nr
+   * @annotation ["readable"]
+   * 当前页数。
+   */
+  uint32_t pages_nr;
+  /**
+   * @property {uint32_t} evictions
+   * @annotation ["readable"]
+   * 页面被回收的次数。
+   */
+  uint32_t evictions;
+
+  /*private*/
+  glyph_atlas_page_t* pages;
+  uint64_t alloc_seq;
+  darray_t listeners;
+} glyph_atlas_t;
+
+/*页面回收的回调函数，[start, end)为被回收页面的地址范围。*/
+typedef ret_t (*glyph_atlas_on_evict_t)(void* ctx, const uint8_t* start, const uint8_t* end);
+
+/**
+ * @method glyph_atlas
+ * 获取缺省的字模图集(没有启用图集时返回NULL)。
+ * @annotation ["constructor"]
+ *
+ * @return {glyph_atlas_t*} 返回字模图集对象。
+ */
+glyph_atlas_t* glyph_atlas(void);
+
+/**
+ * @method glyph_atlas_set
+ * 设置缺省的字模图集。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_atlas_set(glyph_atlas_t* atlas);
+
+/**
+ * @method glyph_atlas_create
+ * 创建字模图集。
+ * @annotation ["constructor"]
+ * @param {uint32_t} page_w 页面宽度(不超过255)。
+ * @param {uint32_t} page_h 页面高度。
+ * @param {uint32_t} max_pages 最大页数。
+ *
+ * @return {glyph_atlas_t*} 返回字模图集对象。
+ */
+glyph_atlas_t* glyph_atlas_create(uint32_t page_w, uint32_t page_h, uint32_t max_pages);
+
+/**
+ * @method glyph_atlas_on_evict
+ * 注册页面回收的回调函数。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ * @param {glyph_atlas_on_evict_t} on_evict 回调函数。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_atlas_on_evict(glyph_atlas_t* atlas, glyph_atlas_on_evict_t on_evict, void* ctx);
+
+/**
+ * @method glyph_atlas_off_evict
+ * 注销页面回收的回调函数。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_atlas_off_evict(glyph_atlas_t* atlas, void* ctx);
+
+/**
+ * @method glyph_atlas_alloc
+ * 为A8格式的字模分配空间。
+ *
+ * > 成功后g->data指向页面中的位置，g->pitch为页面宽度，数据已清零。
+ *
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ * @param {glyph_t*} g 字模对象(w和h必须有效)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败(比如字模比页面还大)。
+ */
+ret_t glyph_atlas_alloc(glyph_atlas_t* atlas, glyph_t* g);
+
+/**
+ * @method glyph_atlas_has
+ * 检查数据是否在图集中。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ * @param {const uint8_t*} data 数据。
+ *
+ * @return {bool_t} 返回TRUE表示在图集中，否则不在。
+ */
+bool_t glyph_atlas_has(glyph_atlas_t* atlas, const uint8_t* data);
+
+/**
+ * @method glyph_atlas_get_page
+ * 获取指定的页面(供GPU上传纹理使用)。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ * @param {uint32_t} index 页面的序数。
+ *
+ * @return {const glyph_atlas_page_t*} 返回页面对象。
+ */
+const glyph_atlas_page_t* glyph_atlas_get_page(glyph_atlas_t* atlas, uint32_t index);
+
+/**
+ * @method glyph_atlas_reset
+ * 回收全部页面。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_atlas_reset(glyph_atlas_t* atlas);
+
+/**
+ * @method glyph_atlas_destroy
+ * 销毁字模图集。
+ * @param {glyph_atlas_t*} atlas 字模图集对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_atlas_destroy(glyph_atlas_t* atlas);
+
+END_C_DECLS
+
+#endif /*TK_GLYPH_ATLAS_H*/
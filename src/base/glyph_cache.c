@@ -19,93 +19,264 @@
  *
  */
 
-#define GLYPH_CACHE_FREE_ITEM(cache, item)            \
-  {                                                   \
-    if (cache->destroy_glyph && item->g != NULL) {    \
-      cache->destroy_glyph(item->g);                  \
-      memset(item, 0x00, sizeof(glyph_cache_item_t)); \
-    }                                                 \
+#define GLYPH_CACHE_FREE_ITEM(cache, item)         \
+  {                                                \
+    if (cache->destroy_glyph && item->g != NULL) { \
+      cache->destroy_glyph(item->g);               \
+    }                                              \
+    item->g = NULL;                                \
+    item->code = 0;                                \
+    item->size = 0;                                \
+    item->last_access_time = 0;                    \
   }
 
 #include "tkc/mem.h"
-#include "tkc/time_now.h"
+#include "tkc/utils.h"
 #include "base/glyph_cache.h"
 
+static inline uint32_t glyph_cache_hash(wchar_t code, font_size_t size) {
+  uint32_t h = ((uint32_t)code) * 2654435761u;
+
+  return h ^ (((uint32_t)size) * 40503u);
+}
+
+static uint32_t glyph_cache_buckets_nr(uint32_t capacity) {
+  uint32_t nr = 8;
+
+  /*负载因子不超过0.5*/
+  while (nr < capacity * 2) {
+    nr <<= 1;
+  }
+
+  return nr;
+}
+
 glyph_cache_t* glyph_cache_init(glyph_cache_t* cache, uint32_t capacity,
                                 tk_destroy_t destroy_glyph) {
+  uint32_t buckets_nr = 0;
   return_value_if_fail(cache != NULL && capacity > 0, NULL);
 
+  memset(cache, 0x00, sizeof(glyph_cache_t));
+  buckets_nr = glyph_cache_buckets_nr(capacity);
+
   cache->items = TKMEM_ZALLOCN(glyph_cache_item_t, capacity);
   return_value_if_fail(cache->items != NULL, NULL);
 
+  cache->buckets = TKMEM_ZALLOCN(uint32_t, buckets_nr);
+  if (cache->buckets == NULL) {
+    TKMEM_FREE(cache->items);
+    return NULL;
+  }
+
   cache->size = 0;
   cache->capacity = capacity;
   cache->destroy_glyph = destroy_glyph;
+  cache->buckets_mask = buckets_nr - 1;
+  cache->lru_head = GLYPH_CACHE_NIL;
+  cache->lru_tail = GLYPH_CACHE_NIL;
 
   return cache;
 }
 
-static glyph_cache_item_t* glyph_cache_get_empty(glyph_cache_t* cache) {
+static void glyph_cache_lru_unlink(glyph_cache_t* cache, uint32_t index) {
+  glyph_cache_item_t* item = cache->items + index;
+
+  if (item->prev != GLYPH_CACHE_NIL) {
+    cache->items[item->prev].next = item->next;
+  } else {
+    cache->lru_head = item->next;
+  }
+
+  if (item->next != GLYPH_CACHE_NIL) {
+    cache->items[item->next].prev = item->prev;
+  } else {
+    cache->lru_tail = item->prev;
+  }
+
+  item->prev = GLYPH_CACHE_NIL;
+  item->next = GLYPH_CACHE_NIL;
+}
+
+static void glyph_cache_lru_push_front(glyph_cache_t* cache, uint32_t index) {
+  glyph_cache_item_t* item = cache->items + index;
+
+  item->prev = GLYPH_CACHE_NIL;
+  item->next = cache->lru_head;
+  if (cache->lru_head != GLYPH_CACHE_NIL) {
+    cache->items[cache->lru_head].prev = index;
+  } else {
+    cache->lru_tail = index;
+  }
+  cache->lru_head = index;
+}
+
+static void glyph_cache_lru_touch(glyph_cache_t* cache, uint32_t index) {
+  if (cache->lru_head != index) {
+    glyph_cache_lru_unlink(cache, index);
+    glyph_cache_lru_push_front(cache, index);
+  }
+
+  cache->items[index].last_access_time = ++cache->access_seq;
+}
+
+static void glyph_cache_hash_insert(glyph_cache_t* cache, uint32_t index) {
+  glyph_cache_item_t* item = cache->items + index;
+  uint32_t mask = cache->buckets_mask;
+  uint32_t i = glyph_cache_hash(item->code, item->size) & mask;
+
+  while (cache->buckets[i] != 0) {
+    i = (i + 1) & mask;
+  }
+
+  cache->buckets[i] = index + 1;
+}
+
+static uint32_t glyph_cache_hash_find(glyph_cache_t* cache, wchar_t code, font_size_t size) {
+  uint32_t mask = cache->buckets_mask;
+  uint32_t i = glyph_cache_hash(code, size) & mask;
+
+  while (cache->buckets[i] != 0) {
+    glyph_cache_item_t* item = cache->items + cache->buckets[i] - 1;
+    if (item->code == code && item->size == size) {
+      return i;
+    }
+    i = (i + 1) & mask;
+  }
+
+  return GLYPH_CACHE_NIL;
+}
+
+static void glyph_cache_hash_remove(glyph_cache_t* cache, uint32_t index) {
+  uint32_t mask = cache->buckets_mask;
+  glyph_cache_item_t* item = cache->items + index;
+  uint32_t i = glyph_cache_hash(item->code, item->size) & mask;
+  uint32_t j = 0;
+
+  while (cache->buckets[i] != 0 && cache->buckets[i] != index + 1) {
+    i = (i + 1) & mask;
+  }
+  return_if_fail(cache->buckets[i] != 0);
+
+  /*线性探测的删除：把后面的元素往前移，避免使用墓碑标记。*/
+  cache->buckets[i] = 0;
+  for (j = (i + 1) & mask; cache->buckets[j] != 0; j = (j + 1) & mask) {
+    glyph_cache_item_t* iter = cache->items + cache->buckets[j] - 1;
+    uint32_t home = glyph_cache_hash(iter->code, iter->size) & mask;
+
+    if (((j - home) & mask) >= ((j - i) & mask)) {
+      cache->buckets[i] = cache->buckets[j];
+      cache->buckets[j] = 0;
+      i = j;
+    }
+  }
+}
+
+static void glyph_cache_rebuild_index(glyph_cache_t* cache) {
   uint32_t i = 0;
-  uint32_t nr = 0;
-  uint32_t oldest = 0;
+
+  memset(cache->buckets, 0x00, sizeof(uint32_t) * (cache->buckets_mask + 1));
+  cache->lru_head = GLYPH_CACHE_NIL;
+  cache->lru_tail = GLYPH_CACHE_NIL;
+
+  /*items已经按访问时间从新到旧排列*/
+  for (i = cache->size; i > 0; i--) {
+    glyph_cache_hash_insert(cache, i - 1);
+    glyph_cache_lru_push_front(cache, i - 1);
+  }
+}
+
+static glyph_cache_item_t* glyph_cache_get_empty(glyph_cache_t* cache) {
+  uint32_t index = 0;
   glyph_cache_item_t* item = NULL;
-  uint64_t oldest_time = 0xffffffffffffffff;
 
   return_value_if_fail(cache != NULL && cache->items != NULL, NULL);
 
   if (cache->size < cache->capacity) {
-    oldest = cache->size++;
-    return cache->items + oldest;
+    index = cache->size++;
+    item = cache->items + index;
+  } else {
+    index = cache->lru_tail;
+    return_value_if_fail(index != GLYPH_CACHE_NIL, NULL);
+
+    item = cache->items + index;
+    glyph_cache_hash_remove(cache, index);
+    glyph_cache_lru_unlink(cache, index);
+    GLYPH_CACHE_FREE_ITEM(cache, item);
+    cache->evictions++;
   }
 
-  for (i = 0, nr = cache->size; i < nr; i++) {
-    glyph_cache_item_t* item = cache->items + i;
-    if (item->last_access_time < oldest_time) {
-      oldest_time = item->last_access_time;
-      oldest = i;
-      if (oldest_time == 0) {
-        break;
-      }
-    }
-  }
-
-  item = cache->items + oldest;
-  GLYPH_CACHE_FREE_ITEM(cache, item);
+  glyph_cache_lru_push_front(cache, index);
 
   return item;
 }
 
 ret_t glyph_cache_add(glyph_cache_t* cache, wchar_t code, font_size_t size, glyph_t* g) {
-  glyph_cache_item_t* item = glyph_cache_get_empty(cache);
-  return_value_if_fail(cache != NULL && g != NULL && item != NULL, RET_BAD_PARAMS);
+  glyph_cache_item_t* item = NULL;
+  return_value_if_fail(cache != NULL && g != NULL, RET_BAD_PARAMS);
+
+  item = glyph_cache_get_empty(cache);
+  return_value_if_fail(item != NULL, RET_BAD_PARAMS);
 
   item->g = g;
   item->size = size;
   item->code = code;
-  item->last_access_time = time_now_ms();
+  item->last_access_time = ++cache->access_seq;
+  glyph_cache_hash_insert(cache, item - cache->items);
 
   return RET_OK;
 }
 
 ret_t glyph_cache_lookup(glyph_cache_t* cache, wchar_t code, font_size_t size, glyph_t* g) {
-  uint32_t i = 0;
-  uint32_t nr = 0;
+  uint32_t bucket = 0;
 
-  return_value_if_fail(cache != NULL && g != NULL, RET_BAD_PARAMS);
-  for (i = 0, nr = cache->size; i < nr; i++) {
-    glyph_cache_item_t* item = cache->items + i;
-    if (item->code == code && item->size == size) {
-      *g = *(item->g);
-      item->last_access_time = time_now_ms();
+  return_value_if_fail(cache != NULL && cache->buckets != NULL && g != NULL, RET_BAD_PARAMS);
 
-      return RET_OK;
-    }
+  bucket = glyph_cache_hash_find(cache, code, size);
+  if (bucket != GLYPH_CACHE_NIL) {
+    uint32_t index = cache->buckets[bucket] - 1;
+
+    *g = *(cache->items[index].g);
+    glyph_cache_lru_touch(cache, index);
+    cache->hits++;
+
+    return RET_OK;
   }
 
+  cache->misses++;
+
   return RET_NOT_FOUND;
 }
 
+typedef struct _glyph_data_range_t {
+  const uint8_t* start;
+  const uint8_t* end;
+} glyph_data_range_t;
+
+static bool_t glyph_cache_glyph_in_range(void* ctx, const void* data) {
+  const glyph_t* g = (const glyph_t*)data;
+  const glyph_data_range_t* range = (const glyph_data_range_t*)ctx;
+
+  return g->data >= range->start && g->data < range->end;
+}
+
+ret_t glyph_cache_remove_by_range(glyph_cache_t* cache, const uint8_t* start, const uint8_t* end) {
+  glyph_data_range_t range = {start, end};
+
+  return glyph_cache_remove_if(cache, glyph_cache_glyph_in_range, &range);
+}
+
+ret_t glyph_cache_get_stats(glyph_cache_t* cache, font_cache_stats_t* stats) {
+  return_value_if_fail(cache != NULL && stats != NULL, RET_BAD_PARAMS);
+
+  stats->size += cache->size;
+  stats->capacity += cache->capacity;
+  stats->hits += cache->hits;
+  stats->misses += cache->misses;
+  stats->evictions += cache->evictions;
+
+  return RET_OK;
+}
+
 ret_t glyph_cache_deinit(glyph_cache_t* cache) {
   uint32_t i = 0;
   uint32_t nr = 0;
@@ -121,6 +292,7 @@ ret_t glyph_cache_deinit(glyph_cache_t* cache) {
   }
 
   TKMEM_FREE(cache->items);
+  TKMEM_FREE(cache->buckets);
   memset(cache, 0x00, sizeof(glyph_cache_t));
 
   return RET_OK;
@@ -130,7 +302,11 @@ static int glyph_cache_item_compare_by_time(const void* a, const void* b) {
   glyph_cache_item_t* aa = (glyph_cache_item_t*)a;
   glyph_cache_item_t* bb = (glyph_cache_item_t*)b;
 
-  return bb->last_access_time - aa->last_access_time;
+  if (bb->last_access_time == aa->last_access_time) {
+    return 0;
+  }
+
+  return bb->last_access_time > aa->last_access_time ? 1 : -1;
 }
 
 ret_t glyph_cache_shrink(glyph_cache_t* cache, uint32_t cache_size) {
@@ -146,6 +322,34 @@ ret_t glyph_cache_shrink(glyph_cache_t* cache, uint32_t cache_size) {
     }
 
     cache->size = cache_size;
+    glyph_cache_rebuild_index(cache);
+  }
+
+  return RET_OK;
+}
+
+ret_t glyph_cache_remove_if(glyph_cache_t* cache, tk_filter_t filter, void* ctx) {
+  uint32_t i = 0;
+  uint32_t k = 0;
+  return_value_if_fail(cache != NULL && cache->items != NULL && filter != NULL, RET_BAD_PARAMS);
+
+  for (i = 0; i < cache->size; i++) {
+    glyph_cache_item_t* item = cache->items + i;
+
+    if (item->g != NULL && filter(ctx, item->g)) {
+      GLYPH_CACHE_FREE_ITEM(cache, item);
+    } else {
+      if (k != i) {
+        cache->items[k] = *item;
+      }
+      k++;
+    }
+  }
+
+  if (k != cache->size) {
+    cache->size = k;
+    qsort(cache->items, cache->size, sizeof(glyph_cache_item_t), glyph_cache_item_compare_by_time);
+    glyph_cache_rebuild_index(cache);
   }
 
   return RET_OK;
@@ -27,21 +27,45 @@
 BEGIN_C_DECLS
 
 typedef struct _glyph_cache_item_t {
+  /*访问序号(单调递增)，值越大表示越近被访问。*/
   uint64_t last_access_time;
   font_size_t size;
   wchar_t code;
   glyph_t* g;
+
+  /*LRU双向链表(item的下标，GLYPH_CACHE_NIL表示无)。*/
+  uint32_t prev;
+  uint32_t next;
 } glyph_cache_item_t;
 
+#define GLYPH_CACHE_NIL 0xffffffff
+
 /**
  * @class glyph_cache_t
  * glyph cache
+ *
+ * 用开放寻址的哈希表(以code和size为key)查找glyph，用LRU链表淘汰最久没用的glyph。
+ * 查找、增加和淘汰的复杂度都是O(1)。
  */
 typedef struct _glyph_cache_t {
   uint32_t size;
   uint32_t capacity;
   glyph_cache_item_t* items;
   tk_destroy_t destroy_glyph;
+
+  /*哈希表，保存item的下标+1，0表示空位。*/
+  uint32_t* buckets;
+  uint32_t buckets_mask;
+
+  /*LRU链表，head为最近访问的，tail为最久没访问的。*/
+  uint32_t lru_head;
+  uint32_t lru_tail;
+  uint64_t access_seq;
+
+  /*统计信息。*/
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
 } glyph_cache_t;
 
 /**
@@ -93,6 +117,41 @@ ret_t glyph_cache_lookup(glyph_cache_t* cache, wchar_t code, font_size_t size, g
  */
 ret_t glyph_cache_shrink(glyph_cache_t* cache, uint32_t cache_size);
 
+/**
+ * @method glyph_cache_remove_if
+ * 删除满足条件的glyph。
+ * 
+ * @param {glyph_cache_t*} cache cache对象。
+ * @param {tk_filter_t} filter 过滤函数(参数data为glyph_t*，返回TRUE表示删除)。
+ * @param {void*} ctx 过滤函数的上下文。
+ * 
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_cache_remove_if(glyph_cache_t* cache, tk_filter_t filter, void* ctx);
+
+/**
+ * @method glyph_cache_remove_by_range
+ * 删除数据在[start, end)范围内的glyph(用于字模图集回收页面)。
+ * 
+ * @param {glyph_cache_t*} cache cache对象。
+ * @param {const uint8_t*} start 起始地址。
+ * @param {const uint8_t*} end 结束地址(不包含)。
+ * 
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_cache_remove_by_range(glyph_cache_t* cache, const uint8_t* start, const uint8_t* end);
+
+/**
+ * @method glyph_cache_get_stats
+ * 获取cache的统计信息(累加到stats中)。
+ * 
+ * @param {glyph_cache_t*} cache cache对象。
+ * @param {font_cache_stats_t*} stats 用于返回统计信息。
+ * 
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t glyph_cache_get_stats(glyph_cache_t* cache, font_cache_stats_t* stats);
+
 /**
  * @method glyph_cache_deinit
  * 释放全部cache。
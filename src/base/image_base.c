@@ -87,33 +87,45 @@ ret_t image_base_get_prop(widget_t* widget, const char* name, value_t* v) {
   image_base_t* image = IMAGE_BASE(widget);
   return_value_if_fail(image != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_IMAGE)) {
-    value_set_str(v, image->image);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SCALE_X)) {
-    value_set_float(v, image->scale_x);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SCALE_Y)) {
-    value_set_float(v, image->scale_y);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ANCHOR_X)) {
-    value_set_float(v, image->anchor_x);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ANCHOR_Y)) {
-    value_set_float(v, image->anchor_y);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ROTATION)) {
-    value_set_float(v, image->rotation);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SELECTABLE)) {
-    value_set_bool(v, image->selectable);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SELECTED)) {
-    value_set_bool(v, image->selected);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CLICKABLE)) {
-    value_set_bool(v, image->clickable);
-    return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_IMAGE: {
+      value_set_str(v, image->image);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SCALE_X: {
+      value_set_float(v, image->scale_x);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SCALE_Y: {
+      value_set_float(v, image->scale_y);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ANCHOR_X: {
+      value_set_float(v, image->anchor_x);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ANCHOR_Y: {
+      value_set_float(v, image->anchor_y);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ROTATION: {
+      value_set_float(v, image->rotation);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SELECTABLE: {
+      value_set_bool(v, image->selectable);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SELECTED: {
+      value_set_bool(v, image->selected);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_CLICKABLE: {
+      value_set_bool(v, image->clickable);
+      return RET_OK;
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -123,31 +135,43 @@ ret_t image_base_set_prop(widget_t* widget, const char* name, const value_t* v)
   image_base_t* image = IMAGE_BASE(widget);
   return_value_if_fail(image != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_IMAGE)) {
-    return image_base_set_image(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_SCALE_X)) {
-    image->scale_x = value_float(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SCALE_Y)) {
-    image->scale_y = value_float(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ANCHOR_X)) {
-    image->anchor_x = value_float(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ANCHOR_Y)) {
-    image->anchor_y = value_float(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ROTATION)) {
-    image->rotation = value_float(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SELECTABLE)) {
-    image->selectable = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SELECTED)) {
-    return image_base_set_selected(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_CLICKABLE)) {
-    image->clickable = value_bool(v);
-    return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_IMAGE: {
+      return image_base_set_image(widget, value_str(v));
+    }
+    case WIDGET_PROP_ATOM_SCALE_X: {
+      image->scale_x = value_float(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SCALE_Y: {
+      image->scale_y = value_float(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ANCHOR_X: {
+      image->anchor_x = value_float(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ANCHOR_Y: {
+      image->anchor_y = value_float(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ROTATION: {
+      image->rotation = value_float(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SELECTABLE: {
+      image->selectable = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SELECTED: {
+      return image_base_set_selected(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_CLICKABLE: {
+      image->clickable = value_bool(v);
+      return RET_OK;
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -180,6 +204,7 @@ ret_t image_base_set_image(widget_t* widget, const char* name) {
   return_value_if_fail(image != NULL, RET_BAD_PARAMS);
 
   if (!tk_str_eq(image->image, name)) {
+    widget_cancel_load_image_async(widget);
     image->image = tk_str_copy(image->image, name);
     return widget_invalidate(widget, NULL);
   }
@@ -0,0 +1,657 @@
+﻿/**
+ * File:   image_disk_cache.c
+ * Author: AWTK Develop Team
+ * Brief:  on-disk cache of decoded images
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/fs.h"
+#include "tkc/crc.h"
+#include "tkc/mem.h"
+#include "tkc/path.h"
+#include "tkc/utils.h"
+#include "tkc/buffer.h"
+#include "base/system_info.h"
+#include "base/image_disk_cache.h"
+
+#ifdef WITH_IMAGE_DISK_CACHE
+
+#define IMAGE_DISK_CACHE_EXT ".tkbm"
+#define IMAGE_DISK_CACHE_INDEX "index"
+#define IMAGE_DISK_CACHE_HEADER_SIZE 64
+#define IMAGE_DISK_CACHE_MMAP_MIN_SIZE 4 * 1024
+/*变体和名称的哈希(8)-源数据crc32和长度(16)-配置(8).tkbm*/
+#define IMAGE_DISK_CACHE_KEY_LEN 39
+#define IMAGE_DISK_CACHE_NAME_PREFIX_LEN 9
+
+/*文件头(小端)，后面紧跟像素数据*/
+typedef struct _image_disk_cache_header_t {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t name_hash;
+  uint32_t crc;
+  uint32_t src_size;
+  uint32_t profile;
+  uint32_t w;
+  uint32_t h;
+  uint32_t line_length;
+  uint32_t flags;
+  uint32_t format;
+  uint32_t orientation;
+  uint32_t physical_w;
+  uint32_t physical_h;
+  uint32_t physical_line_length;
+  uint32_t data_size;
+} image_disk_cache_header_t;
+
+typedef struct _image_disk_cache_entry_t {
+  char key[IMAGE_DISK_CACHE_KEY_LEN + 1];
+  uint32_t size;
+  /*最后一次使用时的计数器，越大越新*/
+  uint32_t access;
+} image_disk_cache_entry_t;
+
+static uint32_t image_disk_cache_hash_str(uint32_t hash, const char* str) {
+  while (*str) {
+    hash ^= (uint8_t)(*str++);
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+/*不同主题或屏幕密度下的同名图片是不同的图片，旧缓存的淘汰只在同一变体内进行*/
+static uint32_t image_disk_cache_hash_name(const char* variant, const char* name) {
+  uint32_t hash = 2166136261u;
+
+  if (variant != NULL) {
+    hash = image_disk_cache_hash_str(hash, variant);
+    hash = image_disk_cache_hash_str(hash, "/");
+  }
+
+  return image_disk_cache_hash_str(hash, name);
+}
+
+/*影响解码结果(像素格式、预乘和旋转)的配置，与image_loader_stb保持一致*/
+static uint32_t image_disk_cache_get_profile(void) {
+  uint32_t profile = 0;
+  system_info_t* info = system_info();
+
+#ifdef WITH_BITMAP_BGR565
+  profile |= 0x01;
+#elif defined(WITH_BITMAP_RGB565)
+  profile |= 0x02;
+#elif defined(WITH_BITMAP_BGR888)
+  profile |= 0x04;
+#elif defined(WITH_BITMAP_RGB888)
+  profile |= 0x08;
+#endif /*WITH_BITMAP_BGR565*/
+#ifdef WITH_BITMAP_BGRA
+  profile |= 0x10;
+#endif /*WITH_BITMAP_BGRA*/
+#ifdef WITH_LCD_MONO
+  profile |= 0x20;
+#endif /*WITH_LCD_MONO*/
+#ifdef WITH_BITMAP_PREMULTI_ALPHA
+  profile |= 0x40;
+#endif /*WITH_BITMAP_PREMULTI_ALPHA*/
+
+  if (info != NULL) {
+    profile |= ((uint32_t)(info->lcd_orientation) & 0xffff) << 8;
+    if (info->flags & SYSTEM_INFO_FLAG_FAST_LCD_PORTRAIT) {
+      profile |= 0x01000000;
+    }
+  }
+
+  return profile;
+}
+
+static ret_t image_disk_cache_init_header(image_disk_cache_header_t* header,
+                                          const asset_info_t* res, const char* variant) {
+  memset(header, 0x00, sizeof(*header));
+  header->magic = IMAGE_DISK_CACHE_MAGIC;
+  header->version = IMAGE_DISK_CACHE_VERSION;
+  header->name_hash = image_disk_cache_hash_name(variant, asset_info_get_name(res));
+  header->crc = tk_crc32(PPPINITFCS32, res->data, res->size);
+  header->src_size = res->size;
+  header->profile = image_disk_cache_get_profile();
+
+  return RET_OK;
+}
+
+static ret_t image_disk_cache_build_key(const image_disk_cache_header_t* header,
+                                        char key[IMAGE_DISK_CACHE_KEY_LEN + 1]) {
+  tk_snprintf(key, IMAGE_DISK_CACHE_KEY_LEN + 1, "%08x-%08x%08x-%08x" IMAGE_DISK_CACHE_EXT,
+              header->name_hash, header->crc, header->src_size, header->profile);
+
+  return RET_OK;
+}
+
+static bool_t image_disk_cache_is_cacheable(const asset_info_t* res) {
+  return res != NULL && res->size > 0 && res->subtype != ASSET_TYPE_IMAGE_GIF &&
+         res->subtype != ASSET_TYPE_IMAGE_RAW && res->subtype != ASSET_TYPE_IMAGE_BSVG;
+}
+
+static int32_t image_disk_cache_find_index(image_disk_cache_t* cache, const char* key) {
+  uint32_t i = 0;
+
+  for (i = 0; i < cache->entries.size; i++) {
+    image_disk_cache_entry_t* iter = (image_disk_cache_entry_t*)darray_get(&(cache->entries), i);
+    if (tk_str_eq(iter->key, key)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/*调用者需要持有cache->mutex*/
+static ret_t image_disk_cache_remove_index(image_disk_cache_t* cache, uint32_t index) {
+  char path[MAX_PATH + 1];
+  image_disk_cache_entry_t* entry =
+      (image_disk_cache_entry_t*)darray_get(&(cache->entries), index);
+
+  path_build(path, MAX_PATH, cache->dir, entry->key, NULL);
+  fs_remove_file(os_fs(), path);
+  cache->size -= entry->size;
+  cache->dirty = TRUE;
+
+  return darray_remove_index(&(cache->entries), index);
+}
+
+/*删除同一图片(同名且同一变体)在相同配置下的旧缓存(源数据已经变化)。调用者需要持有cache->mutex*/
+static ret_t image_disk_cache_remove_stale(image_disk_cache_t* cache, const char* key) {
+  uint32_t i = 0;
+  const char* profile = key + IMAGE_DISK_CACHE_NAME_PREFIX_LEN + 17;
+
+  for (i = 0; i < cache->entries.size;) {
+    image_disk_cache_entry_t* iter = (image_disk_cache_entry_t*)darray_get(&(cache->entries), i);
+    if (strncmp(iter->key, key, IMAGE_DISK_CACHE_NAME_PREFIX_LEN) == 0 &&
+        tk_str_eq(iter->key + IMAGE_DISK_CACHE_NAME_PREFIX_LEN + 17, profile) &&
+        !tk_str_eq(iter->key, key)) {
+      image_disk_cache_remove_index(cache, i);
+    } else {
+      i++;
+    }
+  }
+
+  return RET_OK;
+}
+
+/*淘汰最久没有使用的文件，直到可以再放入size字节。调用者需要持有cache->mutex*/
+static ret_t image_disk_cache_evict(image_disk_cache_t* cache, uint32_t size) {
+  while (cache->entries.size > 0 && cache->size + size > cache->max_size) {
+    uint32_t i = 0;
+    uint32_t oldest = 0;
+    image_disk_cache_entry_t* entry = NULL;
+
+    for (i = 1; i < cache->entries.size; i++) {
+      image_disk_cache_entry_t* iter = (image_disk_cache_entry_t*)darray_get(&(cache->entries), i);
+      entry = (image_disk_cache_entry_t*)darray_get(&(cache->entries), oldest);
+      if (iter->access < entry->access) {
+        oldest = i;
+      }
+    }
+
+    image_disk_cache_remove_index(cache, oldest);
+  }
+
+  return RET_OK;
+}
+
+static ret_t image_disk_cache_add_entry(image_disk_cache_t* cache, const char* key, uint32_t size,
+                                        uint32_t access) {
+  image_disk_cache_entry_t* entry = TKMEM_ZALLOC(image_disk_cache_entry_t);
+  return_value_if_fail(entry != NULL, RET_OOM);
+
+  tk_strncpy(entry->key, key, IMAGE_DISK_CACHE_KEY_LEN);
+  entry->size = size;
+  entry->access = access;
+  if (darray_push(&(cache->entries), entry) != RET_OK) {
+    TKMEM_FREE(entry);
+    return RET_OOM;
+  }
+  cache->size += size;
+
+  return RET_OK;
+}
+
+static ret_t image_disk_cache_scan(image_disk_cache_t* cache) {
+  fs_item_t item;
+  char path[MAX_PATH + 1];
+  fs_dir_t* dir = fs_open_dir(os_fs(), cache->dir);
+  return_value_if_fail(dir != NULL, RET_FAIL);
+
+  while (fs_dir_read(dir, &item) == RET_OK) {
+    if (!item.is_reg_file) {
+      continue;
+    }
+
+    path_build(path, MAX_PATH, cache->dir, item.name, NULL);
+    if (strlen(item.name) == IMAGE_DISK_CACHE_KEY_LEN &&
+        tk_str_end_with(item.name, IMAGE_DISK_CACHE_EXT)) {
+      int32_t size = file_get_size(path);
+      if (size > 0) {
+        image_disk_cache_add_entry(cache, item.name, size, 0);
+      }
+    } else if (tk_str_end_with(item.name, ".tmp")) {
+      /*上次保存时中断留下的临时文件*/
+      fs_remove_file(os_fs(), path);
+    }
+  }
+  fs_dir_close(dir);
+
+  return RET_OK;
+}
+
+/*index文件每行为：文件名 使用顺序*/
+static ret_t image_disk_cache_load_index(image_disk_cache_t* cache) {
+  char* p = NULL;
+  char* data = NULL;
+  uint32_t size = 0;
+  char path[MAX_PATH + 1];
+
+  path_build(path, MAX_PATH, cache->dir, IMAGE_DISK_CACHE_INDEX, NULL);
+  data = (char*)file_read(path, &size);
+  if (data == NULL) {
+    return RET_NOT_FOUND;
+  }
+
+  p = data;
+  while (p != NULL && *p) {
+    char* next = strchr(p, '\n');
+    char* space = strchr(p, ' ');
+
+    if (next != NULL) {
+      *next++ = '\0';
+    }
+
+    if (space != NULL) {
+      int32_t index = 0;
+      *space = '\0';
+      index = image_disk_cache_find_index(cache, p);
+      if (index >= 0) {
+        image_disk_cache_entry_t* entry =
+            (image_disk_cache_entry_t*)darray_get(&(cache->entries), index);
+        entry->access = (uint32_t)tk_atoi(space + 1);
+        cache->clock = tk_max(cache->clock, entry->access);
+      }
+    }
+    p = next;
+  }
+  TKMEM_FREE(data);
+
+  return RET_OK;
+}
+
+image_disk_cache_t* image_disk_cache_create(const char* dir, uint32_t max_size) {
+  image_disk_cache_t* cache = NULL;
+  return_value_if_fail(dir != NULL && *dir, NULL);
+
+  if (!fs_dir_exist(os_fs(), dir)) {
+    return_value_if_fail(fs_create_dir_r(os_fs(), dir) == RET_OK, NULL);
+  }
+
+  cache = TKMEM_ZALLOC(image_disk_cache_t);
+  return_value_if_fail(cache != NULL, NULL);
+
+  cache->dir = tk_strdup(dir);
+  cache->max_size = max_size;
+  cache->mutex = tk_mutex_create();
+  darray_init(&(cache->entries), 32, default_destroy, NULL);
+  goto_error_if_fail(cache->dir != NULL && cache->mutex != NULL);
+
+  image_disk_cache_scan(cache);
+  image_disk_cache_load_index(cache);
+  image_disk_cache_evict(cache, 0);
+
+  return cache;
+error:
+  image_disk_cache_destroy(cache);
+  return NULL;
+}
+
+static ret_t image_disk_cache_read_header(const uint8_t* data, uint32_t size,
+                                          const image_disk_cache_header_t* expected,
+                                          image_disk_cache_header_t* header) {
+  return_value_if_fail(size >= IMAGE_DISK_CACHE_HEADER_SIZE, RET_FAIL);
+
+  memcpy(header, data, sizeof(*header));
+  return_value_if_fail(header->magic == expected->magic, RET_FAIL);
+  return_value_if_fail(header->version == expected->version, RET_FAIL);
+  return_value_if_fail(header->crc == expected->crc && header->src_size == expected->src_size,
+                       RET_FAIL);
+  return_value_if_fail(header->name_hash == expected->name_hash, RET_FAIL);
+  return_value_if_fail(header->profile == expected->profile, RET_FAIL);
+  return_value_if_fail(header->physical_line_length * header->physical_h == header->data_size,
+                       RET_FAIL);
+  return_value_if_fail(IMAGE_DISK_CACHE_HEADER_SIZE + header->data_size == size, RET_FAIL);
+
+  return RET_OK;
+}
+
+static ret_t image_disk_cache_init_bitmap(bitmap_t* image,
+                                          const image_disk_cache_header_t* header) {
+  memset(image, 0x00, sizeof(bitmap_t));
+  image->w = header->w;
+  image->h = header->h;
+  image->flags = header->flags;
+  image->format = header->format;
+  image->line_length = header->line_length;
+  image->orientation = (lcd_orientation_t)(header->orientation);
+
+  return RET_OK;
+}
+
+/*小文件直接读到内存中*/
+static ret_t image_disk_cache_read_file(const char* path, const image_disk_cache_header_t* expected,
+                                        bitmap_t* image) {
+  uint32_t y = 0;
+  uint32_t size = 0;
+  uint8_t* dst = NULL;
+  uint32_t dst_line_length = 0;
+  image_disk_cache_header_t header;
+  uint8_t* data = (uint8_t*)file_read(path, &size);
+  return_value_if_fail(data != NULL, RET_FAIL);
+
+  if (image_disk_cache_read_header(data, size, expected, &header) != RET_OK) {
+    TKMEM_FREE(data);
+    return RET_FAIL;
+  }
+
+  image_disk_cache_init_bitmap(image, &header);
+  image->w = header.physical_w;
+  image->h = header.physical_h;
+  image->line_length = header.physical_line_length;
+  if (bitmap_alloc_data(image) != RET_OK) {
+    TKMEM_FREE(data);
+    return RET_OOM;
+  }
+  image->w = header.w;
+  image->h = header.h;
+  image->line_length = header.line_length;
+
+  dst = bitmap_lock_buffer_for_write(image);
+  dst_line_length = bitmap_get_physical_line_length(image);
+  if (dst == NULL || dst_line_length < header.physical_line_length) {
+    if (dst != NULL) {
+      bitmap_unlock_buffer(image);
+    }
+    bitmap_destroy(image);
+    TKMEM_FREE(data);
+    return RET_FAIL;
+  }
+
+  for (y = 0; y < header.physical_h; y++) {
+    memcpy(dst + y * dst_line_length,
+           data + IMAGE_DISK_CACHE_HEADER_SIZE + y * header.physical_line_length,
+           header.physical_line_length);
+  }
+  bitmap_unlock_buffer(image);
+  TKMEM_FREE(data);
+
+  return RET_OK;
+}
+
+static ret_t image_disk_cache_map_file(const char* path, const image_disk_cache_header_t* expected,
+                                       bitmap_t* image, mmap_t** map) {
+  image_disk_cache_header_t header;
+  mmap_t* m = mmap_create(path, FALSE, FALSE);
+  return_value_if_fail(m != NULL, RET_FAIL);
+
+  if (image_disk_cache_read_header(m->data, m->size, expected, &header) != RET_OK) {
+    mmap_destroy(m);
+    return RET_FAIL;
+  }
+
+  image_disk_cache_init_bitmap(image, &header);
+  image->buffer = GRAPHIC_BUFFER_CREATE_WITH_DATA_EX(
+      (uint8_t*)(m->data) + IMAGE_DISK_CACHE_HEADER_SIZE, NULL, header.physical_w,
+      header.physical_h, header.physical_line_length, (bitmap_format_t)(header.format));
+  if (image->buffer == NULL) {
+    mmap_destroy(m);
+    return RET_OOM;
+  }
+  image->should_free_data = TRUE;
+  *map = m;
+
+  return RET_OK;
+}
+
+ret_t image_disk_cache_load(image_disk_cache_t* cache, const asset_info_t* res,
+                            const char* variant, bitmap_t* image, mmap_t** map) {
+  ret_t ret = RET_OK;
+  int32_t index = 0;
+  int32_t size = 0;
+  char path[MAX_PATH + 1];
+  char key[IMAGE_DISK_CACHE_KEY_LEN + 1];
+  image_disk_cache_header_t expected;
+  return_value_if_fail(cache != NULL && image != NULL && map != NULL, RET_BAD_PARAMS);
+
+  *map = NULL;
+  if (!image_disk_cache_is_cacheable(res)) {
+    return RET_NOT_FOUND;
+  }
+
+  image_disk_cache_init_header(&expected, res, variant);
+  image_disk_cache_build_key(&expected, key);
+
+  tk_mutex_lock(cache->mutex);
+  index = image_disk_cache_find_index(cache, key);
+  if (index < 0) {
+    image_disk_cache_remove_stale(cache, key);
+    cache->misses++;
+    tk_mutex_unlock(cache->mutex);
+    return RET_NOT_FOUND;
+  } else {
+    image_disk_cache_entry_t* entry =
+        (image_disk_cache_entry_t*)darray_get(&(cache->entries), index);
+    entry->access = ++cache->clock;
+    size = entry->size;
+    cache->dirty = TRUE;
+  }
+  tk_mutex_unlock(cache->mutex);
+
+  path_build(path, MAX_PATH, cache->dir, key, NULL);
+  if (size >= IMAGE_DISK_CACHE_MMAP_MIN_SIZE) {
+    ret = image_disk_cache_map_file(path, &expected, image, map);
+  } else {
+    ret = image_disk_cache_read_file(path, &expected, image);
+  }
+
+  tk_mutex_lock(cache->mutex);
+  if (ret == RET_OK) {
+    cache->hits++;
+  } else {
+    /*文件已经损坏*/
+    index = image_disk_cache_find_index(cache, key);
+    if (index >= 0) {
+      image_disk_cache_remove_index(cache, index);
+    }
+    cache->misses++;
+    ret = RET_NOT_FOUND;
+  }
+  tk_mutex_unlock(cache->mutex);
+
+  return ret;
+}
+
+static ret_t image_disk_cache_write_file(const char* path, const image_disk_cache_header_t* header,
+                                         const uint8_t* data) {
+  int32_t ret = 0;
+  uint8_t buff[IMAGE_DISK_CACHE_HEADER_SIZE];
+  fs_file_t* f = fs_open_file(os_fs(), path, "wb+");
+  return_value_if_fail(f != NULL, RET_IO);
+
+  memset(buff, 0x00, sizeof(buff));
+  memcpy(buff, header, sizeof(*header));
+  ret = fs_file_write(f, buff, sizeof(buff));
+  if (ret == sizeof(buff)) {
+    ret = fs_file_write(f, data, header->data_size);
+  }
+  fs_file_close(f);
+
+  if (ret != (int32_t)(header->data_size)) {
+    fs_remove_file(os_fs(), path);
+    return RET_IO;
+  }
+
+  return RET_OK;
+}
+
+ret_t image_disk_cache_save(image_disk_cache_t* cache, const asset_info_t* res,
+                            const char* variant, bitmap_t* image) {
+  ret_t ret = RET_OK;
+  uint32_t size = 0;
+  uint8_t* data = NULL;
+  int32_t index = 0;
+  char path[MAX_PATH + 1];
+  char tmp_path[MAX_PATH + 1];
+  char key[IMAGE_DISK_CACHE_KEY_LEN + 1];
+  image_disk_cache_header_t header;
+  return_value_if_fail(cache != NULL && image != NULL, RET_BAD_PARAMS);
+
+  if (!image_disk_cache_is_cacheable(res) || image->is_gif || image->buffer == NULL) {
+    return RET_NOT_IMPL;
+  }
+
+  image_disk_cache_init_header(&header, res, variant);
+  header.w = image->w;
+  header.h = image->h;
+  header.line_length = bitmap_get_line_length(image);
+  header.flags = image->flags;
+  header.format = image->format;
+  header.orientation = image->orientation;
+  header.physical_w = bitmap_get_physical_width(image);
+  header.physical_h = bitmap_get_physical_height(image);
+  header.physical_line_length = bitmap_get_physical_line_length(image);
+  header.data_size = header.physical_line_length * header.physical_h;
+  size = IMAGE_DISK_CACHE_HEADER_SIZE + header.data_size;
+  image_disk_cache_build_key(&header, key);
+
+  if (header.data_size == 0 || size > cache->max_size) {
+    return RET_NOT_IMPL;
+  }
+
+  tk_mutex_lock(cache->mutex);
+  index = image_disk_cache_find_index(cache, key);
+  tk_mutex_unlock(cache->mutex);
+  if (index >= 0) {
+    return RET_OK;
+  }
+
+  path_build(path, MAX_PATH, cache->dir, key, NULL);
+  tk_snprintf(tmp_path, MAX_PATH, "%s.%p.tmp", path, (void*)image);
+
+  data = bitmap_lock_buffer_for_read(image);
+  return_value_if_fail(data != NULL, RET_FAIL);
+  ret = image_disk_cache_write_file(tmp_path, &header, data);
+  bitmap_unlock_buffer(image);
+  return_value_if_fail(ret == RET_OK, ret);
+
+  tk_mutex_lock(cache->mutex);
+  if (image_disk_cache_find_index(cache, key) >= 0) {
+    /*其它线程已经保存了同一图片*/
+    fs_remove_file(os_fs(), tmp_path);
+  } else {
+    image_disk_cache_remove_stale(cache, key);
+    image_disk_cache_evict(cache, size);
+    if (fs_file_rename(os_fs(), tmp_path, path) == RET_OK) {
+      ret = image_disk_cache_add_entry(cache, key, size, ++cache->clock);
+      cache->dirty = TRUE;
+    } else {
+      fs_remove_file(os_fs(), tmp_path);
+      ret = RET_IO;
+    }
+  }
+  tk_mutex_unlock(cache->mutex);
+
+  return ret;
+}
+
+ret_t image_disk_cache_set_max_size(image_disk_cache_t* cache, uint32_t max_size) {
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  tk_mutex_lock(cache->mutex);
+  cache->max_size = max_size;
+  image_disk_cache_evict(cache, 0);
+  tk_mutex_unlock(cache->mutex);
+
+  return RET_OK;
+}
+
+ret_t image_disk_cache_clear(image_disk_cache_t* cache) {
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  tk_mutex_lock(cache->mutex);
+  while (cache->entries.size > 0) {
+    image_disk_cache_remove_index(cache, cache->entries.size - 1);
+  }
+  cache->clock = 0;
+  tk_mutex_unlock(cache->mutex);
+
+  return RET_OK;
+}
+
+ret_t image_disk_cache_flush(image_disk_cache_t* cache) {
+  uint32_t i = 0;
+  ret_t ret = RET_OK;
+  wbuffer_t wb;
+  char path[MAX_PATH + 1];
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  tk_mutex_lock(cache->mutex);
+  if (!cache->dirty) {
+    tk_mutex_unlock(cache->mutex);
+    return RET_OK;
+  }
+
+  wbuffer_init_extendable(&wb);
+  for (i = 0; i < cache->entries.size; i++) {
+    char line[IMAGE_DISK_CACHE_KEY_LEN + 16];
+    image_disk_cache_entry_t* iter = (image_disk_cache_entry_t*)darray_get(&(cache->entries), i);
+
+    tk_snprintf(line, sizeof(line), "%s %u\n", iter->key, iter->access);
+    wbuffer_write_binary(&wb, line, strlen(line));
+  }
+
+  path_build(path, MAX_PATH, cache->dir, IMAGE_DISK_CACHE_INDEX, NULL);
+  ret = file_write(path, wb.data != NULL ? wb.data : (uint8_t*)"", wb.cursor);
+  if (ret == RET_OK) {
+    cache->dirty = FALSE;
+  }
+  wbuffer_deinit(&wb);
+  tk_mutex_unlock(cache->mutex);
+
+  return ret;
+}
+
+ret_t image_disk_cache_destroy(image_disk_cache_t* cache) {
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  if (cache->mutex != NULL) {
+    image_disk_cache_flush(cache);
+    tk_mutex_destroy(cache->mutex);
+  }
+  darray_deinit(&(cache->entries));
+  TKMEM_FREE(cache->dir);
+  TKMEM_FREE(cache);
+
+  return RET_OK;
+}
+
+#endif /*WITH_IMAGE_DISK_CACHE*/
@@ -0,0 +1,180 @@
+﻿/**
+ * File:   image_disk_cache.h
+ * Author: AWTK Develop Team
+ * Brief:  on-disk cache of decoded images
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_IMAGE_DISK_CACHE_H
+#define TK_IMAGE_DISK_CACHE_H
+
+#include "tkc/mmap.h"
+#include "tkc/mutex.h"
+#include "tkc/darray.h"
+#include "tkc/asset_info.h"
+#include "base/bitmap.h"
+
+BEGIN_C_DECLS
+
+#define IMAGE_DISK_CACHE_MAGIC 0x4d424b54 /*TKBM*/
+#define IMAGE_DISK_CACHE_VERSION 2
+
+/**
+ * @class image_disk_cache_t
+ * 解码后图片的磁盘缓存。
+ *
+ * 把PNG/JPG等图片解码并转换成LCD需要的格式(包括预乘alpha和行对齐)后的像素数据保存到文件中，
+ * 下次启动时直接mmap缓存文件，不再解码和转换格式。一般用于固件升级后首次启动较慢的设备。
+ *
+ * * 缓存以图片源数据的哈希值(crc32和长度)、图片名称和像素格式配置为键。
+ *   图片源数据变化后，旧的缓存不再命中，并在下次加载该图片时删除。
+ * * 缓存文件总大小超过上限时，淘汰最久没有使用的文件。使用顺序保存在缓存目录的index文件中。
+ * * 不小于4K的缓存文件通过mmap加载(与缓存的图片共享映射的内存)，小文件直接读到内存中。
+ * * gif等多帧图片不缓存。
+ *
+ * 一般通过image\_manager\_set\_disk\_cache设置到图片管理器中：
+ *
+ * ```c
+ * char dir[MAX_PATH + 1];
+ * fs_build_user_storage_file_name(dir, "myapp", "image_cache");
+ * image_manager_set_disk_cache(image_manager(), image_disk_cache_create(dir, 32 * 1024 * 1024));
+ * ```
+ *
+ * > 需要定义WITH\_IMAGE\_DISK\_CACHE，且平台支持mmap。
+ */
+typedef struct _image_disk_cache_t {
+  /**
+   * @property {char*} dir
+   * @annotation ["readable"]
+   * 缓存目录。
+   */
+  char* dir;
+  /**
+   * @property {uint32_t} max_size
+   * @annotation ["readable"]
+   * 缓存文件总大小的上限。
+   */
+  uint32_t max_size;
+  /**
+   * @property {uint32_t} size
+   * @annotation ["readable"]
+   * 缓存文件的总大小。
+   */
+  uint32_t size;
+  /**
+   * @property {uint32_t} hits
+   * @annotation ["readable"]
+   * 命中次数。
+   */
+  uint32_t hits;
+  /**
+   * @property {uint32_t} misses
+   * @annotation ["readable"]
+   * 没有命中的次数。
+   */
+  uint32_t misses;
+
+  /*private*/
+  tk_mutex_t* mutex;
+  darray_t entries;
+  /*使用顺序的计数器*/
+  uint32_t clock;
+  /*使用顺序是否需要保存*/
+  bool_t dirty;
+} image_disk_cache_t;
+
+/**
+ * @method image_disk_cache_create
+ * 创建磁盘缓存对象。目录不存在时自动创建。
+ * @annotation ["constructor"]
+ * @param {const char*} dir 缓存目录。
+ * @param {uint32_t} max_size 缓存文件总大小的上限。
+ *
+ * @return {image_disk_cache_t*} 返回缓存对象，失败返回NULL。
+ */
+image_disk_cache_t* image_disk_cache_create(const char* dir, uint32_t max_size);
+
+/**
+ * @method image_disk_cache_load
+ * 从缓存中加载图片。
+ *
+ * > map不为NULL时，图片的数据指向映射的内存，需要在销毁图片之后调用mmap\_destroy释放map。
+ *
+ * @param {image_disk_cache_t*} cache 缓存对象。
+ * @param {const asset_info_t*} res 图片的源数据。
+ * @param {const char*} variant 图片所属的变体(如主题和屏幕密度，可以为NULL)。同名图片的不同变体分别缓存。
+ * @param {bitmap_t*} image 用于返回图片。
+ * @param {mmap_t**} map 用于返回映射对象(为NULL表示数据已经读到内存中)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，RET_NOT_FOUND表示没有缓存，否则表示失败。
+ */
+ret_t image_disk_cache_load(image_disk_cache_t* cache, const asset_info_t* res,
+                            const char* variant, bitmap_t* image, mmap_t** map);
+
+/**
+ * @method image_disk_cache_save
+ * 把解码后的图片保存到缓存中。
+ * @param {image_disk_cache_t*} cache 缓存对象。
+ * @param {const asset_info_t*} res 图片的源数据。
+ * @param {const char*} variant 图片所属的变体(如主题和屏幕密度，可以为NULL)。
+ * @param {bitmap_t*} image 解码后的图片。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_disk_cache_save(image_disk_cache_t* cache, const asset_info_t* res,
+                            const char* variant, bitmap_t* image);
+
+/**
+ * @method image_disk_cache_set_max_size
+ * 设置缓存文件总大小的上限，超过上限时淘汰最久没有使用的文件。
+ * @param {image_disk_cache_t*} cache 缓存对象。
+ * @param {uint32_t} max_size 缓存文件总大小的上限。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_disk_cache_set_max_size(image_disk_cache_t* cache, uint32_t max_size);
+
+/**
+ * @method image_disk_cache_clear
+ * 删除全部缓存文件。
+ * @param {image_disk_cache_t*} cache 缓存对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_disk_cache_clear(image_disk_cache_t* cache);
+
+/**
+ * @method image_disk_cache_flush
+ * 把使用顺序保存到index文件中。
+ * @param {image_disk_cache_t*} cache 缓存对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_disk_cache_flush(image_disk_cache_t* cache);
+
+/**
+ * @method image_disk_cache_destroy
+ * 保存使用顺序，并销毁缓存对象(不删除缓存文件)。
+ * @param {image_disk_cache_t*} cache 缓存对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_disk_cache_destroy(image_disk_cache_t* cache);
+
+END_C_DECLS
+
+#endif /*TK_IMAGE_DISK_CACHE_H*/
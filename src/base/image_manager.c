@@ -21,36 +21,97 @@
 
 #include "tkc/mem.h"
 #include "tkc/utils.h"
+#include "tkc/mutex.h"
+#include "tkc/platform.h"
 #include "tkc/time_now.h"
+#include "tkc/action_thread_pool.h"
+#include "base/idle.h"
 #include "base/locale_info.h"
 #include "base/image_manager.h"
+#include "base/tile_painter.h"
+#include "base/image_disk_cache.h"
 
-typedef struct _bitmap_cache_t {
+#define IMAGE_MANAGER_INDEX_MIN_CAPACITY 32
+#define IMAGE_MANAGER_VARIANT_LEN 63
+
+struct _bitmap_cache_t {
   bitmap_t image;
   char* name;
   uint32_t access_count;
   uint64_t created_time;
   uint64_t last_access_time;
-} bitmap_cache_t;
 
-static int bitmap_cache_cmp_time(bitmap_cache_t* a, bitmap_cache_t* b) {
-  return (a->last_access_time <= b->last_access_time) ? 0 : -1;
-}
+  /*计入缓存的内存大小*/
+  uint32_t mem_size;
+  /*解码耗时(us)*/
+  uint32_t decode_time;
+
+  /*名称的哈希值*/
+  uint32_t hash;
+  /*在images中的位置*/
+  uint32_t index;
+  /*LRU链表，头部是最近使用的*/
+  bitmap_cache_t* prev;
+  bitmap_cache_t* next;
+  /*图片数据来自磁盘缓存的映射时，在销毁图片后释放*/
+  mmap_t* map;
+};
+
+static ret_t image_manager_unmap(mmap_t* map) {
+#ifdef WITH_IMAGE_DISK_CACHE
+  if (map != NULL) {
+    mmap_destroy(map);
+  }
+#endif /*WITH_IMAGE_DISK_CACHE*/
 
-static int bitmap_cache_cmp_name(bitmap_cache_t* a, bitmap_cache_t* b) {
-  return strcmp(a->name, b->name);
+  return RET_OK;
 }
 
-static int bitmap_cache_cmp_data(bitmap_cache_t* a, bitmap_cache_t* b) {
-  return (char*)(a->image.buffer) - (char*)(b->image.buffer);
+/*释放没有加入缓存的解码结果*/
+static ret_t image_manager_free_decoded(bitmap_t* image, mmap_t* map) {
+  bitmap_destroy(image);
+
+  return image_manager_unmap(map);
 }
 
-static int bitmap_cache_cmp_with_name(bitmap_cache_t* a, const char* name) {
-  return strcmp(a->name, name);
+/*图片所属的变体(主题和屏幕密度)，磁盘缓存用它区分不同目录下的同名图片。在UI线程中调用*/
+static const char* image_manager_get_variant(image_manager_t* imm,
+                                             char variant[IMAGE_MANAGER_VARIANT_LEN + 1]) {
+  system_info_t* info = system_info();
+  const char* theme = imm->assets_manager != NULL
+                          ? assets_manager_get_theme_name(imm->assets_manager)
+                          : NULL;
+  int32_t ratio = info != NULL ? tk_roundi(info->device_pixel_ratio) : 1;
+
+  tk_snprintf(variant, IMAGE_MANAGER_VARIANT_LEN + 1, "%s@%d", theme != NULL ? theme : "",
+              ratio);
+
+  return variant;
 }
 
-static int bitmap_cache_cmp_access_time_dec(bitmap_cache_t* a, bitmap_cache_t* b) {
-  return (b->last_access_time) - (a->last_access_time);
+/*先从磁盘缓存中加载，没有命中时再解码，可能在解码线程中调用*/
+static ret_t image_manager_decode(image_disk_cache_t* disk_cache, const asset_info_t* res,
+                                  const char* variant, bitmap_t* image, mmap_t** map) {
+  ret_t ret = RET_OK;
+
+  *map = NULL;
+#ifdef WITH_IMAGE_DISK_CACHE
+  if (disk_cache != NULL &&
+      image_disk_cache_load(disk_cache, res, variant, image, map) == RET_OK) {
+    return RET_OK;
+  }
+#else
+  (void)variant;
+#endif /*WITH_IMAGE_DISK_CACHE*/
+
+  ret = image_loader_load_image(res, image);
+#ifdef WITH_IMAGE_DISK_CACHE
+  if (ret == RET_OK && disk_cache != NULL) {
+    image_disk_cache_save(disk_cache, res, variant, image);
+  }
+#endif /*WITH_IMAGE_DISK_CACHE*/
+
+  return ret;
 }
 
 static ret_t bitmap_cache_destroy(bitmap_cache_t* cache) {
@@ -58,11 +119,11 @@ static ret_t bitmap_cache_destroy(bitmap_cache_t* cache) {
   bitmap_t* image = &(cache->image);
   image_manager_t* imm = image->image_manager;
 
-  if (imm != NULL && image->should_free_data) {
-    imm->mem_size_of_cached_images -= bitmap_get_mem_size(image);
+  if (imm != NULL) {
+    imm->mem_size_of_cached_images -= cache->mem_size;
   }
   log_debug("unload image %s\n", cache->name);
-  bitmap_destroy(&(cache->image));
+  image_manager_free_decoded(&(cache->image), cache->map);
   TKMEM_FREE(cache->name);
   TKMEM_FREE(cache);
 
@@ -98,6 +159,141 @@ static locale_info_t* image_manager_get_locale_info(image_manager_t* imm) {
   return locale;
 }
 
+static uint32_t image_manager_hash_name(const char* name) {
+  uint32_t hash = 2166136261u;
+
+  while (*name) {
+    hash ^= (uint8_t)(*name++);
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+static ret_t image_manager_index_insert(image_manager_t* imm, bitmap_cache_t* cache) {
+  uint32_t mask = imm->index_capacity - 1;
+  uint32_t i = cache->hash & mask;
+
+  while (imm->index[i] != NULL) {
+    i = (i + 1) & mask;
+  }
+  imm->index[i] = cache;
+
+  return RET_OK;
+}
+
+static ret_t image_manager_index_rebuild(image_manager_t* imm, uint32_t capacity) {
+  uint32_t i = 0;
+  bitmap_cache_t** index = TKMEM_ZALLOCN(bitmap_cache_t*, capacity);
+  return_value_if_fail(index != NULL, RET_OOM);
+
+  TKMEM_FREE(imm->index);
+  imm->index = index;
+  imm->index_capacity = capacity;
+
+  for (i = 0; i < imm->images.size; i++) {
+    image_manager_index_insert(imm, (bitmap_cache_t*)darray_get(&(imm->images), i));
+  }
+
+  return RET_OK;
+}
+
+static bitmap_cache_t* image_manager_index_find(image_manager_t* imm, const char* name) {
+  uint32_t i = 0;
+  uint32_t mask = 0;
+  uint32_t hash = 0;
+
+  if (imm->index == NULL) {
+    return NULL;
+  }
+
+  mask = imm->index_capacity - 1;
+  hash = image_manager_hash_name(name);
+  for (i = hash & mask; imm->index[i] != NULL; i = (i + 1) & mask) {
+    bitmap_cache_t* iter = imm->index[i];
+    if (iter->hash == hash && strcmp(iter->name, name) == 0) {
+      return iter;
+    }
+  }
+
+  return NULL;
+}
+
+static ret_t image_manager_index_remove(image_manager_t* imm, bitmap_cache_t* cache) {
+  uint32_t i = 0;
+  uint32_t j = 0;
+  uint32_t mask = imm->index_capacity - 1;
+
+  for (i = cache->hash & mask; imm->index[i] != cache; i = (i + 1) & mask) {
+    return_value_if_fail(imm->index[i] != NULL, RET_NOT_FOUND);
+  }
+
+  /*backward shift deletion，保持探测序列连续*/
+  for (j = i;;) {
+    uint32_t k = 0;
+    j = (j + 1) & mask;
+    if (imm->index[j] == NULL) {
+      break;
+    }
+
+    k = imm->index[j]->hash & mask;
+    if ((i <= j) ? (i < k && k <= j) : (i < k || k <= j)) {
+      continue;
+    }
+
+    imm->index[i] = imm->index[j];
+    i = j;
+  }
+  imm->index[i] = NULL;
+
+  return RET_OK;
+}
+
+static void image_manager_lru_unlink(image_manager_t* imm, bitmap_cache_t* cache) {
+  if (cache->prev != NULL) {
+    cache->prev->next = cache->next;
+  } else {
+    imm->lru_head = cache->next;
+  }
+
+  if (cache->next != NULL) {
+    cache->next->prev = cache->prev;
+  } else {
+    imm->lru_tail = cache->prev;
+  }
+
+  cache->prev = NULL;
+  cache->next = NULL;
+}
+
+static void image_manager_lru_push_front(image_manager_t* imm, bitmap_cache_t* cache) {
+  cache->prev = NULL;
+  cache->next = imm->lru_head;
+
+  if (imm->lru_head != NULL) {
+    imm->lru_head->prev = cache;
+  } else {
+    imm->lru_tail = cache;
+  }
+  imm->lru_head = cache;
+}
+
+static ret_t image_manager_remove_cache(image_manager_t* imm, bitmap_cache_t* cache) {
+  uint32_t last = imm->images.size - 1;
+
+  image_manager_index_remove(imm, cache);
+  image_manager_lru_unlink(imm, cache);
+
+  if (cache->index != last) {
+    bitmap_cache_t* moved = (bitmap_cache_t*)darray_get(&(imm->images), last);
+    imm->images.elms[cache->index] = moved;
+    moved->index = cache->index;
+  }
+  darray_pop(&(imm->images));
+
+  return bitmap_cache_destroy(cache);
+}
+
 image_manager_t* image_manager_init(image_manager_t* imm) {
   return_value_if_fail(imm != NULL, NULL);
 
@@ -105,37 +301,60 @@ image_manager_t* image_manager_init(image_manager_t* imm) {
   imm->assets_manager = assets_manager();
   imm->refcount = 1;
   imm->name = NULL;
+  imm->index = NULL;
+  imm->index_capacity = 0;
+  imm->lru_head = NULL;
+  imm->lru_tail = NULL;
+  imm->hits = 0;
+  imm->misses = 0;
+  imm->evictions = 0;
+  imm->reserved_mem_size = 0;
+  imm->async = NULL;
+  imm->disk_cache = NULL;
 
   return imm;
 }
 
+/*淘汰最久没有使用的图片，直到缓存的内存不超过上限。*/
 static ret_t image_manager_clear_cache(image_manager_t* imm) {
-  bitmap_cache_t* iter = NULL;
   return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
   if (imm->images.size == 0 || imm->max_mem_size_of_cached_images == 0 ||
-      imm->mem_size_of_cached_images < imm->max_mem_size_of_cached_images) {
+      imm->mem_size_of_cached_images + imm->reserved_mem_size <
+          imm->max_mem_size_of_cached_images) {
+    return RET_OK;
+  }
+
+  /*并行绘制时，其它线程可能正在使用缓存的图片，等下次添加时再淘汰*/
+  if (tile_painter_is_painting()) {
     return RET_OK;
   }
 
-  darray_sort(&(imm->images), (tk_compare_t)bitmap_cache_cmp_access_time_dec);
   do {
-    iter = (bitmap_cache_t*)darray_pop(&(imm->images));
-    bitmap_cache_destroy(iter);
+    image_manager_remove_cache(imm, imm->lru_tail);
+    imm->evictions++;
     log_debug("clear cache: mem_size_of_cached_images=%u nr=%u", imm->mem_size_of_cached_images,
               imm->images.size);
-  } while (imm->images.size > 0 &&
-           imm->mem_size_of_cached_images > imm->max_mem_size_of_cached_images);
+  } while (imm->images.size > 0 && imm->mem_size_of_cached_images + imm->reserved_mem_size >
+                                        imm->max_mem_size_of_cached_images);
 
   return RET_OK;
 }
 
-ret_t image_manager_add(image_manager_t* imm, const char* name, const bitmap_t* image) {
+/*map不为NULL时，由缓存负责释放(包括失败的情况)*/
+static ret_t image_manager_add_impl(image_manager_t* imm, const char* name, const bitmap_t* image,
+                                    uint32_t decode_time, mmap_t* map) {
   bitmap_cache_t* cache = NULL;
   return_value_if_fail(imm != NULL && name != NULL && image != NULL, RET_BAD_PARAMS);
 
   cache = TKMEM_ZALLOC(bitmap_cache_t);
-  return_value_if_fail(cache != NULL, RET_OOM);
+  if (cache == NULL) {
+    if (map != NULL) {
+      image_manager_free_decoded((bitmap_t*)image, map);
+    }
+    return RET_OOM;
+  }
 
+  cache->map = map;
   cache->image = *image;
   cache->access_count = 1;
   cache->created_time = time_now_s();
@@ -143,45 +362,86 @@ ret_t image_manager_add(image_manager_t* imm, const char* name, const bitmap_t*
   cache->name = tk_strdup(name);
   cache->image.name = cache->name;
   cache->last_access_time = cache->created_time;
+  cache->hash = image_manager_hash_name(name);
+  cache->decode_time = decode_time;
 
   cache->image.image_manager = imm;
   if (image->should_free_data) {
-    imm->mem_size_of_cached_images += bitmap_get_mem_size((bitmap_t*)image);
+    cache->mem_size = bitmap_get_mem_size((bitmap_t*)image);
+    imm->mem_size_of_cached_images += cache->mem_size;
     image_manager_clear_cache(imm);
   }
 
-  return darray_push(&(imm->images), cache);
+  if (darray_push(&(imm->images), cache) != RET_OK) {
+    bitmap_cache_destroy(cache);
+    return RET_OOM;
+  }
+
+  cache->index = imm->images.size - 1;
+  image_manager_lru_push_front(imm, cache);
+  if (imm->images.size * 2 > imm->index_capacity) {
+    uint32_t capacity = tk_max(IMAGE_MANAGER_INDEX_MIN_CAPACITY, imm->index_capacity * 2);
+    if (image_manager_index_rebuild(imm, capacity) != RET_OK) {
+      image_manager_remove_cache(imm, cache);
+      return RET_OOM;
+    }
+  } else {
+    image_manager_index_insert(imm, cache);
+  }
+
+  return RET_OK;
+}
+
+ret_t image_manager_add(image_manager_t* imm, const char* name, const bitmap_t* image) {
+  return image_manager_add_impl(imm, name, image, 0, NULL);
+}
+
+static ret_t image_manager_get_cached(image_manager_t* imm, bitmap_cache_t* cache,
+                                      bitmap_t* image) {
+  *image = cache->image;
+  image->destroy = NULL;
+  image->image_manager = imm;
+  image->specific_destroy = NULL;
+  image->should_free_data = FALSE;
+
+  return RET_OK;
 }
 
 ret_t image_manager_lookup(image_manager_t* imm, const char* name, bitmap_t* image) {
-  bitmap_cache_t info;
   bitmap_cache_t* iter = NULL;
   return_value_if_fail(imm != NULL && name != NULL && image != NULL, RET_BAD_PARAMS);
 
-  memset(&info, 0x00, sizeof(info));
-
-  info.name = (char*)name;
-  imm->images.compare = (tk_compare_t)bitmap_cache_cmp_name;
-  iter = darray_find(&(imm->images), &info);
-
+  iter = image_manager_index_find(imm, name);
   if (iter != NULL) {
-    *image = iter->image;
-    image->destroy = NULL;
-    image->image_manager = imm;
-    image->specific_destroy = NULL;
-    image->should_free_data = FALSE;
-
     iter->access_count++;
     iter->last_access_time = time_now_s();
+    if (imm->lru_head != iter) {
+      image_manager_lru_unlink(imm, iter);
+      image_manager_lru_push_front(imm, iter);
+    }
+    imm->hits++;
 
-    return RET_OK;
+    return image_manager_get_cached(imm, iter, image);
   }
 
   return RET_NOT_FOUND;
 }
 
+static bitmap_cache_t* image_manager_find_by_buffer(image_manager_t* imm,
+                                                    graphic_buffer_t* buffer) {
+  uint32_t i = 0;
+
+  for (i = 0; i < imm->images.size; i++) {
+    bitmap_cache_t* iter = (bitmap_cache_t*)darray_get(&(imm->images), i);
+    if (iter->image.buffer == buffer) {
+      return iter;
+    }
+  }
+
+  return NULL;
+}
+
 ret_t image_manager_update_specific(image_manager_t* imm, bitmap_t* image) {
-  bitmap_cache_t info;
   bitmap_cache_t* iter = NULL;
   return_value_if_fail(image != NULL, RET_BAD_PARAMS);
 
@@ -193,9 +453,7 @@ ret_t image_manager_update_specific(image_manager_t* imm, bitmap_t* image) {
     imm = image->image_manager;
   }
 
-  info.image.buffer = image->buffer;
-  imm->images.compare = (tk_compare_t)bitmap_cache_cmp_data;
-  iter = darray_find(&(imm->images), &info);
+  iter = image_manager_find_by_buffer(imm, image->buffer);
 
   if (iter != NULL) {
     iter->image.flags = image->flags;
@@ -210,8 +468,8 @@ ret_t image_manager_update_specific(image_manager_t* imm, bitmap_t* image) {
   return RET_NOT_FOUND;
 }
 
-static ret_t image_manager_get_bitmap_impl(image_manager_t* imm, const char* name,
-                                           bitmap_t* image) {
+static ret_t image_manager_get_bitmap_nolock(image_manager_t* imm, const char* name,
+                                             bitmap_t* image) {
   const asset_info_t* res = NULL;
   return_value_if_fail(imm != NULL && name != NULL && image != NULL, RET_BAD_PARAMS);
 
@@ -220,6 +478,8 @@ static ret_t image_manager_get_bitmap_impl(image_manager_t* imm, const char* nam
     return RET_OK;
   }
 
+  imm->misses++;
+
   res = assets_manager_ref(imm->assets_manager, ASSET_TYPE_IMAGE, name);
   if (res == NULL) {
     if (imm->fallback_get_bitmap != NULL) {
@@ -259,18 +519,35 @@ static ret_t image_manager_get_bitmap_impl(image_manager_t* imm, const char* nam
 
     return RET_OK;
   } else if (res->subtype != ASSET_TYPE_IMAGE_BSVG) {
-    ret_t ret = image_loader_load_image(res, image);
+    mmap_t* map = NULL;
+    bitmap_cache_t* cache = NULL;
+    uint64_t start = time_now_us();
+    char variant[IMAGE_MANAGER_VARIANT_LEN + 1];
+    ret_t ret = image_manager_decode(imm->disk_cache, res,
+                                     image_manager_get_variant(imm, variant), image, &map);
     if (ret == RET_OK) {
-      image_manager_add(imm, name, image);
+      image_manager_add_impl(imm, name, image, (uint32_t)(time_now_us() - start), map);
     }
     assets_manager_unref(imm->assets_manager, res);
 
-    return image_manager_lookup(imm, name, image);
+    cache = image_manager_index_find(imm, name);
+    return cache != NULL ? image_manager_get_cached(imm, cache, image) : RET_NOT_FOUND;
   } else {
     return RET_NOT_FOUND;
   }
 }
 
+static ret_t image_manager_get_bitmap_impl(image_manager_t* imm, const char* name,
+                                           bitmap_t* image) {
+  ret_t ret = RET_OK;
+
+  tile_painter_lock();
+  ret = image_manager_get_bitmap_nolock(imm, name, image);
+  tile_painter_unlock();
+
+  return ret;
+}
+
 typedef struct _imm_expr_info_t {
   image_manager_t* imm;
   bitmap_t* image;
@@ -325,6 +602,547 @@ ret_t image_manager_get_bitmap(image_manager_t* imm, const char* name, bitmap_t*
   }
 }
 
+/*异步解码*/
+typedef enum _image_async_state_t {
+  IMAGE_ASYNC_PENDING = 0,
+  IMAGE_ASYNC_RUNNING,
+  IMAGE_ASYNC_DONE
+} image_async_state_t;
+
+typedef struct _image_async_waiter_t {
+  event_func_t on_done;
+  void* ctx;
+} image_async_waiter_t;
+
+typedef struct _image_async_req_t {
+  char* name;
+  int32_t priority;
+  uint32_t seq;
+  const asset_info_t* res;
+  char variant[IMAGE_MANAGER_VARIANT_LEN + 1];
+  /*只在UI线程中访问*/
+  darray_t waiters;
+
+  /*以下字段受async->mutex保护*/
+  image_async_state_t state;
+  bitmap_t image;
+  ret_t ret;
+  uint32_t decode_time;
+  mmap_t* map;
+} image_async_req_t;
+
+struct _image_manager_async_t {
+  /*image_manager销毁后为NULL*/
+  image_manager_t* imm;
+  tk_mutex_t* mutex;
+  action_thread_pool_t* pool;
+
+  /*以下字段受mutex保护*/
+  darray_t requests;
+  uint32_t workers;
+  uint32_t seq;
+  uint32_t refcount;
+  bool_t drain_queued;
+  bool_t quit;
+};
+
+static ret_t image_async_req_destroy(image_async_req_t* req) {
+  darray_deinit(&(req->waiters));
+  TKMEM_FREE(req->name);
+  TKMEM_FREE(req);
+
+  return RET_OK;
+}
+
+static image_async_req_t* image_async_req_create(const char* name, const asset_info_t* res,
+                                                 int32_t priority, uint32_t seq) {
+  image_async_req_t* req = TKMEM_ZALLOC(image_async_req_t);
+  return_value_if_fail(req != NULL, NULL);
+
+  req->res = res;
+  req->seq = seq;
+  req->priority = priority;
+  req->name = tk_strdup(name);
+  req->state = IMAGE_ASYNC_PENDING;
+  darray_init(&(req->waiters), 1, default_destroy, NULL);
+  if (req->name == NULL) {
+    image_async_req_destroy(req);
+    return NULL;
+  }
+
+  return req;
+}
+
+static ret_t image_async_req_add_waiter(image_async_req_t* req, event_func_t on_done, void* ctx) {
+  uint32_t i = 0;
+  image_async_waiter_t* waiter = NULL;
+
+  for (i = 0; i < req->waiters.size; i++) {
+    waiter = (image_async_waiter_t*)darray_get(&(req->waiters), i);
+    if (waiter->on_done == on_done && waiter->ctx == ctx) {
+      return RET_OK;
+    }
+  }
+
+  waiter = TKMEM_ZALLOC(image_async_waiter_t);
+  return_value_if_fail(waiter != NULL, RET_OOM);
+
+  waiter->on_done = on_done;
+  waiter->ctx = ctx;
+  if (darray_push(&(req->waiters), waiter) != RET_OK) {
+    TKMEM_FREE(waiter);
+    return RET_OOM;
+  }
+
+  return RET_OK;
+}
+
+static ret_t image_manager_async_unref(image_manager_async_t* async) {
+  bool_t destroy = FALSE;
+
+  tk_mutex_lock(async->mutex);
+  assert(async->refcount > 0);
+  async->refcount--;
+  destroy = async->refcount == 0;
+  tk_mutex_unlock(async->mutex);
+
+  if (destroy) {
+    darray_deinit(&(async->requests));
+    tk_mutex_destroy(async->mutex);
+    TKMEM_FREE(async);
+  }
+
+  return RET_OK;
+}
+
+static ret_t image_manager_async_on_idle(const idle_info_t* idle);
+
+/*调用者需要持有async->mutex*/
+static ret_t image_manager_async_queue_drain(image_manager_async_t* async) {
+  if (async->drain_queued || async->quit) {
+    return RET_OK;
+  }
+
+  async->drain_queued = TRUE;
+  async->refcount++;
+  tk_mutex_unlock(async->mutex);
+  if (idle_queue_impl(image_manager_async_on_idle, async, NULL, NULL, FALSE) != RET_OK) {
+    /*主循环的队列满了，下次调用image_manager_get_bitmap_async时再试*/
+    tk_mutex_lock(async->mutex);
+    async->drain_queued = FALSE;
+    async->refcount--;
+  } else {
+    tk_mutex_lock(async->mutex);
+  }
+
+  return RET_OK;
+}
+
+/*调用者需要持有async->mutex*/
+static image_async_req_t* image_manager_async_pick(image_manager_async_t* async) {
+  uint32_t i = 0;
+  image_async_req_t* best = NULL;
+
+  for (i = 0; i < async->requests.size; i++) {
+    image_async_req_t* iter = (image_async_req_t*)darray_get(&(async->requests), i);
+    if (iter->state != IMAGE_ASYNC_PENDING) {
+      continue;
+    }
+
+    if (best == NULL || iter->priority > best->priority ||
+        (iter->priority == best->priority && iter->seq < best->seq)) {
+      best = iter;
+    }
+  }
+
+  return best;
+}
+
+static ret_t image_manager_async_exec(qaction_t* action) {
+  image_async_req_t* req = NULL;
+  image_manager_async_t* async = NULL;
+
+  memcpy(&async, action->args, sizeof(async));
+  tk_mutex_lock(async->mutex);
+  while (!async->quit && (req = image_manager_async_pick(async)) != NULL) {
+    ret_t ret = RET_OK;
+    bitmap_t image;
+    mmap_t* map = NULL;
+    uint64_t start = 0;
+
+    req->state = IMAGE_ASYNC_RUNNING;
+    tk_mutex_unlock(async->mutex);
+
+    start = time_now_us();
+    memset(&image, 0x00, sizeof(image));
+    ret = image_manager_decode(async->imm->disk_cache, req->res, req->variant, &image, &map);
+
+    tk_mutex_lock(async->mutex);
+    req->ret = ret;
+    req->map = map;
+    req->image = image;
+    req->decode_time = (uint32_t)(time_now_us() - start);
+    req->state = IMAGE_ASYNC_DONE;
+    image_manager_async_queue_drain(async);
+  }
+  async->workers--;
+  tk_mutex_unlock(async->mutex);
+
+  return RET_OK;
+}
+
+static image_manager_async_t* image_manager_async_create(image_manager_t* imm) {
+  image_manager_async_t* async = TKMEM_ZALLOC(image_manager_async_t);
+  return_value_if_fail(async != NULL, NULL);
+
+  async->imm = imm;
+  async->refcount = 1;
+  async->mutex = tk_mutex_create();
+  async->pool = action_thread_pool_create(TK_IMAGE_ASYNC_THREADS, 1);
+  darray_init(&(async->requests), 8, NULL, NULL);
+
+  if (async->mutex == NULL || async->pool == NULL) {
+    if (async->pool != NULL) {
+      action_thread_pool_destroy(async->pool);
+    }
+    if (async->mutex != NULL) {
+      tk_mutex_destroy(async->mutex);
+    }
+    TKMEM_FREE(async);
+    return NULL;
+  }
+
+  return async;
+}
+
+/*调用者需要持有async->mutex*/
+static ret_t image_manager_async_spawn(image_manager_async_t* async) {
+  qaction_t* action = NULL;
+
+  if (async->workers >= TK_IMAGE_ASYNC_THREADS) {
+    return RET_OK;
+  }
+
+  action = qaction_create(image_manager_async_exec, &async, sizeof(async));
+  return_value_if_fail(action != NULL, RET_OOM);
+
+  async->workers++;
+  if (action_thread_pool_exec(async->pool, action) != RET_OK) {
+    async->workers--;
+    qaction_destroy(action);
+    return RET_FAIL;
+  }
+
+  return RET_OK;
+}
+
+static ret_t image_manager_async_notify(image_async_req_t* req, ret_t ret) {
+  uint32_t i = 0;
+  done_event_t e;
+
+  done_event_init(&e, ret);
+  for (i = 0; i < req->waiters.size; i++) {
+    image_async_waiter_t* waiter = (image_async_waiter_t*)darray_get(&(req->waiters), i);
+    e.e.target = waiter->ctx;
+    waiter->on_done(waiter->ctx, (event_t*)&e);
+  }
+
+  return RET_OK;
+}
+
+/*在UI线程中把解码完成的图片加入缓存，并通知等待者*/
+static ret_t image_manager_async_drain(image_manager_async_t* async) {
+  uint32_t i = 0;
+  darray_t done;
+  image_manager_t* imm = async->imm;
+
+  darray_init(&done, 4, NULL, NULL);
+  tk_mutex_lock(async->mutex);
+  for (i = 0; i < async->requests.size;) {
+    image_async_req_t* iter = (image_async_req_t*)darray_get(&(async->requests), i);
+    if (iter->state == IMAGE_ASYNC_DONE) {
+      darray_push(&done, iter);
+      darray_remove_index(&(async->requests), i);
+    } else {
+      i++;
+    }
+  }
+  tk_mutex_unlock(async->mutex);
+
+  for (i = 0; i < done.size; i++) {
+    ret_t ret = RET_OK;
+    image_async_req_t* req = (image_async_req_t*)darray_get(&done, i);
+
+    tile_painter_lock();
+    ret = req->ret;
+    if (ret == RET_OK) {
+      if (image_manager_index_find(imm, req->name) != NULL) {
+        /*解码期间已经被同步加载了*/
+        image_manager_free_decoded(&(req->image), req->map);
+      } else {
+        ret = image_manager_add_impl(imm, req->name, &(req->image), req->decode_time, req->map);
+      }
+    }
+    assets_manager_unref(imm->assets_manager, req->res);
+    tile_painter_unlock();
+
+    image_manager_async_notify(req, ret);
+    image_async_req_destroy(req);
+  }
+  darray_deinit(&done);
+
+  return RET_OK;
+}
+
+static ret_t image_manager_async_on_idle(const idle_info_t* idle) {
+  image_manager_async_t* async = (image_manager_async_t*)(idle->ctx);
+
+  tk_mutex_lock(async->mutex);
+  async->drain_queued = FALSE;
+  tk_mutex_unlock(async->mutex);
+
+  if (async->imm != NULL) {
+    image_manager_async_drain(async);
+  }
+  image_manager_async_unref(async);
+
+  return RET_REMOVE;
+}
+
+static image_async_req_t* image_manager_async_find(image_manager_async_t* async,
+                                                   const char* name) {
+  uint32_t i = 0;
+
+  for (i = 0; i < async->requests.size; i++) {
+    image_async_req_t* iter = (image_async_req_t*)darray_get(&(async->requests), i);
+    if (iter->state != IMAGE_ASYNC_DONE && tk_str_eq(iter->name, name)) {
+      return iter;
+    }
+  }
+
+  return NULL;
+}
+
+static ret_t image_manager_async_deinit(image_manager_t* imm) {
+  uint32_t i = 0;
+  image_manager_async_t* async = imm->async;
+
+  if (async == NULL) {
+    return RET_OK;
+  }
+
+  tk_mutex_lock(async->mutex);
+  async->quit = TRUE;
+  tk_mutex_unlock(async->mutex);
+
+  /*等待正在解码的线程退出*/
+  action_thread_pool_destroy(async->pool);
+  async->pool = NULL;
+
+  for (i = 0; i < async->requests.size; i++) {
+    image_async_req_t* req = (image_async_req_t*)darray_get(&(async->requests), i);
+    if (req->state == IMAGE_ASYNC_DONE && req->ret == RET_OK) {
+      image_manager_free_decoded(&(req->image), req->map);
+    }
+    assets_manager_unref(imm->assets_manager, req->res);
+    image_async_req_destroy(req);
+  }
+  darray_clear(&(async->requests));
+
+  async->imm = NULL;
+  imm->async = NULL;
+  image_manager_async_unref(async);
+
+  return RET_OK;
+}
+
+ret_t image_manager_get_bitmap_async(image_manager_t* imm, const char* name, bitmap_t* image,
+                                     int32_t priority, event_func_t on_done, void* ctx) {
+  ret_t ret = RET_OK;
+  image_async_req_t* req = NULL;
+  const asset_info_t* res = NULL;
+  image_manager_async_t* async = NULL;
+  return_value_if_fail(imm != NULL && name != NULL && image != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(on_done != NULL, RET_BAD_PARAMS);
+
+  if (strstr(name, TK_LOCALE_MAGIC) != NULL || strchr(name, '$') != NULL ||
+      strchr(name, ',') != NULL) {
+    return image_manager_get_bitmap(imm, name, image);
+  }
+
+  memset(image, 0x00, sizeof(bitmap_t));
+  tile_painter_lock();
+  ret = image_manager_lookup(imm, name, image);
+  tile_painter_unlock();
+  if (ret == RET_OK) {
+    return RET_OK;
+  }
+
+  if (imm->async == NULL) {
+    imm->async = image_manager_async_create(imm);
+    if (imm->async == NULL) {
+      return image_manager_get_bitmap(imm, name, image);
+    }
+  }
+  async = imm->async;
+
+  tk_mutex_lock(async->mutex);
+  req = image_manager_async_find(async, name);
+  tk_mutex_unlock(async->mutex);
+
+  if (req == NULL) {
+    res = assets_manager_ref(imm->assets_manager, ASSET_TYPE_IMAGE, name);
+    if (res == NULL || res->subtype == ASSET_TYPE_IMAGE_RAW ||
+        res->subtype == ASSET_TYPE_IMAGE_BSVG) {
+      /*位图不需要解码，矢量图不在这里加载*/
+      if (res != NULL) {
+        assets_manager_unref(imm->assets_manager, res);
+      }
+      return image_manager_get_bitmap(imm, name, image);
+    }
+
+    tk_mutex_lock(async->mutex);
+    req = image_async_req_create(name, res, priority, async->seq++);
+    if (req != NULL) {
+      image_manager_get_variant(imm, req->variant);
+    }
+    if (req == NULL || darray_push(&(async->requests), req) != RET_OK) {
+      tk_mutex_unlock(async->mutex);
+      if (req != NULL) {
+        image_async_req_destroy(req);
+      }
+      assets_manager_unref(imm->assets_manager, res);
+      return image_manager_get_bitmap(imm, name, image);
+    }
+    imm->misses++;
+  } else {
+    tk_mutex_lock(async->mutex);
+    req->priority = tk_max(req->priority, priority);
+  }
+
+  image_manager_async_spawn(async);
+  if (async->workers == 0 && req->state == IMAGE_ASYNC_PENDING) {
+    /*没有可用的线程，同步解码*/
+    darray_remove(&(async->requests), req);
+    tk_mutex_unlock(async->mutex);
+    image_manager_async_notify(req, RET_FAIL);
+    assets_manager_unref(imm->assets_manager, req->res);
+    image_async_req_destroy(req);
+
+    return image_manager_get_bitmap(imm, name, image);
+  }
+
+  /*之前的解码结果没能通知到UI线程*/
+  image_manager_async_queue_drain(async);
+  tk_mutex_unlock(async->mutex);
+
+  image_async_req_add_waiter(req, on_done, ctx);
+
+  return RET_BUSY;
+}
+
+ret_t image_manager_cancel_async_if(image_manager_t* imm, image_manager_async_filter_t filter,
+                                    void* ctx) {
+  uint32_t i = 0;
+  uint32_t k = 0;
+  image_manager_async_t* async = NULL;
+  return_value_if_fail(imm != NULL && filter != NULL, RET_BAD_PARAMS);
+
+  async = imm->async;
+  if (async == NULL) {
+    return RET_OK;
+  }
+
+  tk_mutex_lock(async->mutex);
+  for (i = 0; i < async->requests.size;) {
+    image_async_req_t* req = (image_async_req_t*)darray_get(&(async->requests), i);
+
+    for (k = 0; k < req->waiters.size;) {
+      image_async_waiter_t* waiter = (image_async_waiter_t*)darray_get(&(req->waiters), k);
+      if (filter(ctx, waiter->on_done, waiter->ctx)) {
+        darray_remove_index(&(req->waiters), k);
+      } else {
+        k++;
+      }
+    }
+
+    if (req->waiters.size == 0 && req->state == IMAGE_ASYNC_PENDING) {
+      /*正在解码和已经解码的图片仍然加入缓存*/
+      darray_remove_index(&(async->requests), i);
+      assets_manager_unref(imm->assets_manager, req->res);
+      image_async_req_destroy(req);
+    } else {
+      i++;
+    }
+  }
+  tk_mutex_unlock(async->mutex);
+
+  return RET_OK;
+}
+
+typedef struct _imm_cancel_info_t {
+  event_func_t on_done;
+  void* ctx;
+} imm_cancel_info_t;
+
+static bool_t image_manager_cancel_match(void* ctx, event_func_t on_done, void* on_done_ctx) {
+  imm_cancel_info_t* info = (imm_cancel_info_t*)ctx;
+
+  return (info->on_done == NULL || info->on_done == on_done) && info->ctx == on_done_ctx;
+}
+
+ret_t image_manager_cancel_async(image_manager_t* imm, event_func_t on_done, void* ctx) {
+  imm_cancel_info_t info = {on_done, ctx};
+
+  return image_manager_cancel_async_if(imm, image_manager_cancel_match, &info);
+}
+
+ret_t image_manager_dispatch_async(image_manager_t* imm, bool_t wait) {
+  bool_t busy = FALSE;
+  image_manager_async_t* async = NULL;
+  return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
+
+  async = imm->async;
+  if (async == NULL) {
+    return RET_OK;
+  }
+
+  do {
+    image_manager_async_drain(async);
+
+    tk_mutex_lock(async->mutex);
+    busy = async->requests.size > 0;
+    tk_mutex_unlock(async->mutex);
+
+    if (busy && wait) {
+      sleep_ms(1);
+    }
+  } while (busy && wait);
+
+  return RET_OK;
+}
+
+ret_t image_manager_set_disk_cache(image_manager_t* imm, image_disk_cache_t* cache) {
+  return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
+#ifdef WITH_IMAGE_DISK_CACHE
+  if (imm->disk_cache == cache) {
+    return RET_OK;
+  }
+
+  /*解码线程会访问disk_cache，等它们空闲后再替换*/
+  image_manager_dispatch_async(imm, TRUE);
+  if (imm->disk_cache != NULL) {
+    image_disk_cache_destroy(imm->disk_cache);
+  }
+  imm->disk_cache = cache;
+
+  return RET_OK;
+#else
+  (void)cache;
+  return RET_NOT_IMPL;
+#endif /*WITH_IMAGE_DISK_CACHE*/
+}
+
 ret_t image_manager_preload(image_manager_t* imm, const char* name) {
   bitmap_t image;
   return_value_if_fail(imm != NULL && name != NULL && *name, RET_BAD_PARAMS);
@@ -341,47 +1159,58 @@ ret_t image_manager_set_assets_manager(image_manager_t* imm, assets_manager_t* a
 }
 
 bool_t image_manager_has_bitmap(image_manager_t* imm, bitmap_t* image) {
-  bitmap_cache_t b;
   return_value_if_fail(imm != NULL && image != NULL, RET_BAD_PARAMS);
 
-  b.image.buffer = image->buffer;
-
-  if (darray_find_ex(&(imm->images), (tk_compare_t)bitmap_cache_cmp_data, &b) == NULL) {
-    return FALSE;
-  } else {
-    return TRUE;
-  }
+  return image_manager_find_by_buffer(imm, image->buffer) != NULL;
 }
 
 ret_t image_manager_unload_unused(image_manager_t* imm, uint32_t time_delta_s) {
-  bitmap_cache_t b;
-  b.last_access_time = time_now_s() - time_delta_s;
+  uint64_t last_access_time = time_now_s() - time_delta_s;
   return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
 
-  imm->images.compare = (tk_compare_t)bitmap_cache_cmp_time;
-  return darray_remove_all(&(imm->images), NULL, &b);
+  while (imm->lru_tail != NULL && imm->lru_tail->last_access_time <= last_access_time) {
+    image_manager_remove_cache(imm, imm->lru_tail);
+  }
+
+  return RET_OK;
 }
 
 ret_t image_manager_unload_all(image_manager_t* imm) {
   return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
 
+  imm->lru_head = NULL;
+  imm->lru_tail = NULL;
+  if (imm->index != NULL) {
+    memset(imm->index, 0x00, imm->index_capacity * sizeof(bitmap_cache_t*));
+  }
+
   return darray_clear(&(imm->images));
 }
 
 ret_t image_manager_unload_bitmap(image_manager_t* imm, bitmap_t* image) {
-  bitmap_cache_t b;
+  int32_t i = 0;
   return_value_if_fail(imm != NULL && image != NULL, RET_BAD_PARAMS);
 
-  b.image.buffer = image->buffer;
-  imm->images.compare = (tk_compare_t)bitmap_cache_cmp_data;
+  /*倒序遍历，移除时填补空位的元素已经检查过*/
+  for (i = (int32_t)(imm->images.size) - 1; i >= 0; i--) {
+    bitmap_cache_t* iter = (bitmap_cache_t*)darray_get(&(imm->images), i);
+    if (iter->image.buffer == image->buffer) {
+      image_manager_remove_cache(imm, iter);
+    }
+  }
 
-  return darray_remove_all(&(imm->images), NULL, &b);
+  return RET_OK;
 }
 
 ret_t image_manager_unload_bitmap_by_name(image_manager_t* imm, const char* name) {
+  bitmap_cache_t* iter = NULL;
   return_value_if_fail(imm != NULL && name != NULL, RET_BAD_PARAMS);
 
-  return darray_remove_all(&(imm->images), (tk_compare_t)bitmap_cache_cmp_with_name, (void*)name);
+  while ((iter = image_manager_index_find(imm, name)) != NULL) {
+    image_manager_remove_cache(imm, iter);
+  }
+
+  return RET_OK;
 }
 
 ret_t image_manager_dump(image_manager_t* im, str_t* result) {
@@ -390,18 +1219,32 @@ ret_t image_manager_dump(image_manager_t* im, str_t* result) {
 
   for (i = 0; i < im->images.size; i++) {
     bitmap_cache_t* cache = (bitmap_cache_t*)darray_get(&(im->images), i);
-    str_append_format(result, 1024, "%s: w=%d h=%d format=%d\n", cache->name, cache->image.w,
-                      cache->image.h, cache->image.format);
+    str_append_format(result, 1024, "%s: w=%d h=%d format=%d bytes=%u hits=%u decode_us=%u\n",
+                      cache->name, cache->image.w, cache->image.h, cache->image.format,
+                      cache->mem_size, cache->access_count - 1, cache->decode_time);
   }
 
+  str_append_format(result, 1024,
+                    "total: nr=%u mem=%u reserved=%u max_mem=%u hits=%u misses=%u evictions=%u\n",
+                    im->images.size, im->mem_size_of_cached_images, im->reserved_mem_size,
+                    im->max_mem_size_of_cached_images, im->hits, im->misses, im->evictions);
+
   return RET_OK;
 }
 
 ret_t image_manager_deinit(image_manager_t* imm) {
   return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
 
+  image_manager_async_deinit(imm);
+#ifdef WITH_IMAGE_DISK_CACHE
+  if (imm->disk_cache != NULL) {
+    image_disk_cache_destroy(imm->disk_cache);
+    imm->disk_cache = NULL;
+  }
+#endif /*WITH_IMAGE_DISK_CACHE*/
   TKMEM_FREE(imm->name);
   darray_deinit(&(imm->images));
+  TKMEM_FREE(imm->index);
 
   return RET_OK;
 }
@@ -423,6 +1266,14 @@ ret_t image_manager_set_max_mem_size_of_cached_images(image_manager_t* imm, uint
   return RET_OK;
 }
 
+ret_t image_manager_set_reserved_mem_size(image_manager_t* imm, uint32_t mem_size) {
+  return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
+
+  imm->reserved_mem_size = mem_size;
+
+  return image_manager_clear_cache(imm);
+}
+
 ret_t image_manager_set_fallback_get_bitmap(image_manager_t* imm,
                                             image_manager_get_bitmap_t fallback_get_bitmap,
                                             void* ctx) {
@@ -41,6 +41,11 @@ typedef struct _bitmap_header_t {
 } bitmap_header_t;
 
 typedef ret_t (*image_manager_get_bitmap_t)(void* ctx, const char* name, bitmap_t* image);
+typedef bool_t (*image_manager_async_filter_t)(void* ctx, event_func_t on_done, void* on_done_ctx);
+
+typedef struct _bitmap_cache_t bitmap_cache_t;
+typedef struct _image_manager_async_t image_manager_async_t;
+typedef struct _image_disk_cache_t image_disk_cache_t;
 
 /**
  * @class image_manager_t
@@ -67,9 +72,26 @@ struct _image_manager_t {
   int32_t refcount;
   uint32_t mem_size_of_cached_images;
   uint32_t max_mem_size_of_cached_images;
+  /*其它缓存(如控件的位图缓存)占用的内存，和图片共用max_mem_size_of_cached_images*/
+  uint32_t reserved_mem_size;
 
   image_manager_get_bitmap_t fallback_get_bitmap;
   void* fallback_get_bitmap_ctx;
+
+  /*按名称索引(开放寻址)*/
+  bitmap_cache_t** index;
+  uint32_t index_capacity;
+  /*LRU链表，头部是最近使用的，淘汰从尾部开始*/
+  bitmap_cache_t* lru_head;
+  bitmap_cache_t* lru_tail;
+  /*统计信息*/
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  /*异步解码(第一次调用image_manager_get_bitmap_async时创建)*/
+  image_manager_async_t* async;
+  /*解码后图片的磁盘缓存*/
+  image_disk_cache_t* disk_cache;
 };
 
 /**
@@ -119,6 +141,19 @@ image_manager_t* image_manager_init(image_manager_t* imm);
  */
 ret_t image_manager_set_max_mem_size_of_cached_images(image_manager_t* imm, uint32_t max_mem_size);
 
+/**
+ * @method image_manager_set_reserved_mem_size
+ * 设置其它缓存(如控件的位图缓存)占用的内存。
+ *
+ * > 缓存的图片和其它缓存共用max\_mem\_size\_of\_cached\_images，超过上限时淘汰最久没有使用的图片。
+ *
+ * @param {image_manager_t*} imm 图片管理器对象。
+ * @param {uint32_t} mem_size 其它缓存占用的内存(字节数)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_manager_set_reserved_mem_size(image_manager_t* imm, uint32_t mem_size);
+
 /**
  * @method image_manager_get_bitmap
  * 获取指定的图片。
@@ -133,6 +168,85 @@ ret_t image_manager_set_max_mem_size_of_cached_images(image_manager_t* imm, uint
  */
 ret_t image_manager_get_bitmap(image_manager_t* imm, const char* name, bitmap_t* image);
 
+/**
+ * @method image_manager_get_bitmap_async
+ * 异步获取指定的图片。
+ *
+ * 图片已经在缓存中时，直接返回RET_OK。否则在后台线程(action\_thread\_pool)中解码并返回RET_BUSY，
+ * 解码完成后加入缓存，并在UI线程中调用on\_done(事件为done\_event\_t，result为解码的结果)，
+ * 此时再调用image\_manager\_get\_bitmap即可拿到图片。
+ *
+ * * 同一图片的多个请求合并为一个，优先级取最大值。优先级高的请求先解码，优先级相同时先请求的先解码。
+ * * 后台线程数由TK\_IMAGE\_ASYNC\_THREADS指定。
+ * * 位图(raw)、本地化图片(带$)、表达式以及无法创建线程时，同步加载，返回值与image\_manager\_get\_bitmap相同。
+ *
+ * @param {image_manager_t*} imm 图片管理器对象。
+ * @param {const char*} name 图片名称。
+ * @param {bitmap_t*} image 用于返回图片。
+ * @param {int32_t} priority 优先级(越大越优先)。
+ * @param {event_func_t} on_done 解码完成的回调函数。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，RET_BUSY表示正在解码，否则表示失败。
+ */
+ret_t image_manager_get_bitmap_async(image_manager_t* imm, const char* name, bitmap_t* image,
+                                     int32_t priority, event_func_t on_done, void* ctx);
+
+/**
+ * @method image_manager_cancel_async
+ * 取消异步获取图片的请求。
+ *
+ * > 还没有开始解码的图片不再解码，正在解码的图片解码完成后仍然加入缓存，但不再调用回调函数。
+ *
+ * @param {image_manager_t*} imm 图片管理器对象。
+ * @param {event_func_t} on_done 回调函数(为NULL时匹配任意回调函数)。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_manager_cancel_async(image_manager_t* imm, event_func_t on_done, void* ctx);
+
+/**
+ * @method image_manager_cancel_async_if
+ * 取消满足条件的异步获取图片的请求。
+ * @param {image_manager_t*} imm 图片管理器对象。
+ * @param {image_manager_async_filter_t} filter 过滤函数，返回TRUE表示取消。
+ * @param {void*} ctx 过滤函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_manager_cancel_async_if(image_manager_t* imm, image_manager_async_filter_t filter,
+                                    void* ctx);
+
+/**
+ * @method image_manager_dispatch_async
+ * 把已经解码完成的图片加入缓存，并调用回调函数。
+ *
+ * > 解码完成后会自动在UI线程中调用本函数，一般不需要直接调用。
+ *
+ * @param {image_manager_t*} imm 图片管理器对象。
+ * @param {bool_t} wait 是否等待全部请求完成。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_manager_dispatch_async(image_manager_t* imm, bool_t wait);
+
+/**
+ * @method image_manager_set_disk_cache
+ * 设置解码后图片的磁盘缓存。
+ *
+ * 解码图片之前先从磁盘缓存中加载，没有命中时解码并保存到磁盘缓存中。
+ *
+ * > 图片管理器负责销毁cache(设置新的cache或者析构图片管理器时)。
+ * > 需要定义WITH\_IMAGE\_DISK\_CACHE，否则返回RET\_NOT\_IMPL。
+ *
+ * @param {image_manager_t*} imm 图片管理器对象。
+ * @param {image_disk_cache_t*} cache 磁盘缓存对象(为NULL时取消磁盘缓存)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_manager_set_disk_cache(image_manager_t* imm, image_disk_cache_t* cache);
+
 /**
  * @method image_manager_set_fallback_get_bitmap
  * 设置一个函数，该函数在找不到图片时加载后补图片。
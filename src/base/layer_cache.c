@@ -0,0 +1,316 @@
+﻿/**
+ * File:   layer_cache.c
+ * Author: AWTK Develop Team
+ * Brief:  cache widget subtrees as offscreen bitmaps
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "base/layer_cache.h"
+#include "base/display_list.h"
+#include "base/image_manager.h"
+#include "base/canvas_offline.h"
+
+typedef struct _layer_cache_item_t {
+  widget_t* widget;
+  canvas_t* canvas;
+  uint32_t mem_size;
+  uint32_t last_used;
+  uint32_t hits;
+  uint32_t misses;
+  bool_t dirty;
+  bool_t rendering;
+} layer_cache_item_t;
+
+static layer_cache_t* s_layer_cache = NULL;
+
+static ret_t layer_cache_item_destroy(layer_cache_item_t* item) {
+  if (item->canvas != NULL) {
+    canvas_offline_destroy(item->canvas);
+  }
+  TKMEM_FREE(item);
+
+  return RET_OK;
+}
+
+static int layer_cache_item_compare(const void* a, const void* b) {
+  const layer_cache_item_t* item = (const layer_cache_item_t*)a;
+
+  return item->widget == (const widget_t*)b ? 0 : -1;
+}
+
+static layer_cache_item_t* layer_cache_find(layer_cache_t* cache, widget_t* widget) {
+  return (layer_cache_item_t*)darray_find(&(cache->items), widget);
+}
+
+static ret_t layer_cache_update_reserved(layer_cache_t* cache) {
+  image_manager_t* imm = image_manager();
+
+  if (imm != NULL) {
+    image_manager_set_reserved_mem_size(imm, cache->mem_size);
+  }
+
+  return RET_OK;
+}
+
+static ret_t layer_cache_release(layer_cache_t* cache, layer_cache_item_t* item) {
+  if (item->canvas != NULL) {
+    canvas_offline_destroy(item->canvas);
+    item->canvas = NULL;
+    cache->mem_size -= item->mem_size;
+    item->mem_size = 0;
+    layer_cache_update_reserved(cache);
+  }
+  item->dirty = TRUE;
+
+  return RET_OK;
+}
+
+/*位图缓存自身超出上限时，淘汰最久没有使用的位图*/
+static ret_t layer_cache_make_room(layer_cache_t* cache, uint32_t mem_size) {
+  uint32_t i = 0;
+  image_manager_t* imm = image_manager();
+  uint32_t max_mem_size = imm != NULL ? imm->max_mem_size_of_cached_images : 0;
+
+  if (max_mem_size == 0) {
+    return RET_OK;
+  }
+
+  if (mem_size > max_mem_size) {
+    return RET_FAIL;
+  }
+
+  while (cache->mem_size + mem_size > max_mem_size) {
+    layer_cache_item_t* oldest = NULL;
+
+    for (i = 0; i < cache->items.size; i++) {
+      layer_cache_item_t* iter = (layer_cache_item_t*)darray_get(&(cache->items), i);
+      if (iter->canvas != NULL && !iter->rendering &&
+          (oldest == NULL || iter->last_used < oldest->last_used)) {
+        oldest = iter;
+      }
+    }
+
+    if (oldest == NULL) {
+      return RET_FAIL;
+    }
+
+    layer_cache_release(cache, oldest);
+    cache->evictions++;
+  }
+
+  return RET_OK;
+}
+
+static ret_t layer_cache_prepare(layer_cache_t* cache, layer_cache_item_t* item) {
+  bitmap_t* bitmap = NULL;
+  widget_t* widget = item->widget;
+  bitmap_format_t format = BITMAP_FMT_BGRA8888;
+  uint32_t mem_size = widget->w * widget->h * 4;
+
+#if defined(WITH_BITMAP_RGBA) || defined(WITH_GPU)
+  format = BITMAP_FMT_RGBA8888;
+#endif /*WITH_BITMAP_RGBA || WITH_GPU*/
+
+  if (item->canvas != NULL) {
+    bitmap = canvas_offline_get_bitmap(item->canvas);
+    if (bitmap->w == widget->w && bitmap->h == widget->h) {
+      return RET_OK;
+    }
+    layer_cache_release(cache, item);
+  }
+
+  if (layer_cache_make_room(cache, mem_size) != RET_OK) {
+    return RET_FAIL;
+  }
+
+  item->canvas = canvas_offline_create_by_widget(widget, format);
+  return_value_if_fail(item->canvas != NULL, RET_FAIL);
+
+  bitmap = canvas_offline_get_bitmap(item->canvas);
+  item->mem_size = bitmap_get_mem_size(bitmap);
+  item->dirty = TRUE;
+  cache->mem_size += item->mem_size;
+  layer_cache_update_reserved(cache);
+
+  return RET_OK;
+}
+
+static ret_t layer_cache_render(layer_cache_t* cache, layer_cache_item_t* item) {
+  canvas_t* c = item->canvas;
+  widget_t* widget = item->widget;
+
+  canvas_offline_begin_draw(c);
+  canvas_offline_clear_canvas(c);
+  canvas_translate(c, -widget->x, -widget->y);
+
+  /*绘制期间子控件调用widget_invalidate会再次设置dirty，下一帧重新绘制*/
+  item->dirty = FALSE;
+  item->rendering = TRUE;
+  widget_paint(widget, c);
+  item->rendering = FALSE;
+
+  canvas_untranslate(c, -widget->x, -widget->y);
+  canvas_offline_end_draw(c);
+
+  return RET_OK;
+}
+
+static ret_t layer_cache_draw_debug_info(layer_cache_item_t* item, canvas_t* c, bool_t hit) {
+  char info[32];
+  widget_t* widget = item->widget;
+  color_t color = hit ? color_init(0, 0xc0, 0, 0xff) : color_init(0xff, 0, 0, 0xff);
+
+  tk_snprintf(info, sizeof(info), "H:%u M:%u", item->hits, item->misses);
+  canvas_set_stroke_color(c, color);
+  canvas_stroke_rect(c, widget->x, widget->y, widget->w, widget->h);
+  canvas_set_text_color(c, color);
+  canvas_set_font(c, NULL, 12);
+  canvas_draw_utf8(c, info, widget->x + 2, widget->y + 2);
+
+  return RET_OK;
+}
+
+layer_cache_t* layer_cache(void) {
+  return s_layer_cache;
+}
+
+ret_t layer_cache_set(layer_cache_t* cache) {
+  s_layer_cache = cache;
+
+  return RET_OK;
+}
+
+layer_cache_t* layer_cache_create(void) {
+  layer_cache_t* cache = TKMEM_ZALLOC(layer_cache_t);
+  return_value_if_fail(cache != NULL, NULL);
+
+  darray_init(&(cache->items), 4, (tk_destroy_t)layer_cache_item_destroy,
+              layer_cache_item_compare);
+
+  return cache;
+}
+
+ret_t layer_cache_set_debug(layer_cache_t* cache, bool_t debug) {
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  cache->debug = debug;
+
+  return RET_OK;
+}
+
+ret_t layer_cache_paint(layer_cache_t* cache, widget_t* widget, canvas_t* c) {
+  rect_t src;
+  rect_t dst;
+  bool_t hit = FALSE;
+  bitmap_t* bitmap = NULL;
+  layer_cache_item_t* item = NULL;
+  return_value_if_fail(cache != NULL && widget != NULL && c != NULL, RET_BAD_PARAMS);
+
+  /*位图不在image_manager中，不能被录制到绘制命令列表*/
+  if (display_list_is_recording(c) || widget->w <= 0 || widget->h <= 0) {
+    return RET_NOT_IMPL;
+  }
+
+  item = layer_cache_find(cache, widget);
+  if (item == NULL) {
+    item = TKMEM_ZALLOC(layer_cache_item_t);
+    return_value_if_fail(item != NULL, RET_NOT_IMPL);
+
+    item->dirty = TRUE;
+    item->widget = widget;
+    if (darray_push(&(cache->items), item) != RET_OK) {
+      TKMEM_FREE(item);
+      return RET_NOT_IMPL;
+    }
+  }
+
+  if (item->rendering || layer_cache_prepare(cache, item) != RET_OK) {
+    return RET_NOT_IMPL;
+  }
+
+  if (item->dirty) {
+    item->misses++;
+    cache->misses++;
+    layer_cache_render(cache, item);
+  } else {
+    hit = TRUE;
+    item->hits++;
+    cache->hits++;
+  }
+  item->last_used = ++cache->clock;
+
+  bitmap = canvas_offline_get_bitmap(item->canvas);
+  src = rect_init(0, 0, bitmap->w, bitmap->h);
+  dst = rect_init(widget->x, widget->y, widget->w, widget->h);
+  canvas_draw_image(c, bitmap, &src, &dst);
+
+  if (cache->debug) {
+    layer_cache_draw_debug_info(item, c, hit);
+  }
+
+  return RET_OK;
+}
+
+ret_t layer_cache_invalidate(layer_cache_t* cache, widget_t* widget) {
+  layer_cache_item_t* item = NULL;
+  return_value_if_fail(cache != NULL && widget != NULL, RET_BAD_PARAMS);
+
+  item = layer_cache_find(cache, widget);
+  if (item != NULL) {
+    item->dirty = TRUE;
+  }
+
+  return RET_OK;
+}
+
+ret_t layer_cache_remove(layer_cache_t* cache, widget_t* widget) {
+  layer_cache_item_t* item = NULL;
+  return_value_if_fail(cache != NULL && widget != NULL, RET_BAD_PARAMS);
+
+  item = layer_cache_find(cache, widget);
+  if (item == NULL) {
+    return RET_NOT_FOUND;
+  }
+
+  cache->mem_size -= item->mem_size;
+  darray_remove(&(cache->items), widget);
+  layer_cache_update_reserved(cache);
+
+  return RET_OK;
+}
+
+ret_t layer_cache_clear(layer_cache_t* cache) {
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  darray_clear(&(cache->items));
+  cache->mem_size = 0;
+  layer_cache_update_reserved(cache);
+
+  return RET_OK;
+}
+
+ret_t layer_cache_destroy(layer_cache_t* cache) {
+  return_value_if_fail(cache != NULL, RET_BAD_PARAMS);
+
+  layer_cache_clear(cache);
+  darray_deinit(&(cache->items));
+  TKMEM_FREE(cache);
+
+  return RET_OK;
+}
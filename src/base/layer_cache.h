@@ -0,0 +1,177 @@
+﻿/**
+ * File:   layer_cache.h
+ * Author: AWTK Develop Team
+ * Brief:  cache widget subtrees as offscreen bitmaps
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_LAYER_CACHE_H
+#define TK_LAYER_CACHE_H
+
+#include "tkc/darray.h"
+#include "base/widget.h"
+#include "base/canvas.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class layer_cache_t
+ * 控件位图缓存。
+ *
+ * 设置了cache\_as\_bitmap属性的控件，第一次绘制时把自己和子控件绘制到离线画布(canvas\_offline)上，
+ * 之后直接绘制缓存的位图，直到自己或者子控件调用widget\_invalidate。
+ * 适用于内容复杂但很少变化的控件，如刻度很多的仪表、包含rich\_text的面板等。
+ *
+ * * 缓存的位图和image\_manager缓存的图片共用max\_mem\_size\_of\_cached\_images。
+ *   位图缓存自身超出上限时淘汰最久没有使用的位图，否则由image\_manager淘汰图片。
+ * * 命中缓存时不分发控件的绘制事件。
+ * * 打开debug后，在缓存的控件上画出边框和命中/未命中次数(绿色表示命中，红色表示重新绘制)。
+ *
+ * ```xml
+ * <view cache_as_bitmap="true" x="0" y="0" w="200" h="200">
+ * ```
+ */
+typedef struct _layer_cache_t {
+  /**
+   * @property {uint32_t} hits
+   * @annotation ["readable"]
+   * 命中的次数。
+   */
+  uint32_t hits;
+  /**
+   * @property {uint32_t} misses
+   * @annotation ["readable"]
+   * 未命中(需要重新绘制)的次数。
+   */
+  uint32_t misses;
+  /**
+   * @property {uint32_t} evictions
+   * @annotation ["readable"]
+   * 因为内存超出上限而淘汰的次数。
+   */
+  uint32_t evictions;
+  /**
+   * @property {uint32_t} mem_size
+   * @annotation ["readable"]
+   * 缓存的位图占用的内存。
+   */
+  uint32_t mem_size;
+  /**
+   * @property {bool_t} debug
+   * @annotation ["readable"]
+   * 是否显示调试信息。
+   */
+  bool_t debug;
+
+  /*private*/
+  darray_t items;
+  uint32_t clock;
+} layer_cache_t;
+
+/**
+ * @method layer_cache
+ * 获取缺省的layer_cache对象。
+ * @annotation ["constructor"]
+ *
+ * @return {layer_cache_t*} 返回layer_cache对象。
+ */
+layer_cache_t* layer_cache(void);
+
+/**
+ * @method layer_cache_set
+ * 设置缺省的layer_cache对象。
+ * @param {layer_cache_t*} cache layer_cache对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t layer_cache_set(layer_cache_t* cache);
+
+/**
+ * @method layer_cache_create
+ * @annotation ["constructor"]
+ * 创建layer_cache对象。
+ *
+ * @return {layer_cache_t*} 返回layer_cache对象。
+ */
+layer_cache_t* layer_cache_create(void);
+
+/**
+ * @method layer_cache_set_debug
+ * 设置是否显示调试信息。
+ * @param {layer_cache_t*} cache layer_cache对象。
+ * @param {bool_t} debug 是否显示调试信息。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t layer_cache_set_debug(layer_cache_t* cache, bool_t debug);
+
+/**
+ * @method layer_cache_paint
+ * 通过缓存的位图绘制控件。
+ *
+ * > 不能使用缓存时(如正在录制绘制命令、正在绘制缓存本身或者创建离线画布失败)返回RET_NOT_IMPL，
+ * > 调用者需要自己绘制。
+ *
+ * @param {layer_cache_t*} cache layer_cache对象。
+ * @param {widget_t*} widget 控件对象。
+ * @param {canvas_t*} c 画布对象。
+ *
+ * @return {ret_t} 返回RET_OK表示已经绘制，RET_NOT_IMPL表示没有绘制。
+ */
+ret_t layer_cache_paint(layer_cache_t* cache, widget_t* widget, canvas_t* c);
+
+/**
+ * @method layer_cache_invalidate
+ * 标识控件的缓存需要重新绘制。
+ * @param {layer_cache_t*} cache layer_cache对象。
+ * @param {widget_t*} widget 控件对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t layer_cache_invalidate(layer_cache_t* cache, widget_t* widget);
+
+/**
+ * @method layer_cache_remove
+ * 释放控件的缓存。
+ * @param {layer_cache_t*} cache layer_cache对象。
+ * @param {widget_t*} widget 控件对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t layer_cache_remove(layer_cache_t* cache, widget_t* widget);
+
+/**
+ * @method layer_cache_clear
+ * 释放全部缓存。
+ * @param {layer_cache_t*} cache layer_cache对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t layer_cache_clear(layer_cache_t* cache);
+
+/**
+ * @method layer_cache_destroy
+ * 销毁layer_cache对象。
+ * @param {layer_cache_t*} cache layer_cache对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t layer_cache_destroy(layer_cache_t* cache);
+
+END_C_DECLS
+
+#endif /*TK_LAYER_CACHE_H*/
@@ -72,9 +72,15 @@ ret_t main_loop_set(main_loop_t* loop) {
 }
 
 ret_t main_loop_queue_event(main_loop_t* l, const event_queue_req_t* e) {
+  ret_t ret = RET_OK;
   return_value_if_fail(l != NULL && l->queue_event != NULL && e != NULL, RET_BAD_PARAMS);
 
-  return l->queue_event(l, e);
+  ret = l->queue_event(l, e);
+  if (ret == RET_OK && l->tickless) {
+    main_loop_wakeup(l);
+  }
+
+  return ret;
 }
 
 ret_t main_loop_recv_event(main_loop_t* l, event_queue_req_t* r) {
@@ -85,13 +91,72 @@ ret_t main_loop_recv_event(main_loop_t* l, event_queue_req_t* r) {
 
 #include "base/idle.h"
 #include "base/timer.h"
+#include "base/native_window.h"
 #include "base/window_manager.h"
 
-ret_t main_loop_sleep_default(main_loop_t* l) {
+static uint32_t main_loop_get_least_sleep_time(main_loop_t* l) {
   uint64_t now = time_now_ms();
   uint32_t gap = now - l->last_loop_time;
+
+  return gap > TK_MAX_SLEEP_TIME ? 0 : (TK_MAX_SLEEP_TIME - gap);
+}
+
+uint32_t main_loop_get_next_wakeup_time(main_loop_t* l) {
+  uint32_t t = TK_MAX_TICKLESS_SLEEP_TIME;
+  event_source_manager_t* m = NULL;
+  return_value_if_fail(l != NULL, 0);
+
+  m = main_loop_get_event_source_manager(l);
+  if (m != NULL) {
+    t = tk_min(t, event_source_manager_get_next_wakeup_time(m));
+  } else {
+    timer_manager_t* tm = timer_manager();
+
+    if (tm != NULL) {
+      int64_t timeout = timer_manager_next_time(tm) - timer_manager_get_time(tm);
+      t = tk_min(t, timeout > 0 ? timeout : 0);
+    }
+    if (idle_manager() != NULL && idle_manager_count(idle_manager()) > 0) {
+      t = 0;
+    }
+  }
+
+  t = tk_min(t, l->curr_expected_sleep_time);
+  if (l->wm != NULL) {
+    native_window_t* nw =
+        (native_window_t*)widget_get_prop_pointer(l->wm, WIDGET_PROP_NATIVE_WINDOW);
+
+    if (window_manager_is_animating(l->wm) || (nw != NULL && nw->dirty_rects.nr > 0)) {
+      t = tk_min(t, TK_MAX_SLEEP_TIME);
+    }
+  }
+
+  /*idle或者已经到期的定时器，按原来的频率执行，避免忙等*/
+  if (t == 0) {
+    t = main_loop_get_least_sleep_time(l);
+  }
+
+  return t;
+}
+
+static ret_t main_loop_sleep_tickless(main_loop_t* l) {
+  uint32_t sleep_time = main_loop_get_next_wakeup_time(l);
+
+  if (sleep_time > 0) {
+    l->wait(l, sleep_time);
+  }
+  l->last_loop_time = time_now_ms();
+
+  return RET_OK;
+}
+
+ret_t main_loop_sleep_default(main_loop_t* l) {
   uint32_t sleep_time = TK_MAX_SLEEP_TIME;
-  int32_t least_sleep_time = gap > TK_MAX_SLEEP_TIME ? 0 : (TK_MAX_SLEEP_TIME - gap);
+  uint32_t least_sleep_time = main_loop_get_least_sleep_time(l);
+
+  if (l->tickless && l->wait != NULL) {
+    return main_loop_sleep_tickless(l);
+  }
 
   sleep_time = tk_min(least_sleep_time, sleep_time);
   sleep_time = tk_min(sleep_time, l->curr_expected_sleep_time);
@@ -103,14 +168,50 @@ ret_t main_loop_sleep_default(main_loop_t* l) {
   return RET_OK;
 }
 
+static ret_t main_loop_count_wakeup(main_loop_t* l) {
+  uint64_t now = time_now_ms();
+  uint64_t elapsed = now - l->wakeups_start_time;
+
+  l->wakeups++;
+  if (elapsed >= 1000) {
+    l->wakeups_per_second = l->wakeups_start_time > 0 ? (l->wakeups * 1000 / elapsed) : 0;
+    l->wakeups_start_time = now;
+    l->wakeups = 0;
+  }
+
+  return RET_OK;
+}
+
 ret_t main_loop_sleep(main_loop_t* l) {
+  ret_t ret = RET_OK;
   return_value_if_fail(l != NULL, RET_BAD_PARAMS);
 
   if (l->sleep != NULL) {
-    return l->sleep(l);
+    ret = l->sleep(l);
+  } else {
+    ret = main_loop_sleep_default(l);
   }
+  main_loop_count_wakeup(l);
+
+  return ret;
+}
+
+ret_t main_loop_set_tickless(main_loop_t* l, bool_t tickless) {
+  return_value_if_fail(l != NULL, RET_BAD_PARAMS);
+
+  /*先准备好资源再打开开关，其它线程看到tickless时才会唤醒*/
+  if (l->set_tickless != NULL) {
+    return_value_if_fail(l->set_tickless(l, tickless) == RET_OK, RET_FAIL);
+  }
+  l->tickless = tickless;
+
+  return RET_OK;
+}
+
+uint32_t main_loop_get_wakeups_per_second(main_loop_t* l) {
+  return_value_if_fail(l != NULL, 0);
 
-  return main_loop_sleep_default(l);
+  return l->wakeups_per_second;
 }
 
 ret_t main_loop_step(main_loop_t* l) {
@@ -39,6 +39,8 @@ typedef event_source_manager_t* (*main_loop_get_event_source_manager_t)(main_loo
 typedef ret_t (*main_loop_wakeup_t)(main_loop_t* l);
 typedef ret_t (*main_loop_step_t)(main_loop_t* l);
 typedef ret_t (*main_loop_sleep_t)(main_loop_t* l);
+typedef ret_t (*main_loop_wait_t)(main_loop_t* l, uint32_t timeout);
+typedef ret_t (*main_loop_set_tickless_t)(main_loop_t* l, bool_t tickless);
 typedef ret_t (*main_loop_destroy_t)(main_loop_t* l);
 
 /**
@@ -56,6 +58,10 @@ struct _main_loop_t {
   main_loop_queue_event_t queue_event;
   main_loop_get_event_source_manager_t get_event_source_manager;
   main_loop_destroy_t destroy;
+  /*等待输入事件或者被main_loop_wakeup唤醒，最多等待timeout毫秒(tickless模式使用)*/
+  main_loop_wait_t wait;
+  /*切换tickless模式时调用(可选)，用于创建等待和唤醒需要的资源*/
+  main_loop_set_tickless_t set_tickless;
 
   uint8_t running;
   uint8_t quit_num;
@@ -64,6 +70,11 @@ struct _main_loop_t {
   uint32_t curr_expected_sleep_time;
   uint32_t step_count;
   widget_t* wm;
+
+  bool_t tickless;
+  uint32_t wakeups;
+  uint32_t wakeups_per_second;
+  uint64_t wakeups_start_time;
 };
 
 main_loop_t* main_loop_init(int w, int h);
@@ -154,6 +165,46 @@ ret_t main_loop_destroy(main_loop_t* l);
 ret_t main_loop_step(main_loop_t* l);
 
 ret_t main_loop_sleep(main_loop_t* l);
+
+/**
+ * @method main_loop_set_tickless
+ * 设置是否启用tickless模式。
+ *
+ * tickless模式下，主循环不再按固定的频率唤醒，而是计算定时器、idle、事件源、
+ * 窗口动画和待绘制的脏矩形中最近的截止时间，然后等待输入事件直到该时间。
+ *
+ *> 需要主循环提供wait函数(SDL和没有轮询输入设备的main\_loop\_simple已经支持)，否则仍按原来的频率唤醒。
+ *> 其它线程通过main\_loop\_queue\_event发送的请求会唤醒主循环。
+ *
+ * @param {main_loop_t*} l main_loop对象。
+ * @param {bool_t} tickless 是否启用tickless模式。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t main_loop_set_tickless(main_loop_t* l, bool_t tickless);
+
+/**
+ * @method main_loop_get_next_wakeup_time
+ * 计算距离最近的截止时间(毫秒)。
+ *
+ * 考虑定时器、idle、事件源、窗口动画、窗口管理器期望的睡眠时间和待绘制的脏矩形，
+ * 不超过TK_MAX_TICKLESS_SLEEP_TIME。
+ *
+ * @param {main_loop_t*} l main_loop对象。
+ *
+ * @return {uint32_t} 返回距离最近的截止时间(毫秒)。
+ */
+uint32_t main_loop_get_next_wakeup_time(main_loop_t* l);
+
+/**
+ * @method main_loop_get_wakeups_per_second
+ * 获取最近一秒主循环被唤醒的次数，用于评估tickless模式节省的唤醒次数。
+ * @param {main_loop_t*} l main_loop对象。
+ *
+ * @return {uint32_t} 返回每秒唤醒的次数。
+ */
+uint32_t main_loop_get_wakeups_per_second(main_loop_t* l);
+
 /*event_source*/
 
 /**
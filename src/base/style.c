@@ -43,12 +43,14 @@ ret_t style_notify_widget_state_changed(style_t* s, widget_t* widget) {
   return_value_if_fail(
       s != NULL && s->vt != NULL && s->vt->notify_widget_state_changed != NULL && widget != NULL,
       RET_BAD_PARAMS);
+  style_invalidate_snapshot(s);
   return s->vt->notify_widget_state_changed(s, widget);
 }
 
 ret_t style_update_state(style_t* s, theme_t* theme, const char* widget_type,
                          const char* style_name, const char* widget_state) {
   return_value_if_fail(s != NULL && s->vt != NULL && s->vt->update_state != NULL, RET_BAD_PARAMS);
+  style_invalidate_snapshot(s);
   return s->vt->update_state(s, theme, widget_type, style_name, widget_state);
 }
 
@@ -112,7 +114,131 @@ const char* style_get_str(style_t* s, const char* name, const char* defval) {
   return s->vt->get_str(s, name, defval);
 }
 
+static const style_snapshot_t s_default_snapshot = {.valid = TRUE,
+                                                     .border = BORDER_ALL,
+                                                     .border_width = 1,
+                                                     .spacer = 2,
+                                                     .icon_at = ICON_AT_AUTO};
+
+static bool_t style_lookup_int(style_t* s, const char* name, int32_t* value) {
+  int32_t v = style_get_int(s, name, INT32_MIN);
+
+  if (v == INT32_MIN && style_get_int(s, name, INT32_MAX) == INT32_MAX) {
+    return FALSE;
+  }
+  *value = v;
+
+  return TRUE;
+}
+
+static bool_t style_lookup_color(style_t* s, const char* name, color_t* value) {
+  color_t c = style_get_color(s, name, color_init(0, 0, 0, 0));
+
+  if (c.color == 0 && style_get_color(s, name, color_init(0xff, 0xff, 0xff, 0xff)).color != 0) {
+    return FALSE;
+  }
+  *value = c;
+
+  return TRUE;
+}
+
+static ret_t style_snapshot_update(style_snapshot_t* snapshot, style_t* s) {
+  int32_t radius = 0;
+  int32_t font_size = 0;
+
+  *snapshot = s_default_snapshot;
+
+  if (style_lookup_color(s, STYLE_ID_TEXT_COLOR, &(snapshot->text_color))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_TEXT_COLOR;
+  }
+  snapshot->font_name = style_get_str(s, STYLE_ID_FONT_NAME, NULL);
+  if (style_lookup_int(s, STYLE_ID_FONT_SIZE, &font_size)) {
+    snapshot->font_size = font_size;
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_FONT_SIZE;
+  }
+  if (style_lookup_int(s, STYLE_ID_TEXT_ALIGN_H, &(snapshot->text_align_h))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_TEXT_ALIGN_H;
+  }
+  if (style_lookup_int(s, STYLE_ID_TEXT_ALIGN_V, &(snapshot->text_align_v))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_TEXT_ALIGN_V;
+  }
+
+  if (style_lookup_int(s, STYLE_ID_MARGIN, &(snapshot->margin))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_MARGIN;
+  }
+  if (style_lookup_int(s, STYLE_ID_MARGIN_LEFT, &(snapshot->margin_left))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_MARGIN_LEFT;
+  }
+  if (style_lookup_int(s, STYLE_ID_MARGIN_RIGHT, &(snapshot->margin_right))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_MARGIN_RIGHT;
+  }
+  if (style_lookup_int(s, STYLE_ID_MARGIN_TOP, &(snapshot->margin_top))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_MARGIN_TOP;
+  }
+  if (style_lookup_int(s, STYLE_ID_MARGIN_BOTTOM, &(snapshot->margin_bottom))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_MARGIN_BOTTOM;
+  }
+
+  snapshot->border_color = style_get_color(s, STYLE_ID_BORDER_COLOR, color_init(0, 0, 0, 0));
+  snapshot->border = style_get_int(s, STYLE_ID_BORDER, BORDER_ALL);
+  snapshot->border_width = style_get_int(s, STYLE_ID_BORDER_WIDTH, 1);
+  radius = style_get_int(s, STYLE_ID_ROUND_RADIUS, 0);
+  snapshot->radius_tl = style_get_int(s, STYLE_ID_ROUND_RADIUS_TOP_LEFT, radius);
+  snapshot->radius_tr = style_get_int(s, STYLE_ID_ROUND_RADIUS_TOP_RIGHT, radius);
+  snapshot->radius_bl = style_get_int(s, STYLE_ID_ROUND_RADIUS_BOTTOM_LEFT, radius);
+  snapshot->radius_br = style_get_int(s, STYLE_ID_ROUND_RADIUS_BOTTOM_RIGHT, radius);
+  snapshot->clear_bg = style_get_uint(s, STYLE_ID_CLEAR_BG, 0);
+
+  snapshot->spacer = style_get_int(s, STYLE_ID_SPACER, 2);
+  snapshot->icon_at = style_get_int(s, STYLE_ID_ICON_AT, ICON_AT_AUTO);
+  snapshot->icon = style_get_str(s, STYLE_ID_ICON, NULL);
+  snapshot->x_offset = style_get_int(s, STYLE_ID_X_OFFSET, 0);
+  snapshot->y_offset = style_get_int(s, STYLE_ID_Y_OFFSET, 0);
+
+  snapshot->bg_image = style_get_str(s, STYLE_ID_BG_IMAGE, NULL);
+  snapshot->fg_image = style_get_str(s, STYLE_ID_FG_IMAGE, NULL);
+  if (style_lookup_int(s, STYLE_ID_BG_IMAGE_DRAW_TYPE, &(snapshot->bg_image_draw_type))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_BG_IMAGE_DRAW_TYPE;
+  }
+  if (style_lookup_int(s, STYLE_ID_FG_IMAGE_DRAW_TYPE, &(snapshot->fg_image_draw_type))) {
+    snapshot->flags |= STYLE_SNAPSHOT_HAS_FG_IMAGE_DRAW_TYPE;
+  }
+
+  return RET_OK;
+}
+
+const style_snapshot_t* style_get_snapshot(style_t* s) {
+  if (s == NULL || s->vt == NULL) {
+    return &s_default_snapshot;
+  }
+
+  if (s->snapshot == NULL) {
+    s->snapshot = TKMEM_ZALLOC(style_snapshot_t);
+    return_value_if_fail(s->snapshot != NULL, &s_default_snapshot);
+  }
+
+  if (!s->snapshot->valid) {
+    style_snapshot_update(s->snapshot, s);
+  }
+
+  return s->snapshot;
+}
+
+ret_t style_invalidate_snapshot(style_t* s) {
+  return_value_if_fail(s != NULL, RET_BAD_PARAMS);
+
+  if (s->snapshot != NULL) {
+    s->snapshot->valid = FALSE;
+  }
+
+  return RET_OK;
+}
+
 ret_t style_destroy(style_t* s) {
+  if (s != NULL) {
+    TKMEM_FREE(s->snapshot);
+  }
+
   if (s != NULL && s->vt != NULL && s->vt->destroy != NULL) {
     return s->vt->destroy(s);
   }
@@ -131,12 +257,14 @@ ret_t style_set(style_t* s, const char* state, const char* name, const value_t*
   return_value_if_fail(s != NULL && s->vt != NULL && s->vt->set != NULL, RET_BAD_PARAMS);
   return_value_if_fail(state != NULL && name != NULL && value != NULL, RET_BAD_PARAMS);
 
+  style_invalidate_snapshot(s);
   return s->vt->set(s, state, name, value);
 }
 
 ret_t style_set_style_data(style_t* s, const uint8_t* data, const char* state) {
   return_value_if_fail(s != NULL && s->vt != NULL && s->vt->set_style_data != NULL && data != NULL,
                        RET_BAD_PARAMS);
+  style_invalidate_snapshot(s);
   return s->vt->set_style_data(s, data, state);
 }
 
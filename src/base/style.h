@@ -364,6 +364,92 @@ typedef struct _style_vtable_t {
   style_get_style_state_t get_style_state;
 } style_vtable_t;
 
+/**
+ * @enum style_snapshot_flag_t
+ * @prefix STYLE_SNAPSHOT_HAS_
+ * style快照中，缺省值由调用者决定的属性，是否在style中有定义。
+ */
+typedef enum _style_snapshot_flag_t {
+  STYLE_SNAPSHOT_HAS_TEXT_COLOR = 1,
+  STYLE_SNAPSHOT_HAS_FONT_SIZE = 1 << 1,
+  STYLE_SNAPSHOT_HAS_TEXT_ALIGN_H = 1 << 2,
+  STYLE_SNAPSHOT_HAS_TEXT_ALIGN_V = 1 << 3,
+  STYLE_SNAPSHOT_HAS_MARGIN = 1 << 4,
+  STYLE_SNAPSHOT_HAS_MARGIN_LEFT = 1 << 5,
+  STYLE_SNAPSHOT_HAS_MARGIN_RIGHT = 1 << 6,
+  STYLE_SNAPSHOT_HAS_MARGIN_TOP = 1 << 7,
+  STYLE_SNAPSHOT_HAS_MARGIN_BOTTOM = 1 << 8,
+  STYLE_SNAPSHOT_HAS_BG_IMAGE_DRAW_TYPE = 1 << 9,
+  STYLE_SNAPSHOT_HAS_FG_IMAGE_DRAW_TYPE = 1 << 10
+} style_snapshot_flag_t;
+
+/**
+ * @class style_snapshot_t
+ * 控件风格的快照。
+ *
+ * 绘制时常用的属性，在style的数据或状态变化后解析一次，绘制时直接读取结构体的成员，
+ * 不需要每次按名称查找。缺省值固定的属性已经填入了缺省值，其它属性需要先检查flags。
+ *
+ * ```c
+ * const style_snapshot_t* snapshot = style_get_snapshot(widget->astyle);
+ * uint16_t font_size =
+ *     STYLE_SNAPSHOT_GET(snapshot, font_size, STYLE_SNAPSHOT_HAS_FONT_SIZE, TK_DEFAULT_FONT_SIZE);
+ * ```
+ *
+ * > 其中的字符串指向style的数据，style变化后不能再使用。
+ */
+typedef struct _style_snapshot_t {
+  /**
+   * @property {bool_t} valid
+   * @annotation ["readable"]
+   * 快照是否有效。
+   */
+  bool_t valid;
+  /**
+   * @property {uint32_t} flags
+   * @annotation ["readable"]
+   * 属性是否有定义(参考style\_snapshot\_flag\_t)。
+   */
+  uint32_t flags;
+
+  color_t text_color;
+  const char* font_name;
+  uint16_t font_size;
+  int32_t text_align_h;
+  int32_t text_align_v;
+
+  int32_t margin;
+  int32_t margin_left;
+  int32_t margin_right;
+  int32_t margin_top;
+  int32_t margin_bottom;
+
+  /*以下属性的缺省值固定，没有定义时为缺省值*/
+  color_t border_color;
+  int32_t border;
+  uint32_t border_width;
+  uint32_t radius_tl;
+  uint32_t radius_tr;
+  uint32_t radius_bl;
+  uint32_t radius_br;
+  uint32_t clear_bg;
+
+  int32_t spacer;
+  int32_t icon_at;
+  const char* icon;
+  int32_t x_offset;
+  int32_t y_offset;
+
+  const char* bg_image;
+  const char* fg_image;
+  int32_t bg_image_draw_type;
+  int32_t fg_image_draw_type;
+} style_snapshot_t;
+
+/*从快照中获取属性的值，没有定义时返回缺省值。*/
+#define STYLE_SNAPSHOT_GET(snapshot, field, flag, defval) \
+  (((snapshot)->flags & (flag)) ? (snapshot)->field : (defval))
+
 /**
  * @class style_t
  * @annotation ["scriptable"]
@@ -383,6 +469,8 @@ typedef struct _style_vtable_t {
  */
 struct _style_t {
   const style_vtable_t* vt;
+  /*private*/
+  style_snapshot_t* snapshot;
 };
 
 /**
@@ -547,6 +635,28 @@ bool_t style_is_mutable(style_t* s);
  */
 const char* style_get_style_type(style_t* s);
 
+/**
+ * @method style_get_snapshot
+ * 获取style的快照。
+ *
+ * > 快照在首次获取时创建，style的数据或状态变化后自动更新。
+ * @param {style_t*} s style对象(为NULL时返回缺省的快照)。
+ *
+ * @return {const style_snapshot_t*} 返回快照对象(不会返回NULL)。
+ */
+const style_snapshot_t* style_get_snapshot(style_t* s);
+
+/**
+ * @method style_invalidate_snapshot
+ * 让style的快照失效，下次获取时重新解析。
+ *
+ * > style的实现在数据变化时调用。
+ * @param {style_t*} s style对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t style_invalidate_snapshot(style_t* s);
+
 /**
  * @method style_destroy
  * 销毁style对象
@@ -103,8 +103,8 @@ static ret_t style_const_apply_props(style_t* s, widget_t* widget) {
     }
   }
 
-  widget->focusable = style_get_int(s, STYLE_ID_FOCUSABLE, widget->focusable);
-  widget->feedback = style_get_int(s, STYLE_ID_FEEDBACK, widget->feedback);
+  widget->focusable = style_get_int(s, STYLE_ID_FOCUSABLE, widget->focusable) ? TRUE : FALSE;
+  widget->feedback = style_get_int(s, STYLE_ID_FEEDBACK, widget->feedback) ? TRUE : FALSE;
 
   return RET_OK;
 }
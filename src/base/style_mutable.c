@@ -376,6 +376,7 @@ ret_t style_mutable_set_value(style_t* s, const char* state, const char* name, c
   if (style_item_set(witer->items, name, v) != RET_OK) {
     witer->items = style_item_add(witer->items, name, v);
   }
+  style_invalidate_snapshot(s);
 
   return RET_OK;
 }
@@ -451,6 +452,8 @@ ret_t style_mutable_reset(style_t* s) {
     witer = wnext;
   }
   style->styles = NULL;
+  style_invalidate_snapshot(s);
+
   return RET_OK;
 }
 
@@ -525,6 +528,7 @@ ret_t style_mutable_set_default_style(style_t* s, style_t* default_style) {
     style_destroy(style->default_style);
   }
   style->default_style = default_style;
+  style_invalidate_snapshot(s);
 
   return RET_OK;
 }
@@ -29,6 +29,17 @@ BEGIN_C_DECLS
 
 #define THEME_MAGIC 0xFAFBFCFD
 
+/*
+ * version 1(header中的version为0): theme_item_t按定义顺序排列，每个style的属性线性存放。
+ * version 2: theme_item_t按(widget_type, name, state)排序，可二分查找。
+ *            style数据的nr最高位为STYLE_DATA_INDEXED，其后紧跟按属性ID排序的索引表。
+ */
+#define THEME_VERSION_1 0
+#define THEME_VERSION_2 2
+
+#define STYLE_DATA_INDEXED 0x80000000u
+#define STYLE_DATA_ID_UNKNOWN 0xffff
+
 #pragma pack(push, 1)
 
 typedef struct _theme_header_t {
@@ -57,6 +68,13 @@ typedef struct _style_name_value_t {
   const char name[4];
 } style_name_value_t;
 
+typedef struct _style_index_item_t {
+  /*属性名的ID，未知的属性名为STYLE_DATA_ID_UNKNOWN(按名称排序)*/
+  uint16_t id;
+  /*属性数据相对style数据开始位置的偏移*/
+  uint16_t offset;
+} style_index_item_t;
+
 #pragma pack(pop)
 
 ret_t style_data_get_value(const uint8_t* s, const char* name, value_t* v);
@@ -66,6 +84,14 @@ color_t style_data_get_color(const uint8_t* s, const char* name, color_t defval)
 gradient_t* style_data_get_gradient(const uint8_t* s, const char* name, gradient_t* gradient);
 const char* style_data_get_str(const uint8_t* s, const char* name, const char* defval);
 
+/**
+ * 获取style属性名对应的ID。
+ * ID只追加不修改，生成的主题数据在不同版本之间保持兼容。
+ * 不是内置的属性名，返回STYLE_DATA_ID_UNKNOWN。
+ */
+uint16_t style_data_name_to_id(const char* name);
+const char* style_data_id_to_name(uint16_t id);
+
 #define STYLE_NAME_SIZE_MAX 255
 #define STYLE_VALUE_SIZE_MAX 1023
 
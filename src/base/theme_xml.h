@@ -52,6 +52,20 @@ theme_t* theme_xml_create(const char* xml);
  */
 uint8_t* theme_xml_gen(const char* xml, uint32_t* size);
 
+/**
+ * @method theme_xml_gen_ex
+ * 生成指定版本的二进制的数据。
+ *
+ * > THEME\_VERSION\_2的数据带有索引，查找更快，但老版本的AWTK无法加载。
+ *
+ * @param {const char*} xml XML格式窗体样式数据。
+ * @param {uint32_t*} size 用于返回数据长度。
+ * @param {uint32_t} version 数据格式的版本(THEME\_VERSION\_1或THEME\_VERSION\_2)。
+ *
+ * @return {uint8_t*} 返回二进制的数据。
+ */
+uint8_t* theme_xml_gen_ex(const char* xml, uint32_t* size, uint32_t version);
+
 END_C_DECLS
 
 #endif /*TK_THEME_XML_H*/
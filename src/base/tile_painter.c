@@ -0,0 +1,491 @@
+﻿/**
+ * File:   tile_painter.c
+ * Author: AWTK Develop Team
+ * Brief:  paint dirty rects with multiple threads
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "base/lcd.h"
+#include "base/style.h"
+#include "base/system_info.h"
+#include "base/font_manager.h"
+#include "base/image_manager.h"
+#include "base/widget_vtable.h"
+#include "base/window_manager.h"
+#include "base/tile_painter.h"
+
+#if defined(WITH_GPU) || defined(FRAGMENT_FRAME_BUFFER_SIZE) || \
+    defined(ENABLE_PERFORMANCE_PROFILE)
+#define WITHOUT_TILE_PAINTER_LCD 1
+#else
+#include "../lcd/lcd_mem_rgb565.h"
+#include "../lcd/lcd_mem_bgr565.h"
+#include "../lcd/lcd_mem_rgba8888.h"
+#include "../lcd/lcd_mem_bgra8888.h"
+
+#ifdef LINUX
+#define WITH_LCD_RGB888 1
+#endif /*LINUX*/
+
+#ifdef WITH_LCD_RGB888
+#include "../lcd/lcd_mem_rgb888.h"
+#include "../lcd/lcd_mem_bgr888.h"
+#endif /*WITH_LCD_RGB888*/
+#endif
+
+/*每个条带最多同时缓存的framebuffer视图数(三缓冲时offline fb会轮换)*/
+#define TILE_PAINTER_FB_NR 3
+#define TILE_PAINTER_MIN_BAND_H 16
+#define TILE_PAINTER_MIN_PIXELS (128 * 128)
+
+/*等待绘制线程超过该时间(毫秒)时输出警告，但仍继续等待*/
+#ifndef TILE_PAINTER_WAIT_TIMEOUT
+#define TILE_PAINTER_WAIT_TIMEOUT 5000
+#endif /*TILE_PAINTER_WAIT_TIMEOUT*/
+
+struct _tile_painter_band_t {
+  canvas_t canvas;
+  bool_t inited;
+  uint32_t next_slot;
+  lcd_t* lcds[TILE_PAINTER_FB_NR];
+  uint8_t* fbs[TILE_PAINTER_FB_NR];
+
+  rect_t rect;
+  widget_t* widget;
+  widget_on_paint_t on_paint;
+  tile_painter_t* painter;
+};
+
+static tile_painter_t* s_tile_painter = NULL;
+static tile_painter_t* s_painting = NULL;
+
+tile_painter_t* tile_painter(void) {
+  return s_tile_painter;
+}
+
+ret_t tile_painter_set(tile_painter_t* painter) {
+  s_tile_painter = painter;
+
+  return RET_OK;
+}
+
+bool_t tile_painter_is_painting(void) {
+  return s_painting != NULL;
+}
+
+ret_t tile_painter_lock(void) {
+  if (s_painting != NULL) {
+    return tk_mutex_nest_lock(s_painting->mutex);
+  }
+
+  return RET_OK;
+}
+
+ret_t tile_painter_unlock(void) {
+  if (s_painting != NULL) {
+    return tk_mutex_nest_unlock(s_painting->mutex);
+  }
+
+  return RET_OK;
+}
+
+tile_painter_t* tile_painter_create(uint32_t threads) {
+  tile_painter_t* painter = NULL;
+  return_value_if_fail(threads > 1, NULL);
+
+  painter = TKMEM_ZALLOC(tile_painter_t);
+  return_value_if_fail(painter != NULL, NULL);
+
+  painter->threads = threads;
+  painter->min_pixels = TILE_PAINTER_MIN_PIXELS;
+  painter->mutex = tk_mutex_nest_create();
+  painter->done = tk_semaphore_create(0, NULL);
+  painter->pool = action_thread_pool_create(threads - 1, threads - 1);
+  painter->bands = TKMEM_ZALLOCN(tile_painter_band_t, threads);
+
+  if (painter->mutex == NULL || painter->done == NULL || painter->pool == NULL ||
+      painter->bands == NULL) {
+    tile_painter_destroy(painter);
+    painter = NULL;
+  }
+
+  return painter;
+}
+
+ret_t tile_painter_set_min_pixels(tile_painter_t* painter, uint32_t min_pixels) {
+  return_value_if_fail(painter != NULL, RET_BAD_PARAMS);
+
+  painter->min_pixels = min_pixels;
+
+  return RET_OK;
+}
+
+#ifndef WITHOUT_TILE_PAINTER_LCD
+static lcd_t* tile_painter_create_lcd(lcd_mem_t* mem, uint8_t* fb, assets_manager_t* am) {
+  lcd_t* lcd = NULL;
+  vgcanvas_t* vg = NULL;
+  system_info_t* info = system_info();
+  wh_t w = mem->base.w;
+  wh_t h = mem->base.h;
+  uint32_t lcd_w = info->lcd_w;
+  uint32_t lcd_h = info->lcd_h;
+  lcd_type_t lcd_type = info->lcd_type;
+  float_t ratio = info->device_pixel_ratio;
+
+  if (mem->format == BITMAP_FMT_RGBA8888) {
+    lcd = lcd_mem_rgba8888_create_single_fb(w, h, fb);
+  } else if (mem->format == BITMAP_FMT_BGRA8888) {
+    lcd = lcd_mem_bgra8888_create_single_fb(w, h, fb);
+  } else if (mem->format == BITMAP_FMT_BGR565) {
+    lcd = lcd_mem_bgr565_create_single_fb(w, h, fb);
+  } else if (mem->format == BITMAP_FMT_RGB565) {
+    lcd = lcd_mem_rgb565_create_single_fb(w, h, fb);
+  }
+#ifdef WITH_LCD_RGB888
+  else if (mem->format == BITMAP_FMT_RGB888) {
+    lcd = lcd_mem_rgb888_create_single_fb(w, h, fb);
+  } else if (mem->format == BITMAP_FMT_BGR888) {
+    lcd = lcd_mem_bgr888_create_single_fb(w, h, fb);
+  }
+#endif /*WITH_LCD_RGB888*/
+
+  if (lcd != NULL) {
+    lcd_set_line_length(lcd, mem->line_length);
+    /*vgcanvas在UI线程中创建，绘制线程只会reinit*/
+    vg = lcd_get_vgcanvas(lcd);
+    if (vg != NULL && am != NULL) {
+      vgcanvas_set_assets_manager(vg, am);
+    }
+  }
+
+  /*lcd_mem_init会修改system_info，这里恢复原来的值*/
+  system_info_set_lcd_w(info, lcd_w);
+  system_info_set_lcd_h(info, lcd_h);
+  system_info_set_lcd_type(info, lcd_type);
+  system_info_set_device_pixel_ratio(info, ratio);
+
+  return lcd;
+}
+
+static lcd_t* tile_painter_band_get_lcd(tile_painter_band_t* band, lcd_mem_t* mem,
+                                        assets_manager_t* am) {
+  uint32_t i = 0;
+  lcd_t* lcd = NULL;
+  uint8_t* fb = lcd_mem_get_offline_fb(mem);
+
+  for (i = 0; i < TILE_PAINTER_FB_NR; i++) {
+    lcd = band->lcds[i];
+    if (lcd != NULL && band->fbs[i] == fb && lcd->w == mem->base.w && lcd->h == mem->base.h &&
+        ((lcd_mem_t*)lcd)->line_length == mem->line_length) {
+      return lcd;
+    }
+  }
+
+  i = band->next_slot++ % TILE_PAINTER_FB_NR;
+  lcd = tile_painter_create_lcd(mem, fb, am);
+  return_value_if_fail(lcd != NULL, NULL);
+
+  if (band->lcds[i] != NULL) {
+    lcd_destroy(band->lcds[i]);
+  }
+  band->lcds[i] = lcd;
+  band->fbs[i] = fb;
+
+  return lcd;
+}
+
+static ret_t tile_painter_band_prepare(tile_painter_band_t* band, canvas_t* c) {
+  vgcanvas_t* vg = NULL;
+  lcd_t* lcd = tile_painter_band_get_lcd(band, (lcd_mem_t*)(c->lcd), c->assets_manager);
+  return_value_if_fail(lcd != NULL, RET_FAIL);
+
+  if (!band->inited) {
+    return_value_if_fail(canvas_init(&(band->canvas), lcd, c->font_manager) != NULL, RET_FAIL);
+    band->inited = TRUE;
+  } else if (band->canvas.font_manager != c->font_manager) {
+    canvas_set_font_manager(&(band->canvas), c->font_manager);
+  }
+  /*不用canvas_set_assets_manager，它会修改font_manager的assets_manager*/
+  band->canvas.assets_manager = c->assets_manager;
+  band->canvas.lcd = lcd;
+
+  vg = lcd_get_vgcanvas(lcd);
+  if (vg != NULL && c->assets_manager != NULL) {
+    vgcanvas_set_assets_manager(vg, c->assets_manager);
+  }
+
+  return RET_OK;
+}
+
+static ret_t tile_painter_band_paint(tile_painter_band_t* band) {
+  canvas_t* c = &(band->canvas);
+  vgcanvas_t* vg = lcd_get_vgcanvas(c->lcd);
+
+  c->ox = 0;
+  c->oy = 0;
+  canvas_set_global_alpha(c, 0xff);
+  lcd_set_canvas(c->lcd, c);
+  canvas_set_clip_rect(c, &(band->rect));
+
+  if (vg != NULL) {
+    vgcanvas_begin_frame(vg, NULL);
+  }
+  widget_paint_with_clip(band->widget, &(band->rect), c, band->on_paint);
+  if (vg != NULL) {
+    vgcanvas_end_frame(vg);
+  }
+
+  return RET_OK;
+}
+
+static ret_t tile_painter_band_exec(qaction_t* action) {
+  tile_painter_band_t* band = NULL;
+
+  memcpy(&band, action->args, sizeof(band));
+  tile_painter_band_paint(band);
+  tk_semaphore_post(band->painter->done);
+
+  return RET_OK;
+}
+
+static bool_t tile_painter_has_paint_handler(widget_t* widget) {
+  emitter_t* emitter = widget->emitter;
+
+  if (WIDGET_EXTRA(widget, dispatch_callback) != NULL) {
+    return TRUE;
+  }
+
+  if (emitter == NULL) {
+    return FALSE;
+  }
+
+  /*懒加载的子控件(ui_builder)和tr_text也是在EVT_BEFORE_PAINT中创建/更新的*/
+  return emitter_exist_by_etype(emitter, EVT_BEFORE_PAINT) ||
+         emitter_exist_by_etype(emitter, EVT_PAINT) ||
+         emitter_exist_by_etype(emitter, EVT_AFTER_PAINT) ||
+         emitter_exist_by_etype(emitter, EVT_PAINT_DONE);
+}
+
+static bool_t tile_painter_is_window_ready(widget_t* widget, canvas_t* c) {
+  font_manager_t* fm = widget_get_font_manager(widget);
+  image_manager_t* imm = widget_get_image_manager(widget);
+  assets_manager_t* am = widget_get_assets_manager(widget);
+
+  /*window_base_on_paint_begin在并行绘制时不会修改画布和各个manager*/
+  return fm == c->font_manager && am == c->assets_manager &&
+         (imm == NULL || imm->assets_manager == am) && (fm == NULL || fm->assets_manager == am);
+}
+
+/*
+ * 在UI线程中更新样式(及其快照)，绘制线程只读。返回FALSE表示有控件不能并行绘制：
+ * 只有声明了paint_thread_safe的控件可以并行绘制，而且不能有绘制事件的处理函数。
+ */
+static bool_t tile_painter_prepare_widget(widget_t* widget, canvas_t* c) {
+  if (!widget->visible) {
+    return TRUE;
+  }
+
+  if (!widget->vt->paint_thread_safe || tile_painter_has_paint_handler(widget)) {
+    return FALSE;
+  }
+
+  /*位图缓存在绘制时会创建和更新离线画布*/
+  if (widget->cache_as_bitmap) {
+    return FALSE;
+  }
+
+  /*异步加载的图片在绘制时会提交解码任务*/
+  if (widget_get_prop_bool(widget, WIDGET_PROP_ASYNC_LOAD, FALSE)) {
+    return FALSE;
+  }
+
+  if (widget->vt->is_window_manager && window_manager_get_dialog_highlighter(widget) != NULL) {
+    return FALSE;
+  }
+
+  if (widget->vt->is_window && !tile_painter_is_window_ready(widget, c)) {
+    return FALSE;
+  }
+
+  if (widget->need_update_style) {
+    widget_update_style(widget);
+  }
+
+  if (widget->astyle != NULL) {
+    style_get_snapshot(widget->astyle);
+  }
+
+  WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+  if (!tile_painter_prepare_widget(iter, c)) {
+    return FALSE;
+  }
+  WIDGET_FOR_EACH_CHILD_END();
+
+  return TRUE;
+}
+
+/*与单线程绘制一致：绘制过的控件及其子控件都不再是dirty的*/
+static ret_t tile_painter_clear_dirty(widget_t* widget) {
+  widget->dirty = FALSE;
+
+  if (widget->visible) {
+    WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+    tile_painter_clear_dirty(iter);
+    WIDGET_FOR_EACH_CHILD_END();
+  }
+
+  return RET_OK;
+}
+
+static ret_t tile_painter_wait(tile_painter_t* painter, uint32_t nr) {
+  uint32_t i = 0;
+  uint32_t waited = 0;
+  bool_t warned = FALSE;
+
+  /*条带还在访问控件树和framebuffer，UI线程不能提前返回，只能一直等待*/
+  for (i = 0; i < nr; i++) {
+    while (tk_semaphore_wait(painter->done, 1000) != RET_OK) {
+      waited += 1000;
+      if (!warned && waited >= TILE_PAINTER_WAIT_TIMEOUT) {
+        warned = TRUE;
+        log_warn("tile painter: band not done after %u ms, still waiting\n", waited);
+      }
+    }
+  }
+
+  return RET_OK;
+}
+#endif /*WITHOUT_TILE_PAINTER_LCD*/
+
+ret_t tile_painter_paint(tile_painter_t* painter, widget_t* widget, canvas_t* c, const rect_t* r,
+                         widget_on_paint_t on_paint) {
+#ifdef WITHOUT_TILE_PAINTER_LCD
+  (void)painter;
+  (void)widget;
+  (void)c;
+  (void)r;
+  (void)on_paint;
+
+  return RET_NOT_IMPL;
+#else
+  rect_t clip;
+  rect_t area;
+  uint32_t i = 0;
+  uint32_t n = 0;
+  uint32_t band_h = 0;
+  qaction_t* action = NULL;
+  return_value_if_fail(painter != NULL && widget != NULL && c != NULL && c->lcd != NULL,
+                       RET_BAD_PARAMS);
+  return_value_if_fail(r != NULL && on_paint != NULL, RET_BAD_PARAMS);
+
+  if (s_painting != NULL || lcd_get_type(c->lcd) != LCD_FRAMEBUFFER || c->lcd->ratio != 1 ||
+      system_info()->lcd_orientation != LCD_ORIENTATION_0) {
+    return RET_NOT_IMPL;
+  }
+
+  canvas_get_clip_rect(c, &clip);
+  area = rect_intersect(r, &clip);
+  if ((uint32_t)(area.w * area.h) < painter->min_pixels) {
+    return RET_NOT_IMPL;
+  }
+
+  n = tk_min(painter->threads, (uint32_t)(area.h / TILE_PAINTER_MIN_BAND_H));
+  if (n < 2 || !tile_painter_prepare_widget(widget, c)) {
+    return RET_NOT_IMPL;
+  }
+
+  band_h = (area.h + n - 1) / n;
+  for (i = 0; i < n; i++) {
+    tile_painter_band_t* band = painter->bands + i;
+    xy_t y = area.y + i * band_h;
+
+    if (tile_painter_band_prepare(band, c) != RET_OK) {
+      return RET_NOT_IMPL;
+    }
+
+    band->painter = painter;
+    band->widget = widget;
+    band->on_paint = on_paint;
+    band->rect = rect_init(area.x, y, area.w, tk_min(band_h, (uint32_t)(area.y + area.h - y)));
+  }
+
+  s_painting = painter;
+  for (i = 1; i < n; i++) {
+    tile_painter_band_t* band = painter->bands + i;
+
+    action = qaction_create(tile_painter_band_exec, &band, sizeof(band));
+    if (action == NULL || action_thread_pool_exec(painter->pool, action) != RET_OK) {
+      /*线程池满了，由UI线程自己绘制*/
+      qaction_destroy(action);
+      tile_painter_band_paint(band);
+      tk_semaphore_post(painter->done);
+    }
+  }
+
+  tile_painter_band_paint(painter->bands);
+
+  tile_painter_wait(painter, n - 1);
+  s_painting = NULL;
+  tile_painter_clear_dirty(widget);
+
+  return RET_OK;
+#endif /*WITHOUT_TILE_PAINTER_LCD*/
+}
+
+ret_t tile_painter_destroy(tile_painter_t* painter) {
+  uint32_t i = 0;
+  uint32_t k = 0;
+  return_value_if_fail(painter != NULL, RET_BAD_PARAMS);
+
+  if (painter->pool != NULL) {
+    action_thread_pool_destroy(painter->pool);
+  }
+
+  if (painter->bands != NULL) {
+    for (i = 0; i < painter->threads; i++) {
+      tile_painter_band_t* band = painter->bands + i;
+
+      if (band->inited) {
+        canvas_reset(&(band->canvas));
+      }
+
+      for (k = 0; k < TILE_PAINTER_FB_NR; k++) {
+        if (band->lcds[k] != NULL) {
+          lcd_destroy(band->lcds[k]);
+        }
+      }
+    }
+    TKMEM_FREE(painter->bands);
+  }
+
+  if (painter->done != NULL) {
+    tk_semaphore_destroy(painter->done);
+  }
+
+  if (painter->mutex != NULL) {
+    tk_mutex_nest_destroy(painter->mutex);
+  }
+
+  if (s_tile_painter == painter) {
+    s_tile_painter = NULL;
+  }
+  TKMEM_FREE(painter);
+
+  return RET_OK;
+}
@@ -0,0 +1,177 @@
+﻿/**
+ * File:   tile_painter.h
+ * Author: AWTK Develop Team
+ * Brief:  paint dirty rects with multiple threads
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_TILE_PAINTER_H
+#define TK_TILE_PAINTER_H
+
+#include "tkc/mutex_nest.h"
+#include "tkc/semaphore.h"
+#include "tkc/action_thread_pool.h"
+#include "base/widget.h"
+#include "base/canvas.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class tile_painter_band_t
+ * 一个绘制条带(私有)。
+ */
+typedef struct _tile_painter_band_t tile_painter_band_t;
+
+/**
+ * @class tile_painter_t
+ * 多线程分块绘制。
+ *
+ * 软件渲染(lcd_mem)时，把较大的脏矩形按水平方向切分成若干条带，
+ * 每个条带用独立的canvas(共享同一个framebuffer)在不同的线程中绘制，
+ * 所有条带绘制完成后才返回，所以lcd在flush之前总能拿到完整的一帧。
+ *
+ * 绘制期间，image\_manager/font\_manager/字模缓存/vgcanvas资源和绘制事件的分发由内部的锁串行化，
+ * 并暂停图片缓存的淘汰。控件样式在分发之前由UI线程预先更新。
+ *
+ * 限制：
+ *
+ * * 只有vtable中paint\_thread\_safe为TRUE的控件(绘制时只读取状态，如label/button/image等)可以并行绘制，
+ * 界面上有其它可见控件(如edit/rich\_text/svg\_image)时，自动退回到单线程绘制。
+ * * 控件注册了绘制事件(EVT\_BEFORE\_PAINT/EVT\_PAINT/EVT\_AFTER\_PAINT/EVT\_PAINT\_DONE)的处理函数、
+ * 有懒加载的子控件、启用了cache\_as\_bitmap或async\_load时，也退回到单线程绘制。
+ * * 所有条带完成之前UI线程一直等待，等待超过TILE\_PAINTER\_WAIT\_TIMEOUT毫秒时输出警告。
+ * * 仅支持lcd\_mem(不支持GPU、FRAGMENT\_FRAME\_BUFFER\_SIZE和ENABLE\_PERFORMANCE\_PROFILE)，且LCD没有旋转。
+ *
+ * 定义WITH\_TILE\_PAINTER后，tk\_init时自动创建(线程数由TK\_TILE\_PAINTER\_THREADS指定)，
+ * 也可以自己创建后用tile\_painter\_set启用。
+ *
+ * ```c
+ * tile_painter_set(tile_painter_create(4));
+ * ```
+ */
+typedef struct _tile_painter_t {
+  /**
+   * @property {uint32_t} threads
+   * @annotation ["readable"]
+   * 参与绘制的线程数(包括UI线程)。
+   */
+  uint32_t threads;
+  /**
+   * @property {uint32_t} min_pixels
+   * @annotation ["readable"]
+   * 脏矩形的像素数不小于该值时才并行绘制。
+   */
+  uint32_t min_pixels;
+
+  /*private*/
+  tk_mutex_nest_t* mutex;
+  tk_semaphore_t* done;
+  action_thread_pool_t* pool;
+  tile_painter_band_t* bands;
+} tile_painter_t;
+
+/**
+ * @method tile_painter_create
+ * @annotation ["constructor"]
+ * 创建tile_painter对象。
+ * @param {uint32_t} threads 参与绘制的线程数(包括UI线程，必须大于1)。
+ *
+ * @return {tile_painter_t*} 返回tile_painter对象。
+ */
+tile_painter_t* tile_painter_create(uint32_t threads);
+
+/**
+ * @method tile_painter_set_min_pixels
+ * 设置并行绘制的最小像素数。
+ * @param {tile_painter_t*} painter tile_painter对象。
+ * @param {uint32_t} min_pixels 最小像素数。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t tile_painter_set_min_pixels(tile_painter_t* painter, uint32_t min_pixels);
+
+/**
+ * @method tile_painter_paint
+ * 多线程绘制指定的区域。
+ *
+ * > 不满足并行绘制条件时返回RET_NOT_IMPL，调用者需要自己绘制。
+ *
+ * @param {tile_painter_t*} painter tile_painter对象。
+ * @param {widget_t*} widget 控件对象。
+ * @param {canvas_t*} c 画布对象(必须是lcd_mem)。
+ * @param {const rect_t*} r 需要绘制的区域。
+ * @param {widget_on_paint_t} on_paint 绘制函数。
+ *
+ * @return {ret_t} 返回RET_OK表示已经绘制，其它值(如RET_NOT_IMPL)表示需要调用者自己绘制。
+ */
+ret_t tile_painter_paint(tile_painter_t* painter, widget_t* widget, canvas_t* c, const rect_t* r,
+                         widget_on_paint_t on_paint);
+
+/**
+ * @method tile_painter_destroy
+ * 销毁tile_painter对象。
+ * @param {tile_painter_t*} painter tile_painter对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t tile_painter_destroy(tile_painter_t* painter);
+
+/**
+ * @method tile_painter
+ * 获取缺省的tile_painter对象。
+ * @annotation ["constructor"]
+ *
+ * @return {tile_painter_t*} 返回tile_painter对象(没有启用时返回NULL)。
+ */
+tile_painter_t* tile_painter(void);
+
+/**
+ * @method tile_painter_set
+ * 设置缺省的tile_painter对象。
+ * @param {tile_painter_t*} painter tile_painter对象(NULL表示禁用)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t tile_painter_set(tile_painter_t* painter);
+
+/**
+ * @method tile_painter_is_painting
+ * 是否正在并行绘制。
+ *
+ * @return {bool_t} 返回TRUE表示正在并行绘制。
+ */
+bool_t tile_painter_is_painting(void);
+
+/**
+ * @method tile_painter_lock
+ * 并行绘制时，访问共享状态(如缓存)之前调用，其它时候什么也不做。可以嵌套。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t tile_painter_lock(void);
+
+/**
+ * @method tile_painter_unlock
+ * 与tile_painter_lock配对使用。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t tile_painter_unlock(void);
+
+END_C_DECLS
+
+#endif /*TK_TILE_PAINTER_H*/
@@ -57,7 +57,8 @@ ret_t timer_suspend(uint32_t timer_id) {
   timer_info_t* timer = (timer_info_t*)timer_find(timer_id);
   return_value_if_fail(timer != NULL, RET_BAD_PARAMS);
   timer->suspend = TRUE;
-  return RET_OK;
+
+  return timer_manager_update(timer_manager(), timer_id);
 }
 
 ret_t timer_resume(uint32_t timer_id) {
@@ -89,7 +90,7 @@ ret_t timer_modify_ex(uint32_t timer_id, uint32_t duration, bool_t reset_timer)
     info->start = timer_manager()->get_time();
   }
 
-  return RET_OK;
+  return timer_manager_update(timer_manager(), timer_id);
 }
 
 uint32_t timer_count(void) {
@@ -297,6 +297,10 @@ typedef enum _app_type_t {
 
 #define TK_MAX_SLEEP_TIME (1000 / TK_MAX_LOOP_FPS)
 
+#ifndef TK_MAX_TICKLESS_SLEEP_TIME
+#define TK_MAX_TICKLESS_SLEEP_TIME 1000
+#endif /*TK_MAX_TICKLESS_SLEEP_TIME*/
+
 /* alpha 大于 TK_OPACITY_ALPHA 的颜色认为是不透明颜色，不进行alpha混合。*/
 #define TK_OPACITY_ALPHA 0xfa
 
@@ -403,6 +407,34 @@ typedef struct _system_info_t system_info_t;
 #error " TK_GLYPH_CACHE_NR must > 0 "
 #endif
 
+#ifdef WITH_GLYPH_ATLAS
+#ifndef TK_GLYPH_ATLAS_PAGE_W
+#define TK_GLYPH_ATLAS_PAGE_W 248
+#endif /*TK_GLYPH_ATLAS_PAGE_W*/
+
+#ifndef TK_GLYPH_ATLAS_PAGE_H
+#define TK_GLYPH_ATLAS_PAGE_H 512
+#endif /*TK_GLYPH_ATLAS_PAGE_H*/
+
+#ifndef TK_GLYPH_ATLAS_PAGE_NR
+#define TK_GLYPH_ATLAS_PAGE_NR 8
+#endif /*TK_GLYPH_ATLAS_PAGE_NR*/
+
+#if TK_GLYPH_ATLAS_PAGE_W > 255
+#error " TK_GLYPH_ATLAS_PAGE_W must <= 255 "
+#endif
+#endif /*WITH_GLYPH_ATLAS*/
+
+#ifndef TK_IMAGE_ASYNC_THREADS
+#define TK_IMAGE_ASYNC_THREADS 2
+#endif /*TK_IMAGE_ASYNC_THREADS*/
+
+#ifdef WITH_TILE_PAINTER
+#ifndef TK_TILE_PAINTER_THREADS
+#define TK_TILE_PAINTER_THREADS 4
+#endif /*TK_TILE_PAINTER_THREADS*/
+#endif /*WITH_TILE_PAINTER*/
+
 #if defined(WITH_STB_FONT) || defined(WITH_FT_FONT)
 #define WITH_TRUETYPE_FONT 1
 #endif /*WITH_STB_FONT or WITH_FT_FONT*/
@@ -34,6 +34,21 @@ ret_t ui_builder_on_widget_prop(ui_builder_t* b, const char* name, const char* v
   return b->on_widget_prop(b, name, value);
 }
 
+ret_t ui_builder_on_widget_prop_value(ui_builder_t* b, const char* name, const value_t* value) {
+  char str[64];
+  return_value_if_fail(b != NULL && name != NULL && value != NULL, RET_BAD_PARAMS);
+
+  if (b->on_widget_prop_value != NULL) {
+    return b->on_widget_prop_value(b, name, value);
+  }
+
+  if (value->type == VALUE_TYPE_STRING) {
+    return ui_builder_on_widget_prop(b, name, value_str(value));
+  }
+
+  return ui_builder_on_widget_prop(b, name, value_str_ex(value, str, sizeof(str)));
+}
+
 ret_t ui_builder_on_widget_prop_end(ui_builder_t* b) {
   return_value_if_fail(b != NULL && b->on_widget_prop_end != NULL, RET_BAD_PARAMS);
 
@@ -38,6 +38,8 @@ typedef struct _widget_desc_t {
 typedef ret_t (*ui_builder_on_start_t)(ui_builder_t* b);
 typedef ret_t (*ui_builder_on_widget_start_t)(ui_builder_t* b, const widget_desc_t* desc);
 typedef ret_t (*ui_builder_on_widget_prop_t)(ui_builder_t* b, const char* name, const char* value);
+typedef ret_t (*ui_builder_on_widget_prop_value_t)(ui_builder_t* b, const char* name,
+                                                  const value_t* value);
 typedef ret_t (*ui_builder_on_widget_prop_end_t)(ui_builder_t* b);
 typedef ret_t (*ui_builder_on_widget_end_t)(ui_builder_t* b);
 typedef ret_t (*ui_builder_on_end_t)(ui_builder_t* b);
@@ -68,6 +70,7 @@ struct _ui_builder_t {
   ui_builder_on_start_t on_start;
   ui_builder_on_widget_start_t on_widget_start;
   ui_builder_on_widget_prop_t on_widget_prop;
+  ui_builder_on_widget_prop_value_t on_widget_prop_value;
   ui_builder_on_widget_prop_end_t on_widget_prop_end;
   ui_builder_on_widget_end_t on_widget_end;
   ui_builder_on_end_t on_end;
@@ -102,6 +105,22 @@ ret_t ui_builder_on_widget_start(ui_builder_t* builder, const widget_desc_t* des
  */
 ret_t ui_builder_on_widget_prop(ui_builder_t* builder, const char* name, const char* value);
 
+/**
+ * @method ui_builder_on_widget_prop_value
+ * ui\_loader在解析到预先转换好类型的widget属性时，调用本函数进一步处理。
+ *
+ * > builder没有实现on\_widget\_prop\_value时，把属性值转换成字符串后调用on\_widget\_prop。
+ *
+ * @param {ui_builder_t*} builder builder对象。
+ * @param {const char*} name 属性名。
+ * @param {const value_t*} value 属性值。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ *
+ */
+ret_t ui_builder_on_widget_prop_value(ui_builder_t* builder, const char* name,
+                                      const value_t* value);
+
 /**
  * @method ui_builder_on_widget_prop_end
  * ui\_loader在解析到widget全部属性结束时，调用本函数进一步处理。
@@ -159,6 +178,9 @@ ret_t ui_builder_destroy(ui_builder_t* builder);
 
 #define UI_DATA_MAGIC 0x11221212
 
+/*v2格式：属性名使用内置属性的atom，属性值预先转换好类型。*/
+#define UI_DATA_MAGIC_V2 0x11221213
+
 END_C_DECLS
 
 #endif /*TK_UI_BUILDER_H*/
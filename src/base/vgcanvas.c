@@ -22,6 +22,7 @@
 
 #include "base/vgcanvas.h"
 #include "base/system_info.h"
+#include "base/tile_painter.h"
 #include "tkc/color_parser.h"
 #include "tkc/mem.h"
 #include "tkc/utils.h"
@@ -145,9 +146,14 @@ ret_t vgcanvas_stroke(vgcanvas_t* vg) {
 }
 
 ret_t vgcanvas_paint(vgcanvas_t* vg, bool_t stroke, bitmap_t* img) {
+  ret_t ret = RET_OK;
   return_value_if_fail(vg != NULL && vg->vt->paint != NULL && img != NULL, RET_BAD_PARAMS);
 
-  return vg->vt->paint(vg, stroke, img);
+  tile_painter_lock();
+  ret = vg->vt->paint(vg, stroke, img);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t vgcanvas_destroy(vgcanvas_t* vg) {
@@ -247,12 +253,17 @@ bool_t vgcanvas_is_point_in_path(vgcanvas_t* vg, float_t x, float_t y) {
 }
 
 ret_t vgcanvas_set_font(vgcanvas_t* vg, const char* font) {
+  ret_t ret = RET_OK;
   return_value_if_fail(vg != NULL && vg->vt->set_font != NULL, RET_BAD_PARAMS);
 
   font = system_info_fix_font_name(font);
   vg->font = tk_str_copy(vg->font, font);
 
-  return vg->vt->set_font(vg, vg->font);
+  tile_painter_lock();
+  ret = vg->vt->set_font(vg, vg->font);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t vgcanvas_set_font_size(vgcanvas_t* vg, float_t size) {
@@ -291,31 +302,51 @@ ret_t vgcanvas_set_text_baseline(vgcanvas_t* vg, const char* text_baseline) {
 
 ret_t vgcanvas_fill_text(vgcanvas_t* vg, const char* text, float_t x, float_t y,
                          float_t max_width) {
+  ret_t ret = RET_OK;
   return_value_if_fail(vg != NULL && vg->vt->fill_text != NULL && text != NULL, RET_BAD_PARAMS);
 
-  return vg->vt->fill_text(vg, text, x, y, max_width);
+  tile_painter_lock();
+  ret = vg->vt->fill_text(vg, text, x, y, max_width);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 float_t vgcanvas_measure_text(vgcanvas_t* vg, const char* text) {
+  float_t ret = 0;
   return_value_if_fail(vg != NULL && vg->vt->measure_text != NULL && text != NULL, RET_BAD_PARAMS);
 
-  return vg->vt->measure_text(vg, text);
+  tile_painter_lock();
+  ret = vg->vt->measure_text(vg, text);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t vgcanvas_draw_image(vgcanvas_t* vg, bitmap_t* img, float_t sx, float_t sy, float_t sw,
                           float_t sh, float_t dx, float_t dy, float_t dw, float_t dh) {
+  ret_t ret = RET_OK;
   return_value_if_fail(vg != NULL && vg->vt->draw_image != NULL && img != NULL, RET_BAD_PARAMS);
 
-  return vg->vt->draw_image(vg, img, sx, sy, sw, sh, dx, dy, dw, dh);
+  tile_painter_lock();
+  ret = vg->vt->draw_image(vg, img, sx, sy, sw, sh, dx, dy, dw, dh);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t vgcanvas_draw_image_repeat(vgcanvas_t* vg, bitmap_t* img, float_t sx, float_t sy, float_t sw,
                                  float_t sh, float_t dx, float_t dy, float_t dw, float_t dh,
                                  float_t dst_w, float_t dst_h) {
+  ret_t ret = RET_OK;
   return_value_if_fail(vg != NULL && vg->vt->draw_image_repeat != NULL && img != NULL,
                        RET_BAD_PARAMS);
 
-  return vg->vt->draw_image_repeat(vg, img, sx, sy, sw, sh, dx, dy, dw, dh, dst_w, dst_h);
+  tile_painter_lock();
+  ret = vg->vt->draw_image_repeat(vg, img, sx, sy, sw, sh, dx, dy, dw, dh, dst_w, dst_h);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t vgcanvas_set_antialias(vgcanvas_t* vg, bool_t value) {
@@ -579,10 +610,15 @@ wh_t vgcanvas_get_height(vgcanvas_t* vgcanvas) {
 
 ret_t vgcanvas_get_text_metrics(vgcanvas_t* vg, float_t* ascent, float_t* descent,
                                 float_t* line_hight) {
+  ret_t ret = RET_OK;
   return_value_if_fail(vg != NULL && vg->vt != NULL, RET_BAD_PARAMS);
   return_value_if_fail(vg->vt->get_text_metrics != NULL, RET_BAD_PARAMS);
 
-  return vg->vt->get_text_metrics(vg, ascent, descent, line_hight);
+  tile_painter_lock();
+  ret = vg->vt->get_text_metrics(vg, ascent, descent, line_hight);
+  tile_painter_unlock();
+
+  return ret;
 }
 
 ret_t vgcanvas_clear_cache(vgcanvas_t* vg) {
@@ -41,6 +41,8 @@
 #include "base/system_info.h"
 #include "base/window_manager.h"
 #include "base/widget_vtable.h"
+#include "base/tile_painter.h"
+#include "base/layer_cache.h"
 #include "base/style_mutable.h"
 #include "base/style_factory.h"
 #include "base/widget_animator_manager.h"
@@ -52,6 +54,12 @@
 #include "base/style_const.h"
 #include "base/widget_visible_in_scroll_view.inc"
 
+/*
+ * 控件的标志是1位的位域，直接赋值时2这样的非0值会被截断为0。
+ * C++和部分编译器中bool_t是uint8_t，传入的参数不一定是0/1，所以按字节读取参数再规范化。
+ */
+#define WIDGET_FLAG(v) ((*(const uint8_t*)&(v)) != 0 ? TRUE : FALSE)
+
 ret_t widget_focus_up(widget_t* widget);
 ret_t widget_focus_down(widget_t* widget);
 ret_t widget_focus_left(widget_t* widget);
@@ -62,11 +70,20 @@ static ret_t widget_dispatch_blur_event(widget_t* widget);
 /*虚函数的包装*/
 static ret_t widget_on_paint_done(widget_t* widget, canvas_t* c);
 static ret_t widget_on_paint_begin(widget_t* widget, canvas_t* c);
+static ret_t widget_dispatch_paint_event(widget_t* widget, event_t* e);
 static ret_t widget_on_paint_end(widget_t* widget, canvas_t* c);
 
 typedef widget_t* (*widget_find_wanted_focus_widget_t)(widget_t* widget, darray_t* all_focusable);
 static ret_t widget_move_focus(widget_t* widget, widget_find_wanted_focus_widget_t find);
 
+static widget_extra_t* widget_get_extra(widget_t* widget) {
+  if (widget->extra == NULL) {
+    widget->extra = TKMEM_ZALLOC(widget_extra_t);
+  }
+
+  return widget->extra;
+}
+
 static void widget_set_need_relayout_parent_if_flex(widget_t* widget, char val) {
   widget_t* parent = widget->parent;
   if (parent != NULL) {
@@ -128,6 +145,26 @@ static ret_t widget_set_h(widget_t* widget, xy_t h, bool_t update_layout) {
   return RET_OK;
 }
 
+/*从窗口开始查找时使用的名称索引(parent不是窗口或者没有打开名称索引时返回NULL)*/
+static widget_name_index_t* widget_get_lookup_name_index(widget_t* parent) {
+  /*从子控件开始查找时，遍历子树的代价只和子树大小有关，不使用索引*/
+  if (widget_is_window(parent) && !parent->destroying) {
+    return WINDOW_BASE(parent)->widget_names;
+  } else {
+    return NULL;
+  }
+}
+
+/*parent所在窗口的名称索引(没有打开名称索引时返回NULL)*/
+static widget_name_index_t* widget_get_name_index(widget_t* parent) {
+  widget_t* win = widget_get_window(parent);
+  if (win != NULL && !win->destroying) {
+    return WINDOW_BASE(win)->widget_names;
+  } else {
+    return NULL;
+  }
+}
+
 static bool_t widget_is_strongly_focus(widget_t* widget) {
   widget_t* win = widget_get_window(widget);
   if (win != NULL) {
@@ -218,11 +255,21 @@ static ret_t widget_real_destroy(widget_t* widget) {
   TKMEM_FREE(widget->style);
   TKMEM_FREE(widget->last_state_for_style);
   TKMEM_FREE(widget->tr_text);
-  TKMEM_FREE(widget->animation);
-  TKMEM_FREE(widget->pointer_cursor);
-  TK_OBJECT_UNREF(widget->custom_props);
+  if (widget->extra != NULL) {
+    widget_cancel_load_image_async(widget);
+    TKMEM_FREE(widget->extra->animation);
+    TKMEM_FREE(widget->extra->pointer_cursor);
+    TK_OBJECT_UNREF(widget->extra->custom_props);
+    TKMEM_FREE(widget->extra);
+  }
   wstr_reset(&(widget->text));
   style_destroy(widget->astyle);
+  if (widget->display_list != NULL) {
+    display_list_destroy(widget->display_list);
+  }
+  if (widget->cache_as_bitmap && layer_cache() != NULL) {
+    layer_cache_remove(layer_cache(), widget);
+  }
 
   memset(widget, 0x00, sizeof(widget_t));
   TKMEM_FREE(widget);
@@ -681,12 +728,26 @@ const wchar_t* widget_get_text(widget_t* widget) {
 }
 
 ret_t widget_set_name(widget_t* widget, const char* name) {
+  widget_name_index_t* index = NULL;
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
+  if (widget->parent != NULL) {
+    index = widget_get_name_index(widget->parent);
+  }
+
+  if (index != NULL) {
+    widget_name_index_remove(index, widget, FALSE);
+  }
+
   if (name != NULL) {
     widget->name = tk_str_copy(widget->name, name);
   } else {
     TKMEM_FREE(widget->name);
+    widget->name = NULL;
+  }
+
+  if (index != NULL) {
+    widget_name_index_add(index, widget, FALSE);
   }
 
   return RET_OK;
@@ -738,8 +799,11 @@ ret_t widget_set_theme(widget_t* widget, const char* name) {
 ret_t widget_set_pointer_cursor(widget_t* widget, const char* cursor) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  if (!tk_str_eq(widget->pointer_cursor, cursor)) {
-    widget->pointer_cursor = tk_str_copy(widget->pointer_cursor, cursor);
+  if (!tk_str_eq(WIDGET_EXTRA(widget, pointer_cursor), cursor)) {
+    widget_extra_t* extra = widget_get_extra(widget);
+    return_value_if_fail(extra != NULL, RET_OOM);
+
+    extra->pointer_cursor = tk_str_copy(extra->pointer_cursor, cursor);
     widget_update_pointer_cursor(widget);
   }
 
@@ -748,9 +812,12 @@ ret_t widget_set_pointer_cursor(widget_t* widget, const char* cursor) {
 
 #ifndef WITHOUT_WIDGET_ANIMATORS
 ret_t widget_set_animation(widget_t* widget, const char* animation) {
+  widget_extra_t* extra = NULL;
   return_value_if_fail(widget != NULL && animation != NULL, RET_BAD_PARAMS);
 
-  widget->animation = tk_str_copy(widget->animation, animation);
+  extra = widget_get_extra(widget);
+  return_value_if_fail(extra != NULL, RET_OOM);
+  extra->animation = tk_str_copy(extra->animation, animation);
 
   return widget_create_animator(widget, animation);
 }
@@ -828,6 +895,7 @@ ret_t widget_destroy_animator(widget_t* widget, const char* name) {
 ret_t widget_set_enable(widget_t* widget, bool_t enable) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
+  enable = WIDGET_FLAG(enable);
   if (widget->enable != enable) {
     widget->enable = enable;
     widget_set_need_update_style_recursive(widget);
@@ -841,7 +909,7 @@ ret_t widget_set_enable(widget_t* widget, bool_t enable) {
 ret_t widget_set_feedback(widget_t* widget, bool_t feedback) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget->feedback = feedback;
+  widget->feedback = WIDGET_FLAG(feedback);
 
   return RET_OK;
 }
@@ -849,7 +917,7 @@ ret_t widget_set_feedback(widget_t* widget, bool_t feedback) {
 ret_t widget_set_auto_adjust_size(widget_t* widget, bool_t auto_adjust_size) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget->auto_adjust_size = auto_adjust_size;
+  widget->auto_adjust_size = WIDGET_FLAG(auto_adjust_size);
   widget_set_need_relayout(widget);
 
   return RET_OK;
@@ -858,11 +926,23 @@ ret_t widget_set_auto_adjust_size(widget_t* widget, bool_t auto_adjust_size) {
 ret_t widget_set_floating(widget_t* widget, bool_t floating) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget->floating = floating;
+  widget->floating = WIDGET_FLAG(floating);
 
   return RET_OK;
 }
 
+ret_t widget_set_cache_as_bitmap(widget_t* widget, bool_t cache_as_bitmap) {
+  return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
+
+  cache_as_bitmap = WIDGET_FLAG(cache_as_bitmap);
+  if (widget->cache_as_bitmap && !cache_as_bitmap && layer_cache() != NULL) {
+    layer_cache_remove(layer_cache(), widget);
+  }
+  widget->cache_as_bitmap = cache_as_bitmap;
+
+  return widget_invalidate(widget, NULL);
+}
+
 ret_t widget_set_focused_internal(widget_t* widget, bool_t focused) {
   int32_t stage;
   widget_t* win = widget_get_window(widget);
@@ -877,6 +957,7 @@ ret_t widget_set_focused_internal(widget_t* widget, bool_t focused) {
     return RET_FAIL;
   }
 
+  focused = WIDGET_FLAG(focused);
   if (widget->focused != focused) {
     widget->focused = focused;
     widget_set_need_update_style(widget);
@@ -918,7 +999,7 @@ ret_t widget_set_focused(widget_t* widget, bool_t focused) {
 ret_t widget_set_focusable(widget_t* widget, bool_t focusable) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget->focusable = focusable;
+  widget->focusable = WIDGET_FLAG(focusable);
 
   return RET_OK;
 }
@@ -990,7 +1071,7 @@ ret_t widget_set_state(widget_t* widget, const char* state) {
 ret_t widget_set_sync_state_to_children(widget_t* widget, bool_t sync_state_to_children) {
   return_value_if_fail(widget != NULL, RET_BAD_PARAMS);
 
-  widget->sync_state_to_children = sync_state_to_children;
+  widget->sync_state_to_children = WIDGET_FLAG(sync_state_to_children);
 
   if (widget->sync_state_to_children) {
     /* 在获取 state_for_style 属性后，会调用 widget_sync_state_to_children 函数更新 */
@@ -1003,7 +1084,7 @@ ret_t widget_set_sync_state_to_children(widget_t* widget, bool_t sync_state_to_c
 ret_t widget_set_state_from_parent_sync(widget_t* widget, bool_t state_from_parent_sync) {
   return_value_if_fail(widget != NULL, RET_BAD_PARAMS);
 
-  widget->state_from_parent_sync = state_from_parent_sync;
+  widget->state_from_parent_sync = WIDGET_FLAG(state_from_parent_sync);
 
   return RET_OK;
 }
@@ -1152,6 +1233,7 @@ static ret_t widget_update_style_object_recursive(widget_t* widget) {
 }
 
 ret_t widget_add_child_default(widget_t* widget, widget_t* child) {
+  widget_name_index_t* index = NULL;
   event_t e = event_init(EVT_WIDGET_ADD_CHILD, widget);
   return_value_if_fail(widget != NULL && child != NULL && child->parent == NULL, RET_BAD_PARAMS);
 
@@ -1161,6 +1243,11 @@ ret_t widget_add_child_default(widget_t* widget, widget_t* child) {
 
   ENSURE(darray_push(widget->children, child) == RET_OK);
 
+  index = widget_get_name_index(widget);
+  if (index != NULL) {
+    widget_name_index_add(index, child, TRUE);
+  }
+
   if (!widget_is_window_manager(widget)) {
     widget_set_need_relayout_children(widget);
   }
@@ -1190,8 +1277,14 @@ ret_t widget_add_child(widget_t* widget, widget_t* child) {
 }
 
 ret_t widget_remove_child_prepare(widget_t* widget, widget_t* child) {
+  widget_name_index_t* index = NULL;
   return_value_if_fail(widget != NULL && child != NULL, RET_BAD_PARAMS);
 
+  index = widget_get_name_index(widget);
+  if (index != NULL) {
+    widget_name_index_remove(index, child, TRUE);
+  }
+
   if (!widget_is_window_manager(widget)) {
     widget_set_need_relayout_children(widget);
   }
@@ -1200,6 +1293,7 @@ ret_t widget_remove_child_prepare(widget_t* widget, widget_t* child) {
     widget_set_focused(child, FALSE);
   }
   widget_invalidate_force(child, NULL);
+  widget_cancel_load_image_async(child);
   if (widget->target == child) {
     widget->target = NULL;
   }
@@ -1308,6 +1402,12 @@ widget_t* widget_child(widget_t* widget, const char* path) {
       return NULL;
     }
   } else {
+    widget_t* ret = NULL;
+    widget_name_index_t* index = widget_get_lookup_name_index(widget);
+    if (index != NULL && widget_name_index_lookup(index, widget, path, FALSE, &ret) != RET_FAIL) {
+      return ret;
+    }
+
     return widget_lookup_child(widget, path);
   }
 }
@@ -1349,6 +1449,15 @@ static widget_t* widget_lookup_all(widget_t* widget, const char* name) {
 }
 
 widget_t* widget_lookup(widget_t* widget, const char* name, bool_t recursive) {
+  if (widget != NULL && name != NULL) {
+    widget_t* ret = NULL;
+    widget_name_index_t* index = widget_get_lookup_name_index(widget);
+    if (index != NULL &&
+        widget_name_index_lookup(index, widget, name, recursive, &ret) != RET_FAIL) {
+      return ret;
+    }
+  }
+
   if (recursive) {
     return widget_lookup_all(widget, name);
   } else {
@@ -1398,6 +1507,7 @@ widget_t* widget_lookup_by_type(widget_t* widget, const char* type, bool_t recur
 static ret_t widget_set_visible_self(widget_t* widget, bool_t visible) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
+  visible = WIDGET_FLAG(visible);
   if (widget->visible != visible) {
     widget_invalidate_force(widget, NULL);
     widget->visible = visible;
@@ -1414,7 +1524,7 @@ static ret_t widget_set_visible_self(widget_t* widget, bool_t visible) {
 ret_t widget_set_sensitive(widget_t* widget, bool_t sensitive) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget->sensitive = sensitive;
+  widget->sensitive = WIDGET_FLAG(sensitive);
 
   return RET_OK;
 }
@@ -1422,7 +1532,7 @@ ret_t widget_set_sensitive(widget_t* widget, bool_t sensitive) {
 ret_t widget_set_visible_only(widget_t* widget, bool_t visible) {
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget->visible = visible;
+  widget->visible = WIDGET_FLAG(visible);
 
   return RET_OK;
 }
@@ -1450,8 +1560,8 @@ ret_t widget_on_event_before_children(widget_t* widget, event_t* e) {
 }
 
 static const char* widget_get_pointer_cursor(widget_t* widget) {
-  if (widget->pointer_cursor != NULL) {
-    return widget->pointer_cursor;
+  if (WIDGET_EXTRA(widget, pointer_cursor) != NULL) {
+    return widget->extra->pointer_cursor;
   } else if (widget_vtable_get_pointer_cursor(widget->vt) != NULL) {
     return widget_vtable_get_pointer_cursor(widget->vt);
   }
@@ -1499,8 +1609,8 @@ ret_t widget_dispatch(widget_t* widget, event_t* e) {
       e->target = saved_target;
     }
 
-    if (widget->dispatch_callback != NULL) {
-      widget->dispatch_callback(widget->dispatch_callback_ctx, e);
+    if (WIDGET_EXTRA(widget, dispatch_callback) != NULL) {
+      widget->extra->dispatch_callback(widget->extra->dispatch_callback_ctx, e);
     }
   }
   widget_unref(widget);
@@ -1702,13 +1812,14 @@ ret_t widget_draw_icon_text(widget_t* widget, canvas_t* c, const char* icon, wst
   int32_t icon_at = 0;
   uint16_t font_size = 0;
   float_t text_size = 0.0f;
-  style_t* style = widget->astyle;
   int32_t align_h = ALIGN_H_LEFT;
   int32_t align_v = ALIGN_V_MIDDLE;
+  const style_snapshot_t* snapshot = NULL;
   return_value_if_fail(widget->astyle != NULL, RET_BAD_PARAMS);
 
-  spacer = style_get_int(style, STYLE_ID_SPACER, 2);
-  icon_at = style_get_int(style, STYLE_ID_ICON_AT, ICON_AT_AUTO);
+  snapshot = style_get_snapshot(widget->astyle);
+  spacer = snapshot->spacer;
+  icon_at = snapshot->icon_at;
 
   ir = widget_get_content_area_ex(widget, 0);
 
@@ -1719,19 +1830,21 @@ ret_t widget_draw_icon_text(widget_t* widget, canvas_t* c, const char* icon, wst
   }
 
   if (icon == NULL) {
-    icon = style_get_str(style, STYLE_ID_ICON, NULL);
+    icon = snapshot->icon;
   }
 
   widget_prepare_text_style(widget, c);
 
   font_size = c->font_size;
   text_size = text->size > 0 ? canvas_measure_text(c, text->str, text->size) : 0;
+  align_v = STYLE_SNAPSHOT_GET(snapshot, text_align_v, STYLE_SNAPSHOT_HAS_TEXT_ALIGN_V,
+                               ALIGN_V_MIDDLE);
   if (icon_at == ICON_AT_RIGHT || icon_at == ICON_AT_LEFT) {
-    align_v = style_get_int(style, STYLE_ID_TEXT_ALIGN_V, ALIGN_V_MIDDLE);
-    align_h = style_get_int(style, STYLE_ID_TEXT_ALIGN_H, ALIGN_H_LEFT);
+    align_h = STYLE_SNAPSHOT_GET(snapshot, text_align_h, STYLE_SNAPSHOT_HAS_TEXT_ALIGN_H,
+                                 ALIGN_H_LEFT);
   } else {
-    align_v = style_get_int(style, STYLE_ID_TEXT_ALIGN_V, ALIGN_V_MIDDLE);
-    align_h = style_get_int(style, STYLE_ID_TEXT_ALIGN_H, ALIGN_H_CENTER);
+    align_h = STYLE_SNAPSHOT_GET(snapshot, text_align_h, STYLE_SNAPSHOT_HAS_TEXT_ALIGN_H,
+                                 ALIGN_H_CENTER);
   }
   canvas_set_text_align(c, (align_h_t)align_h, (align_v_t)align_v);
 
@@ -1792,18 +1905,16 @@ ret_t widget_fill_rect(widget_t* widget, canvas_t* c, const rect_t* r, bool_t bg
   ret_t ret = RET_OK;
   gradient_t agradient;
   style_t* style = widget->astyle;
-  uint32_t radius = style_get_int(style, STYLE_ID_ROUND_RADIUS, 0);
+  const style_snapshot_t* snapshot = style_get_snapshot(style);
   const char* color_key = bg ? STYLE_ID_BG_COLOR : STYLE_ID_FG_COLOR;
-  const char* image_key = bg ? STYLE_ID_BG_IMAGE : STYLE_ID_FG_IMAGE;
   rect_t bg_r = rect_init(widget->x, widget->y, widget->w, widget->h);
-  uint32_t radius_tl = style_get_int(style, STYLE_ID_ROUND_RADIUS_TOP_LEFT, radius);
-  uint32_t radius_tr = style_get_int(style, STYLE_ID_ROUND_RADIUS_TOP_RIGHT, radius);
-  uint32_t radius_bl = style_get_int(style, STYLE_ID_ROUND_RADIUS_BOTTOM_LEFT, radius);
-  uint32_t radius_br = style_get_int(style, STYLE_ID_ROUND_RADIUS_BOTTOM_RIGHT, radius);
-  uint32_t clear_bg = style_get_uint(style, STYLE_ID_CLEAR_BG, 0);
-  const char* draw_type_key = bg ? STYLE_ID_BG_IMAGE_DRAW_TYPE : STYLE_ID_FG_IMAGE_DRAW_TYPE;
+  uint32_t radius_tl = snapshot->radius_tl;
+  uint32_t radius_tr = snapshot->radius_tr;
+  uint32_t radius_bl = snapshot->radius_bl;
+  uint32_t radius_br = snapshot->radius_br;
+  uint32_t clear_bg = snapshot->clear_bg;
   gradient_t* gradient = style_get_gradient(style, color_key, &agradient);
-  const char* image_name = style_get_str(style, image_key, NULL);
+  const char* image_name = bg ? snapshot->bg_image : snapshot->fg_image;
 
   if (gradient != NULL && r->w > 0 && r->h > 0) {
     color_t color = gradient_get_first_color(gradient);
@@ -1838,7 +1949,13 @@ ret_t widget_fill_rect(widget_t* widget, canvas_t* c, const rect_t* r, bool_t bg
   if (image_name != NULL && *image_name && r->w > 0 && r->h > 0) {
     if (widget_load_image(widget, image_name, &img) == RET_OK) {
       const char* region = strrchr(image_name, '#');
-      draw_type = (image_draw_type_t)style_get_int(style, draw_type_key, draw_type);
+      if (bg) {
+        draw_type = (image_draw_type_t)STYLE_SNAPSHOT_GET(
+            snapshot, bg_image_draw_type, STYLE_SNAPSHOT_HAS_BG_IMAGE_DRAW_TYPE, draw_type);
+      } else {
+        draw_type = (image_draw_type_t)STYLE_SNAPSHOT_GET(
+            snapshot, fg_image_draw_type, STYLE_SNAPSHOT_HAS_FG_IMAGE_DRAW_TYPE, draw_type);
+      }
 
       if (region == NULL) {
         canvas_draw_image_ex(c, &img, draw_type, r);
@@ -1888,16 +2005,14 @@ ret_t widget_stroke_border_rect_for_border_type(canvas_t* c, const rect_t* r, co
 }
 
 ret_t widget_stroke_border_rect(widget_t* widget, canvas_t* c, const rect_t* r) {
-  style_t* style = widget->astyle;
-  color_t trans = color_init(0, 0, 0, 0);
-  color_t bd = style_get_color(style, STYLE_ID_BORDER_COLOR, trans);
-  uint32_t radius = style_get_int(style, STYLE_ID_ROUND_RADIUS, 0);
-  int32_t border = style_get_int(style, STYLE_ID_BORDER, BORDER_ALL);
-  uint32_t border_width = style_get_int(style, STYLE_ID_BORDER_WIDTH, 1);
-  uint32_t radius_tl = style_get_int(style, STYLE_ID_ROUND_RADIUS_TOP_LEFT, radius);
-  uint32_t radius_tr = style_get_int(style, STYLE_ID_ROUND_RADIUS_TOP_RIGHT, radius);
-  uint32_t radius_bl = style_get_int(style, STYLE_ID_ROUND_RADIUS_BOTTOM_LEFT, radius);
-  uint32_t radius_br = style_get_int(style, STYLE_ID_ROUND_RADIUS_BOTTOM_RIGHT, radius);
+  const style_snapshot_t* snapshot = style_get_snapshot(widget->astyle);
+  color_t bd = snapshot->border_color;
+  int32_t border = snapshot->border;
+  uint32_t border_width = snapshot->border_width;
+  uint32_t radius_tl = snapshot->radius_tl;
+  uint32_t radius_tr = snapshot->radius_tr;
+  uint32_t radius_bl = snapshot->radius_bl;
+  uint32_t radius_br = snapshot->radius_br;
 
   if (bd.rgba.a) {
     canvas_set_stroke_color(c, bd);
@@ -1959,8 +2074,10 @@ static ret_t widget_paint_impl(widget_t* widget, canvas_t* c) {
   }
 
   if (widget->astyle != NULL) {
-    ox += style_get_int(widget->astyle, STYLE_ID_X_OFFSET, 0);
-    oy += style_get_int(widget->astyle, STYLE_ID_Y_OFFSET, 0);
+    const style_snapshot_t* snapshot = style_get_snapshot(widget->astyle);
+
+    ox += snapshot->x_offset;
+    oy += snapshot->y_offset;
   }
 
   canvas_translate(c, ox, oy);
@@ -1985,7 +2102,9 @@ ret_t widget_paint(widget_t* widget, canvas_t* c) {
   return_value_if_fail(widget != NULL && c != NULL, RET_BAD_PARAMS);
 
   if (!widget->visible || widget->opacity <= 0x08 || widget->w <= 0 || widget->h <= 0) {
-    widget->dirty = FALSE;
+    if (!tile_painter_is_painting()) {
+      widget->dirty = FALSE;
+    }
     return RET_OK;
   }
 
@@ -1994,14 +2113,53 @@ ret_t widget_paint(widget_t* widget, canvas_t* c) {
   }
 
   canvas_save(c);
-  widget_paint_impl(widget, c);
+  if (!widget->cache_as_bitmap || layer_cache() == NULL ||
+      layer_cache_paint(layer_cache(), widget, c) != RET_OK) {
+    widget_paint_impl(widget, c);
+  }
   canvas_restore(c);
 
-  widget->dirty = FALSE;
+  /*并行绘制时由tile_painter在UI线程中统一清除*/
+  if (!tile_painter_is_painting()) {
+    widget->dirty = FALSE;
+  }
 
   return RET_OK;
 }
 
+ret_t widget_paint_with_display_list(widget_t* widget, canvas_t* c) {
+  display_list_t* dl = NULL;
+  rect_t r = rect_init(0, 0, 0, 0);
+  return_value_if_fail(widget != NULL && c != NULL, RET_BAD_PARAMS);
+
+  if (widget->display_list == NULL) {
+    if (!display_list_is_supported(c)) {
+      return widget_paint(widget, c);
+    }
+    widget->display_list = display_list_create();
+    if (widget->display_list == NULL) {
+      return widget_paint(widget, c);
+    }
+  }
+
+  dl = widget->display_list;
+  r = rect_init(widget->x, widget->y, widget->w, widget->h);
+  if (dl->dirty || memcmp(&(dl->bounds), &r, sizeof(r)) != 0) {
+    if (display_list_begin_record(dl, c, &r) == RET_OK) {
+      widget_paint(widget, c);
+      display_list_end_record(dl);
+    } else {
+      dl->valid = FALSE;
+    }
+  }
+
+  if (dl->valid) {
+    return display_list_replay(dl, c);
+  }
+
+  return widget_paint(widget, c);
+}
+
 static const widget_cmd_t s_widget_cmds[] = {
     {WIDGET_EXEC_START_ANIMATOR, widget_start_animator},
     {WIDGET_EXEC_STOP_ANIMATOR, widget_stop_animator},
@@ -2046,8 +2204,9 @@ static widget_t* widget_get_top_widget_grab_key(widget_t* widget) {
   WIDGET_FOR_EACH_CHILD_BEGIN_R(widget, iter, i)
   value_t v;
   widget_t* widget_grab_key = widget_get_top_widget_grab_key(iter);
-  if (widget_grab_key == NULL && iter != NULL && iter->visible && iter->custom_props != NULL) {
-    ret_t ret = tk_object_get_prop(iter->custom_props, WIDGET_PROP_GRAB_KEYS, &v);
+  if (widget_grab_key == NULL && iter != NULL && iter->visible &&
+      WIDGET_EXTRA(iter, custom_props) != NULL) {
+    ret_t ret = tk_object_get_prop(iter->extra->custom_props, WIDGET_PROP_GRAB_KEYS, &v);
     if (ret == RET_OK && value_bool(&v)) {
       return iter;
     }
@@ -2255,13 +2414,12 @@ static ret_t widget_exec_code(void* ctx, event_t* evt) {
 
 #endif /*WITHOUT_FSCRIPT*/
 
-ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v) {
+static ret_t widget_set_prop_impl(widget_t* widget, widget_prop_atom_t atom, const char* name,
+                                  const value_t* v) {
   ret_t ret = RET_OK;
   prop_change_event_t e;
-  return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
-  return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_EXEC)) {
+  if (atom == WIDGET_PROP_ATOM_EXEC) {
     ret = widget_exec(widget, value_str(v));
     if (ret != RET_NOT_FOUND) {
       return ret;
@@ -2273,61 +2431,87 @@ ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v) {
   e.e = event_init(EVT_PROP_WILL_CHANGE, widget);
   widget_dispatch(widget, (event_t*)&e);
 
-  if (tk_str_eq(name, WIDGET_PROP_X)) {
-    widget_set_x(widget, (xy_t)value_int(v), TRUE);
-  } else if (tk_str_eq(name, WIDGET_PROP_Y)) {
-    widget_set_y(widget, (xy_t)value_int(v), TRUE);
-  } else if (tk_str_eq(name, WIDGET_PROP_W)) {
-    widget_set_w(widget, (wh_t)value_int(v), TRUE);
-  } else if (tk_str_eq(name, WIDGET_PROP_H)) {
-    widget_set_h(widget, (wh_t)value_int(v), TRUE);
-  } else if (tk_str_eq(name, WIDGET_PROP_OPACITY)) {
-    widget->opacity = (uint8_t)value_int(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_VISIBLE)) {
-    widget_set_visible(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_SENSITIVE)) {
-    widget->sensitive = value_bool(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_FLOATING)) {
-    widget->floating = value_bool(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_FOCUSABLE)) {
-    widget->focusable = value_bool(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_WITH_FOCUS_STATE)) {
-    widget->with_focus_state = value_bool(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_DIRTY_RECT_TOLERANCE)) {
-    widget->dirty_rect_tolerance = value_int(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_STYLE)) {
-    const char* name = value_str(v);
-    return widget_use_style(widget, name);
-  } else if (tk_str_eq(name, WIDGET_PROP_STATE)) {
-    const char* name = value_str(v);
-    return widget_set_state(widget, name);
-  } else if (tk_str_eq(name, WIDGET_PROP_ENABLE)) {
-    widget_set_enable(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_FEEDBACK)) {
-    widget->feedback = value_bool(v);
-  } else if (tk_str_eq(name, WIDGET_PROP_AUTO_ADJUST_SIZE)) {
-    widget_set_auto_adjust_size(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_NAME)) {
-    widget_set_name(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_TR_TEXT)) {
-    widget_set_tr_text(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_ANIMATION)) {
-    widget_set_animation(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_SELF_LAYOUT)) {
-    widget_set_self_layout(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_LAYOUT) || tk_str_eq(name, WIDGET_PROP_CHILDREN_LAYOUT)) {
-    widget_set_children_layout(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_POINTER_CURSOR)) {
-    widget_set_pointer_cursor(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_STATE_FROM_PARENT_SYNC)) {
-    widget_set_state_from_parent_sync(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_SYNC_STATE_TO_CHILDREN)) {
-    widget_set_sync_state_to_children(widget, value_bool(v));
-  } else {
-    ret = RET_NOT_FOUND;
+  switch (atom) {
+    case WIDGET_PROP_ATOM_X:
+      widget_set_x(widget, (xy_t)value_int(v), TRUE);
+      break;
+    case WIDGET_PROP_ATOM_Y:
+      widget_set_y(widget, (xy_t)value_int(v), TRUE);
+      break;
+    case WIDGET_PROP_ATOM_W:
+      widget_set_w(widget, (wh_t)value_int(v), TRUE);
+      break;
+    case WIDGET_PROP_ATOM_H:
+      widget_set_h(widget, (wh_t)value_int(v), TRUE);
+      break;
+    case WIDGET_PROP_ATOM_OPACITY:
+      widget->opacity = (uint8_t)value_int(v);
+      break;
+    case WIDGET_PROP_ATOM_VISIBLE:
+      widget_set_visible(widget, value_bool(v));
+      break;
+    case WIDGET_PROP_ATOM_SENSITIVE:
+      widget->sensitive = value_bool(v);
+      break;
+    case WIDGET_PROP_ATOM_FLOATING:
+      widget->floating = value_bool(v);
+      break;
+    case WIDGET_PROP_ATOM_CACHE_AS_BITMAP:
+      widget_set_cache_as_bitmap(widget, value_bool(v));
+      break;
+    case WIDGET_PROP_ATOM_FOCUSABLE:
+      widget->focusable = value_bool(v);
+      break;
+    case WIDGET_PROP_ATOM_WITH_FOCUS_STATE:
+      widget->with_focus_state = value_bool(v);
+      break;
+    case WIDGET_PROP_ATOM_DIRTY_RECT_TOLERANCE:
+      widget->dirty_rect_tolerance = value_int(v);
+      break;
+    case WIDGET_PROP_ATOM_STYLE:
+      return widget_use_style(widget, value_str(v));
+    case WIDGET_PROP_ATOM_STATE:
+      return widget_set_state(widget, value_str(v));
+    case WIDGET_PROP_ATOM_ENABLE:
+      widget_set_enable(widget, value_bool(v));
+      break;
+    case WIDGET_PROP_ATOM_FEEDBACK:
+      widget->feedback = value_bool(v);
+      break;
+    case WIDGET_PROP_ATOM_AUTO_ADJUST_SIZE:
+      widget_set_auto_adjust_size(widget, value_bool(v));
+      break;
+    case WIDGET_PROP_ATOM_NAME:
+      widget_set_name(widget, value_str(v));
+      break;
+    case WIDGET_PROP_ATOM_TR_TEXT:
+      widget_set_tr_text(widget, value_str(v));
+      break;
+    case WIDGET_PROP_ATOM_ANIMATION:
+      widget_set_animation(widget, value_str(v));
+      break;
+    case WIDGET_PROP_ATOM_SELF_LAYOUT:
+      widget_set_self_layout(widget, value_str(v));
+      break;
+    case WIDGET_PROP_ATOM_LAYOUT:
+    case WIDGET_PROP_ATOM_CHILDREN_LAYOUT:
+      widget_set_children_layout(widget, value_str(v));
+      break;
+    case WIDGET_PROP_ATOM_POINTER_CURSOR:
+      widget_set_pointer_cursor(widget, value_str(v));
+      break;
+    case WIDGET_PROP_ATOM_STATE_FROM_PARENT_SYNC:
+      widget_set_state_from_parent_sync(widget, value_bool(v));
+      break;
+    case WIDGET_PROP_ATOM_SYNC_STATE_TO_CHILDREN:
+      widget_set_sync_state_to_children(widget, value_bool(v));
+      break;
+    default:
+      ret = RET_NOT_FOUND;
+      break;
   }
 
-  if (tk_str_start_with(name, WIDGET_PROP_ANIMATE_PREFIX)) {
+  if (atom == WIDGET_PROP_ATOM_NONE && tk_str_start_with(name, WIDGET_PROP_ANIMATE_PREFIX)) {
     uint32_t duration = TK_ANIMATING_TIME;
     const char* prop_name = name + strlen(WIDGET_PROP_ANIMATE_PREFIX);
     if (v->type == VALUE_TYPE_STRING && TK_STR_IS_EMPTY(value_str(v))) {
@@ -2347,24 +2531,27 @@ ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v) {
   }
 
   if (ret == RET_NOT_FOUND) {
-    if (tk_str_eq(name, WIDGET_PROP_FOCUSED) || tk_str_eq(name, WIDGET_PROP_FOCUS)) {
+    if (atom == WIDGET_PROP_ATOM_FOCUSED || atom == WIDGET_PROP_ATOM_FOCUS) {
       widget_set_focused(widget, value_bool(v));
       ret = RET_OK;
-    } else if (tk_str_eq(name, WIDGET_PROP_TEXT)) {
+    } else if (atom == WIDGET_PROP_ATOM_TEXT) {
       wstr_from_value(&(widget->text), v);
       ret = RET_OK;
-    } else if (tk_str_eq(name, WIDGET_PROP_EXEC)) {
+    } else if (atom == WIDGET_PROP_ATOM_EXEC) {
       ret = RET_NOT_FOUND;
     } else if (tk_str_start_with(name, "style:") || tk_str_start_with(name, "style.")) {
       return widget_set_style(widget, name + 6, v);
-    } else if (tk_str_eq(name, WIDGET_PROP_DIRTY_RECT)) {
+    } else if (atom == WIDGET_PROP_ATOM_DIRTY_RECT) {
       return RET_FAIL;
     } else {
-      if (widget->custom_props == NULL) {
-        widget->custom_props = object_default_create();
+      widget_extra_t* extra = widget_get_extra(widget);
+      return_value_if_fail(extra != NULL, RET_OOM);
+
+      if (extra->custom_props == NULL) {
+        extra->custom_props = object_default_create();
       }
 
-      if (tk_str_eq(name, WIDGET_PROP_GRAB_KEYS)) {
+      if (atom == WIDGET_PROP_ATOM_GRAB_KEYS) {
         window_manager_t* wm = WINDOW_MANAGER(widget_get_window_manager(widget));
 
         if (value_bool(v)) {
@@ -2415,7 +2602,7 @@ ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v) {
       } else
 #endif /*WITHOUT_FSCRIPT*/
       {
-        ret = tk_object_set_prop(widget->custom_props, name, v);
+        ret = tk_object_set_prop(extra->custom_props, name, v);
       }
     }
   }
@@ -2429,79 +2616,123 @@ ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v) {
   return ret;
 }
 
-ret_t widget_get_prop(widget_t* widget, const char* name, value_t* v) {
-  ret_t ret = RET_OK;
+ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v) {
   return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
   return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_X)) {
-    value_set_int32(v, widget->x);
-  } else if (tk_str_eq(name, WIDGET_PROP_Y)) {
-    value_set_int32(v, widget->y);
-  } else if (tk_str_eq(name, WIDGET_PROP_W)) {
-    value_set_int32(v, widget->w);
-  } else if (tk_str_eq(name, WIDGET_PROP_H)) {
-    value_set_int32(v, widget->h);
-  } else if (tk_str_eq(name, WIDGET_PROP_OPACITY)) {
-    value_set_int32(v, widget->opacity);
-  } else if (tk_str_eq(name, WIDGET_PROP_VISIBLE)) {
-    value_set_bool(v, widget->visible);
-  } else if (tk_str_eq(name, WIDGET_PROP_SENSITIVE)) {
-    value_set_bool(v, widget->sensitive);
-  } else if (tk_str_eq(name, WIDGET_PROP_FLOATING)) {
-    value_set_bool(v, widget->floating);
-  } else if (tk_str_eq(name, WIDGET_PROP_FOCUSABLE)) {
-    value_set_bool(v, widget_is_focusable(widget));
-  } else if (tk_str_eq(name, WIDGET_PROP_FOCUSED)) {
-    value_set_bool(v, widget->focused);
-  } else if (tk_str_eq(name, WIDGET_PROP_WITH_FOCUS_STATE)) {
-    value_set_bool(v, widget->with_focus_state);
-  } else if (tk_str_eq(name, WIDGET_PROP_DIRTY_RECT_TOLERANCE)) {
-    value_set_int(v, widget->dirty_rect_tolerance);
-  } else if (tk_str_eq(name, WIDGET_PROP_STYLE)) {
-    value_set_str(v, widget->style);
-  } else if (tk_str_eq(name, WIDGET_PROP_STATE)) {
-    value_set_str(v, widget->state);
-  } else if (tk_str_eq(name, WIDGET_PROP_ENABLE)) {
-    value_set_bool(v, widget->enable);
-  } else if (tk_str_eq(name, WIDGET_PROP_FEEDBACK)) {
-    value_set_bool(v, widget->feedback);
-  } else if (tk_str_eq(name, WIDGET_PROP_AUTO_ADJUST_SIZE)) {
-    value_set_bool(v, widget->auto_adjust_size);
-  } else if (tk_str_eq(name, WIDGET_PROP_NAME)) {
-    value_set_str(v, widget->name);
-  } else if (tk_str_eq(name, WIDGET_PROP_ANIMATION)) {
-    value_set_str(v, widget->animation);
-  } else if (tk_str_eq(name, WIDGET_PROP_POINTER_CURSOR)) {
-    value_set_str(v, widget->pointer_cursor);
-  } else if (tk_str_eq(name, WIDGET_PROP_LOADING)) {
-    value_set_bool(v, widget->loading);
-  } else if (tk_str_eq(name, WIDGET_PROP_SELF_LAYOUT)) {
-    if (widget->self_layout != NULL) {
-      value_set_str(v, self_layouter_to_string(widget->self_layout));
-    } else {
-      ret = RET_NOT_FOUND;
-    }
-  } else if (tk_str_eq(name, WIDGET_PROP_CHILDREN_LAYOUT)) {
-    if (widget->children_layout != NULL) {
-      value_set_str(v, children_layouter_to_string(widget->children_layout));
-    } else {
-      ret = RET_NOT_FOUND;
-    }
-  } else if (tk_str_eq(name, WIDGET_PROP_STATE_FROM_PARENT_SYNC)) {
-    value_set_bool(v, widget->state_from_parent_sync);
-  } else if (tk_str_eq(name, WIDGET_PROP_SYNC_STATE_TO_CHILDREN)) {
-    value_set_bool(v, widget->sync_state_to_children);
-  } else {
-    ret = widget_vtable_get_prop(widget, name, v);
-    if (ret == RET_NOT_IMPL) {
-      ret = RET_NOT_FOUND;
-    }
+  return widget_set_prop_impl(widget, widget_prop_atom_from_name(name), name, v);
+}
+
+ret_t widget_set_prop_atom(widget_t* widget, widget_prop_atom_t atom, const value_t* v) {
+  const char* name = widget_prop_atom_to_name(atom);
+  return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
+
+  return widget_set_prop_impl(widget, atom, name, v);
+}
+
+static ret_t widget_get_prop_impl(widget_t* widget, widget_prop_atom_t atom, const char* name,
+                                  value_t* v) {
+  ret_t ret = RET_OK;
+
+  switch (atom) {
+    case WIDGET_PROP_ATOM_X:
+      value_set_int32(v, widget->x);
+      break;
+    case WIDGET_PROP_ATOM_Y:
+      value_set_int32(v, widget->y);
+      break;
+    case WIDGET_PROP_ATOM_W:
+      value_set_int32(v, widget->w);
+      break;
+    case WIDGET_PROP_ATOM_H:
+      value_set_int32(v, widget->h);
+      break;
+    case WIDGET_PROP_ATOM_OPACITY:
+      value_set_int32(v, widget->opacity);
+      break;
+    case WIDGET_PROP_ATOM_VISIBLE:
+      value_set_bool(v, widget->visible);
+      break;
+    case WIDGET_PROP_ATOM_SENSITIVE:
+      value_set_bool(v, widget->sensitive);
+      break;
+    case WIDGET_PROP_ATOM_FLOATING:
+      value_set_bool(v, widget->floating);
+      break;
+    case WIDGET_PROP_ATOM_CACHE_AS_BITMAP:
+      value_set_bool(v, widget->cache_as_bitmap);
+      break;
+    case WIDGET_PROP_ATOM_FOCUSABLE:
+      value_set_bool(v, widget_is_focusable(widget));
+      break;
+    case WIDGET_PROP_ATOM_FOCUSED:
+      value_set_bool(v, widget->focused);
+      break;
+    case WIDGET_PROP_ATOM_WITH_FOCUS_STATE:
+      value_set_bool(v, widget->with_focus_state);
+      break;
+    case WIDGET_PROP_ATOM_DIRTY_RECT_TOLERANCE:
+      value_set_int(v, widget->dirty_rect_tolerance);
+      break;
+    case WIDGET_PROP_ATOM_STYLE:
+      value_set_str(v, widget->style);
+      break;
+    case WIDGET_PROP_ATOM_STATE:
+      value_set_str(v, widget->state);
+      break;
+    case WIDGET_PROP_ATOM_ENABLE:
+      value_set_bool(v, widget->enable);
+      break;
+    case WIDGET_PROP_ATOM_FEEDBACK:
+      value_set_bool(v, widget->feedback);
+      break;
+    case WIDGET_PROP_ATOM_AUTO_ADJUST_SIZE:
+      value_set_bool(v, widget->auto_adjust_size);
+      break;
+    case WIDGET_PROP_ATOM_NAME:
+      value_set_str(v, widget->name);
+      break;
+    case WIDGET_PROP_ATOM_ANIMATION:
+      value_set_str(v, WIDGET_EXTRA(widget, animation));
+      break;
+    case WIDGET_PROP_ATOM_POINTER_CURSOR:
+      value_set_str(v, WIDGET_EXTRA(widget, pointer_cursor));
+      break;
+    case WIDGET_PROP_ATOM_LOADING:
+      value_set_bool(v, widget->loading);
+      break;
+    case WIDGET_PROP_ATOM_SELF_LAYOUT:
+      if (widget->self_layout != NULL) {
+        value_set_str(v, self_layouter_to_string(widget->self_layout));
+      } else {
+        ret = RET_NOT_FOUND;
+      }
+      break;
+    case WIDGET_PROP_ATOM_CHILDREN_LAYOUT:
+      if (widget->children_layout != NULL) {
+        value_set_str(v, children_layouter_to_string(widget->children_layout));
+      } else {
+        ret = RET_NOT_FOUND;
+      }
+      break;
+    case WIDGET_PROP_ATOM_STATE_FROM_PARENT_SYNC:
+      value_set_bool(v, widget->state_from_parent_sync);
+      break;
+    case WIDGET_PROP_ATOM_SYNC_STATE_TO_CHILDREN:
+      value_set_bool(v, widget->sync_state_to_children);
+      break;
+    default:
+      ret = widget_vtable_get_prop(widget, name, v);
+      if (ret == RET_NOT_IMPL) {
+        ret = RET_NOT_FOUND;
+      }
+      break;
   }
 
   /*default*/
   if (ret == RET_NOT_FOUND) {
-    if (tk_str_eq(name, WIDGET_PROP_LAYOUT_W)) {
+    if (atom == WIDGET_PROP_ATOM_LAYOUT_W) {
       if (widget->self_layout != NULL) {
         w_attr_t w_attr =
             (w_attr_t)self_layouter_get_param_int(widget->self_layout, "w_attr", W_ATTR_UNDEF);
@@ -2516,7 +2747,7 @@ ret_t widget_get_prop(widget_t* widget, const char* name, value_t* v) {
         value_set_int32(v, widget->w);
         ret = RET_OK;
       }
-    } else if (tk_str_eq(name, WIDGET_PROP_LAYOUT_H)) {
+    } else if (atom == WIDGET_PROP_ATOM_LAYOUT_H) {
       if (widget->self_layout != NULL) {
         h_attr_t h_attr =
             (h_attr_t)self_layouter_get_param_int(widget->self_layout, "h_attr", H_ATTR_UNDEF);
@@ -2531,10 +2762,10 @@ ret_t widget_get_prop(widget_t* widget, const char* name, value_t* v) {
         value_set_int32(v, widget->h);
         ret = RET_OK;
       }
-    } else if (tk_str_eq(name, WIDGET_PROP_TR_TEXT)) {
+    } else if (atom == WIDGET_PROP_ATOM_TR_TEXT) {
       value_set_str(v, widget->tr_text);
       ret = RET_OK;
-    } else if (tk_str_eq(name, WIDGET_PROP_TEXT)) {
+    } else if (atom == WIDGET_PROP_ATOM_TEXT) {
       wchar_t* text = widget->text.str;
       if (text != NULL) {
         text[widget->text.size] = 0;
@@ -2543,35 +2774,50 @@ ret_t widget_get_prop(widget_t* widget, const char* name, value_t* v) {
       }
       value_set_wstr(v, text);
       ret = RET_OK;
-    } else if (tk_str_eq(name, WIDGET_PROP_STATE_FOR_STYLE)) {
+    } else if (atom == WIDGET_PROP_ATOM_STATE_FOR_STYLE) {
       value_set_str(v, widget_get_state_for_style(widget, FALSE, FALSE));
       ret = RET_OK;
-    } else if (tk_str_eq(name, WIDGET_PROP_DIRTY_RECT)) {
+    } else if (atom == WIDGET_PROP_ATOM_DIRTY_RECT) {
       value_set_rect(v, rect_init(widget->x, widget->y, widget->w, widget->h));
       ret = RET_OK;
     }
   }
 
   if (ret == RET_NOT_FOUND) {
-    if (widget->custom_props != NULL) {
-      ret = tk_object_get_prop(widget->custom_props, name, v);
+    if (WIDGET_EXTRA(widget, custom_props) != NULL) {
+      ret = tk_object_get_prop(widget->extra->custom_props, name, v);
     }
   }
 
   if (ret == RET_NOT_FOUND) {
-    if (tk_str_eq(name, WIDGET_PROP_TYPE)) {
+    if (atom == WIDGET_PROP_ATOM_TYPE) {
       value_set_str(v, widget->vt->type);
       ret = RET_OK;
     }
   }
 
-  if (widget->sync_state_to_children && tk_str_eq(name, WIDGET_PROP_STATE_FOR_STYLE)) {
+  if (widget->sync_state_to_children && atom == WIDGET_PROP_ATOM_STATE_FOR_STYLE) {
     widget_sync_state_to_children(widget, value_str(v));
   }
 
   return ret;
 }
 
+ret_t widget_get_prop(widget_t* widget, const char* name, value_t* v) {
+  return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
+
+  return widget_get_prop_impl(widget, widget_prop_atom_from_name(name), name, v);
+}
+
+ret_t widget_get_prop_atom(widget_t* widget, widget_prop_atom_t atom, value_t* v) {
+  const char* name = widget_prop_atom_to_name(atom);
+  return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
+
+  return widget_get_prop_impl(widget, atom, name, v);
+}
+
 ret_t widget_set_prop_str(widget_t* widget, const char* name, const char* str) {
   value_t v;
   value_set_str(&v, str);
@@ -2686,7 +2932,7 @@ ret_t widget_on_paint_self(widget_t* widget, canvas_t* c) {
   ret = widget_vtable_on_paint_self(widget, c);
   if (ret == RET_NOT_IMPL) {
     paint_event_t e;
-    ret = widget_dispatch(widget, paint_event_init(&e, EVT_PAINT, widget, c));
+    ret = widget_dispatch_paint_event(widget, paint_event_init(&e, EVT_PAINT, widget, c));
   }
 
   return ret;
@@ -2721,13 +2967,24 @@ ret_t widget_on_paint_border(widget_t* widget, canvas_t* c) {
   return ret;
 }
 
+/*事件处理函数和引用计数都不是线程安全的，并行绘制时需要串行分发*/
+static ret_t widget_dispatch_paint_event(widget_t* widget, event_t* e) {
+  ret_t ret = RET_OK;
+
+  tile_painter_lock();
+  ret = widget_dispatch(widget, e);
+  tile_painter_unlock();
+
+  return ret;
+}
+
 static ret_t widget_on_paint_begin(widget_t* widget, canvas_t* c) {
   paint_event_t e;
   ret_t ret = RET_OK;
   return_value_if_fail(widget != NULL && c != NULL, RET_BAD_PARAMS);
   return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
   ret = widget_vtable_on_paint_begin(widget, c);
-  widget_dispatch(widget, paint_event_init(&e, EVT_BEFORE_PAINT, widget, c));
+  widget_dispatch_paint_event(widget, paint_event_init(&e, EVT_BEFORE_PAINT, widget, c));
 
   return ret == RET_NOT_IMPL ? RET_OK : ret;
 }
@@ -2738,7 +2995,7 @@ static ret_t widget_on_paint_done(widget_t* widget, canvas_t* c) {
   return_value_if_fail(widget != NULL && c != NULL, RET_BAD_PARAMS);
   return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
 
-  widget_dispatch(widget, paint_event_init(&e, EVT_PAINT_DONE, widget, c));
+  widget_dispatch_paint_event(widget, paint_event_init(&e, EVT_PAINT_DONE, widget, c));
 
   return ret;
 }
@@ -2750,7 +3007,7 @@ static ret_t widget_on_paint_end(widget_t* widget, canvas_t* c) {
   return_value_if_fail(widget->vt != NULL, RET_BAD_PARAMS);
 
   ret = widget_vtable_on_paint_end(widget, c);
-  widget_dispatch(widget, paint_event_init(&e, EVT_AFTER_PAINT, widget, c));
+  widget_dispatch_paint_event(widget, paint_event_init(&e, EVT_AFTER_PAINT, widget, c));
 
   return ret == RET_NOT_IMPL ? RET_OK : ret;
 }
@@ -2774,7 +3031,7 @@ static ret_t widget_map_key(widget_t* widget, key_event_t* e) {
   value_t v;
   const key_type_value_t* kv = NULL;
 
-  if (widget->custom_props != NULL) {
+  if (WIDGET_EXTRA(widget, custom_props) != NULL) {
     kv = keys_type_find_by_value(e->key);
     if (kv != NULL) {
       const char* to = NULL;
@@ -2782,13 +3039,13 @@ static ret_t widget_map_key(widget_t* widget, key_event_t* e) {
       char fixed_name[TK_NAME_LEN + 1];
 
       tk_snprintf(from, sizeof(from), "map_key:%s", kv->name);
-      if (tk_object_get_prop(widget->custom_props, from, &v) == RET_OK) {
+      if (tk_object_get_prop(widget->extra->custom_props, from, &v) == RET_OK) {
         to = value_str(&v);
       } else if (strlen(kv->name) > 1) {
         tk_strcpy(fixed_name, kv->name);
         tk_str_tolower(fixed_name);
         tk_snprintf(from, sizeof(from), "map_key:%s", fixed_name);
-        if (tk_object_get_prop(widget->custom_props, from, &v) == RET_OK) {
+        if (tk_object_get_prop(widget->extra->custom_props, from, &v) == RET_OK) {
           to = value_str(&v);
         }
       }
@@ -3880,8 +4137,18 @@ static bool_t widget_self_and_ancestors_visible(widget_t* widget) {
 ret_t widget_invalidate(widget_t* widget, const rect_t* r) {
   ret_t ret;
   rect_t rself;
+  widget_t* iter = NULL;
   return_value_if_fail(widget != NULL && widget->vt != NULL, RET_BAD_PARAMS);
 
+  for (iter = widget; iter != NULL; iter = iter->parent) {
+    if (iter->display_list != NULL) {
+      display_list_invalidate(iter->display_list);
+    }
+    if (iter->cache_as_bitmap && layer_cache() != NULL) {
+      layer_cache_invalidate(layer_cache(), iter);
+    }
+  }
+
   if (widget->dirty) {
     return RET_OK;
   }
@@ -3989,6 +4256,8 @@ ret_t widget_get_prop_default_value(widget_t* widget, const char* name, value_t*
     value_set_bool(v, TRUE);
   } else if (tk_str_eq(name, WIDGET_PROP_FLOATING)) {
     value_set_bool(v, FALSE);
+  } else if (tk_str_eq(name, WIDGET_PROP_CACHE_AS_BITMAP)) {
+    value_set_bool(v, FALSE);
   } else if (tk_str_eq(name, WIDGET_PROP_FOCUSABLE)) {
     value_set_bool(v, FALSE);
   } else if (tk_str_eq(name, WIDGET_PROP_WITH_FOCUS_STATE)) {
@@ -4132,12 +4401,16 @@ int32_t widget_index_of(const widget_t* widget) {
 ret_t widget_prepare_text_style_ex(widget_t* widget, canvas_t* c, color_t default_trans,
                                    const char* default_font, uint16_t default_font_size,
                                    align_h_t default_align_h, align_v_t default_align_v) {
-  style_t* style = widget->astyle;
-  color_t tc = style_get_color(style, STYLE_ID_TEXT_COLOR, default_trans);
-  const char* font_name = style_get_str(style, STYLE_ID_FONT_NAME, default_font);
-  uint16_t font_size = style_get_int(style, STYLE_ID_FONT_SIZE, default_font_size);
-  align_h_t align_h = (align_h_t)style_get_int(style, STYLE_ID_TEXT_ALIGN_H, default_align_h);
-  align_v_t align_v = (align_v_t)style_get_int(style, STYLE_ID_TEXT_ALIGN_V, default_align_v);
+  const style_snapshot_t* snapshot = style_get_snapshot(widget->astyle);
+  color_t tc =
+      STYLE_SNAPSHOT_GET(snapshot, text_color, STYLE_SNAPSHOT_HAS_TEXT_COLOR, default_trans);
+  const char* font_name = snapshot->font_name != NULL ? snapshot->font_name : default_font;
+  uint16_t font_size =
+      STYLE_SNAPSHOT_GET(snapshot, font_size, STYLE_SNAPSHOT_HAS_FONT_SIZE, default_font_size);
+  align_h_t align_h = (align_h_t)STYLE_SNAPSHOT_GET(
+      snapshot, text_align_h, STYLE_SNAPSHOT_HAS_TEXT_ALIGN_H, default_align_h);
+  align_v_t align_v = (align_v_t)STYLE_SNAPSHOT_GET(
+      snapshot, text_align_v, STYLE_SNAPSHOT_HAS_TEXT_ALIGN_V, default_align_v);
 
   canvas_set_text_color(c, tc);
   canvas_set_font(c, font_name, font_size);
@@ -4175,6 +4448,7 @@ static const char* const s_widget_persistent_props[] = {WIDGET_PROP_NAME,
                                                         WIDGET_PROP_ENABLE,
                                                         WIDGET_PROP_VISIBLE,
                                                         WIDGET_PROP_FLOATING,
+                                                        WIDGET_PROP_CACHE_AS_BITMAP,
                                                         WIDGET_PROP_CHILDREN_LAYOUT,
                                                         WIDGET_PROP_SELF_LAYOUT,
                                                         WIDGET_PROP_OPACITY,
@@ -4192,7 +4466,7 @@ const char* const* widget_get_persistent_props(void) {
 
 static ret_t widget_copy_base_props(widget_t* widget, widget_t* other) {
   widget->state = tk_str_copy(widget->state, other->state);
-  widget->name = tk_str_copy(widget->name, other->name);
+  widget_set_name(widget, other->name);
   widget->style = tk_str_copy(widget->style, other->style);
 
   if (other->text.str != NULL) {
@@ -4203,22 +4477,23 @@ static ret_t widget_copy_base_props(widget_t* widget, widget_t* other) {
     widget_set_tr_text(widget, other->tr_text);
   }
 
-  widget->enable = other->enable;
-  widget->visible = other->visible;
-  widget->floating = other->floating;
+  widget->enable = other->enable ? TRUE : FALSE;
+  widget->visible = other->visible ? TRUE : FALSE;
+  widget->floating = other->floating ? TRUE : FALSE;
+  widget->cache_as_bitmap = other->cache_as_bitmap ? TRUE : FALSE;
   widget->opacity = other->opacity;
-  widget->feedback = other->feedback;
-  widget->auto_adjust_size = other->auto_adjust_size;
-  widget->focusable = other->focusable;
-  widget->sensitive = other->sensitive;
-  widget->auto_created = other->auto_created;
-  widget->with_focus_state = other->with_focus_state;
+  widget->feedback = other->feedback ? TRUE : FALSE;
+  widget->auto_adjust_size = other->auto_adjust_size ? TRUE : FALSE;
+  widget->focusable = other->focusable ? TRUE : FALSE;
+  widget->sensitive = other->sensitive ? TRUE : FALSE;
+  widget->auto_created = other->auto_created ? TRUE : FALSE;
+  widget->with_focus_state = other->with_focus_state ? TRUE : FALSE;
   widget->dirty_rect_tolerance = other->dirty_rect_tolerance;
-  widget->sync_state_to_children = other->sync_state_to_children;
-  widget->state_from_parent_sync = other->state_from_parent_sync;
+  widget->sync_state_to_children = other->sync_state_to_children ? TRUE : FALSE;
+  widget->state_from_parent_sync = other->state_from_parent_sync ? TRUE : FALSE;
 
-  if (other->animation != NULL && *(other->animation)) {
-    widget_set_animation(widget, other->animation);
+  if (WIDGET_EXTRA(other, animation) != NULL && *(other->extra->animation)) {
+    widget_set_animation(widget, other->extra->animation);
   }
 
   if (other->self_layout != NULL) {
@@ -4239,8 +4514,9 @@ static ret_t widget_copy(widget_t* widget, widget_t* other) {
   widget_copy_style(widget, other);
   widget_copy_base_props(widget, other);
 
-  if (other->custom_props) {
-    widget->custom_props = object_default_clone(OBJECT_DEFAULT(other->custom_props));
+  if (WIDGET_EXTRA(other, custom_props) != NULL && widget_get_extra(widget) != NULL) {
+    widget->extra->custom_props =
+        object_default_clone(OBJECT_DEFAULT(other->extra->custom_props));
   }
 
   if (widget_vtable_on_copy(widget, other) == RET_NOT_IMPL) {
@@ -4393,6 +4669,96 @@ ret_t widget_load_image(widget_t* widget, const char* name, bitmap_t* bitmap) {
   return image_manager_get_bitmap(imm, name, bitmap);
 }
 
+static ret_t widget_on_load_image_async_done(void* ctx, event_t* e) {
+  widget_t* widget = WIDGET(ctx);
+
+  widget_invalidate_force(widget, NULL);
+
+  return RET_OK;
+}
+
+ret_t widget_load_image_async(widget_t* widget, const char* name, bitmap_t* bitmap,
+                              int32_t priority) {
+  ret_t ret = RET_OK;
+  char real_name[MAX_PATH + 1];
+  const char* region = NULL;
+  image_manager_t* imm = widget_get_image_manager(widget);
+
+  return_value_if_fail(imm != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(widget != NULL && name != NULL && bitmap != NULL, RET_BAD_PARAMS);
+
+  region = strrchr(name, '#');
+  if (region != NULL) {
+    tk_strncpy(real_name, name, region - name);
+    name = real_name;
+  }
+
+  ret = image_manager_get_bitmap_async(imm, name, bitmap, priority,
+                                       widget_on_load_image_async_done, widget);
+  if (ret == RET_BUSY) {
+    widget_extra_t* extra = widget_get_extra(widget);
+    if (extra == NULL) {
+      image_manager_cancel_async(imm, widget_on_load_image_async_done, widget);
+      return widget_load_image(widget, name, bitmap);
+    }
+    extra->async_image_manager = imm;
+  }
+
+  return ret;
+}
+
+ret_t widget_cancel_load_image_async(widget_t* widget) {
+  image_manager_t* imm = NULL;
+  return_value_if_fail(widget != NULL, RET_BAD_PARAMS);
+
+  imm = WIDGET_EXTRA(widget, async_image_manager);
+  if (imm != NULL) {
+    widget->extra->async_image_manager = NULL;
+    return image_manager_cancel_async(imm, widget_on_load_image_async_done, widget);
+  }
+
+  return RET_OK;
+}
+
+typedef struct _widget_viewport_info_t {
+  widget_t* viewport;
+  rect_t r;
+} widget_viewport_info_t;
+
+static bool_t widget_is_out_of_viewport(void* ctx, event_func_t on_done, void* on_done_ctx) {
+  rect_t r;
+  point_t p = {0, 0};
+  widget_t* widget = WIDGET(on_done_ctx);
+  widget_viewport_info_t* info = (widget_viewport_info_t*)ctx;
+
+  if (on_done != widget_on_load_image_async_done || !widget_is_parent_of(info->viewport, widget)) {
+    return FALSE;
+  }
+
+  widget_to_screen(widget, &p);
+  r = rect_init(p.x, p.y, widget->w, widget->h);
+
+  return !rect_has_intersect(&r, &(info->r));
+}
+
+ret_t widget_cancel_load_image_async_invisible(widget_t* viewport) {
+  point_t p;
+  widget_viewport_info_t info;
+  return_value_if_fail(viewport != NULL, RET_BAD_PARAMS);
+
+  p.x = viewport->x;
+  p.y = viewport->y;
+  if (viewport->parent != NULL) {
+    widget_to_screen(viewport->parent, &p);
+  }
+
+  info.viewport = viewport;
+  info.r = rect_init(p.x, p.y, viewport->w, viewport->h);
+
+  return image_manager_cancel_async_if(widget_get_image_manager(viewport),
+                                       widget_is_out_of_viewport, &info);
+}
+
 ret_t widget_unload_image(widget_t* widget, bitmap_t* bitmap) {
   image_manager_t* imm = widget_get_image_manager(widget);
 
@@ -5539,12 +5905,17 @@ rect_t widget_get_content_area(widget_t* widget) {
 
 rect_t widget_get_content_area_ex(widget_t* widget, int32_t default_margin) {
   if (widget != NULL && widget->astyle != NULL) {
-    style_t* style = widget->astyle;
-    int32_t margin = style_get_int(style, STYLE_ID_MARGIN, default_margin);
-    int32_t margin_top = style_get_int(style, STYLE_ID_MARGIN_TOP, margin);
-    int32_t margin_left = style_get_int(style, STYLE_ID_MARGIN_LEFT, margin);
-    int32_t margin_right = style_get_int(style, STYLE_ID_MARGIN_RIGHT, margin);
-    int32_t margin_bottom = style_get_int(style, STYLE_ID_MARGIN_BOTTOM, margin);
+    const style_snapshot_t* snapshot = style_get_snapshot(widget->astyle);
+    int32_t margin =
+        STYLE_SNAPSHOT_GET(snapshot, margin, STYLE_SNAPSHOT_HAS_MARGIN, default_margin);
+    int32_t margin_top =
+        STYLE_SNAPSHOT_GET(snapshot, margin_top, STYLE_SNAPSHOT_HAS_MARGIN_TOP, margin);
+    int32_t margin_left =
+        STYLE_SNAPSHOT_GET(snapshot, margin_left, STYLE_SNAPSHOT_HAS_MARGIN_LEFT, margin);
+    int32_t margin_right =
+        STYLE_SNAPSHOT_GET(snapshot, margin_right, STYLE_SNAPSHOT_HAS_MARGIN_RIGHT, margin);
+    int32_t margin_bottom =
+        STYLE_SNAPSHOT_GET(snapshot, margin_bottom, STYLE_SNAPSHOT_HAS_MARGIN_BOTTOM, margin);
     int32_t w = widget->w - margin_left - margin_right;
     int32_t h = widget->h - margin_top - margin_bottom;
 
@@ -42,7 +42,9 @@
 #include "base/layout_def.h"
 #include "base/locale_info.h"
 #include "base/image_manager.h"
+#include "base/display_list.h"
 #include "base/widget_consts.h"
+#include "base/widget_prop_atom.h"
 #include "base/self_layouter.h"
 #include "base/widget_animator.h"
 #include "base/children_layouter.h"
@@ -161,6 +163,12 @@ struct _widget_vtable_t {
    */
   bool_t allow_draw_outside;
 
+  /**
+   * on_paint_xxx是否可以在多个线程中同时执行(参考tile_painter_t，只读取控件和共享资源的状态)。
+   *>子类无法继承。
+   */
+  bool_t paint_thread_safe;
+
   /**
    * dynamic parent class vtable
    * 该属性用于动态继承使用的获取父类虚表。（parent 和 get_parent_vt 只能二选一）
@@ -229,6 +237,49 @@ struct _widget_vtable_t {
   widget_init_t init;
 };
 
+/**
+ * @class widget_extra_t
+ * 控件中很少用到的数据。
+ *
+ * 放在单独分配的内存中(第一次设置时才分配)，减少widget_t的大小，让遍历控件树时访问的数据更紧凑。
+ * 通过widget\_t的extra成员访问，extra可能为NULL，请用WIDGET\_EXTRA宏读取。
+ */
+typedef struct _widget_extra_t {
+  /**
+   * @property {char*} pointer_cursor
+   * @annotation ["readable"]
+   * 鼠标光标图片名称。
+   *
+   * > 通过widget\_set\_prop/widget\_get\_prop访问控件的WIDGET\_PROP\_POINTER\_CURSOR属性。
+   */
+  char* pointer_cursor;
+  /**
+   * @property {char*} animation
+   * @annotation ["readable"]
+   * 动画参数。请参考[控件动画](https://github.com/zlgopen/awtk/blob/master/docs/widget_animator.md)
+   *
+   * > 通过widget\_set\_prop/widget\_get\_prop访问控件的WIDGET\_PROP\_ANIMATION属性。
+   */
+  char* animation;
+  /**
+   * @property {tk_object_t*} custom_props
+   * @annotation ["readable"]
+   * 自定义属性。
+   *
+   * > 用widget\_set\_prop设置控件不认识的属性时自动创建。
+   */
+  tk_object_t* custom_props;
+
+  /* private */
+  /* 用于将分发的事件转给 object_widget */
+  event_func_t dispatch_callback;
+  void* dispatch_callback_ctx;
+  /* 异步加载图片使用的图片管理器，参考 widget_load_image_async */
+  image_manager_t* async_image_manager;
+} widget_extra_t;
+
+#define WIDGET_EXTRA(widget, field) ((widget)->extra != NULL ? (widget)->extra->field : NULL)
+
 /**
  * @class widget_t
  * @annotation ["scriptable","widget"]
@@ -318,74 +369,72 @@ struct _widget_t {
    */
   wh_t h;
   /**
-   * @property {char*} name
-   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
-   * 控件名字。
+   * @property {const widget_vtable_t*} vt
+   * @annotation ["readable"]
+   * 虚函数表。
    */
-  char* name;
+  const widget_vtable_t* vt;
   /**
-   * @property {char*} pointer_cursor
-   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
-   * 鼠标光标图片名称。
+   * @property {widget_t*} parent
+   * @annotation ["readable", "scriptable"]
+   * 父控件
    */
-  char* pointer_cursor;
+  widget_t* parent;
   /**
-   * @property {char*} tr_text
-   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
-   * 保存用于翻译的字符串。
+   * @property {darray_t*} children
+   * @annotation ["readable"]
+   * 全部子控件。
    */
-  char* tr_text;
+  darray_t* children;
   /**
-   * @property {char*} style
-   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
-   * style的名称。
+   * @property {emitter_t*} emitter
+   * @annotation ["readable"]
+   * 事件发射器。
    */
-  char* style;
+  emitter_t* emitter;
   /**
-   * @property {char*} animation
-   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
-   * 动画参数。请参考[控件动画](https://github.com/zlgopen/awtk/blob/master/docs/widget_animator.md)
+   * @property {style_t*} astyle
+   * @annotation ["readable"]
+   * Style对象。
    */
-  char* animation;
+  style_t* astyle;
   /**
    * @property {bool_t} enable
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 启用/禁用状态。
    */
-  bool_t enable;
+  bool_t enable : 1;
   /**
    * @property {bool_t} feedback
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 是否启用按键音、触屏音和震动等反馈。
    */
-  bool_t feedback;
+  bool_t feedback : 1;
   /**
    * @property {bool_t} visible
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 是否可见。
    */
-  bool_t visible;
+  bool_t visible : 1;
   /**
    * @property {bool_t} sensitive
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 是否接受用户事件。
    */
-  bool_t sensitive;
+  bool_t sensitive : 1;
   /**
    * @property {bool_t} focusable
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 是否支持焦点停留。
    */
-  bool_t focusable;
-
+  bool_t focusable : 1;
   /**
    * @property {bool_t} with_focus_state
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 是否支持焦点状态。
    * > 如果希望style支持焦点状态，但又不希望焦点停留，可用本属性。
    */
-  bool_t with_focus_state;
-
+  bool_t with_focus_state : 1;
   /**
    * @property {bool_t} auto_adjust_size
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
@@ -394,81 +443,75 @@ struct _widget_t {
    *> 为true时，最好不要使用 layout 的相关东西，否则可能有冲突。
    *> 注意：只是调整控件的本身的宽高，不会修改控件本身的位置，仅部分控件实现该效果。
    */
-  bool_t auto_adjust_size;
-
+  bool_t auto_adjust_size : 1;
   /**
    * @property {bool_t} focused
    * @annotation ["readable"]
    * 是否得到焦点。
    */
-  bool_t focused;
+  bool_t focused : 1;
   /**
    * @property {bool_t} auto_created
    * @annotation ["readable"]
    * 是否由父控件自动创建。
    */
-  bool_t auto_created;
+  bool_t auto_created : 1;
   /**
    * @property {bool_t} dirty
    * @annotation ["readable"]
    * 标识控件是否需要重绘。
    */
-  bool_t dirty;
+  bool_t dirty : 1;
   /**
    * @property {bool_t} floating
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 标识控件是否启用浮动布局，不受父控件的children_layout的控制。
    */
-  bool_t floating;
+  bool_t floating : 1;
   /**
-   * @property {bool_t} need_update_style
-   * @annotation ["readable"]
-   * 标识控件是否需要update style。
+   * @property {bool_t} cache_as_bitmap
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 标识是否把控件及其子控件缓存为位图(缺省FALSE)。
+   *
+   *> 子控件没有变化时直接绘制缓存的位图，适用于内容复杂但很少变化的控件，详情请参考[layer_cache](layer_cache_t.md)。
    */
-  bool_t need_update_style;
+  bool_t cache_as_bitmap : 1;
   /**
-   * @property {int32_t} ref_count
+   * @property {bool_t} need_update_style
    * @annotation ["readable"]
-   * 引用计数，计数为0时销毁。
+   * 标识控件是否需要update style。
    */
-  int32_t ref_count;
-
+  bool_t need_update_style : 1;
   /**
    * @property {bool_t} initializing
    * @annotation ["readable"]
    * 标识控件正在初始化。
    */
-  bool_t initializing;
+  bool_t initializing : 1;
   /**
    * @property {bool_t} loading
    * @annotation ["readable"]
    * 标识控件正在加载。
    */
-  bool_t loading;
+  bool_t loading : 1;
   /**
    * @property {bool_t} destroying
    * @annotation ["readable"]
    * 标识控件正在被销毁。
    */
-  bool_t destroying;
+  bool_t destroying : 1;
   /**
    * @property {bool_t} sync_state_to_children
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 标识是否将当前控件状态同步到子控件中。
    */
-  bool_t sync_state_to_children;
+  bool_t sync_state_to_children : 1;
   /**
    * @property {bool_t} state_from_parent_sync
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
    * 标识是否接收父控件的状态同步。
    */
-  bool_t state_from_parent_sync;
-  /**
-   * @property {char*} state
-   * @annotation ["set_prop","get_prop","readable"]
-   * 控件的状态(取值参考widget_state_t)。
-   */
-  char* state;
+  bool_t state_from_parent_sync : 1;
   /**
    * @property {uint8_t} opacity
    * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
@@ -483,7 +526,36 @@ struct _widget_t {
    *> 如果 border 太粗或 offset 太大等原因，导致脏矩形超出控件本身大小太多（大于缺省值）时，才需要指定。
    */
   uint16_t dirty_rect_tolerance;
-
+  /**
+   * @property {self_layouter_t*} self_layout
+   * @annotation ["readable", "set_prop", "get_prop"]
+   * 控件布局器。请参考[控件布局参数](https://github.com/zlgopen/awtk/blob/master/docs/layout.md)
+   */
+  self_layouter_t* self_layout;
+  /**
+   * @property {children_layouter_t*} children_layout
+   * @annotation ["readable", "set_prop", "get_prop"]
+   * 子控件布局器。请参考[控件布局参数](https://github.com/zlgopen/awtk/blob/master/docs/layout.md)
+   */
+  children_layouter_t* children_layout;
+  /**
+   * @property {char*} name
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 控件名字。
+   */
+  char* name;
+  /**
+   * @property {char*} state
+   * @annotation ["set_prop","get_prop","readable"]
+   * 控件的状态(取值参考widget_state_t)。
+   */
+  char* state;
+  /**
+   * @property {char*} style
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * style的名称。
+   */
+  char* style;
   /**
    * @property {wstr_t} text
    * @annotation ["readable"]
@@ -491,17 +563,23 @@ struct _widget_t {
    */
   wstr_t text;
   /**
-   * @property {widget_t*} parent
-   * @annotation ["readable", "scriptable"]
-   * 父控件
+   * @property {char*} tr_text
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 保存用于翻译的字符串。
    */
-  widget_t* parent;
+  char* tr_text;
   /**
    * @property {widget_t*} target
    * @annotation ["private"]
    * 接收事件的子控件。
    */
   widget_t* target;
+  /**
+   * @property {widget_t*} key_target
+   * @annotation ["private"]
+   * 接收按键事件的子控件。
+   */
+  widget_t* key_target;
   /**
    * @property {widget_t*} grab_widget
    * @annotation ["private"]
@@ -515,60 +593,18 @@ struct _widget_t {
    */
   int32_t grab_widget_count;
   /**
-   * @property {widget_t*} key_target
-   * @annotation ["private"]
-   * 接收按键事件的子控件。
-   */
-  widget_t* key_target;
-  /**
-   * @property {darray_t*} children
-   * @annotation ["readable"]
-   * 全部子控件。
-   */
-  darray_t* children;
-  /**
-   * @property {emitter_t*} emitter
-   * @annotation ["readable"]
-   * 事件发射器。
-   */
-  emitter_t* emitter;
-  /**
-   * @property {style_t*} astyle
-   * @annotation ["readable"]
-   * Style对象。
-   */
-  style_t* astyle;
-  /**
-   * @property {children_layouter_t*} children_layout
-   * @annotation ["readable", "set_prop", "get_prop"]
-   * 子控件布局器。请参考[控件布局参数](https://github.com/zlgopen/awtk/blob/master/docs/layout.md)
-   */
-  children_layouter_t* children_layout;
-  /**
-   * @property {self_layouter_t*} self_layout
-   * @annotation ["readable", "set_prop", "get_prop"]
-   * 控件布局器。请参考[控件布局参数](https://github.com/zlgopen/awtk/blob/master/docs/layout.md)
-   */
-  self_layouter_t* self_layout;
-  /**
-   * @property {tk_object_t*} custom_props
-   * @annotation ["readable"]
-   * 自定义属性。
-   */
-  tk_object_t* custom_props;
-
-  /**
-   * @property {const widget_vtable_t*} vt
+   * @property {int32_t} ref_count
    * @annotation ["readable"]
-   * 虚函数表。
+   * 引用计数，计数为0时销毁。
    */
-  const widget_vtable_t* vt;
+  int32_t ref_count;
 
   /* private */
   char* last_state_for_style; /* 上一次的 state_for_style */
-  /* 用于将分发的事件转给 object_widget */
-  event_func_t dispatch_callback;
-  void* dispatch_callback_ctx;
+  /* 缓存的绘制命令，参考 widget_paint_with_display_list */
+  display_list_t* display_list;
+  /* 很少用到的数据，需要时才分配，参考 widget_extra_t */
+  widget_extra_t* extra;
 };
 
 /**
@@ -1610,6 +1646,18 @@ ret_t widget_set_auto_adjust_size(widget_t* widget, bool_t auto_adjust_size);
  */
 ret_t widget_set_floating(widget_t* widget, bool_t floating);
 
+/**
+ * @method widget_set_cache_as_bitmap
+ * 设置是否把控件及其子控件缓存为位图。
+ *
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget 控件对象。
+ * @param {bool_t} cache_as_bitmap 是否缓存为位图。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_set_cache_as_bitmap(widget_t* widget, bool_t cache_as_bitmap);
+
 /**
  * @method widget_set_focused
  * 设置控件是否获得焦点。
@@ -1956,6 +2004,23 @@ ret_t widget_invalidate_force(widget_t* widget, const rect_t* r);
  */
 ret_t widget_paint(widget_t* widget, canvas_t* c);
 
+/**
+ * @method widget_paint_with_display_list
+ * 通过绘制命令列表绘制控件到一个canvas上。
+ *
+ * 第一次绘制(或者控件及其子控件调用widget\_invalidate之后)时录制控件的绘制命令，
+ * 之后直接按canvas当前的原点回放，适用于内容不变、只是位置变化的情况(如窗口动画)。
+ *
+ * > 回放时不会分发绘制事件。不支持录制的canvas或者控件用到了vgcanvas时，
+ * > 等同于widget\_paint。
+ *
+ * @param {widget_t*} widget 控件对象。
+ * @param {canvas_t*} c 画布对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_paint_with_display_list(widget_t* widget, canvas_t* c);
+
 /**
  * @method widget_draw_text_in_rect
  * 在canvas绘制一行文本。
@@ -2059,6 +2124,28 @@ ret_t widget_get_prop_default_value(widget_t* widget, const char* name, value_t*
  */
 ret_t widget_set_prop(widget_t* widget, const char* name, const value_t* v);
 
+/**
+ * @method widget_get_prop_atom
+ * 获取控件指定属性的值(用原子指定属性，省去属性名到原子的转换)。
+ * @param {widget_t*} widget 控件对象。
+ * @param {widget_prop_atom_t} atom 属性的原子。
+ * @param {value_t*} v 返回属性的值。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_get_prop_atom(widget_t* widget, widget_prop_atom_t atom, value_t* v);
+
+/**
+ * @method widget_set_prop_atom
+ * 设置控件指定属性的值(用原子指定属性，省去属性名到原子的转换)。
+ * @param {widget_t*} widget 控件对象。
+ * @param {widget_prop_atom_t} atom 属性的原子。
+ * @param {const value_t*} v 属性的值。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_set_prop_atom(widget_t* widget, widget_prop_atom_t atom, const value_t* v);
+
 /**
  * @method widget_set_props
  * 设置多个参数。
@@ -2595,6 +2682,47 @@ ret_t widget_remove_idle(widget_t* widget, uint32_t idle_id);
  */
 ret_t widget_load_image(widget_t* widget, const char* name, bitmap_t* bitmap);
 
+/**
+ * @method widget_load_image_async
+ * 异步加载图片。
+ *
+ * 图片已经在缓存中时，与widget\_load\_image相同。否则在后台线程中解码并返回RET\_BUSY，
+ * 解码完成后重绘控件，在下次绘制时再调用本函数即可拿到图片。
+ *
+ * > 控件销毁时自动取消没有完成的请求。
+ *
+ * @param {widget_t*} widget 控件对象。
+ * @param {const char*}  name 图片名(不带扩展名)。
+ * @param {bitmap_t*} bitmap 返回图片对象。
+ * @param {int32_t} priority 优先级(越大越优先)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，RET_BUSY表示正在解码，否则表示失败。
+ */
+ret_t widget_load_image_async(widget_t* widget, const char* name, bitmap_t* bitmap,
+                              int32_t priority);
+
+/**
+ * @method widget_cancel_load_image_async
+ * 取消控件异步加载图片的请求。
+ *
+ * @param {widget_t*} widget 控件对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_cancel_load_image_async(widget_t* widget);
+
+/**
+ * @method widget_cancel_load_image_async_invisible
+ * 取消viewport的子控件中，已经不在viewport可见范围内的控件异步加载图片的请求。
+ *
+ *> 一般在滚动时调用，让可见的图片优先解码。
+ *
+ * @param {widget_t*} viewport 视口控件(如scroll\_view)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_cancel_load_image_async_invisible(widget_t* viewport);
+
 /**
  * @method widget_unload_image
  * 卸载图片。
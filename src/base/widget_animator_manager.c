@@ -86,6 +86,14 @@ static ret_t widget_animator_manager_on_timer(const timer_info_t* info) {
   uint64_t last_dispatch_time = am->last_dispatch_time ? am->last_dispatch_time : info->now;
   uint32_t elapsed_time = info->now - last_dispatch_time;
 
+  /*没有动画时挂起定时器，避免空闲时周期性唤醒主循环*/
+  if (am->first == NULL) {
+    am->last_dispatch_time = 0;
+    timer_suspend(am->timer_id);
+
+    return RET_REPEAT;
+  }
+
   widget_animator_manager_time_elapse(am, elapsed_time);
 
   am->last_dispatch_time = info->now;
@@ -151,6 +159,13 @@ ret_t widget_animator_manager_add(widget_animator_manager_t* am, widget_animator
   }
   animator->widget_animator_manager = am;
 
+  if (am->timer_id != TK_INVALID_ID) {
+    const timer_info_t* timer = timer_find(am->timer_id);
+    if (timer != NULL && timer->suspend) {
+      timer_resume(am->timer_id);
+    }
+  }
+
   return RET_OK;
 }
 
@@ -215,6 +215,19 @@ BEGIN_C_DECLS
  */
 #define WIDGET_PROP_STRONGLY_FOCUS "strongly_focus"
 
+/**
+ * @const WIDGET_PROP_NAME_INDEX
+ * 窗口是否建立控件名称索引，以加快widget\_lookup。
+ */
+#define WIDGET_PROP_NAME_INDEX "name_index"
+
+/**
+ * @const WIDGET_PROP_LAZY_CHILDREN
+ * 容器控件(如pages、slide\_view和scroll\_view)在UI文件中使用。
+ * 为true时，直接子控件的子控件在该子控件第一次绘制时才创建；为idle时，另外在空闲时逐个创建。
+ */
+#define WIDGET_PROP_LAZY_CHILDREN "lazy_children"
+
 /**
  * @const WIDGET_PROP_CHILDREN_LAYOUT
  * 子控件布局参数。
@@ -383,6 +396,12 @@ BEGIN_C_DECLS
  */
 #define WIDGET_PROP_FLOATING "floating"
 
+/**
+ * @const WIDGET_PROP_CACHE_AS_BITMAP
+ * 是否把控件及其子控件缓存为位图。
+ */
+#define WIDGET_PROP_CACHE_AS_BITMAP "cache_as_bitmap"
+
 /**
  * @const WIDGET_PROP_MARGIN
  * 边距。
@@ -835,6 +854,12 @@ BEGIN_C_DECLS
  */
 #define WIDGET_PROP_DRAW_TYPE "draw_type"
 
+/**
+ * @const WIDGET_PROP_ASYNC_LOAD
+ * 是否在后台线程中异步解码图片。
+ */
+#define WIDGET_PROP_ASYNC_LOAD "async_load"
+
 /**
  * @const WIDGET_PROP_SELECTABLE
  * 是否可选择。
@@ -0,0 +1,271 @@
+﻿/**
+ * File:   widget_name_index.c
+ * Author: AWTK Develop Team
+ * Brief:  name to widget index of a window
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "base/widget_name_index.h"
+
+#define WIDGET_NAME_INDEX_MIN_CAPACITY 64
+
+static uint32_t widget_name_index_hash(const char* name) {
+  /*FNV-1a*/
+  uint32_t hash = 2166136261u;
+  const uint8_t* p = (const uint8_t*)name;
+
+  while (*p) {
+    hash ^= *p++;
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+static ret_t widget_name_index_resize(widget_name_index_t* index, uint32_t capacity) {
+  uint32_t i = 0;
+  widget_name_index_node_t** buckets = TKMEM_ZALLOCN(widget_name_index_node_t*, capacity);
+  return_value_if_fail(buckets != NULL, RET_OOM);
+
+  for (i = 0; i < index->capacity; i++) {
+    widget_name_index_node_t* iter = index->buckets[i];
+    while (iter != NULL) {
+      widget_name_index_node_t* next = iter->next;
+      uint32_t b = iter->hash & (capacity - 1);
+
+      iter->next = buckets[b];
+      buckets[b] = iter;
+      iter = next;
+    }
+  }
+
+  TKMEM_FREE(index->buckets);
+  index->buckets = buckets;
+  index->capacity = capacity;
+
+  return RET_OK;
+}
+
+static ret_t widget_name_index_add_one(widget_name_index_t* index, widget_t* widget) {
+  uint32_t b = 0;
+  widget_name_index_node_t* node = NULL;
+
+  if (widget->name == NULL) {
+    return RET_OK;
+  }
+
+  if (index->size >= index->capacity) {
+    widget_name_index_resize(index, index->capacity * 2);
+  }
+
+  node = TKMEM_ZALLOC(widget_name_index_node_t);
+  return_value_if_fail(node != NULL, RET_OOM);
+
+  node->widget = widget;
+  node->hash = widget_name_index_hash(widget->name);
+  b = node->hash & (index->capacity - 1);
+  node->next = index->buckets[b];
+  index->buckets[b] = node;
+  index->size++;
+
+  return RET_OK;
+}
+
+static ret_t widget_name_index_remove_one(widget_name_index_t* index, widget_t* widget) {
+  widget_name_index_node_t* prev = NULL;
+  widget_name_index_node_t* iter = NULL;
+
+  if (widget->name == NULL) {
+    return RET_OK;
+  }
+
+  iter = index->buckets[widget_name_index_hash(widget->name) & (index->capacity - 1)];
+  while (iter != NULL) {
+    if (iter->widget == widget) {
+      if (prev != NULL) {
+        prev->next = iter->next;
+      } else {
+        index->buckets[iter->hash & (index->capacity - 1)] = iter->next;
+      }
+      TKMEM_FREE(iter);
+      index->size--;
+
+      return RET_OK;
+    }
+    prev = iter;
+    iter = iter->next;
+  }
+
+  return RET_NOT_FOUND;
+}
+
+widget_name_index_t* widget_name_index_create(widget_t* root) {
+  widget_name_index_t* index = NULL;
+  return_value_if_fail(root != NULL, NULL);
+
+  index = TKMEM_ZALLOC(widget_name_index_t);
+  return_value_if_fail(index != NULL, NULL);
+
+  if (widget_name_index_resize(index, WIDGET_NAME_INDEX_MIN_CAPACITY) != RET_OK) {
+    TKMEM_FREE(index);
+    return NULL;
+  }
+
+  WIDGET_FOR_EACH_CHILD_BEGIN(root, iter, i)
+  widget_name_index_add(index, iter, TRUE);
+  WIDGET_FOR_EACH_CHILD_END();
+
+  return index;
+}
+
+ret_t widget_name_index_add(widget_name_index_t* index, widget_t* widget, bool_t recursive) {
+  return_value_if_fail(index != NULL && widget != NULL, RET_BAD_PARAMS);
+
+  widget_name_index_add_one(index, widget);
+  if (recursive) {
+    WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+    widget_name_index_add(index, iter, TRUE);
+    WIDGET_FOR_EACH_CHILD_END();
+  }
+
+  return RET_OK;
+}
+
+ret_t widget_name_index_remove(widget_name_index_t* index, widget_t* widget, bool_t recursive) {
+  return_value_if_fail(index != NULL && widget != NULL, RET_BAD_PARAMS);
+
+  widget_name_index_remove_one(index, widget);
+  if (recursive) {
+    WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+    widget_name_index_remove(index, iter, TRUE);
+    WIDGET_FOR_EACH_CHILD_END();
+  }
+
+  return RET_OK;
+}
+
+static uint32_t widget_name_index_depth(widget_t* widget) {
+  uint32_t depth = 0;
+
+  while (widget->parent != NULL) {
+    widget = widget->parent;
+    depth++;
+  }
+
+  return depth;
+}
+
+/*a在深度优先遍历中是否排在b前面(a和b在同一棵树中)*/
+static bool_t widget_name_index_before(widget_t* a, widget_t* b) {
+  uint32_t da = widget_name_index_depth(a);
+  uint32_t db = widget_name_index_depth(b);
+
+  while (da > db) {
+    a = a->parent;
+    da--;
+    if (a == b) {
+      return FALSE;
+    }
+  }
+
+  while (db > da) {
+    b = b->parent;
+    db--;
+    if (a == b) {
+      return TRUE;
+    }
+  }
+
+  while (a->parent != b->parent) {
+    a = a->parent;
+    b = b->parent;
+  }
+
+  return widget_index_of(a) < widget_index_of(b);
+}
+
+static bool_t widget_name_index_is_descendant(widget_t* widget, widget_t* parent) {
+  widget_t* iter = widget->parent;
+
+  while (iter != NULL) {
+    if (iter == parent) {
+      return TRUE;
+    }
+    iter = iter->parent;
+  }
+
+  return FALSE;
+}
+
+ret_t widget_name_index_lookup(widget_name_index_t* index, widget_t* parent, const char* name,
+                               bool_t recursive, widget_t** widget) {
+  uint32_t hash = 0;
+  uint32_t same_name = 0;
+  widget_t* ret = NULL;
+  widget_name_index_node_t* iter = NULL;
+  return_value_if_fail(index != NULL && parent != NULL && name != NULL && widget != NULL,
+                       RET_BAD_PARAMS);
+
+  *widget = NULL;
+  hash = widget_name_index_hash(name);
+
+  /*每个同名控件都要向上比较先后顺序，太多时不如直接遍历，先数一下再比较*/
+  for (iter = index->buckets[hash & (index->capacity - 1)]; iter != NULL; iter = iter->next) {
+    if (iter->hash == hash && tk_str_eq(iter->widget->name, name)) {
+      if (++same_name > WIDGET_NAME_INDEX_MAX_SAME_NAME) {
+        return RET_FAIL;
+      }
+    }
+  }
+
+  iter = index->buckets[hash & (index->capacity - 1)];
+  while (iter != NULL) {
+    widget_t* w = iter->widget;
+
+    if (iter->hash == hash && tk_str_eq(w->name, name)) {
+      if (recursive ? widget_name_index_is_descendant(w, parent) : w->parent == parent) {
+        if (ret == NULL || widget_name_index_before(w, ret)) {
+          ret = w;
+        }
+      }
+    }
+    iter = iter->next;
+  }
+  *widget = ret;
+
+  return ret != NULL ? RET_OK : RET_NOT_FOUND;
+}
+
+ret_t widget_name_index_destroy(widget_name_index_t* index) {
+  uint32_t i = 0;
+  return_value_if_fail(index != NULL, RET_BAD_PARAMS);
+
+  for (i = 0; i < index->capacity; i++) {
+    widget_name_index_node_t* iter = index->buckets[i];
+    while (iter != NULL) {
+      widget_name_index_node_t* next = iter->next;
+      TKMEM_FREE(iter);
+      iter = next;
+    }
+  }
+  TKMEM_FREE(index->buckets);
+  TKMEM_FREE(index);
+
+  return RET_OK;
+}
@@ -0,0 +1,129 @@
+﻿/**
+ * File:   widget_name_index.h
+ * Author: AWTK Develop Team
+ * Brief:  name to widget index of a window
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_WIDGET_NAME_INDEX_H
+#define TK_WIDGET_NAME_INDEX_H
+
+#include "base/widget.h"
+
+BEGIN_C_DECLS
+
+/*同名的控件超过该数量时，不再使用索引，由调用者遍历子树*/
+#ifndef WIDGET_NAME_INDEX_MAX_SAME_NAME
+#define WIDGET_NAME_INDEX_MAX_SAME_NAME 8
+#endif /*WIDGET_NAME_INDEX_MAX_SAME_NAME*/
+
+typedef struct _widget_name_index_node_t {
+  widget_t* widget;
+  uint32_t hash;
+  struct _widget_name_index_node_t* next;
+} widget_name_index_node_t;
+
+/**
+ * @class widget_name_index_t
+ * 窗口的名称索引(名称到控件的哈希表)。
+ *
+ * 窗口设置了name\_index属性后，widget\_add\_child、widget\_remove\_child和widget\_set\_name
+ * 会同步更新索引，widget\_lookup和widget\_child通过索引查找，不再遍历整个子树。
+ * 适用于控件很多，并且经常按名称查找控件的窗口。
+ *
+ * 多个控件同名时，仍然按原来的顺序查找(返回第一个)。
+ * 只有从窗口开始查找时才使用索引，从子控件开始查找仍然遍历该子控件的子树。
+ * 同名的控件超过WIDGET\_NAME\_INDEX\_MAX\_SAME\_NAME个时(如列表的每一行都有一个title)，
+ * 比较它们的先后顺序比直接遍历更慢，此时也退回到遍历。
+ *
+ * ```xml
+ * <window name_index="true">
+ * ```
+ */
+typedef struct _widget_name_index_t {
+  /**
+   * @property {uint32_t} size
+   * @annotation ["readable"]
+   * 索引中的控件数。
+   */
+  uint32_t size;
+
+  /*private*/
+  uint32_t capacity;
+  widget_name_index_node_t** buckets;
+} widget_name_index_t;
+
+/**
+ * @method widget_name_index_create
+ * @annotation ["constructor"]
+ * 创建名称索引，并把root的子控件(不包括root自己)加入索引。
+ * @param {widget_t*} root 根控件(通常是窗口)。
+ *
+ * @return {widget_name_index_t*} 返回名称索引对象。
+ */
+widget_name_index_t* widget_name_index_create(widget_t* root);
+
+/**
+ * @method widget_name_index_add
+ * 把控件加入索引。
+ * @param {widget_name_index_t*} index 名称索引对象。
+ * @param {widget_t*} widget 控件。
+ * @param {bool_t} recursive 是否同时加入子控件。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_name_index_add(widget_name_index_t* index, widget_t* widget, bool_t recursive);
+
+/**
+ * @method widget_name_index_remove
+ * 把控件从索引中移出。
+ * > 需要在修改控件名称之前调用。
+ * @param {widget_name_index_t*} index 名称索引对象。
+ * @param {widget_t*} widget 控件。
+ * @param {bool_t} recursive 是否同时移出子控件。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_name_index_remove(widget_name_index_t* index, widget_t* widget, bool_t recursive);
+
+/**
+ * @method widget_name_index_lookup
+ * 查找parent下指定名称的控件。
+ * @param {widget_name_index_t*} index 名称索引对象。
+ * @param {widget_t*} parent 父控件(必须在索引的根控件之下或者就是根控件)。
+ * @param {const char*} name 名称。
+ * @param {bool_t} recursive 是否查找所有子孙控件(否则只查找直接子控件)。
+ * @param {widget_t**} widget 用于返回找到的控件。
+ *
+ * @return {ret_t} 返回RET_OK表示找到，RET_NOT_FOUND表示没有找到，
+ * RET_FAIL表示同名的控件太多(超过WIDGET\_NAME\_INDEX\_MAX\_SAME\_NAME)，需要调用者遍历查找。
+ */
+ret_t widget_name_index_lookup(widget_name_index_t* index, widget_t* parent, const char* name,
+                               bool_t recursive, widget_t** widget);
+
+/**
+ * @method widget_name_index_destroy
+ * 销毁名称索引对象。
+ * @param {widget_name_index_t*} index 名称索引对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t widget_name_index_destroy(widget_name_index_t* index);
+
+END_C_DECLS
+
+#endif /*TK_WIDGET_NAME_INDEX_H*/
@@ -0,0 +1,106 @@
+﻿/**
+ * File:   widget_prop_atom.c
+ * Author: AWTK Develop Team
+ * Brief:  interned atoms of builtin widget property names
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/utils.h"
+#include "base/widget_prop_atom.h"
+
+/*开放寻址哈希表，大小是2的幂，至少是原子个数的两倍*/
+#define WIDGET_PROP_ATOM_TABLE_SIZE 256
+
+#define WIDGET_PROP_ATOM_NAME(id, name) name,
+
+/*
+ * 原子会写入UI二进制文件(v2)，列表只能在末尾追加。
+ * 固定每一批原子首尾的值，在中间插入或删除都会导致编译失败。
+ * 追加新的一批时，在这里加上该批首尾原子的值。
+ */
+TK_STATIC_ASSERT(WIDGET_PROP_ATOM_X == 1);
+TK_STATIC_ASSERT(WIDGET_PROP_ATOM_ROW == 68);
+TK_STATIC_ASSERT(WIDGET_PROP_ATOM_REPEAT == 69);
+TK_STATIC_ASSERT(WIDGET_PROP_ATOM_CLICKABLE == 95);
+/*UI二进制文件用一个字节保存原子*/
+TK_STATIC_ASSERT(WIDGET_PROP_ATOM_NR <= 256);
+TK_STATIC_ASSERT(WIDGET_PROP_ATOM_NR * 2 <= WIDGET_PROP_ATOM_TABLE_SIZE);
+
+static const char* const s_widget_prop_atom_names[WIDGET_PROP_ATOM_NR] = {
+    NULL, WIDGET_PROP_ATOMS(WIDGET_PROP_ATOM_NAME)};
+
+static uint8_t s_widget_prop_atom_table[WIDGET_PROP_ATOM_TABLE_SIZE];
+static bool_t s_widget_prop_atom_inited = FALSE;
+
+static uint32_t widget_prop_atom_hash(const char* name) {
+  /*FNV-1a*/
+  uint32_t hash = 2166136261u;
+  const uint8_t* p = (const uint8_t*)name;
+
+  while (*p) {
+    hash ^= *p++;
+    hash *= 16777619u;
+  }
+
+  return hash;
+}
+
+static ret_t widget_prop_atom_init(void) {
+  uint32_t i = 0;
+
+  memset(s_widget_prop_atom_table, 0x00, sizeof(s_widget_prop_atom_table));
+  for (i = 1; i < WIDGET_PROP_ATOM_NR; i++) {
+    uint32_t slot = widget_prop_atom_hash(s_widget_prop_atom_names[i]);
+
+    while (s_widget_prop_atom_table[slot & (WIDGET_PROP_ATOM_TABLE_SIZE - 1)] != 0) {
+      slot++;
+    }
+    s_widget_prop_atom_table[slot & (WIDGET_PROP_ATOM_TABLE_SIZE - 1)] = (uint8_t)i;
+  }
+  s_widget_prop_atom_inited = TRUE;
+
+  return RET_OK;
+}
+
+widget_prop_atom_t widget_prop_atom_from_name(const char* name) {
+  uint32_t slot = 0;
+  return_value_if_fail(name != NULL, WIDGET_PROP_ATOM_NONE);
+
+  if (!s_widget_prop_atom_inited) {
+    widget_prop_atom_init();
+  }
+
+  slot = widget_prop_atom_hash(name);
+  while (TRUE) {
+    uint8_t atom = s_widget_prop_atom_table[slot & (WIDGET_PROP_ATOM_TABLE_SIZE - 1)];
+    if (atom == 0) {
+      return WIDGET_PROP_ATOM_NONE;
+    }
+
+    /*调用者通常直接使用WIDGET_PROP_XXX常量，先比较指针*/
+    if (s_widget_prop_atom_names[atom] == name || tk_str_eq(s_widget_prop_atom_names[atom], name)) {
+      return (widget_prop_atom_t)atom;
+    }
+    slot++;
+  }
+}
+
+const char* widget_prop_atom_to_name(widget_prop_atom_t atom) {
+  return_value_if_fail(atom > WIDGET_PROP_ATOM_NONE && atom < WIDGET_PROP_ATOM_NR, NULL);
+
+  return s_widget_prop_atom_names[atom];
+}
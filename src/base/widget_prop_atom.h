@@ -0,0 +1,183 @@
+﻿/**
+ * File:   widget_prop_atom.h
+ * Author: AWTK Develop Team
+ * Brief:  interned atoms of builtin widget property names
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_WIDGET_PROP_ATOM_H
+#define TK_WIDGET_PROP_ATOM_H
+
+#include "base/widget_consts.h"
+
+BEGIN_C_DECLS
+
+/*
+ * 内置属性名列表。ATOM(id, name)生成常量WIDGET_PROP_ATOM_##id。
+ * 新增的属性加到最后即可，名称不能重复。
+ * 原子会写入UI二进制文件(v2)，已有的项不能插入、删除或调整顺序(widget_prop_atom.c中有静态检查)。
+ */
+#define WIDGET_PROP_ATOMS(ATOM)                                          \
+  ATOM(X, WIDGET_PROP_X)                                                 \
+  ATOM(Y, WIDGET_PROP_Y)                                                 \
+  ATOM(W, WIDGET_PROP_W)                                                 \
+  ATOM(H, WIDGET_PROP_H)                                                 \
+  ATOM(OPACITY, WIDGET_PROP_OPACITY)                                     \
+  ATOM(VISIBLE, WIDGET_PROP_VISIBLE)                                     \
+  ATOM(SENSITIVE, WIDGET_PROP_SENSITIVE)                                 \
+  ATOM(FLOATING, WIDGET_PROP_FLOATING)                                   \
+  ATOM(CACHE_AS_BITMAP, WIDGET_PROP_CACHE_AS_BITMAP)                     \
+  ATOM(FOCUSABLE, WIDGET_PROP_FOCUSABLE)                                 \
+  ATOM(FOCUSED, WIDGET_PROP_FOCUSED)                                     \
+  ATOM(FOCUS, WIDGET_PROP_FOCUS)                                         \
+  ATOM(WITH_FOCUS_STATE, WIDGET_PROP_WITH_FOCUS_STATE)                   \
+  ATOM(DIRTY_RECT_TOLERANCE, WIDGET_PROP_DIRTY_RECT_TOLERANCE)           \
+  ATOM(DIRTY_RECT, WIDGET_PROP_DIRTY_RECT)                               \
+  ATOM(STYLE, WIDGET_PROP_STYLE)                                         \
+  ATOM(STATE, WIDGET_PROP_STATE)                                         \
+  ATOM(STATE_FOR_STYLE, WIDGET_PROP_STATE_FOR_STYLE)                     \
+  ATOM(ENABLE, WIDGET_PROP_ENABLE)                                       \
+  ATOM(FEEDBACK, WIDGET_PROP_FEEDBACK)                                   \
+  ATOM(AUTO_ADJUST_SIZE, WIDGET_PROP_AUTO_ADJUST_SIZE)                   \
+  ATOM(NAME, WIDGET_PROP_NAME)                                           \
+  ATOM(TYPE, WIDGET_PROP_TYPE)                                           \
+  ATOM(TEXT, WIDGET_PROP_TEXT)                                           \
+  ATOM(TR_TEXT, WIDGET_PROP_TR_TEXT)                                     \
+  ATOM(VALUE, WIDGET_PROP_VALUE)                                         \
+  ATOM(ANIMATION, WIDGET_PROP_ANIMATION)                                 \
+  ATOM(SELF_LAYOUT, WIDGET_PROP_SELF_LAYOUT)                             \
+  ATOM(CHILDREN_LAYOUT, WIDGET_PROP_CHILDREN_LAYOUT)                     \
+  ATOM(LAYOUT, WIDGET_PROP_LAYOUT)                                       \
+  ATOM(LAYOUT_W, WIDGET_PROP_LAYOUT_W)                                   \
+  ATOM(LAYOUT_H, WIDGET_PROP_LAYOUT_H)                                   \
+  ATOM(POINTER_CURSOR, WIDGET_PROP_POINTER_CURSOR)                       \
+  ATOM(STATE_FROM_PARENT_SYNC, WIDGET_PROP_STATE_FROM_PARENT_SYNC)       \
+  ATOM(SYNC_STATE_TO_CHILDREN, WIDGET_PROP_SYNC_STATE_TO_CHILDREN)       \
+  ATOM(LOADING, WIDGET_PROP_LOADING)                                     \
+  ATOM(EXEC, WIDGET_PROP_EXEC)                                           \
+  ATOM(GRAB_KEYS, WIDGET_PROP_GRAB_KEYS)                                 \
+  ATOM(MIN, WIDGET_PROP_MIN)                                             \
+  ATOM(MAX, WIDGET_PROP_MAX)                                             \
+  ATOM(STEP, WIDGET_PROP_STEP)                                           \
+  ATOM(INPUT_TYPE, WIDGET_PROP_INPUT_TYPE)                               \
+  ATOM(READONLY, WIDGET_PROP_READONLY)                                   \
+  ATOM(CANCELABLE, WIDGET_PROP_CANCELABLE)                               \
+  ATOM(AUTO_FIX, WIDGET_PROP_AUTO_FIX)                                   \
+  ATOM(SELECT_NONE_WHEN_FOCUSED, WIDGET_PROP_SELECT_NONE_WHEN_FOCUSED)   \
+  ATOM(OPEN_IM_WHEN_FOCUSED, WIDGET_PROP_OPEN_IM_WHEN_FOCUSED)           \
+  ATOM(CLOSE_IM_WHEN_BLURED, WIDGET_PROP_CLOSE_IM_WHEN_BLURED)           \
+  ATOM(MARGIN, WIDGET_PROP_MARGIN)                                       \
+  ATOM(LEFT_MARGIN, WIDGET_PROP_LEFT_MARGIN)                             \
+  ATOM(RIGHT_MARGIN, WIDGET_PROP_RIGHT_MARGIN)                           \
+  ATOM(TOP_MARGIN, WIDGET_PROP_TOP_MARGIN)                               \
+  ATOM(BOTTOM_MARGIN, WIDGET_PROP_BOTTOM_MARGIN)                         \
+  ATOM(PASSWORD_VISIBLE, WIDGET_PROP_PASSWORD_VISIBLE)                   \
+  ATOM(ACTION_TEXT, WIDGET_PROP_ACTION_TEXT)                             \
+  ATOM(TIPS, WIDGET_PROP_TIPS)                                           \
+  ATOM(TR_TIPS, WIDGET_PROP_TR_TIPS)                                     \
+  ATOM(KEYBOARD, WIDGET_PROP_KEYBOARD)                                   \
+  ATOM(CARET_X, WIDGET_PROP_CARET_X)                                     \
+  ATOM(CARET_Y, WIDGET_PROP_CARET_Y)                                     \
+  ATOM(LINE_HEIGHT, WIDGET_PROP_LINE_HEIGHT)                             \
+  ATOM(INPUTING, WIDGET_PROP_INPUTING)                                   \
+  ATOM(VALIDATOR, WIDGET_PROP_VALIDATOR)                                 \
+  ATOM(ITEM_WIDTH, WIDGET_PROP_ITEM_WIDTH)                               \
+  ATOM(ITEM_HEIGHT, WIDGET_PROP_ITEM_HEIGHT)                             \
+  ATOM(DEFAULT_ITEM_HEIGHT, WIDGET_PROP_DEFAULT_ITEM_HEIGHT)             \
+  ATOM(AUTO_HIDE_SCROLL_BAR, WIDGET_PROP_AUTO_HIDE_SCROLL_BAR)           \
+  ATOM(ROW, WIDGET_PROP_ROW)                                             \
+  ATOM(REPEAT, WIDGET_PROP_REPEAT)                                       \
+  ATOM(LONG_PRESS_TIME, WIDGET_PROP_LONG_PRESS_TIME)                     \
+  ATOM(ENABLE_LONG_PRESS, WIDGET_PROP_ENABLE_LONG_PRESS)                 \
+  ATOM(ENABLE_PREVIEW, WIDGET_PROP_ENABLE_PREVIEW)                       \
+  ATOM(IS_ACCEPT_STATUS, WIDGET_PROP_IS_ACCEPT_STATUS)                   \
+  ATOM(LENGTH, WIDGET_PROP_LENGTH)                                       \
+  ATOM(MAX_W, WIDGET_PROP_MAX_W)                                         \
+  ATOM(LINE_WRAP, WIDGET_PROP_LINE_WRAP)                                 \
+  ATOM(WORD_WRAP, WIDGET_PROP_WORD_WRAP)                                 \
+  ATOM(ELLIPSES, WIDGET_PROP_ELLIPSES)                                   \
+  ATOM(VERTICAL, WIDGET_PROP_VERTICAL)                                   \
+  ATOM(BAR_SIZE, WIDGET_PROP_BAR_SIZE)                                   \
+  ATOM(DRAG_THRESHOLD, WIDGET_PROP_DRAG_THRESHOLD)                       \
+  ATOM(FORMAT, WIDGET_PROP_FORMAT)                                       \
+  ATOM(SHOW_TEXT, WIDGET_PROP_SHOW_TEXT)                                 \
+  ATOM(REVERSE, WIDGET_PROP_REVERSE)                                     \
+  ATOM(DRAW_TYPE, WIDGET_PROP_DRAW_TYPE)                                 \
+  ATOM(ASYNC_LOAD, WIDGET_PROP_ASYNC_LOAD)                               \
+  ATOM(IMAGE, WIDGET_PROP_IMAGE)                                         \
+  ATOM(SCALE_X, WIDGET_PROP_SCALE_X)                                     \
+  ATOM(SCALE_Y, WIDGET_PROP_SCALE_Y)                                     \
+  ATOM(ANCHOR_X, WIDGET_PROP_ANCHOR_X)                                   \
+  ATOM(ANCHOR_Y, WIDGET_PROP_ANCHOR_Y)                                   \
+  ATOM(ROTATION, WIDGET_PROP_ROTATION)                                   \
+  ATOM(SELECTABLE, WIDGET_PROP_SELECTABLE)                               \
+  ATOM(SELECTED, WIDGET_PROP_SELECTED)                                   \
+  ATOM(CLICKABLE, WIDGET_PROP_CLICKABLE)
+
+#define WIDGET_PROP_ATOM_ENUM(id, name) WIDGET_PROP_ATOM_##id,
+
+/**
+ * @enum widget_prop_atom_t
+ * @prefix WIDGET_PROP_ATOM_
+ * 内置属性名的原子(小整数)。
+ *
+ * 属性名先通过哈希表转换成原子，控件的set\_prop/get\_prop再用switch分发，
+ * 避免逐个比较字符串。不在列表中的属性名对应WIDGET\_PROP\_ATOM\_NONE。
+ */
+typedef enum _widget_prop_atom_t {
+  /**
+   * @const WIDGET_PROP_ATOM_NONE
+   * 不是内置属性。
+   */
+  WIDGET_PROP_ATOM_NONE = 0,
+  WIDGET_PROP_ATOMS(WIDGET_PROP_ATOM_ENUM)
+  /**
+   * @const WIDGET_PROP_ATOM_NR
+   * 原子的个数。
+   */
+  WIDGET_PROP_ATOM_NR
+} widget_prop_atom_t;
+
+/**
+ * @class widget_prop_atoms_t
+ * @annotation ["fake"]
+ * 内置属性名的原子表。
+ */
+
+/**
+ * @method widget_prop_atom_from_name
+ * 获取属性名对应的原子。
+ * @annotation ["static"]
+ * @param {const char*} name 属性名。
+ *
+ * @return {widget_prop_atom_t} 返回原子，不是内置属性时返回WIDGET_PROP_ATOM_NONE。
+ */
+widget_prop_atom_t widget_prop_atom_from_name(const char* name);
+
+/**
+ * @method widget_prop_atom_to_name
+ * 获取原子对应的属性名。
+ * @annotation ["static"]
+ * @param {widget_prop_atom_t} atom 原子。
+ *
+ * @return {const char*} 返回属性名，无效的原子返回NULL。
+ */
+const char* widget_prop_atom_to_name(widget_prop_atom_t atom);
+
+END_C_DECLS
+
+#endif /*TK_WIDGET_PROP_ATOM_H*/
@@ -20,6 +20,7 @@
  */
 
 #include "base/widget_vtable.h"
+#include "base/tile_painter.h"
 #include "tkc/mem.h"
 
 #define widget_vtable_get_value(vt, name, value) \
@@ -727,12 +728,16 @@ ret_t widget_on_paint_self_default(widget_t* widget, canvas_t* c) {
 }
 
 ret_t widget_on_paint_children_default(widget_t* widget, canvas_t* c) {
+  /*并行绘制时由tile_painter在UI线程中统一清除dirty标志*/
+  bool_t clear_dirty = !tile_painter_is_painting();
   return_value_if_fail(widget != NULL && c != NULL, RET_BAD_PARAMS);
 
   WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
 
   if (!iter->visible) {
-    iter->dirty = FALSE;
+    if (clear_dirty) {
+      iter->dirty = FALSE;
+    }
     continue;
   }
 
@@ -744,7 +749,9 @@ ret_t widget_on_paint_children_default(widget_t* widget, canvas_t* c) {
     int32_t right = left + iter->w + 2 * tolerance;
 
     if (!canvas_is_rect_in_clip_rect(c, left, top, right, bottom)) {
-      iter->dirty = FALSE;
+      if (clear_dirty) {
+        iter->dirty = FALSE;
+      }
       continue;
     }
   }
@@ -882,7 +889,8 @@ ret_t widget_paint_with_clip(widget_t* widget, rect_t* clip, canvas_t* c,
   rect_t r = {0};
   rect_t r_save = {0};
   rect_t r_vg_save = {0};
-  vgcanvas_t* vg = canvas_get_vgcanvas(c);
+  /* 录制绘制命令时不使用 vg，裁剪区由 canvas 负责 */
+  vgcanvas_t* vg = display_list_is_recording(c) ? NULL : canvas_get_vgcanvas(c);
   return_value_if_fail(widget != NULL && on_paint != NULL, RET_BAD_PARAMS);
 
   /* 裁剪子控件的话，需要注意保存和还原 canvas 和 vg 这两个画布，*/
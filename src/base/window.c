@@ -80,6 +80,7 @@ static ret_t window_on_copy(widget_t* widget, widget_t* other) {
 }
 
 TK_DECL_VTABLE(window) = {.type = WIDGET_TYPE_NORMAL_WINDOW,
+                          .paint_thread_safe = TRUE,
                           .size = sizeof(window_t),
                           .is_window = TRUE,
                           .get_parent_vt = TK_GET_PARENT_VTABLE(window_base),
@@ -32,12 +32,16 @@
 #include "base/locale_info.h"
 #include "base/window_manager.h"
 #include "base/widget_vtable.h"
+#include "base/tile_painter.h"
 
 ret_t window_close(widget_t* widget);
 
 ret_t window_base_on_paint_self(widget_t* widget, canvas_t* c) {
   paint_event_t e;
+
+  tile_painter_lock();
   widget_dispatch(widget, paint_event_init(&e, EVT_PAINT, widget, c));
+  tile_painter_unlock();
 
   return RET_OK;
 }
@@ -47,6 +51,11 @@ ret_t window_base_on_paint_begin(widget_t* widget, canvas_t* c) {
   image_manager_t* imm = widget_get_image_manager(widget);
   assets_manager_t* am = widget_get_assets_manager(widget);
 
+  if (tile_painter_is_painting()) {
+    /*tile_painter已在UI线程中确认它们与画布一致，这里不能修改共享的状态*/
+    return RET_OK;
+  }
+
   canvas_set_font_manager(c, fm);
   canvas_set_assets_manager(c, am);
   image_manager_set_assets_manager(imm, am);
@@ -308,6 +317,9 @@ ret_t window_base_get_prop(widget_t* widget, const char* name, value_t* v) {
   } else if (tk_str_eq(name, WIDGET_PROP_STRONGLY_FOCUS)) {
     value_set_bool(v, window_base->strongly_focus);
     return RET_OK;
+  } else if (tk_str_eq(name, WIDGET_PROP_NAME_INDEX)) {
+    value_set_bool(v, window_base->name_index);
+    return RET_OK;
   } else if (tk_str_eq(name, WIDGET_PROP_DESIGN_W)) {
     value_set_uint32(v, window_base->design_w);
     return RET_OK;
@@ -461,6 +473,8 @@ ret_t window_base_set_prop(widget_t* widget, const char* name, const value_t* v)
   } else if (tk_str_eq(name, WIDGET_PROP_STRONGLY_FOCUS)) {
     window_base->strongly_focus = value_bool(v);
     return RET_OK;
+  } else if (tk_str_eq(name, WIDGET_PROP_NAME_INDEX)) {
+    return window_base_set_name_index(widget, value_bool(v));
   } else if (tk_str_eq(name, WIDGET_PROP_DESIGN_W)) {
     window_base->design_w = value_uint32(v);
     return RET_OK;
@@ -536,6 +550,11 @@ ret_t window_base_on_destroy(widget_t* widget) {
 
   window_base_unload_theme_obj(widget);
 
+  if (window_base->widget_names != NULL) {
+    widget_name_index_destroy(window_base->widget_names);
+    window_base->widget_names = NULL;
+  }
+
   return RET_OK;
 }
 
@@ -903,6 +922,22 @@ widget_t* window_base_create(widget_t* parent, const widget_vtable_t* vt, xy_t x
   return widget;
 }
 
+ret_t window_base_set_name_index(widget_t* widget, bool_t name_index) {
+  window_base_t* window_base = WINDOW_BASE(widget);
+  return_value_if_fail(window_base != NULL, RET_BAD_PARAMS);
+
+  window_base->name_index = name_index;
+  if (name_index && window_base->widget_names == NULL) {
+    window_base->widget_names = widget_name_index_create(widget);
+    return_value_if_fail(window_base->widget_names != NULL, RET_OOM);
+  } else if (!name_index && window_base->widget_names != NULL) {
+    widget_name_index_destroy(window_base->widget_names);
+    window_base->widget_names = NULL;
+  }
+
+  return RET_OK;
+}
+
 ret_t window_base_set_need_relayout(widget_t* widget, bool_t need_relayout) {
   window_base_t* win = WINDOW_BASE(widget);
   return_value_if_fail(win != NULL, RET_BAD_PARAMS);
@@ -940,6 +975,7 @@ static const char* s_window_base_properties[] = {WIDGET_PROP_ANIM_HINT,
                                                  WIDGET_PROP_MOVE_FOCUS_RIGHT_KEY,
                                                  WIDGET_PROP_SINGLE_INSTANCE,
                                                  WIDGET_PROP_STRONGLY_FOCUS,
+                                                 WIDGET_PROP_NAME_INDEX,
                                                  WIDGET_PROP_DESIGN_W,
                                                  WIDGET_PROP_DESIGN_H,
                                                  WIDGET_PROP_AUTO_SCALE_CHILDREN_X,
@@ -25,6 +25,7 @@
 #include "base/widget.h"
 #include "base/widget_vtable.h"
 #include "base/native_window.h"
+#include "base/widget_name_index.h"
 
 BEGIN_C_DECLS
 
@@ -280,7 +281,17 @@ typedef struct _window_base_t {
    */
   bool_t strongly_focus;
 
+  /**
+   * @property {bool_t} name_index
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 是否建立控件名称索引(缺省FALSE)。
+   *
+   * > 控件很多并且经常调用widget\_lookup的窗口可以打开，打开后按名称查找控件不再遍历整个窗口。
+   */
+  bool_t name_index;
+
   /*private*/
+  widget_name_index_t* widget_names;
   theme_t* default_theme_obj;
   const asset_info_t* default_res_theme;
   const asset_info_t* res_theme;
@@ -474,6 +485,16 @@ widget_t* window_base_cast(widget_t* widget);
  */
 ret_t window_base_set_need_relayout(widget_t* widget, bool_t need_relayout);
 
+/**
+ * @method window_base_set_name_index
+ * 设置是否建立控件名称索引。
+ * @param {widget_t*} widget window_base对象。
+ * @param {bool_t} name_index 是否建立控件名称索引。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t window_base_set_name_index(widget_t* widget, bool_t name_index);
+
 /**
  * @method window_base_on_copy
  * 默认拷贝函数。
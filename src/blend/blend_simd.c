@@ -0,0 +1,531 @@
+﻿/**
+ * File:   blend_simd.c
+ * Author: AWTK Develop Team
+ * Brief:  simd row kernels for blend/fill
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/utils.h"
+#include "blend/blend_simd.h"
+
+#ifndef WITHOUT_BLEND_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLEND_SIMD_SSE2 1
+#define BLEND_SIMD_TARGET
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+/*编译选项没有打开SSE2时，运行时检测CPU*/
+#define BLEND_SIMD_SSE2 1
+#define BLEND_SIMD_SSE2_RUNTIME 1
+#define BLEND_SIMD_TARGET __attribute__((target("sse2")))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BLEND_SIMD_NEON 1
+#endif
+#endif /*WITHOUT_BLEND_SIMD*/
+
+#if defined(BLEND_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(BLEND_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+static bool_t s_blend_simd_enable = TRUE;
+
+/*
+ * 以下函数与blend_image_*.c/fill_image.inc中的标量实现逐位一致：
+ * 所有中间结果都不超过0xffff，因此可以用16位无符号整数运算。
+ */
+
+#if defined(BLEND_SIMD_SSE2)
+static inline BLEND_SIMD_TARGET __m128i blend_simd_swap_rb(__m128i v) {
+  __m128i rb = _mm_and_si128(v, _mm_set1_epi32(0x00ff00ff));
+  __m128i ag = _mm_and_si128(v, _mm_set1_epi32((int32_t)0xff00ff00));
+
+  return _mm_or_si128(ag, _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16)));
+}
+
+static inline BLEND_SIMD_TARGET __m128i blend_simd_mix16(__m128i d, __m128i s, __m128i a) {
+  __m128i minus_a = _mm_sub_epi16(_mm_set1_epi16(0xff), a);
+
+  return _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(d, minus_a), _mm_mullo_epi16(s, a)), 8);
+}
+
+static BLEND_SIMD_TARGET uint32_t blend_simd_8888_8888(uint8_t* dst, const uint8_t* src,
+                                                       uint32_t n, uint8_t alpha, bool_t swap) {
+  uint32_t i = 0;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i galpha = _mm_set1_epi32(alpha);
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(src + i * 4));
+    __m128i d = _mm_loadu_si128((const __m128i*)(dst + i * 4));
+    __m128i a = _mm_srli_epi32(s, 24);
+    __m128i copy, keep, mix, opaque, a16, lo, hi, r;
+
+    if (swap) {
+      s = blend_simd_swap_rb(s);
+    }
+    if (alpha != 0xff) {
+      a = _mm_srli_epi32(_mm_mullo_epi16(a, galpha), 8);
+    }
+
+    copy = _mm_cmpgt_epi32(a, _mm_set1_epi32(0xf8));
+    keep = _mm_cmpeq_epi32(a, zero);
+    mix = _mm_xor_si128(_mm_or_si128(copy, keep), _mm_set1_epi32(-1));
+    opaque = _mm_cmpgt_epi32(_mm_srli_epi32(d, 24), _mm_set1_epi32(0xf4));
+    if (_mm_movemask_epi8(_mm_andnot_si128(opaque, mix)) != 0) {
+      /*目标半透明，交给标量实现*/
+      break;
+    }
+
+    a16 = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    lo = blend_simd_mix16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(s, zero),
+                          _mm_unpacklo_epi32(a16, a16));
+    hi = blend_simd_mix16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(s, zero),
+                          _mm_unpackhi_epi32(a16, a16));
+    r = _mm_or_si128(_mm_packus_epi16(lo, hi), _mm_set1_epi32((int32_t)0xff000000));
+
+    r = _mm_or_si128(_mm_and_si128(mix, r),
+                     _mm_or_si128(_mm_and_si128(copy, s), _mm_and_si128(keep, d)));
+    _mm_storeu_si128((__m128i*)(dst + i * 4), r);
+  }
+
+  return i;
+}
+
+static inline BLEND_SIMD_TARGET __m128i blend_simd_channel(__m128i s0, __m128i s1, int shift) {
+  __m128i mask = _mm_set1_epi32(0xff);
+
+  return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(s0, _mm_cvtsi32_si128(shift)), mask),
+                         _mm_and_si128(_mm_srl_epi32(s1, _mm_cvtsi32_si128(shift)), mask));
+}
+
+static BLEND_SIMD_TARGET uint32_t blend_simd_8888_565(uint8_t* dst, const uint8_t* src,
+                                                      uint32_t n, uint8_t alpha, bool_t swap) {
+  uint32_t i = 0;
+  const __m128i c255 = _mm_set1_epi16(0xff);
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m128i s0 = _mm_loadu_si128((const __m128i*)(src + i * 4));
+    __m128i s1 = _mm_loadu_si128((const __m128i*)(src + i * 4 + 16));
+    __m128i d = _mm_loadu_si128((const __m128i*)(dst + i * 2));
+    __m128i sr, sg, sb, a, ma, dr, dg, db, copy, mix, c, m;
+
+    if (swap) {
+      s0 = blend_simd_swap_rb(s0);
+      s1 = blend_simd_swap_rb(s1);
+    }
+
+    sr = blend_simd_channel(s0, s1, 16);
+    sg = blend_simd_channel(s0, s1, 8);
+    sb = blend_simd_channel(s0, s1, 0);
+    a = blend_simd_channel(s0, s1, 24);
+    if (alpha <= 0xf8) {
+      a = _mm_srli_epi16(_mm_mullo_epi16(a, _mm_set1_epi16(alpha)), 8);
+    }
+
+    copy = _mm_cmpgt_epi16(a, _mm_set1_epi16(0xf8));
+    mix = _mm_andnot_si128(copy, _mm_cmpgt_epi16(a, _mm_set1_epi16(8)));
+
+    c = _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(sr, 3), 11),
+                     _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(sg, 2), 5), _mm_srli_epi16(sb, 3)));
+
+    ma = _mm_sub_epi16(c255, a);
+    dr = _mm_srli_epi16(_mm_and_si128(d, _mm_set1_epi16((int16_t)0xf800)), 8);
+    dg = _mm_srli_epi16(_mm_and_si128(d, _mm_set1_epi16(0x7e0)), 3);
+    db = _mm_slli_epi16(_mm_and_si128(d, _mm_set1_epi16(0x1f)), 3);
+    dr = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(dr, ma), _mm_mullo_epi16(sr, a)), 11);
+    dg = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(dg, ma), _mm_mullo_epi16(sg, a)), 10);
+    db = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(db, ma), _mm_mullo_epi16(sb, a)), 11);
+    m = _mm_or_si128(_mm_slli_epi16(dr, 11), _mm_or_si128(_mm_slli_epi16(dg, 5), db));
+
+    d = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(copy, mix), d),
+                     _mm_or_si128(_mm_and_si128(copy, c), _mm_and_si128(mix, m)));
+    _mm_storeu_si128((__m128i*)(dst + i * 2), d);
+  }
+
+  return i;
+}
+
+static BLEND_SIMD_TARGET uint32_t blend_simd_565_565(uint8_t* dst, const uint8_t* src, uint32_t n,
+                                                     uint8_t alpha) {
+  uint32_t i = 0;
+  const __m128i a = _mm_set1_epi16(alpha);
+  const __m128i ma = _mm_set1_epi16(0xff - alpha);
+  const __m128i mask = _mm_set1_epi16(0xff);
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(src + i * 2));
+    __m128i d = _mm_loadu_si128((const __m128i*)(dst + i * 2));
+    __m128i sr = _mm_slli_epi16(_mm_srli_epi16(s, 11), 3);
+    __m128i dr = _mm_slli_epi16(_mm_srli_epi16(d, 11), 3);
+    __m128i sg = _mm_and_si128(_mm_slli_epi16(_mm_srli_epi16(s, 5), 2), mask);
+    __m128i dg = _mm_and_si128(_mm_slli_epi16(_mm_srli_epi16(d, 5), 2), mask);
+    __m128i sb = _mm_slli_epi16(_mm_and_si128(s, _mm_set1_epi16(0x1f)), 3);
+    __m128i db = _mm_slli_epi16(_mm_and_si128(d, _mm_set1_epi16(0x1f)), 3);
+
+    dr = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sr, a), _mm_mullo_epi16(dr, ma)), 11);
+    dg = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sg, a), _mm_mullo_epi16(dg, ma)), 10);
+    db = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(sb, a), _mm_mullo_epi16(db, ma)), 11);
+    d = _mm_or_si128(_mm_slli_epi16(dr, 11), _mm_or_si128(_mm_slli_epi16(dg, 5), db));
+    _mm_storeu_si128((__m128i*)(dst + i * 2), d);
+  }
+
+  return i;
+}
+
+static BLEND_SIMD_TARGET uint32_t blend_simd_fill_8888(uint8_t* dst, uint32_t n, uint32_t color,
+                                                       uint8_t minus_a) {
+  uint32_t i = 0;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i m = _mm_set1_epi16(minus_a);
+  const __m128i mask = _mm_set1_epi16(0xff);
+  const __m128i c = _mm_unpacklo_epi8(_mm_set1_epi32(color), zero);
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    __m128i d = _mm_loadu_si128((const __m128i*)(dst + i * 4));
+    __m128i opaque = _mm_cmpgt_epi32(_mm_srli_epi32(d, 24), _mm_set1_epi32(0xf4));
+    __m128i lo, hi;
+
+    if (_mm_movemask_epi8(opaque) != 0xffff) {
+      break;
+    }
+
+    lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), m), 8);
+    hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), m), 8);
+    lo = _mm_and_si128(_mm_add_epi16(lo, c), mask);
+    hi = _mm_and_si128(_mm_add_epi16(hi, c), mask);
+    d = _mm_or_si128(_mm_packus_epi16(lo, hi), _mm_set1_epi32((int32_t)0xff000000));
+    _mm_storeu_si128((__m128i*)(dst + i * 4), d);
+  }
+
+  return i;
+}
+
+static BLEND_SIMD_TARGET uint32_t blend_simd_fill_565(uint8_t* dst, uint32_t n, rgba_t rgba) {
+  uint32_t i = 0;
+  const __m128i m = _mm_set1_epi16(rgba.a);
+  const __m128i cr = _mm_set1_epi16((int16_t)(rgba.r << 8));
+  const __m128i cg = _mm_set1_epi16((int16_t)(rgba.g << 8));
+  const __m128i cb = _mm_set1_epi16((int16_t)(rgba.b << 8));
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    __m128i d = _mm_loadu_si128((const __m128i*)(dst + i * 2));
+    __m128i dr = _mm_srli_epi16(_mm_and_si128(d, _mm_set1_epi16((int16_t)0xf800)), 8);
+    __m128i dg = _mm_srli_epi16(_mm_and_si128(d, _mm_set1_epi16(0x7e0)), 3);
+    __m128i db = _mm_slli_epi16(_mm_and_si128(d, _mm_set1_epi16(0x1f)), 3);
+
+    dr = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(dr, m), cr), 11);
+    dg = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(dg, m), cg), 10);
+    db = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(db, m), cb), 11);
+    d = _mm_or_si128(_mm_slli_epi16(dr, 11), _mm_or_si128(_mm_slli_epi16(dg, 5), db));
+    _mm_storeu_si128((__m128i*)(dst + i * 2), d);
+  }
+
+  return i;
+}
+#elif defined(BLEND_SIMD_NEON)
+static inline uint32x4_t blend_simd_swap_rb(uint32x4_t v) {
+  uint32x4_t rb = vandq_u32(v, vdupq_n_u32(0x00ff00ff));
+  uint32x4_t ag = vandq_u32(v, vdupq_n_u32(0xff00ff00));
+
+  return vorrq_u32(ag, vorrq_u32(vshlq_n_u32(rb, 16), vshrq_n_u32(rb, 16)));
+}
+
+static inline uint16x8_t blend_simd_mix16(uint16x8_t d, uint16x8_t s, uint16x8_t a) {
+  uint16x8_t minus_a = vsubq_u16(vdupq_n_u16(0xff), a);
+
+  return vshrq_n_u16(vaddq_u16(vmulq_u16(d, minus_a), vmulq_u16(s, a)), 8);
+}
+
+static inline bool_t blend_simd_any(uint32x4_t v) {
+  uint32x2_t t = vorr_u32(vget_low_u32(v), vget_high_u32(v));
+
+  return (vget_lane_u32(t, 0) | vget_lane_u32(t, 1)) != 0;
+}
+
+static uint32_t blend_simd_8888_8888(uint8_t* dst, const uint8_t* src, uint32_t n, uint8_t alpha,
+                                     bool_t swap) {
+  uint32_t i = 0;
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    uint32x4_t s = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+    uint32x4_t d = vreinterpretq_u32_u8(vld1q_u8(dst + i * 4));
+    uint32x4_t a = vshrq_n_u32(s, 24);
+    uint32x4_t copy, keep, mix, opaque, r;
+    uint8x16_t a8, s8, d8;
+    uint16x8_t lo, hi;
+
+    if (swap) {
+      s = blend_simd_swap_rb(s);
+    }
+    if (alpha != 0xff) {
+      a = vshrq_n_u32(vmulq_n_u32(a, alpha), 8);
+    }
+
+    copy = vcgtq_u32(a, vdupq_n_u32(0xf8));
+    keep = vceqq_u32(a, vdupq_n_u32(0));
+    mix = vmvnq_u32(vorrq_u32(copy, keep));
+    opaque = vcgtq_u32(vshrq_n_u32(d, 24), vdupq_n_u32(0xf4));
+    if (blend_simd_any(vbicq_u32(mix, opaque))) {
+      break;
+    }
+
+    a8 = vreinterpretq_u8_u32(vmulq_n_u32(a, 0x01010101));
+    s8 = vreinterpretq_u8_u32(s);
+    d8 = vreinterpretq_u8_u32(d);
+    lo = blend_simd_mix16(vmovl_u8(vget_low_u8(d8)), vmovl_u8(vget_low_u8(s8)),
+                          vmovl_u8(vget_low_u8(a8)));
+    hi = blend_simd_mix16(vmovl_u8(vget_high_u8(d8)), vmovl_u8(vget_high_u8(s8)),
+                          vmovl_u8(vget_high_u8(a8)));
+    r = vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    r = vorrq_u32(r, vdupq_n_u32(0xff000000));
+
+    r = vbslq_u32(copy, s, vbslq_u32(keep, d, r));
+    vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(r));
+  }
+
+  return i;
+}
+
+static inline uint16x8_t blend_simd_channel(uint32x4_t s0, uint32x4_t s1, int shift) {
+  uint32x4_t mask = vdupq_n_u32(0xff);
+  int32x4_t sh = vdupq_n_s32(-shift);
+
+  return vcombine_u16(vmovn_u32(vandq_u32(vshlq_u32(s0, sh), mask)),
+                      vmovn_u32(vandq_u32(vshlq_u32(s1, sh), mask)));
+}
+
+static uint32_t blend_simd_8888_565(uint8_t* dst, const uint8_t* src, uint32_t n, uint8_t alpha,
+                                    bool_t swap) {
+  uint32_t i = 0;
+  const uint16x8_t c255 = vdupq_n_u16(0xff);
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    uint32x4_t s0 = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+    uint32x4_t s1 = vreinterpretq_u32_u8(vld1q_u8(src + i * 4 + 16));
+    uint16x8_t d = vreinterpretq_u16_u8(vld1q_u8(dst + i * 2));
+    uint16x8_t sr, sg, sb, a, ma, dr, dg, db, copy, mix, c, m;
+
+    if (swap) {
+      s0 = blend_simd_swap_rb(s0);
+      s1 = blend_simd_swap_rb(s1);
+    }
+
+    sr = blend_simd_channel(s0, s1, 16);
+    sg = blend_simd_channel(s0, s1, 8);
+    sb = blend_simd_channel(s0, s1, 0);
+    a = blend_simd_channel(s0, s1, 24);
+    if (alpha <= 0xf8) {
+      a = vshrq_n_u16(vmulq_n_u16(a, alpha), 8);
+    }
+
+    copy = vcgtq_u16(a, vdupq_n_u16(0xf8));
+    mix = vbicq_u16(vcgtq_u16(a, vdupq_n_u16(8)), copy);
+
+    c = vorrq_u16(vshlq_n_u16(vshrq_n_u16(sr, 3), 11),
+                  vorrq_u16(vshlq_n_u16(vshrq_n_u16(sg, 2), 5), vshrq_n_u16(sb, 3)));
+
+    ma = vsubq_u16(c255, a);
+    dr = vshrq_n_u16(vandq_u16(d, vdupq_n_u16(0xf800)), 8);
+    dg = vshrq_n_u16(vandq_u16(d, vdupq_n_u16(0x7e0)), 3);
+    db = vshlq_n_u16(vandq_u16(d, vdupq_n_u16(0x1f)), 3);
+    dr = vshrq_n_u16(vaddq_u16(vmulq_u16(dr, ma), vmulq_u16(sr, a)), 11);
+    dg = vshrq_n_u16(vaddq_u16(vmulq_u16(dg, ma), vmulq_u16(sg, a)), 10);
+    db = vshrq_n_u16(vaddq_u16(vmulq_u16(db, ma), vmulq_u16(sb, a)), 11);
+    m = vorrq_u16(vshlq_n_u16(dr, 11), vorrq_u16(vshlq_n_u16(dg, 5), db));
+
+    d = vbslq_u16(copy, c, vbslq_u16(mix, m, d));
+    vst1q_u8(dst + i * 2, vreinterpretq_u8_u16(d));
+  }
+
+  return i;
+}
+
+static uint32_t blend_simd_565_565(uint8_t* dst, const uint8_t* src, uint32_t n, uint8_t alpha) {
+  uint32_t i = 0;
+  const uint16x8_t a = vdupq_n_u16(alpha);
+  const uint16x8_t ma = vdupq_n_u16(0xff - alpha);
+  const uint16x8_t mask = vdupq_n_u16(0xff);
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    uint16x8_t s = vreinterpretq_u16_u8(vld1q_u8(src + i * 2));
+    uint16x8_t d = vreinterpretq_u16_u8(vld1q_u8(dst + i * 2));
+    uint16x8_t sr = vshlq_n_u16(vshrq_n_u16(s, 11), 3);
+    uint16x8_t dr = vshlq_n_u16(vshrq_n_u16(d, 11), 3);
+    uint16x8_t sg = vandq_u16(vshlq_n_u16(vshrq_n_u16(s, 5), 2), mask);
+    uint16x8_t dg = vandq_u16(vshlq_n_u16(vshrq_n_u16(d, 5), 2), mask);
+    uint16x8_t sb = vshlq_n_u16(vandq_u16(s, vdupq_n_u16(0x1f)), 3);
+    uint16x8_t db = vshlq_n_u16(vandq_u16(d, vdupq_n_u16(0x1f)), 3);
+
+    dr = vshrq_n_u16(vaddq_u16(vmulq_u16(sr, a), vmulq_u16(dr, ma)), 11);
+    dg = vshrq_n_u16(vaddq_u16(vmulq_u16(sg, a), vmulq_u16(dg, ma)), 10);
+    db = vshrq_n_u16(vaddq_u16(vmulq_u16(sb, a), vmulq_u16(db, ma)), 11);
+    d = vorrq_u16(vshlq_n_u16(dr, 11), vorrq_u16(vshlq_n_u16(dg, 5), db));
+    vst1q_u8(dst + i * 2, vreinterpretq_u8_u16(d));
+  }
+
+  return i;
+}
+
+static uint32_t blend_simd_fill_8888(uint8_t* dst, uint32_t n, uint32_t color, uint8_t minus_a) {
+  uint32_t i = 0;
+  const uint16x8_t m = vdupq_n_u16(minus_a);
+  const uint16x8_t mask = vdupq_n_u16(0xff);
+  const uint16x8_t c = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(color)));
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    uint8x16_t d8 = vld1q_u8(dst + i * 4);
+    uint32x4_t d = vreinterpretq_u32_u8(d8);
+    uint32x4_t opaque = vcgtq_u32(vshrq_n_u32(d, 24), vdupq_n_u32(0xf4));
+    uint16x8_t lo, hi;
+
+    if (blend_simd_any(vmvnq_u32(opaque))) {
+      break;
+    }
+
+    lo = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(d8)), m), 8);
+    hi = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(d8)), m), 8);
+    lo = vandq_u16(vaddq_u16(lo, c), mask);
+    hi = vandq_u16(vaddq_u16(hi, c), mask);
+    d = vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    d = vorrq_u32(d, vdupq_n_u32(0xff000000));
+    vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(d));
+  }
+
+  return i;
+}
+
+static uint32_t blend_simd_fill_565(uint8_t* dst, uint32_t n, rgba_t rgba) {
+  uint32_t i = 0;
+  const uint16x8_t m = vdupq_n_u16(rgba.a);
+  const uint16x8_t cr = vdupq_n_u16(rgba.r << 8);
+  const uint16x8_t cg = vdupq_n_u16(rgba.g << 8);
+  const uint16x8_t cb = vdupq_n_u16(rgba.b << 8);
+
+  for (i = 0; i + 8 <= n; i += 8) {
+    uint16x8_t d = vreinterpretq_u16_u8(vld1q_u8(dst + i * 2));
+    uint16x8_t dr = vshrq_n_u16(vandq_u16(d, vdupq_n_u16(0xf800)), 8);
+    uint16x8_t dg = vshrq_n_u16(vandq_u16(d, vdupq_n_u16(0x7e0)), 3);
+    uint16x8_t db = vshlq_n_u16(vandq_u16(d, vdupq_n_u16(0x1f)), 3);
+
+    dr = vshrq_n_u16(vaddq_u16(vmulq_u16(dr, m), cr), 11);
+    dg = vshrq_n_u16(vaddq_u16(vmulq_u16(dg, m), cg), 10);
+    db = vshrq_n_u16(vaddq_u16(vmulq_u16(db, m), cb), 11);
+    d = vorrq_u16(vshlq_n_u16(dr, 11), vorrq_u16(vshlq_n_u16(dg, 5), db));
+    vst1q_u8(dst + i * 2, vreinterpretq_u8_u16(d));
+  }
+
+  return i;
+}
+#endif /*BLEND_SIMD_SSE2*/
+
+static bool_t blend_simd_cpu_supported(void) {
+#if defined(BLEND_SIMD_SSE2_RUNTIME)
+  static int32_t s_supported = -1;
+
+  if (s_supported < 0) {
+    __builtin_cpu_init();
+    s_supported = __builtin_cpu_supports("sse2") ? 1 : 0;
+  }
+
+  return s_supported == 1;
+#elif defined(BLEND_SIMD_SSE2) || defined(BLEND_SIMD_NEON)
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+ret_t blend_simd_set_enable(bool_t enable) {
+  s_blend_simd_enable = enable;
+
+  return RET_OK;
+}
+
+bool_t blend_simd_is_enabled(void) {
+  return s_blend_simd_enable && blend_simd_cpu_supported();
+}
+
+static bool_t blend_simd_is_8888(bitmap_format_t format) {
+  return format == BITMAP_FMT_RGBA8888 || format == BITMAP_FMT_BGRA8888;
+}
+
+bool_t blend_simd_blend_supported(bitmap_format_t dst_format, bitmap_format_t src_format,
+                                  bool_t premulti_alpha) {
+  if (!blend_simd_is_enabled()) {
+    return FALSE;
+  }
+
+  if (blend_simd_is_8888(dst_format)) {
+    return !premulti_alpha && blend_simd_is_8888(src_format);
+  } else if (dst_format == BITMAP_FMT_BGR565) {
+    return src_format == BITMAP_FMT_BGR565 || (!premulti_alpha && blend_simd_is_8888(src_format));
+  }
+
+  return FALSE;
+}
+
+uint32_t blend_simd_blend_row(bitmap_format_t dst_format, bitmap_format_t src_format, uint8_t* dst,
+                              const uint8_t* src, uint32_t n, uint8_t alpha) {
+  return_value_if_fail(dst != NULL && src != NULL, 0);
+
+#if defined(BLEND_SIMD_SSE2) || defined(BLEND_SIMD_NEON)
+  if (blend_simd_is_8888(dst_format)) {
+    return blend_simd_8888_8888(dst, src, n, alpha, dst_format != src_format);
+  } else if (dst_format == BITMAP_FMT_BGR565) {
+    if (src_format == BITMAP_FMT_BGR565) {
+      if (alpha > 0xf8) {
+        memcpy(dst, src, n * 2);
+        return n;
+      } else if (alpha <= 8) {
+        return n;
+      }
+      return blend_simd_565_565(dst, src, n, alpha);
+    } else {
+      return blend_simd_8888_565(dst, src, n, alpha, src_format == BITMAP_FMT_RGBA8888);
+    }
+  }
+#endif /*BLEND_SIMD_SSE2 || BLEND_SIMD_NEON*/
+
+  return 0;
+}
+
+bool_t blend_simd_fill_supported(bitmap_format_t dst_format) {
+  if (!blend_simd_is_enabled()) {
+    return FALSE;
+  }
+
+  return blend_simd_is_8888(dst_format) || dst_format == BITMAP_FMT_BGR565;
+}
+
+uint32_t blend_simd_fill_row(bitmap_format_t dst_format, uint8_t* dst, uint32_t n, rgba_t rgba) {
+  return_value_if_fail(dst != NULL, 0);
+
+#if defined(BLEND_SIMD_SSE2) || defined(BLEND_SIMD_NEON)
+  if (dst_format == BITMAP_FMT_BGRA8888) {
+    uint32_t color = rgba.b | (rgba.g << 8) | (rgba.r << 16);
+    return blend_simd_fill_8888(dst, n, color, rgba.a);
+  } else if (dst_format == BITMAP_FMT_RGBA8888) {
+    uint32_t color = rgba.r | (rgba.g << 8) | (rgba.b << 16);
+    return blend_simd_fill_8888(dst, n, color, rgba.a);
+  } else if (dst_format == BITMAP_FMT_BGR565) {
+    return blend_simd_fill_565(dst, n, rgba);
+  }
+#endif /*BLEND_SIMD_SSE2 || BLEND_SIMD_NEON*/
+
+  return 0;
+}
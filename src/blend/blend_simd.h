@@ -0,0 +1,125 @@
+﻿/**
+ * File:   blend_simd.h
+ * Author: AWTK Develop Team
+ * Brief:  simd row kernels for blend/fill
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_BLEND_SIMD_H
+#define TK_BLEND_SIMD_H
+
+#include "tkc/color.h"
+#include "base/bitmap.h"
+
+BEGIN_C_DECLS
+
+/**
+ * 向量化函数无法处理的像素(如目标像素半透明)，由调用者用标量函数处理的像素个数。
+ */
+#define BLEND_SIMD_FALLBACK_PIXELS 8
+
+/**
+ * @class blend_simd_t
+ * @annotation ["fake"]
+ * 贴图/填充的行处理向量化函数(x86上为SSE2，运行时检测；ARM上为NEON，编译时选择)。
+ *
+ * 结果与标量实现逐位一致，标量实现(blend_image.inc/fill_image.inc)仍然是参考实现。
+ * 支持的组合：
+ *
+ * * 贴图：rgba8888/bgra8888 -> rgba8888/bgra8888，rgba8888/bgra8888 -> bgr565，bgr565 -> bgr565。
+ * * 填充：rgba8888/bgra8888/bgr565 半透明填充。
+ *
+ * 定义WITHOUT_BLEND_SIMD可禁用。
+ */
+
+/**
+ * @method blend_simd_set_enable
+ * 启用/禁用向量化函数(主要用于测试和性能对比)。
+ * 启用时，如果CPU不支持，仍然使用标量实现。
+ * @annotation ["static"]
+ * @param {bool_t} enable 是否启用。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t blend_simd_set_enable(bool_t enable);
+
+/**
+ * @method blend_simd_is_enabled
+ * 向量化函数是否可用。
+ * @annotation ["static"]
+ *
+ * @return {bool_t} 返回TRUE表示可用，否则表示不可用。
+ */
+bool_t blend_simd_is_enabled(void);
+
+/**
+ * @method blend_simd_blend_supported
+ * 检查指定的贴图组合是否有向量化函数。
+ * @annotation ["static"]
+ * @param {bitmap_format_t} dst_format 目标图片格式。
+ * @param {bitmap_format_t} src_format 源图片格式。
+ * @param {bool_t} premulti_alpha 源图片是否预乘alpha。
+ *
+ * @return {bool_t} 返回TRUE表示支持，否则表示不支持。
+ */
+bool_t blend_simd_blend_supported(bitmap_format_t dst_format, bitmap_format_t src_format,
+                                  bool_t premulti_alpha);
+
+/**
+ * @method blend_simd_blend_row
+ * 把一行源像素混合到目标像素上(不缩放，不旋转)。
+ * 遇到无法处理的像素时提前返回，调用者用标量函数处理之后再继续调用。
+ * @annotation ["static"]
+ * @param {bitmap_format_t} dst_format 目标图片格式。
+ * @param {bitmap_format_t} src_format 源图片格式。
+ * @param {uint8_t*} dst 目标像素。
+ * @param {const uint8_t*} src 源像素。
+ * @param {uint32_t} n 像素个数。
+ * @param {uint8_t} alpha 全局alpha(0xff表示不透明)。
+ *
+ * @return {uint32_t} 返回从头开始已经处理的像素个数。
+ */
+uint32_t blend_simd_blend_row(bitmap_format_t dst_format, bitmap_format_t src_format, uint8_t* dst,
+                              const uint8_t* src, uint32_t n, uint8_t alpha);
+
+/**
+ * @method blend_simd_fill_supported
+ * 检查指定的格式是否有半透明填充的向量化函数。
+ * @annotation ["static"]
+ * @param {bitmap_format_t} dst_format 目标图片格式。
+ *
+ * @return {bool_t} 返回TRUE表示支持，否则表示不支持。
+ */
+bool_t blend_simd_fill_supported(bitmap_format_t dst_format);
+
+/**
+ * @method blend_simd_fill_row
+ * 用预乘过的颜色填充一行像素。
+ * 遇到无法处理的像素时提前返回，调用者用标量函数处理之后再继续调用。
+ * @annotation ["static"]
+ * @param {bitmap_format_t} dst_format 目标图片格式。
+ * @param {uint8_t*} dst 目标像素。
+ * @param {uint32_t} n 像素个数。
+ * @param {rgba_t} rgba 预乘过的颜色，rgba.a为(0xff - alpha)。
+ *
+ * @return {uint32_t} 返回从头开始已经处理的像素个数。
+ */
+uint32_t blend_simd_fill_row(bitmap_format_t dst_format, uint8_t* dst, uint32_t n, rgba_t rgba);
+
+END_C_DECLS
+
+#endif /*TK_BLEND_SIMD_H*/
@@ -22,6 +22,7 @@
 #include "tkc/mem.h"
 #include "tkc/utils.h"
 #include "conf_io/conf_json.h"
+#include "conf_io/conf_json_parser.h"
 #include "tkc/data_reader_mem.h"
 #include "tkc/data_writer_wbuffer.h"
 #include "tkc/data_reader_factory.h"
@@ -551,23 +552,77 @@ ret_t conf_doc_save_json_ex(conf_doc_t* doc, str_t* str, uint32_t indent) {
   return conf_json_save_node_children(doc->root, str, 0, indent);
 }
 
-static conf_doc_t* conf_doc_load_json_reader(data_reader_t* reader) {
-  char* data = NULL;
-  int32_t rsize = 0;
-  conf_doc_t* doc = NULL;
-  uint64_t size = data_reader_get_size(reader);
-  return_value_if_fail(reader != NULL && size > 0, NULL);
-  data = TKMEM_ALLOC(size + 1);
-  return_value_if_fail(data != NULL, NULL);
+typedef struct _json_stream_loader_t {
+  conf_doc_t* doc;
+  conf_node_t* current;
+  conf_node_t* last;
+} json_stream_loader_t;
 
-  memset(data, 0x00, size + 1);
-  rsize = data_reader_read(reader, 0, data, size);
-  if (rsize > 0) {
-    doc = conf_doc_load_json(data, rsize);
+static ret_t conf_json_on_token(void* ctx, const void* data) {
+  conf_node_t* node = NULL;
+  json_stream_loader_t* loader = (json_stream_loader_t*)ctx;
+  conf_json_parser_t* parser = (conf_json_parser_t*)data;
+  conf_doc_t* doc = loader->doc;
+
+  if (parser->token == CONF_JSON_TOKEN_OBJECT_END || parser->token == CONF_JSON_TOKEN_ARRAY_END) {
+    loader->last = loader->current;
+    loader->current = loader->current->parent;
+    return RET_OK;
   }
-  TKMEM_FREE(data);
 
-  return doc;
+  if (loader->current == NULL) {
+    /*和conf_doc_load_json一样，忽略根上的简单值*/
+    if (parser->token == CONF_JSON_TOKEN_VALUE) {
+      return RET_OK;
+    }
+    node = conf_doc_create_node(doc, CONF_NODE_ROOT_NAME);
+    return_value_if_fail(node != NULL, RET_OOM);
+    doc->root = node;
+  } else {
+    if (parser->name != NULL) {
+      node = conf_doc_create_node(doc, parser->name);
+    } else {
+      char name[TK_NUM_MAX_LEN + 1];
+      tk_snprintf(name, sizeof(name), "%u", parser->index);
+      node = conf_doc_create_node(doc, name);
+    }
+    return_value_if_fail(node != NULL, RET_OOM);
+
+    if (parser->index == 0) {
+      conf_doc_append_child(doc, loader->current, node);
+    } else {
+      conf_doc_append_sibling(doc, loader->last, node);
+    }
+  }
+
+  if (parser->token == CONF_JSON_TOKEN_VALUE) {
+    loader->last = node;
+    return conf_doc_set_node_value(doc, node, &(parser->value));
+  }
+
+  node->value_type = CONF_NODE_VALUE_NODE;
+  if (parser->token == CONF_JSON_TOKEN_ARRAY_BEGIN) {
+    node->node_type = CONF_NODE_ARRAY;
+  }
+  loader->current = node;
+  loader->last = NULL;
+
+  return RET_OK;
+}
+
+conf_doc_t* conf_doc_load_json_reader(data_reader_t* reader) {
+  json_stream_loader_t loader;
+  return_value_if_fail(reader != NULL && data_reader_get_size(reader) > 0, NULL);
+
+  memset(&loader, 0x00, sizeof(loader));
+  loader.doc = conf_doc_create_with_arena(0);
+  return_value_if_fail(loader.doc != NULL, NULL);
+
+  conf_json_parse(reader, conf_json_on_token, &loader);
+  /*加载完成后，修改产生的节点和值从堆上分配，以便可以单独释放*/
+  conf_doc_stop_arena(loader.doc);
+
+  return loader.doc;
 }
 
 static ret_t conf_doc_save_json_writer(conf_doc_t* doc, data_writer_t* writer) {
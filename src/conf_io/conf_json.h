@@ -164,6 +164,20 @@ ret_t conf_json_save_as(tk_object_t* obj, const char* url);
  */
 conf_doc_t* conf_doc_load_json(const char* data, int32_t size);
 
+/**
+ * @method conf_doc_load_json_reader
+ * 从data\_reader中流式加载JSON数据。
+ *
+ * > 不需要把整个文件读到内存中，节点和值从doc的内存池中分配，conf\_doc\_destroy时一次释放。
+ *
+ * @annotation ["global"]
+ *
+ * @param {data_reader_t*} reader 数据读取器。
+ *
+ * @return {conf_doc_t*} 返回doc对象。
+ */
+conf_doc_t* conf_doc_load_json_reader(data_reader_t* reader);
+
 /**
  * @method conf_node_load_json
  * 将 JSON 字符串加载到指定路径的节点。
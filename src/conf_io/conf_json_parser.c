@@ -0,0 +1,307 @@
+﻿/**
+ * File:   conf_json_parser.c
+ * Author: AWTK Develop Team
+ * Brief:  streaming json parser
+ *
+ * Copyright (c) 2026 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/utils.h"
+#include "conf_io/conf_json_parser.h"
+
+#define CONF_JSON_EOF -1
+
+conf_json_parser_t* conf_json_parser_create(data_reader_t* reader) {
+  conf_json_parser_t* parser = NULL;
+  return_value_if_fail(reader != NULL, NULL);
+
+  parser = TKMEM_ZALLOC(conf_json_parser_t);
+  return_value_if_fail(parser != NULL, NULL);
+
+  parser->reader = reader;
+  str_init(&(parser->key), 32);
+  str_init(&(parser->str), 64);
+
+  return parser;
+}
+
+static ret_t conf_json_parser_fill(conf_json_parser_t* parser) {
+  int32_t size = 0;
+
+  if (parser->eos) {
+    return RET_EOS;
+  }
+
+  size = data_reader_read(parser->reader, parser->offset, parser->buff, sizeof(parser->buff));
+  if (size <= 0) {
+    parser->eos = TRUE;
+    return RET_EOS;
+  }
+
+  parser->offset += size;
+  parser->cursor = 0;
+  parser->end = size;
+
+  return RET_OK;
+}
+
+static inline int conf_json_parser_peek(conf_json_parser_t* parser) {
+  if (parser->cursor < parser->end || conf_json_parser_fill(parser) == RET_OK) {
+    return parser->buff[parser->cursor];
+  }
+
+  return CONF_JSON_EOF;
+}
+
+/*跳过一行或者一个块注释，'/'已经读取*/
+static ret_t conf_json_parser_skip_comment(conf_json_parser_t* parser) {
+  int c = conf_json_parser_peek(parser);
+
+  if (c == '/') {
+    while ((c = conf_json_parser_peek(parser)) != CONF_JSON_EOF) {
+      parser->cursor++;
+      if (c == '\n') {
+        break;
+      }
+    }
+  } else if (c == '*') {
+    bool_t star = FALSE;
+
+    parser->cursor++;
+    while ((c = conf_json_parser_peek(parser)) != CONF_JSON_EOF) {
+      parser->cursor++;
+      if (star && c == '/') {
+        break;
+      }
+      star = c == '*';
+    }
+  }
+
+  return RET_OK;
+}
+
+/*跳过空白和注释，返回下一个字符(不读取)*/
+static int conf_json_parser_skip_spaces(conf_json_parser_t* parser) {
+  int c = 0;
+
+  while ((c = conf_json_parser_peek(parser)) != CONF_JSON_EOF) {
+    if (c == '/') {
+      parser->cursor++;
+      conf_json_parser_skip_comment(parser);
+    } else if (c == '\0') {
+      /*和conf_doc_load_json一样，把'\0'当作数据的结尾*/
+      parser->eos = TRUE;
+      parser->end = parser->cursor;
+      return CONF_JSON_EOF;
+    } else if (tk_isspace(c)) {
+      parser->cursor++;
+    } else {
+      break;
+    }
+  }
+
+  return c;
+}
+
+/*读取双引号中的字符串，'"'还没有读取*/
+static ret_t conf_json_parser_read_string(conf_json_parser_t* parser, str_t* s) {
+  bool_t escaped = FALSE;
+
+  str_set(s, "");
+  parser->cursor++;
+  while (conf_json_parser_peek(parser) != CONF_JSON_EOF) {
+    uint32_t start = parser->cursor;
+    const uint8_t* p = parser->buff;
+
+    while (parser->cursor < parser->end && p[parser->cursor] != '\"' &&
+           p[parser->cursor] != '\\') {
+      parser->cursor++;
+    }
+    return_value_if_fail(str_append_with_len(s, (const char*)p + start, parser->cursor - start) ==
+                             RET_OK,
+                         RET_OOM);
+
+    if (parser->cursor < parser->end) {
+      if (p[parser->cursor] == '\"') {
+        parser->cursor++;
+        return escaped ? str_unescape(s) : RET_OK;
+      } else {
+        int c = 0;
+        escaped = TRUE;
+        parser->cursor++;
+        c = conf_json_parser_peek(parser);
+        break_if_fail(c != CONF_JSON_EOF);
+        parser->cursor++;
+        str_append_char(s, '\\');
+        str_append_char(s, (char)c);
+      }
+    }
+  }
+
+  return RET_BAD_PARAMS;
+}
+
+static bool_t conf_json_is_value_end(int c) {
+  return c == CONF_JSON_EOF || c == ',' || c == '}' || c == ']' || c == '/' || c == '\0' ||
+         tk_isspace(c);
+}
+
+/*读取没有引号的值(数字、true/false和null)*/
+static ret_t conf_json_parser_read_literal(conf_json_parser_t* parser) {
+  int c = 0;
+  str_t* s = &(parser->str);
+  value_t* v = &(parser->value);
+
+  str_set(s, "");
+  while (!conf_json_is_value_end(c = conf_json_parser_peek(parser))) {
+    parser->cursor++;
+    return_value_if_fail(str_append_char(s, (char)c) == RET_OK, RET_OOM);
+  }
+
+  c = s->str[0];
+  if (c == 't' || c == 'f') {
+    value_set_bool(v, c == 't');
+  } else if (c == 'n' && tk_str_eq(s->str, "null")) {
+    value_set_str(v, NULL);
+  } else if (strchr(s->str, '.') == NULL && strchr(s->str, 'E') == NULL) {
+    int64_t n = tk_atol(s->str);
+    if (n < INT_MAX && n > INT_MIN) {
+      value_set_int32(v, n);
+    } else {
+      value_set_int64(v, n);
+    }
+  } else {
+    value_set_double(v, tk_atof(s->str));
+  }
+
+  return RET_OK;
+}
+
+static ret_t conf_json_parser_read_value(conf_json_parser_t* parser, int c) {
+  ret_t ret = RET_OK;
+
+  parser->level = parser->depth;
+  if (c == '{' || c == '[') {
+    return_value_if_fail(parser->depth < CONF_JSON_PARSER_MAX_LEVEL, RET_FAIL);
+    parser->cursor++;
+    parser->token = c == '{' ? CONF_JSON_TOKEN_OBJECT_BEGIN : CONF_JSON_TOKEN_ARRAY_BEGIN;
+    parser->stack[parser->depth] = (char)c;
+    parser->counts[parser->depth] = 0;
+    parser->depth++;
+
+    return RET_OK;
+  } else if (c == '\"') {
+    ret = conf_json_parser_read_string(parser, &(parser->str));
+    value_set_str(&(parser->value), parser->str.str);
+  } else {
+    ret = conf_json_parser_read_literal(parser);
+  }
+
+  parser->token = CONF_JSON_TOKEN_VALUE;
+  if (parser->depth == 0) {
+    parser->done = TRUE;
+  }
+
+  return ret;
+}
+
+ret_t conf_json_parser_next(conf_json_parser_t* parser) {
+  int c = 0;
+  char top = 0;
+  return_value_if_fail(parser != NULL, RET_BAD_PARAMS);
+
+  parser->name = NULL;
+  parser->index = 0;
+  parser->token = CONF_JSON_TOKEN_NONE;
+  value_set_int(&(parser->value), 0);
+  if (parser->done) {
+    return RET_EOS;
+  }
+
+  c = conf_json_parser_skip_spaces(parser);
+  if (parser->depth == 0) {
+    if (c == CONF_JSON_EOF) {
+      parser->done = TRUE;
+      return RET_EOS;
+    }
+
+    return conf_json_parser_read_value(parser, c);
+  }
+
+  /*容错：允许多余的逗号和对象中多余的字符*/
+  top = parser->stack[parser->depth - 1];
+  while (c == ',' || (top == '{' && c != '\"' && c != '}' && c != ']' && c != CONF_JSON_EOF)) {
+    parser->cursor++;
+    c = conf_json_parser_skip_spaces(parser);
+  }
+  return_value_if_fail(c != CONF_JSON_EOF, RET_BAD_PARAMS);
+
+  if (c == '}' || c == ']') {
+    parser->cursor++;
+    parser->depth--;
+    parser->level = parser->depth;
+    parser->token = top == '{' ? CONF_JSON_TOKEN_OBJECT_END : CONF_JSON_TOKEN_ARRAY_END;
+    if (parser->depth == 0) {
+      parser->done = TRUE;
+    }
+
+    return RET_OK;
+  }
+
+  if (top == '{') {
+    return_value_if_fail(conf_json_parser_read_string(parser, &(parser->key)) == RET_OK,
+                         RET_BAD_PARAMS);
+    c = conf_json_parser_skip_spaces(parser);
+    if (c == ':') {
+      parser->cursor++;
+      c = conf_json_parser_skip_spaces(parser);
+    }
+    return_value_if_fail(c != CONF_JSON_EOF, RET_BAD_PARAMS);
+    parser->name = parser->key.str;
+  }
+  parser->index = parser->counts[parser->depth - 1]++;
+
+  return conf_json_parser_read_value(parser, c);
+}
+
+ret_t conf_json_parser_destroy(conf_json_parser_t* parser) {
+  return_value_if_fail(parser != NULL, RET_BAD_PARAMS);
+
+  str_reset(&(parser->key));
+  str_reset(&(parser->str));
+  TKMEM_FREE(parser);
+
+  return RET_OK;
+}
+
+ret_t conf_json_parse(data_reader_t* reader, tk_visit_t on_token, void* ctx) {
+  ret_t ret = RET_OK;
+  conf_json_parser_t* parser = NULL;
+  return_value_if_fail(reader != NULL && on_token != NULL, RET_BAD_PARAMS);
+
+  parser = conf_json_parser_create(reader);
+  return_value_if_fail(parser != NULL, RET_OOM);
+
+  while ((ret = conf_json_parser_next(parser)) == RET_OK) {
+    if (on_token(ctx, parser) != RET_OK) {
+      break;
+    }
+  }
+  conf_json_parser_destroy(parser);
+
+  return ret == RET_EOS ? RET_OK : ret;
+}
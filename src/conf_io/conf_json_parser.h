@@ -0,0 +1,192 @@
+﻿/**
+ * File:   conf_json_parser.h
+ * Author: AWTK Develop Team
+ * Brief:  streaming json parser
+ *
+ * Copyright (c) 2026 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_CONF_JSON_PARSER_H
+#define TK_CONF_JSON_PARSER_H
+
+#include "tkc/str.h"
+#include "tkc/value.h"
+#include "tkc/data_reader.h"
+
+BEGIN_C_DECLS
+
+#ifndef CONF_JSON_PARSER_BUFF_SIZE
+#define CONF_JSON_PARSER_BUFF_SIZE 4096
+#endif /*CONF_JSON_PARSER_BUFF_SIZE*/
+
+#ifndef CONF_JSON_PARSER_MAX_LEVEL
+#define CONF_JSON_PARSER_MAX_LEVEL 64
+#endif /*CONF_JSON_PARSER_MAX_LEVEL*/
+
+/**
+ * @enum conf_json_token_t
+ * @prefix CONF_JSON_TOKEN_
+ * json解析器返回的记号类型。
+ */
+typedef enum _conf_json_token_t {
+  /**
+   * @const CONF_JSON_TOKEN_NONE
+   * 无效记号。
+   */
+  CONF_JSON_TOKEN_NONE = 0,
+  /**
+   * @const CONF_JSON_TOKEN_OBJECT_BEGIN
+   * 对象开始。
+   */
+  CONF_JSON_TOKEN_OBJECT_BEGIN,
+  /**
+   * @const CONF_JSON_TOKEN_OBJECT_END
+   * 对象结束。
+   */
+  CONF_JSON_TOKEN_OBJECT_END,
+  /**
+   * @const CONF_JSON_TOKEN_ARRAY_BEGIN
+   * 数组开始。
+   */
+  CONF_JSON_TOKEN_ARRAY_BEGIN,
+  /**
+   * @const CONF_JSON_TOKEN_ARRAY_END
+   * 数组结束。
+   */
+  CONF_JSON_TOKEN_ARRAY_END,
+  /**
+   * @const CONF_JSON_TOKEN_VALUE
+   * 简单值(字符串、数字、布尔和null)。
+   */
+  CONF_JSON_TOKEN_VALUE
+} conf_json_token_t;
+
+/**
+ * @class conf_json_parser_t
+ * 流式json解析器(pull模式)。
+ *
+ * 从data\_reader中分块读取数据，每次调用conf\_json\_parser\_next返回一个记号，
+ * 不需要把整个文档读到内存中，也不创建conf\_doc\_t。适合处理很大的json文件。
+ *
+ * 与conf\_doc\_load\_json一样，支持//和/\* \*\/注释。
+ *
+ * ```c
+ * data_reader_t* reader = data_reader_file_create("profile.json");
+ * conf_json_parser_t* parser = conf_json_parser_create(reader);
+ *
+ * while (conf_json_parser_next(parser) == RET_OK) {
+ *   if (parser->token == CONF_JSON_TOKEN_VALUE && tk_str_eq(parser->name, "id")) {
+ *     log_debug("id=%d\n", value_int(&(parser->value)));
+ *   }
+ * }
+ *
+ * conf_json_parser_destroy(parser);
+ * data_reader_destroy(reader);
+ * ```
+ */
+typedef struct _conf_json_parser_t {
+  /**
+   * @property {conf_json_token_t} token
+   * @annotation ["readable"]
+   * 当前记号的类型。
+   */
+  conf_json_token_t token;
+  /**
+   * @property {const char*} name
+   * @annotation ["readable"]
+   * 当前记号在对象中的名称(数组元素和根为NULL)。
+   * 只在下一次调用conf\_json\_parser\_next之前有效。
+   */
+  const char* name;
+  /**
+   * @property {uint32_t} index
+   * @annotation ["readable"]
+   * 当前记号在父对象或父数组中的序号(对XXX\_END无效)。
+   */
+  uint32_t index;
+  /**
+   * @property {uint32_t} level
+   * @annotation ["readable"]
+   * 当前记号所在的层次(根为0)。
+   */
+  uint32_t level;
+  /**
+   * @property {value_t} value
+   * @annotation ["readable"]
+   * 当前记号的值(只对CONF\_JSON\_TOKEN\_VALUE有效)。
+   * 字符串只在下一次调用conf\_json\_parser\_next之前有效。
+   */
+  value_t value;
+
+  /*private*/
+  data_reader_t* reader;
+  uint64_t offset;
+  uint32_t cursor;
+  uint32_t end;
+  bool_t eos;
+  bool_t done;
+  str_t key;
+  str_t str;
+  uint32_t depth;
+  char stack[CONF_JSON_PARSER_MAX_LEVEL];
+  uint32_t counts[CONF_JSON_PARSER_MAX_LEVEL];
+  uint8_t buff[CONF_JSON_PARSER_BUFF_SIZE];
+} conf_json_parser_t;
+
+/**
+ * @method conf_json_parser_create
+ * 创建解析器。
+ * @annotation ["constructor"]
+ * @param {data_reader_t*} reader 数据读取器(由调用者负责销毁)。
+ *
+ * @return {conf_json_parser_t*} 返回解析器对象。
+ */
+conf_json_parser_t* conf_json_parser_create(data_reader_t* reader);
+
+/**
+ * @method conf_json_parser_next
+ * 读取下一个记号。
+ * @param {conf_json_parser_t*} parser 解析器对象。
+ *
+ * @return {ret_t} 返回RET_OK表示读到一个记号，RET_EOS表示文档结束，否则表示格式错误。
+ */
+ret_t conf_json_parser_next(conf_json_parser_t* parser);
+
+/**
+ * @method conf_json_parser_destroy
+ * 销毁解析器。
+ * @param {conf_json_parser_t*} parser 解析器对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t conf_json_parser_destroy(conf_json_parser_t* parser);
+
+/**
+ * @method conf_json_parse
+ * 流式解析json数据(SAX模式)，每读到一个记号调用一次回调函数。
+ * > 回调函数返回非RET\_OK时停止解析。
+ * @annotation ["static"]
+ * @param {data_reader_t*} reader 数据读取器。
+ * @param {tk_visit_t} on_token 回调函数(data参数为conf\_json\_parser\_t*)。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t conf_json_parse(data_reader_t* reader, tk_visit_t on_token, void* ctx);
+
+END_C_DECLS
+
+#endif /*TK_CONF_JSON_PARSER_H*/
@@ -25,8 +25,93 @@
 #include "conf_io/conf_node.h"
 #include "conf_node_obj.inc"
 
+#define CONF_DOC_ARENA_MIN_BLOCK_SIZE 256
+#define CONF_DOC_ARENA_MAX_BLOCK_SIZE (256 * 1024)
+
+struct _conf_doc_arena_block_t {
+  conf_doc_arena_block_t* next;
+  uint32_t size;
+  uint32_t used;
+};
+
+/*保证块中的数据按8字节对齐*/
+#define CONF_DOC_ARENA_HEADER_SIZE TK_ROUND_TO8(sizeof(conf_doc_arena_block_t))
+
 static ret_t conf_node_destroy(conf_doc_t* doc, conf_node_t* node);
 
+static void* conf_doc_arena_alloc(conf_doc_t* doc, uint32_t size) {
+  uint8_t* p = NULL;
+  conf_doc_arena_block_t* block = doc->arena;
+
+  size = TK_ROUND_TO8(size);
+  if (block == NULL || block->used + size > block->size) {
+    uint32_t block_size = tk_max(doc->arena_block_size, size);
+    conf_doc_arena_block_t* new_block = TKMEM_ALLOC(CONF_DOC_ARENA_HEADER_SIZE + block_size);
+    return_value_if_fail(new_block != NULL, NULL);
+
+    new_block->size = block_size;
+    new_block->used = 0;
+    if (block != NULL && size > doc->arena_block_size) {
+      /*单独分配的大块放在后面，当前块剩余的空间可以继续使用*/
+      new_block->next = block->next;
+      block->next = new_block;
+    } else {
+      new_block->next = block;
+      doc->arena = new_block;
+      if (doc->arena_block_size < CONF_DOC_ARENA_MAX_BLOCK_SIZE) {
+        doc->arena_block_size *= 2;
+      }
+    }
+    block = new_block;
+  }
+
+  p = (uint8_t*)block + CONF_DOC_ARENA_HEADER_SIZE + block->used;
+  block->used += size;
+
+  return p;
+}
+
+static char* conf_doc_arena_strdup(conf_doc_t* doc, const char* str, uint32_t size) {
+  char* p = (char*)conf_doc_arena_alloc(doc, size + 1);
+  return_value_if_fail(p != NULL, NULL);
+
+  memcpy(p, str, size);
+  p[size] = '\0';
+
+  return p;
+}
+
+static ret_t conf_doc_arena_destroy(conf_doc_t* doc) {
+  conf_doc_arena_block_t* iter = doc->arena;
+
+  while (iter != NULL) {
+    conf_doc_arena_block_t* next = iter->next;
+    TKMEM_FREE(iter);
+    iter = next;
+  }
+  doc->arena = NULL;
+
+  return RET_OK;
+}
+
+/*释放堆上分配的值，arena中的值在销毁文档时释放*/
+static ret_t conf_node_free_value(conf_node_t* node) {
+  if (node->is_arena_value) {
+    node->is_arena_value = FALSE;
+    return RET_OK;
+  }
+
+  if (node->value_type == CONF_NODE_VALUE_STRING) {
+    TKMEM_FREE(node->value.str);
+  } else if (node->value_type == CONF_NODE_VALUE_WSTRING) {
+    TKMEM_FREE(node->value.wstr);
+  } else if (node->value_type == CONF_NODE_VALUE_BINARY) {
+    TKMEM_FREE(node->value.binary_data.data);
+  }
+
+  return RET_OK;
+}
+
 conf_node_t* conf_node_get_first_child(conf_node_t* node) {
   return_value_if_fail(node != NULL, NULL);
   if (node->value_type != CONF_NODE_VALUE_NODE && node->value_type != CONF_NODE_VALUE_NONE) {
@@ -69,6 +154,23 @@ conf_doc_t* conf_doc_create(uint32_t prealloc_nodes_nr) {
   return doc;
 }
 
+conf_doc_t* conf_doc_create_with_arena(uint32_t block_size) {
+  conf_doc_t* doc = conf_doc_create(0);
+  return_value_if_fail(doc != NULL, NULL);
+
+  doc->arena_block_size = tk_max(block_size, CONF_DOC_ARENA_MIN_BLOCK_SIZE);
+
+  return doc;
+}
+
+ret_t conf_doc_stop_arena(conf_doc_t* doc) {
+  return_value_if_fail(doc != NULL, RET_BAD_PARAMS);
+
+  doc->arena_block_size = 0;
+
+  return RET_OK;
+}
+
 static conf_node_t* conf_doc_find_free_node(conf_doc_t* doc) {
   uint32_t i = 0;
   return_value_if_fail(doc != NULL, NULL);
@@ -100,12 +202,19 @@ static conf_node_t* conf_doc_find_free_node(conf_doc_t* doc) {
 conf_node_t* conf_doc_create_node(conf_doc_t* doc, const char* name) {
   conf_node_t* node = NULL;
   return_value_if_fail(doc != NULL, NULL);
-  node = conf_doc_find_free_node(doc);
 
-  if (node != NULL) {
+  if (doc->arena_block_size > 0) {
+    node = (conf_node_t*)conf_doc_arena_alloc(doc, sizeof(conf_node_t));
+    return_value_if_fail(node != NULL, NULL);
     memset(node, 0x00, sizeof(conf_node_t));
+    node->is_arena_node = TRUE;
   } else {
-    node = TKMEM_ZALLOC(conf_node_t);
+    node = conf_doc_find_free_node(doc);
+    if (node != NULL) {
+      memset(node, 0x00, sizeof(conf_node_t));
+    } else {
+      node = TKMEM_ZALLOC(conf_node_t);
+    }
   }
   return_value_if_fail(node != NULL, NULL);
 
@@ -115,6 +224,10 @@ conf_node_t* conf_doc_create_node(conf_doc_t* doc, const char* name) {
     if (size < sizeof(node->name)) {
       node->is_small_name = TRUE;
       strcpy(node->name.small_str, name);
+    } else if (doc->arena_block_size > 0) {
+      node->is_small_name = FALSE;
+      node->is_arena_name = TRUE;
+      node->name.str = conf_doc_arena_strdup(doc, name, size);
     } else {
       node->is_small_name = FALSE;
       node->name.str = tk_strdup(name);
@@ -187,6 +300,35 @@ ret_t conf_doc_set_node_prop(conf_doc_t* doc, conf_node_t* node, const char* nam
   }
 }
 
+ret_t conf_doc_set_node_value(conf_doc_t* doc, conf_node_t* node, const value_t* v) {
+  char* p = NULL;
+  uint32_t size = 0;
+  const char* str = NULL;
+  return_value_if_fail(doc != NULL && node != NULL && v != NULL, RET_BAD_PARAMS);
+
+  if (doc->arena_block_size == 0 || v->type != VALUE_TYPE_STRING) {
+    return conf_node_set_value(node, v);
+  }
+
+  str = value_str(v);
+  if (str == NULL || (size = strlen(str)) < sizeof(node->value.small_str)) {
+    return conf_node_set_value(node, v);
+  }
+  return_value_if_fail(node->value_type != CONF_NODE_VALUE_NODE, RET_BAD_PARAMS);
+
+  /*先拷贝再释放，str可能就是原来的值*/
+  p = conf_doc_arena_strdup(doc, str, size);
+  return_value_if_fail(p != NULL, RET_OOM);
+  conf_node_free_value(node);
+
+  node->value_type = CONF_NODE_VALUE_STRING;
+  node->node_type = CONF_NODE_SIMPLE;
+  node->value.str = p;
+  node->is_arena_value = TRUE;
+
+  return RET_OK;
+}
+
 static conf_node_obj_t* conf_doc_obj_array_find(conf_doc_t* doc, conf_node_t* node) {
   conf_node_obj_t* ret = NULL;
   uint32_t i = 0;
@@ -208,6 +350,7 @@ static conf_node_obj_t* conf_doc_obj_array_find(conf_doc_t* doc, conf_node_t* no
 }
 
 ret_t conf_doc_destroy_node(conf_doc_t* doc, conf_node_t* node) {
+  bool_t is_arena_node = FALSE;
   return_value_if_fail(doc != NULL && node != NULL, RET_BAD_PARAMS);
 
   if (doc->use_extend_type) {
@@ -220,19 +363,16 @@ ret_t conf_doc_destroy_node(conf_doc_t* doc, conf_node_t* node) {
     }
   }
 
-  if (!node->is_small_name) {
+  if (!node->is_small_name && !node->is_arena_name) {
     TKMEM_FREE(node->name.str);
   }
+  conf_node_free_value(node);
 
-  if (node->value_type == CONF_NODE_VALUE_STRING) {
-    TKMEM_FREE(node->value.str);
-  } else if (node->value_type == CONF_NODE_VALUE_WSTRING) {
-    TKMEM_FREE(node->value.wstr);
-  } else if (node->value_type == CONF_NODE_VALUE_BINARY) {
-    TKMEM_FREE(node->value.binary_data.data);
-  }
-
+  is_arena_node = node->is_arena_node;
   memset(node, 0x00, sizeof(*node));
+  if (is_arena_node) {
+    return RET_OK;
+  }
 
   if (node >= doc->prealloc_nodes && node < (doc->prealloc_nodes + doc->prealloc_nodes_nr)) {
     node->node_type = CONF_NODE_NONE;
@@ -478,16 +618,60 @@ conf_node_t* conf_node_find_child_by_index(conf_node_t* node, int32_t index) {
   return conf_node_find_sibling_by_index(first_child, index);
 }
 
+/*释放节点在堆上分配的部分，在内存块中的部分随内存块一起释放*/
+static ret_t conf_node_release(conf_node_t* node) {
+  if (!node->is_small_name && !node->is_arena_name) {
+    TKMEM_FREE(node->name.str);
+  }
+  conf_node_free_value(node);
+
+  if (!node->is_arena_node) {
+    TKMEM_FREE(node);
+  }
+
+  return RET_OK;
+}
+
+/*不递归地释放全部节点(子节点先于父节点释放)，大部分节点都在内存块中，不需要逐个释放*/
+static ret_t conf_doc_arena_release_nodes(conf_node_t* root) {
+  conf_node_t* iter = root;
+
+  while (iter != NULL) {
+    if (iter->value_type == CONF_NODE_VALUE_NODE && iter->value.first_child != NULL) {
+      iter = iter->value.first_child;
+      continue;
+    }
+
+    while (iter != NULL) {
+      conf_node_t* next = iter->next;
+      conf_node_t* parent = iter->parent;
+
+      conf_node_release(iter);
+      if (next != NULL) {
+        iter = next;
+        break;
+      }
+      iter = parent;
+    }
+  }
+
+  return RET_OK;
+}
+
 ret_t conf_doc_destroy(conf_doc_t* doc) {
   return_value_if_fail(doc != NULL, RET_BAD_PARAMS);
 
-  if (doc->root != NULL) {
+  if (doc->root != NULL && doc->arena != NULL && doc->obj_array == NULL) {
+    conf_doc_arena_release_nodes(doc->root);
+    doc->root = NULL;
+  } else if (doc->root != NULL) {
     conf_node_destroy(doc, doc->root);
     doc->root = NULL;
   }
   tokenizer_deinit(&(doc->tokenizer));
   TKMEM_FREE(doc->prealloc_nodes);
   TK_OBJECT_UNREF(doc->obj_array);
+  conf_doc_arena_destroy(doc);
 
   TKMEM_FREE(doc);
 
@@ -505,7 +689,6 @@ ret_t conf_node_set_value(conf_node_t* node, const value_t* v) {
         return RET_OK;
       }
     }
-    TKMEM_FREE(node->value.str);
   } else if (node->value_type == CONF_NODE_VALUE_SMALL_STR) {
     if (v->type == VALUE_TYPE_STRING) {
       const char* p = value_str(v);
@@ -520,7 +703,6 @@ ret_t conf_node_set_value(conf_node_t* node, const value_t* v) {
         return RET_OK;
       }
     }
-    TKMEM_FREE(node->value.wstr);
   } else if (node->value_type == CONF_NODE_VALUE_BINARY) {
     if (v->type == VALUE_TYPE_BINARY) {
       if (node->value.binary_data.data == v->value.binary_data.data &&
@@ -528,8 +710,8 @@ ret_t conf_node_set_value(conf_node_t* node, const value_t* v) {
         return RET_OK;
       }
     }
-    TKMEM_FREE(node->value.binary_data.data);
   }
+  conf_node_free_value(node);
 
   switch (v->type) {
     case VALUE_TYPE_BOOL: {
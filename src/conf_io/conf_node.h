@@ -30,6 +30,7 @@ BEGIN_C_DECLS
 
 struct _conf_node_t;
 typedef struct _conf_node_t conf_node_t;
+typedef struct _conf_doc_arena_block_t conf_doc_arena_block_t;
 typedef ret_t (*conf_doc_on_visit_t)(void* ctx, const char* path, value_t* v);
 
 /**
@@ -58,6 +59,9 @@ typedef struct _conf_doc_t {
   uint32_t prealloc_nodes_used;
   uint32_t prealloc_nodes_nr;
   uint32_t max_deep_level;
+  /*arena模式下，节点和字符串从内存块中顺序分配(arena_block_size为0表示不使用)*/
+  conf_doc_arena_block_t* arena;
+  uint32_t arena_block_size;
 } conf_doc_t;
 
 /**
@@ -71,6 +75,35 @@ typedef struct _conf_doc_t {
  */
 conf_doc_t* conf_doc_create(uint32_t prealloc_nodes_nr);
 
+/**
+ * @method conf_doc_create_with_arena
+ *
+ * 构造函数(arena模式)。
+ *
+ * 节点、名称和值的字符串都从一组内存块中顺序分配，不再逐个调用malloc，
+ * 销毁文档时一次性释放全部内存块。适合加载后很少修改的文档。
+ *
+ * > 删除或修改节点时，原来在内存块中的数据在销毁文档时才释放。
+ *
+ * @param {uint32_t} block_size 第一个内存块的大小(后续内存块逐步增大)。
+ *
+ * @return {conf_doc_t*} 返回doc对象。
+ */
+conf_doc_t* conf_doc_create_with_arena(uint32_t block_size);
+
+/**
+ * @method conf_doc_stop_arena
+ *
+ * 停止从内存块中分配，之后创建的节点和设置的值在堆上分配。已经分配的内存块在销毁文档时释放。
+ *
+ * > 一般在加载完成后调用，避免经常修改的文档占用的内存不断增长。
+ *
+ * @param {conf_doc_t*} doc 文档对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t conf_doc_stop_arena(conf_doc_t* doc);
+
 /**
  * @method conf_doc_create_node
  *
@@ -136,6 +169,19 @@ conf_node_t* conf_doc_dup_node(conf_doc_t* doc, conf_node_t* node, const char* n
 ret_t conf_doc_set_node_prop(conf_doc_t* doc, conf_node_t* node, const char* name,
                              const value_t* v);
 
+/**
+ * @method conf_doc_set_node_value
+ *
+ * 设置节点的值。与conf\_node\_set\_value相同，但arena模式下字符串从文档的内存块中分配。
+ *
+ * @param {conf_doc_t*} doc 文档对象。
+ * @param {conf_node_t*} node 节点对象。
+ * @param {const value_t*} v 值。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t conf_doc_set_node_value(conf_doc_t* doc, conf_node_t* node, const value_t* v);
+
 /**
  * @method conf_doc_find_node
  *
@@ -639,6 +685,10 @@ struct _conf_node_t {
 
   /*private*/
   bool_t is_small_name : 1;
+  /*节点、名称和值是否在文档的arena内存块中*/
+  bool_t is_arena_node : 1;
+  bool_t is_arena_name : 1;
+  bool_t is_arena_value : 1;
 
   union {
     char* str;
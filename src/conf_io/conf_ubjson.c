@@ -158,6 +158,8 @@ ret_t conf_doc_save_ubjson(conf_doc_t* doc, ubjson_writer_t* writer) {
 typedef struct _parse_ctx_t {
   conf_doc_t* doc;
   conf_node_t* node;
+  /*当前节点最后一个子节点，追加时不用每次都遍历兄弟节点*/
+  conf_node_t* last;
   uint32_t optimized_type;
 } parse_ctx_t;
 
@@ -172,6 +174,7 @@ static ret_t ubjson_conf_on_key_value(void* ctx, const char* key, value_t* v) {
     if (token == UBJSON_MARKER_OBJECT_END || token == UBJSON_MARKER_ARRAY_END) {
       if (current->parent != NULL) {
         parser->node = current->parent;
+        parser->last = current;
       }
       return RET_OK;
     }
@@ -192,7 +195,12 @@ static ret_t ubjson_conf_on_key_value(void* ctx, const char* key, value_t* v) {
   } else {
     node = conf_doc_create_node(parser->doc, key);
     return_value_if_fail(node != NULL, RET_OOM);
-    conf_doc_append_child(parser->doc, current, node);
+    if (parser->last != NULL) {
+      conf_doc_append_sibling(parser->doc, parser->last, node);
+    } else {
+      conf_doc_append_child(parser->doc, current, node);
+    }
+    parser->last = node;
   }
 
   if (v->type == VALUE_TYPE_TOKEN) {
@@ -201,9 +209,11 @@ static ret_t ubjson_conf_on_key_value(void* ctx, const char* key, value_t* v) {
     if (token == UBJSON_MARKER_OBJECT_BEGIN) {
       node->node_type = CONF_NODE_OBJECT;
       parser->node = node;
+      parser->last = NULL;
     } else if (token == UBJSON_MARKER_ARRAY_BEGIN) {
       node->node_type = CONF_NODE_ARRAY;
       parser->node = node;
+      parser->last = NULL;
 
     } else if (token == UBJSON_MARKER_UINT8) {
       parser->optimized_type = token;
@@ -216,13 +226,14 @@ static ret_t ubjson_conf_on_key_value(void* ctx, const char* key, value_t* v) {
     if (node->node_type == CONF_NODE_ARRAY_UINT8) {
       if (current->parent != NULL) {
         parser->node = current->parent;
+        parser->last = current;
       }
 
-      ret = conf_node_set_value(node, v);
+      ret = conf_doc_set_node_value(parser->doc, node, v);
 
     } else {
       node->node_type = CONF_NODE_SIMPLE;
-      ret = conf_node_set_value(node, v);
+      ret = conf_doc_set_node_value(parser->doc, node, v);
     }
   }
 
@@ -242,22 +253,17 @@ conf_doc_t* conf_doc_load_ubjson(const void* data, uint32_t size) {
 }
 
 static conf_doc_t* conf_doc_load_ubjson_reader(data_reader_t* reader) {
-  char* data = NULL;
-  int32_t rsize = 0;
-  conf_doc_t* doc = NULL;
-  uint64_t size = data_reader_get_size(reader);
-  return_value_if_fail(reader != NULL && size > 0, NULL);
-  data = TKMEM_ALLOC(size + 1);
-  return_value_if_fail(data != NULL, NULL);
+  parse_ctx_t parser;
+  return_value_if_fail(reader != NULL && data_reader_get_size(reader) > 0, NULL);
+  memset(&parser, 0x00, sizeof(parser));
 
-  memset(data, 0x00, size + 1);
-  rsize = data_reader_read(reader, 0, data, size);
-  if (rsize > 0) {
-    doc = conf_doc_load_ubjson(data, rsize);
-  }
-  TKMEM_FREE(data);
+  parser.doc = conf_doc_create_with_arena(0);
+  return_value_if_fail(parser.doc != NULL, NULL);
 
-  return doc;
+  ubjson_parse_reader(reader, ubjson_conf_on_key_value, &parser);
+  conf_doc_stop_arena(parser.doc);
+
+  return parser.doc;
 }
 
 static ret_t conf_doc_save_ubjson_writer(conf_doc_t* doc, data_writer_t* writer) {
@@ -53,18 +53,18 @@ static ret_t yaml_parser_parse_flow_mapping(yaml_parser_t* parser, conf_node_t*
 static ret_t yaml_parser_parse_flow_value(yaml_parser_t* parser, conf_node_t* node);
 static const char* yaml_parser_parse_multiline_string(yaml_parser_t* parser, char block_char);
 
-static ret_t yaml_parser_init(yaml_parser_t* parser, const char* data) {
+static ret_t yaml_parser_init(yaml_parser_t* parser, const char* data, bool_t use_arena) {
   conf_doc_t* doc = NULL;
   return_value_if_fail(parser != NULL && data != NULL, RET_BAD_PARAMS);
 
   memset(parser, 0x00, sizeof(*parser));
-  doc = conf_doc_create(100);
+  doc = use_arena ? conf_doc_create_with_arena(0) : conf_doc_create(100);
   return_value_if_fail(doc != NULL, RET_OOM);
 
   doc->max_deep_level = 20;
   doc->root = conf_doc_create_node(doc, CONF_NODE_ROOT_NAME);
   if (doc->root == NULL) {
-    TKMEM_FREE(doc);
+    conf_doc_destroy(doc);
     return RET_OOM;
   }
 
@@ -596,7 +596,7 @@ static ret_t yaml_parser_parse_flow_value(yaml_parser_t* parser, conf_node_t* no
     value = yaml_parser_parse_quoted_string_internal(parser, '"', FALSE);
     if (value != NULL) {
       value_set_str(&v, value);
-      conf_node_set_value(node, &v);
+      conf_doc_set_node_value(parser->doc, node, &v);
       /* 跳过引号后的空格 */
       yaml_parser_skip_spaces(&parser->cursor);
     }
@@ -606,7 +606,7 @@ static ret_t yaml_parser_parse_flow_value(yaml_parser_t* parser, conf_node_t* no
     value = yaml_parser_parse_quoted_string_internal(parser, '\'', FALSE);
     if (value != NULL) {
       value_set_str(&v, value);
-      conf_node_set_value(node, &v);
+      conf_doc_set_node_value(parser->doc, node, &v);
       /* 跳过引号后的空格 */
       yaml_parser_skip_spaces(&parser->cursor);
     }
@@ -653,7 +653,7 @@ static ret_t yaml_parser_parse_flow_value(yaml_parser_t* parser, conf_node_t* no
       value_set_str(&v, value);
     }
 
-    conf_node_set_value(node, &v);
+    conf_doc_set_node_value(parser->doc, node, &v);
     return RET_OK;
   }
 }
@@ -1004,7 +1004,7 @@ static ret_t yaml_parser_parse_line(yaml_parser_t* parser) {
       /* 检查是否是 null 值 */
       if (yaml_is_null_value(value)) {
         value_set_str(&v, NULL);
-        conf_node_set_value(node, &v);
+        conf_doc_set_node_value(parser->doc, node, &v);
       } else if (*value) {
         /* 非空值：检查是否是布尔值 */
         if (yaml_parse_bool_value(value, &bool_val) == RET_OK) {
@@ -1012,7 +1012,7 @@ static ret_t yaml_parser_parse_line(yaml_parser_t* parser) {
         } else {
           value_set_str(&v, value);
         }
-        conf_node_set_value(node, &v);
+        conf_doc_set_node_value(parser->doc, node, &v);
       } else {
         /* 空字符串：可能是对象节点（如果后续有子节点）或空字符串值
          * 对于非列表项，暂时设置为对象节点，如果后续没有子节点，会在保存时处理 */
@@ -1023,7 +1023,7 @@ static ret_t yaml_parser_parse_line(yaml_parser_t* parser) {
         } else {
           /* 列表项的空值 */
           value_set_str(&v, value);
-          conf_node_set_value(node, &v);
+          conf_doc_set_node_value(parser->doc, node, &v);
         }
       }
     }
@@ -1060,7 +1060,7 @@ static ret_t yaml_parser_parse(yaml_parser_t* parser) {
   return RET_OK;
 }
 
-conf_doc_t* conf_doc_load_yaml(const char* data) {
+static conf_doc_t* conf_doc_load_yaml_impl(const char* data, bool_t use_arena) {
   ret_t ret = RET_OK;
   yaml_parser_t parser;
   conf_doc_t* doc = NULL;
@@ -1082,12 +1082,15 @@ conf_doc_t* conf_doc_load_yaml(const char* data) {
     return empty_doc;
   }
 
-  return_value_if_fail(yaml_parser_init(&parser, data) == RET_OK, NULL);
+  return_value_if_fail(yaml_parser_init(&parser, data, use_arena) == RET_OK, NULL);
 
   ret = yaml_parser_parse(&parser);
   if (ret == RET_OK) {
     doc = parser.doc;
     parser.doc = NULL;
+    if (use_arena) {
+      conf_doc_stop_arena(doc);
+    }
   }
 
   yaml_parser_deinit(&parser);
@@ -1095,6 +1098,10 @@ conf_doc_t* conf_doc_load_yaml(const char* data) {
   return doc;
 }
 
+conf_doc_t* conf_doc_load_yaml(const char* data) {
+  return conf_doc_load_yaml_impl(data, FALSE);
+}
+
 static bool_t yaml_need_quote_internal(const char* str, bool_t include_quotes) {
   const char* p = str;
   if (str == NULL || *str == '\0') {
@@ -1284,7 +1291,8 @@ static conf_doc_t* conf_doc_load_yaml_reader(data_reader_t* reader) {
   memset(data, 0x00, size + 1);
   rsize = data_reader_read(reader, 0, data, size);
   if (rsize > 0) {
-    doc = conf_doc_load_yaml(data);
+    /*yaml需要完整的文本，只把节点放到内存池中，销毁时一次释放*/
+    doc = conf_doc_load_yaml_impl(data, TRUE);
   }
   TKMEM_FREE(data);
 
@@ -221,8 +221,9 @@ static ret_t gif_image_paint_self_normal(widget_t* widget, canvas_t* c) {
       image->timer_id = timer_add(gif_image_on_timer, image, image->delay);
     } else if (image->delay != delay) {
       image->delay = delay;
-      timer_info_t* timer = (timer_info_t*)timer_find(image->timer_id);
-      if (timer) timer->duration = image->delay;
+      if (timer_find(image->timer_id) != NULL) {
+        timer_modify_ex(image->timer_id, image->delay, FALSE);
+      }
     }
   } else if (image->timer_id != TK_INVALID_ID) {
     timer_remove(image->timer_id);
@@ -302,8 +303,9 @@ static ret_t gif_image_paint_self_part_buffer_load(widget_t* widget, canvas_t* c
       image->timer_id = timer_add(gif_image_on_timer, image, image->delay);
     } else if (image->delay != delay) {
       image->delay = delay;
-      timer_info_t* timer = (timer_info_t*)timer_find(image->timer_id);
-      if (timer) timer->duration = image->delay;
+      if (timer_find(image->timer_id) != NULL) {
+        timer_modify_ex(image->timer_id, image->delay, FALSE);
+      }
       if (image->gif_on_end) {
         return_value_if_fail(gif_image_load_gif(widget, image_base->image, bitmap,
                                                 image->part_buffer_load_mode) == RET_OK,
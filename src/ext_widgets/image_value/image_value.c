@@ -23,6 +23,16 @@
 #include "tkc/utils.h"
 #include "image_value/image_value.h"
 
+static ret_t image_value_load_image(widget_t* widget, const char* name, bitmap_t* bitmap) {
+  image_value_t* image_value = IMAGE_VALUE(widget);
+
+  if (image_value->async_load) {
+    return widget_load_image_async(widget, name, bitmap, 0);
+  } else {
+    return widget_load_image(widget, name, bitmap);
+  }
+}
+
 static ret_t image_value_draw_images(widget_t* widget, canvas_t* c,
                                      char bitmap_name[IMAGE_VALUE_MAX_CHAR_NR][TK_NAME_LEN + 1],
                                      uint32_t nr) {
@@ -35,6 +45,7 @@ static ret_t image_value_draw_images(widget_t* widget, canvas_t* c,
   float scale_h = 1;
   rect_t clip_r;
   rect_t save_clip_r;
+  bool_t loading = FALSE;
   float_t ratio = c->lcd->ratio;
   style_t* style = widget->astyle;
   rect_t content_r = widget_get_content_area(widget);
@@ -45,13 +56,23 @@ static ret_t image_value_draw_images(widget_t* widget, canvas_t* c,
 
   for (i = 0; i < nr; i++) {
     bitmap_t b;
-    return_value_if_fail(widget_load_image(widget, bitmap_name[i], &b) == RET_OK, RET_BAD_PARAMS);
+    ret_t ret = image_value_load_image(widget, bitmap_name[i], &b);
+    if (ret == RET_BUSY) {
+      loading = TRUE;
+      continue;
+    }
+    return_value_if_fail(ret == RET_OK, RET_BAD_PARAMS);
     w += b.w;
     if (h < b.h) {
       h = b.h;
     }
   }
 
+  if (loading) {
+    /*全部图片解码完成后再一起绘制*/
+    return RET_OK;
+  }
+
   w = w / ratio;
   h = h / ratio;
   return_value_if_fail(w > 0 && h > 0 && content_r.w > 0 && content_r.h > 0, RET_BAD_PARAMS);
@@ -204,6 +225,9 @@ static ret_t image_value_get_prop(widget_t* widget, const char* name, value_t* v
   } else if (tk_str_eq(name, WIDGET_PROP_CLICK_ADD_DELTA)) {
     value_set_double(v, image_value->click_add_delta);
     return RET_OK;
+  } else if (tk_str_eq(name, WIDGET_PROP_ASYNC_LOAD)) {
+    value_set_bool(v, image_value->async_load);
+    return RET_OK;
   }
 
   return RET_NOT_FOUND;
@@ -224,6 +248,8 @@ static ret_t image_value_set_prop(widget_t* widget, const char* name, const valu
     return image_value_set_format(widget, value_str(v));
   } else if (tk_str_eq(name, WIDGET_PROP_CLICK_ADD_DELTA)) {
     return image_value_set_click_add_delta(widget, value_double(v));
+  } else if (tk_str_eq(name, WIDGET_PROP_ASYNC_LOAD)) {
+    return image_value_set_async_load(widget, value_bool(v));
   }
 
   return RET_NOT_FOUND;
@@ -306,6 +332,7 @@ static const char* s_image_value_properties[] = {WIDGET_PROP_VALUE,
                                                  WIDGET_PROP_FORMAT,
                                                  WIDGET_PROP_IMAGE,
                                                  WIDGET_PROP_CLICK_ADD_DELTA,
+                                                 WIDGET_PROP_ASYNC_LOAD,
                                                  NULL};
 
 TK_DECL_VTABLE(image_value) = {.size = sizeof(image_value_t),
@@ -333,6 +360,7 @@ ret_t image_value_set_image(widget_t* widget, const char* image) {
   image_value_t* image_value = IMAGE_VALUE(widget);
   return_value_if_fail(image_value != NULL && image != NULL, RET_BAD_PARAMS);
 
+  widget_cancel_load_image_async(widget);
   image_value->image = tk_str_copy(image_value->image, image);
 
   return widget_invalidate(widget, NULL);
@@ -395,6 +423,18 @@ ret_t image_value_set_max(widget_t* widget, double max) {
   return RET_OK;
 }
 
+ret_t image_value_set_async_load(widget_t* widget, bool_t async_load) {
+  image_value_t* image_value = IMAGE_VALUE(widget);
+  return_value_if_fail(image_value != NULL, RET_BAD_PARAMS);
+
+  image_value->async_load = async_load;
+  if (!async_load) {
+    widget_cancel_load_image_async(widget);
+  }
+
+  return RET_OK;
+}
+
 widget_t* image_value_cast(widget_t* widget) {
   return_value_if_fail(WIDGET_IS_INSTANCE_OF(widget, image_value), NULL);
 
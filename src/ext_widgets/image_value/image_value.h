@@ -113,6 +113,13 @@ typedef struct _image_value_t {
    */
   double max;
 
+  /**
+   * @property {bool_t} async_load
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 是否在后台线程中异步解码图片(缺省FALSE)。全部图片解码完成后才绘制。
+   */
+  bool_t async_load;
+
   /*private*/
   bool_t pressed;
 } image_value_t;
@@ -207,6 +214,17 @@ ret_t image_value_set_min(widget_t* widget, double min);
  */
 ret_t image_value_set_max(widget_t* widget, double max);
 
+/**
+ * @method image_value_set_async_load
+ * 设置是否在后台线程中异步解码图片。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget image_value对象。
+ * @param {bool_t} async_load 是否异步解码图片。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_value_set_async_load(widget_t* widget, bool_t async_load);
+
 /**
  * @method image_value_cast
  * 转换为image_value对象(供脚本语言使用)。
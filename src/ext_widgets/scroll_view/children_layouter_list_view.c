@@ -531,7 +531,25 @@ static ret_t children_layouter_list_view_for_list_view_layout(children_layouter_
   scroll_bar = list_view_get_scroll_bar(WIDGET(list_view), FALSE);
   scroll_bar_h = list_view_get_scroll_bar(WIDGET(list_view), TRUE);
 
-  if (widget->children != NULL) {
+  if (list_view_is_virtual(WIDGET(list_view))) {
+    /*虚拟列表只布局可见的列表项，虚拟高度由各项的高度计算*/
+    int32_t scroll_view_w = 0;
+    int32_t scroll_view_h = widget->h;
+
+    virtual_h = list_view_layout_virtual_items(WIDGET(list_view), l->x_margin, l->y_margin,
+                                               l->spacing);
+    scroll_view_w =
+        children_layouter_list_view_for_list_view_get_scroll_view_w(list_view, widget, virtual_h);
+
+    virtual_w = tk_max(list_view->item_width, scroll_view_w);
+    if (scroll_bar_h != NULL) {
+      if (virtual_w == scroll_view_w) {
+        scroll_view_h = widget->h + scroll_bar_h->h;
+      }
+    }
+
+    widget_move_resize_ex(widget, widget->x, widget->y, scroll_view_w, scroll_view_h, FALSE);
+  } else if (widget->children != NULL) {
     int32_t scroll_view_w = 0;
     int32_t scroll_view_h = widget->h;
     darray_t children_for_layout;
@@ -23,15 +23,20 @@
 #include "tkc/utils.h"
 #include "tkc/time_now.h"
 #include "base/layout.h"
+#include "scroll_view/list_item.h"
 #include "scroll_view/list_view.h"
 #include "scroll_view/scroll_bar.h"
 #include "scroll_view/scroll_view.h"
+#include "scroll_view/children_layouter_list_view.h"
 
 #define LIST_VIEW_FLOATING_SCROLL_BAR_HIDE_TIME 500
 #define LIST_VIEW_FLOATING_SCROLL_BAR_SHOW_TIME 300
+#define LIST_VIEW_DEFAULT_VIRTUAL_OVERSCAN 2
+#define LIST_VIEW_DEFAULT_VIRTUAL_ITEM_HEIGHT 30
 
 static ret_t list_view_on_add_child(widget_t* widget, widget_t* child);
 static ret_t list_view_on_remove_child(widget_t* widget, widget_t* child);
+static ret_t list_view_virtual_sync(list_view_t* list_view);
 
 static ret_t list_view_on_paint_self(widget_t* widget, canvas_t* c) {
   return widget_paint_helper(widget, c, NULL, NULL);
@@ -41,26 +46,44 @@ static ret_t list_view_get_prop(widget_t* widget, const char* name, value_t* v)
   list_view_t* list_view = LIST_VIEW(widget);
   return_value_if_fail(list_view != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_ITEM_HEIGHT)) {
-    value_set_int(v, list_view->item_height);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_DEFAULT_ITEM_HEIGHT)) {
-    value_set_int(v, list_view->default_item_height);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_AUTO_HIDE_SCROLL_BAR)) {
-    value_set_bool(v, list_view->auto_hide_scroll_bar);
-    return RET_OK;
-  } else if (tk_str_eq(name, LIST_VIEW_PROP_FLOATING_SCROLL_BAR)) {
-    value_set_bool(v, list_view->floating_scroll_bar);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ITEM_WIDTH)) {
-    value_set_int(v, list_view->item_width);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ROW) /* scroll_bar need */) {
-    if (list_view->item_height > 0) {
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_ITEM_HEIGHT: {
       value_set_int(v, list_view->item_height);
       return RET_OK;
     }
+    case WIDGET_PROP_ATOM_DEFAULT_ITEM_HEIGHT: {
+      value_set_int(v, list_view->default_item_height);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_AUTO_HIDE_SCROLL_BAR: {
+      value_set_bool(v, list_view->auto_hide_scroll_bar);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ITEM_WIDTH: {
+      value_set_int(v, list_view->item_width);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ROW: {
+      /* scroll_bar need */
+      if (list_view->item_height > 0) {
+        value_set_int(v, list_view->item_height);
+        return RET_OK;
+      }
+      break;
+    }
+    default: {
+      if (tk_str_eq(name, LIST_VIEW_PROP_FLOATING_SCROLL_BAR)) {
+        value_set_bool(v, list_view->floating_scroll_bar);
+        return RET_OK;
+      } else if (tk_str_eq(name, LIST_VIEW_PROP_VIRTUAL_ITEMS)) {
+        value_set_uint32(v, list_view->virtual_items);
+        return RET_OK;
+      } else if (tk_str_eq(name, LIST_VIEW_PROP_VIRTUAL_OVERSCAN)) {
+        value_set_uint32(v, list_view->virtual_overscan);
+        return RET_OK;
+      }
+      break;
+    }
   }
 
   return RET_NOT_FOUND;
@@ -83,20 +106,33 @@ static ret_t list_view_set_prop(widget_t* widget, const char* name, const value_
   list_view_t* list_view = LIST_VIEW(widget);
   return_value_if_fail(list_view != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_ITEM_HEIGHT)) {
-    list_view->item_height = value_int(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_DEFAULT_ITEM_HEIGHT)) {
-    list_view->default_item_height = value_int(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_AUTO_HIDE_SCROLL_BAR)) {
-    list_view->auto_hide_scroll_bar = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, LIST_VIEW_PROP_FLOATING_SCROLL_BAR)) {
-    return list_view_set_floating_scroll_bar(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_ITEM_WIDTH)) {
-    list_view->item_width = value_int(v);
-    return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_ITEM_HEIGHT: {
+      list_view->item_height = value_int(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_DEFAULT_ITEM_HEIGHT: {
+      list_view->default_item_height = value_int(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_AUTO_HIDE_SCROLL_BAR: {
+      list_view->auto_hide_scroll_bar = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ITEM_WIDTH: {
+      list_view->item_width = value_int(v);
+      return RET_OK;
+    }
+    default: {
+      if (tk_str_eq(name, LIST_VIEW_PROP_FLOATING_SCROLL_BAR)) {
+        return list_view_set_floating_scroll_bar(widget, value_bool(v));
+      } else if (tk_str_eq(name, LIST_VIEW_PROP_VIRTUAL_ITEMS)) {
+        return list_view_set_virtual_items(widget, value_uint32(v));
+      } else if (tk_str_eq(name, LIST_VIEW_PROP_VIRTUAL_OVERSCAN)) {
+        return list_view_set_virtual_overscan(widget, value_uint32(v));
+      }
+      break;
+    }
   }
 
   return RET_NOT_FOUND;
@@ -268,12 +304,34 @@ static const char* s_list_view_clone_properties[] = {WIDGET_PROP_ITEM_WIDTH,
                                                      LIST_VIEW_PROP_FLOATING_SCROLL_BAR,
                                                      NULL};
 
+static ret_t list_view_init(widget_t* widget) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  list_view->virtual_overscan = LIST_VIEW_DEFAULT_VIRTUAL_OVERSCAN;
+
+  return RET_OK;
+}
+
+static ret_t list_view_on_destroy(widget_t* widget) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  TKMEM_FREE(list_view->virtual_heights);
+  TKMEM_FREE(list_view->virtual_bound);
+  list_view->virtual_bound_size = 0;
+
+  return RET_OK;
+}
+
 TK_DECL_VTABLE(list_view) = {.type = WIDGET_TYPE_LIST_VIEW,
                              .size = sizeof(list_view_t),
                              .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                              .clone_properties = s_list_view_clone_properties,
                              .persistent_properties = s_list_view_clone_properties,
                              .create = list_view_create,
+                             .init = list_view_init,
+                             .on_destroy = list_view_on_destroy,
                              .set_prop = list_view_set_prop,
                              .get_prop = list_view_get_prop,
                              .on_event = list_view_on_event,
@@ -370,6 +428,7 @@ static ret_t list_view_on_scroll_view_scroll(widget_t* widget, int32_t xoffset,
   list_view_t* list_view = LIST_VIEW(widget->parent);
   return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
 
+  list_view_virtual_sync(list_view);
   for (i = 0; i < ARRAY_SIZE(list_view->scroll_bars); i++) {
     widget_t* scroll_bar = list_view->scroll_bars[i];
     if (scroll_bar != NULL) {
@@ -432,6 +491,13 @@ static ret_t list_view_on_scroll_view_paint_children(widget_t* widget, canvas_t*
   int32_t right = 0;
   int32_t max_w = canvas_get_width(c);
   int32_t max_h = canvas_get_height(c);
+  list_view_t* list_view = LIST_VIEW(widget->parent);
+  /*虚拟列表中回收的列表项不是按位置排列的，不能提前结束*/
+  bool_t sorted = list_view == NULL || list_view->bind_item == NULL;
+
+  if (!sorted) {
+    list_view_virtual_sync(list_view);
+  }
 
   WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
 
@@ -446,7 +512,11 @@ static ret_t list_view_on_scroll_view_paint_children(widget_t* widget, canvas_t*
   right = left + iter->w;
 
   if (top > max_h || left > max_w) {
-    break;
+    if (sorted) {
+      break;
+    }
+    iter->dirty = FALSE;
+    continue;
   }
 
   if (bottom < 0 || right < 0) {
@@ -611,7 +681,10 @@ ret_t list_view_reinit(widget_t* widget) {
 }
 
 widget_t* list_view_create(widget_t* parent, xy_t x, xy_t y, wh_t w, wh_t h) {
-  return widget_create(parent, TK_REF_VTABLE(list_view), x, y, w, h);
+  widget_t* widget = widget_create(parent, TK_REF_VTABLE(list_view), x, y, w, h);
+  return_value_if_fail(list_view_init(widget) == RET_OK, NULL);
+
+  return widget;
 }
 
 ret_t list_view_set_item_height(widget_t* widget, int32_t item_height) {
@@ -667,6 +740,293 @@ widget_t* list_view_get_scroll_bar(widget_t* widget, bool_t horizon) {
   return NULL;
 }
 
+static int32_t list_view_virtual_get_fixed_item_height(list_view_t* list_view) {
+  int32_t item_height = list_view->item_height;
+  int32_t default_item_height = list_view->default_item_height;
+  widget_t* scroll_view = list_view->scroll_view;
+  children_layouter_t* layouter = scroll_view != NULL ? scroll_view->children_layout : NULL;
+
+  /*与children_layouter_list_view一致，list_view没有设置时使用children_layout中的参数*/
+  if (layouter != NULL && tk_str_eq(layouter->vt->type, CHILDREN_LAYOUTER_LIST_VIEW)) {
+    children_layouter_list_view_t* l = (children_layouter_list_view_t*)layouter;
+
+    if (item_height <= 0) {
+      item_height = l->item_height;
+    }
+    if (default_item_height <= 0) {
+      default_item_height = l->default_item_height;
+    }
+  }
+
+  if (item_height > 0) {
+    return item_height;
+  } else if (default_item_height > 0) {
+    return default_item_height;
+  } else {
+    return LIST_VIEW_DEFAULT_VIRTUAL_ITEM_HEIGHT;
+  }
+}
+
+static int32_t list_view_virtual_get_item_top(list_view_t* list_view, uint32_t index) {
+  int32_t top = list_view->virtual_y_margin + index * list_view->virtual_spacing;
+
+  if (list_view->virtual_heights != NULL) {
+    return top + list_view->virtual_heights[index];
+  } else {
+    return top + index * list_view_virtual_get_fixed_item_height(list_view);
+  }
+}
+
+static int32_t list_view_virtual_get_item_height(list_view_t* list_view, uint32_t index) {
+  if (list_view->virtual_heights != NULL) {
+    return list_view->virtual_heights[index + 1] - list_view->virtual_heights[index];
+  } else {
+    return list_view_virtual_get_fixed_item_height(list_view);
+  }
+}
+
+/*返回y所在(或者y之前最近)的数据项序号，变高时在前缀和上二分查找*/
+static uint32_t list_view_virtual_get_item_index_at(list_view_t* list_view, int32_t y) {
+  uint32_t nr = list_view->virtual_items;
+  int32_t spacing = list_view->virtual_spacing;
+
+  y -= list_view->virtual_y_margin;
+  if (nr == 0 || y <= 0) {
+    return 0;
+  }
+
+  if (list_view->virtual_heights == NULL) {
+    uint32_t index = y / (list_view_virtual_get_fixed_item_height(list_view) + spacing);
+    return tk_min(index, nr - 1);
+  } else {
+    uint32_t low = 0;
+    uint32_t high = nr - 1;
+
+    while (low < high) {
+      uint32_t mid = low + (high - low + 1) / 2;
+      if ((int32_t)(list_view->virtual_heights[mid] + mid * spacing) <= y) {
+        low = mid;
+      } else {
+        high = mid - 1;
+      }
+    }
+
+    return low;
+  }
+}
+
+static ret_t list_view_virtual_build_heights(list_view_t* list_view) {
+  uint32_t i = 0;
+  uint32_t nr = list_view->virtual_items;
+  int32_t fixed_h = list_view_virtual_get_fixed_item_height(list_view);
+
+  TKMEM_FREE(list_view->virtual_heights);
+  if (list_view->get_item_height == NULL || nr == 0) {
+    return RET_OK;
+  }
+
+  list_view->virtual_heights = TKMEM_ZALLOCN(uint32_t, nr + 1);
+  return_value_if_fail(list_view->virtual_heights != NULL, RET_OOM);
+
+  for (i = 0; i < nr; i++) {
+    int32_t h = list_view->get_item_height(list_view->get_item_height_ctx, WIDGET(list_view), i);
+    list_view->virtual_heights[i + 1] = list_view->virtual_heights[i] + (h > 0 ? h : fixed_h);
+  }
+
+  return RET_OK;
+}
+
+static ret_t list_view_virtual_ensure_items(list_view_t* list_view, uint32_t nr) {
+  uint32_t i = 0;
+  widget_t* item = NULL;
+  widget_t* scroll_view = list_view->scroll_view;
+  uint32_t size = (uint32_t)widget_count_children(scroll_view);
+
+  if (size == 0) {
+    item = list_item_create(scroll_view, 0, 0, 0, 0);
+    return_value_if_fail(item != NULL, RET_OOM);
+    size = 1;
+  }
+
+  for (item = widget_get_child(scroll_view, 0); size < nr; size++) {
+    return_value_if_fail(widget_clone(item, scroll_view) != NULL, RET_OOM);
+  }
+
+  if (list_view->virtual_bound_size != size) {
+    int32_t* bound = TKMEM_REALLOCT(int32_t, list_view->virtual_bound, size);
+    return_value_if_fail(bound != NULL, RET_OOM);
+
+    for (i = 0; i < size; i++) {
+      bound[i] = -1;
+    }
+    list_view->virtual_bound = bound;
+    list_view->virtual_bound_size = size;
+  }
+
+  return RET_OK;
+}
+
+/*让列表项只覆盖可见区域(加上overscan)，移出可见区域的列表项用于显示新进入的数据项*/
+static ret_t list_view_virtual_sync(list_view_t* list_view) {
+  uint32_t i = 0;
+  uint32_t nr = 0;
+  uint32_t first = 0;
+  uint32_t size = 0;
+  int32_t item_w = 0;
+  widget_t** items = NULL;
+  widget_t* scroll_view = list_view->scroll_view;
+  scroll_view_t* ascroll_view = SCROLL_VIEW(scroll_view);
+
+  if (list_view->bind_item == NULL || ascroll_view == NULL) {
+    return RET_OK;
+  }
+
+  if (list_view->virtual_items > 0) {
+    uint32_t overscan = list_view->virtual_overscan;
+    int32_t bottom = ascroll_view->yoffset + tk_max(scroll_view->h, 1) - 1;
+    uint32_t last = list_view_virtual_get_item_index_at(list_view, bottom);
+
+    first = list_view_virtual_get_item_index_at(list_view, ascroll_view->yoffset);
+    first = first > overscan ? first - overscan : 0;
+    last = tk_min(last + overscan, list_view->virtual_items - 1);
+    nr = last - first + 1;
+  }
+  return_value_if_fail(list_view_virtual_ensure_items(list_view, nr) == RET_OK, RET_OOM);
+
+  size = list_view->virtual_bound_size;
+  items = (widget_t**)(scroll_view->children->elms);
+  item_w = tk_max(list_view->item_width, scroll_view->w) - 2 * list_view->virtual_x_margin;
+
+  for (i = 0; i < size; i++) {
+    /*数据项index固定由第index%size个列表项显示*/
+    uint32_t index = first + (i + size - first % size) % size;
+    widget_t* iter = items[i];
+
+    if (index >= first + nr) {
+      widget_set_visible_only(iter, FALSE);
+      continue;
+    }
+
+    if (list_view->virtual_bound[i] != (int32_t)index) {
+      list_view->virtual_bound[i] = index;
+      list_view->bind_item(list_view->bind_item_ctx, WIDGET(list_view), iter, index);
+    }
+
+    widget_set_visible_only(iter, TRUE);
+    if (iter->y != list_view_virtual_get_item_top(list_view, index) || iter->w != item_w ||
+        iter->h != list_view_virtual_get_item_height(list_view, index)) {
+      widget_move_resize_ex(iter, list_view->virtual_x_margin,
+                            list_view_virtual_get_item_top(list_view, index), item_w,
+                            list_view_virtual_get_item_height(list_view, index), FALSE);
+      widget_layout_children(iter);
+    }
+  }
+
+  return RET_OK;
+}
+
+int32_t list_view_layout_virtual_items(widget_t* widget, int32_t x_margin, int32_t y_margin,
+                                       int32_t spacing) {
+  uint32_t nr = 0;
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, 0);
+
+  nr = list_view->virtual_items;
+  list_view->virtual_x_margin = x_margin;
+  list_view->virtual_y_margin = y_margin;
+  list_view->virtual_spacing = spacing;
+
+  if (nr == 0) {
+    return 2 * y_margin;
+  }
+
+  return list_view_virtual_get_item_top(list_view, nr - 1) +
+         list_view_virtual_get_item_height(list_view, nr - 1) + y_margin;
+}
+
+bool_t list_view_is_virtual(widget_t* widget) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, FALSE);
+
+  return list_view->bind_item != NULL;
+}
+
+ret_t list_view_reload_virtual_items(widget_t* widget) {
+  uint32_t i = 0;
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  return_value_if_fail(list_view_virtual_build_heights(list_view) == RET_OK, RET_OOM);
+  for (i = 0; i < list_view->virtual_bound_size; i++) {
+    list_view->virtual_bound[i] = -1;
+  }
+
+  if (list_view->bind_item != NULL && list_view->scroll_view != NULL) {
+    widget_layout_children(list_view->scroll_view);
+    list_view_virtual_sync(list_view);
+    widget_invalidate(list_view->scroll_view, NULL);
+  }
+
+  return RET_OK;
+}
+
+ret_t list_view_set_bind_item(widget_t* widget, list_view_bind_item_t bind_item, void* ctx) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  list_view->bind_item = bind_item;
+  list_view->bind_item_ctx = ctx;
+
+  return list_view_reload_virtual_items(widget);
+}
+
+ret_t list_view_set_item_height_func(widget_t* widget, list_view_get_item_height_t get_item_height,
+                                     void* ctx) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  list_view->get_item_height = get_item_height;
+  list_view->get_item_height_ctx = ctx;
+
+  return list_view_reload_virtual_items(widget);
+}
+
+ret_t list_view_set_virtual_items(widget_t* widget, uint32_t virtual_items) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  list_view->virtual_items = virtual_items;
+
+  return list_view_reload_virtual_items(widget);
+}
+
+ret_t list_view_set_virtual_overscan(widget_t* widget, uint32_t virtual_overscan) {
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL, RET_BAD_PARAMS);
+
+  list_view->virtual_overscan = virtual_overscan;
+  list_view_virtual_sync(list_view);
+
+  return RET_OK;
+}
+
+int32_t list_view_get_virtual_item_index(widget_t* widget, widget_t* item) {
+  int32_t i = 0;
+  widget_t* iter = item;
+  list_view_t* list_view = LIST_VIEW(widget);
+  return_value_if_fail(list_view != NULL && item != NULL, -1);
+
+  while (iter != NULL && iter->parent != list_view->scroll_view) {
+    iter = iter->parent;
+  }
+  return_value_if_fail(iter != NULL && iter->visible, -1);
+
+  i = widget_index_of(iter);
+  return_value_if_fail(i >= 0 && i < list_view->virtual_bound_size, -1);
+
+  return list_view->virtual_bound[i];
+}
+
 widget_t* list_view_cast(widget_t* widget) {
   return_value_if_fail(WIDGET_IS_INSTANCE_OF(widget, list_view), NULL);
 
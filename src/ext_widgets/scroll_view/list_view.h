@@ -26,6 +26,33 @@
 
 BEGIN_C_DECLS
 
+/**
+ * @method list_view_bind_item_t
+ * 虚拟列表绑定列表项的回调函数。
+ * 在回调函数中，根据数据把列表项控件设置成第index项的内容(如设置文本)。
+ * @annotation ["global"]
+ * @param {void*} ctx 回调函数的上下文。
+ * @param {widget_t*} widget list_view对象。
+ * @param {widget_t*} item 列表项控件(可能是回收后重用的控件)。
+ * @param {uint32_t} index 数据项的序号。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+typedef ret_t (*list_view_bind_item_t)(void* ctx, widget_t* widget, widget_t* item,
+                                       uint32_t index);
+
+/**
+ * @method list_view_get_item_height_t
+ * 虚拟列表获取列表项高度的回调函数。
+ * @annotation ["global"]
+ * @param {void*} ctx 回调函数的上下文。
+ * @param {widget_t*} widget list_view对象。
+ * @param {uint32_t} index 数据项的序号。
+ *
+ * @return {int32_t} 返回第index项的高度。
+ */
+typedef int32_t (*list_view_get_item_height_t)(void* ctx, widget_t* widget, uint32_t index);
+
 /**
  * @class list_view_t
  * @parent widget_t
@@ -76,6 +103,22 @@ BEGIN_C_DECLS
  * 如果需要动态修改，可以使用widget\_clone来增加列表项，使用widget\_remove\_child来移出列表项。
  *
  * 可用通过style来设置控件的显示风格，如背景颜色和边框颜色等(一般情况不需要)。
+ *
+ * 数据项很多(如几万到上百万行的日志)时，可以使用虚拟列表：调用list\_view\_set\_bind\_item设置
+ * 绑定函数，再调用list\_view\_set\_virtual\_items设置数据项的个数。虚拟列表只为可见区域(加上
+ * virtual\_overscan行)创建列表项控件，滚动时回收不可见的列表项，并调用绑定函数重新设置它的内容。
+ * scroll\_view下的第一个子控件作为列表项的模板，没有时自动创建list\_item。如：
+ *
+ * ```c
+ *  static ret_t on_bind_item(void* ctx, widget_t* widget, widget_t* item, uint32_t index) {
+ *    return widget_set_text_utf8(item, s_lines[index]);
+ *  }
+ *
+ *  list_view_set_bind_item(list_view, on_bind_item, NULL);
+ *  list_view_set_virtual_items(list_view, 1000000);
+ * ```
+ *
+ * > 列表项的高度不同时，调用list\_view\_set\_item\_height\_func设置获取高度的函数。
  * 
  * 备注：list_view 下的 scroll_view 控件不支持遍历所有子控件的效果。
  * 
@@ -121,10 +164,37 @@ typedef struct _list_view_t {
    */
   int32_t item_width;
 
+  /**
+   * @property {uint32_t} virtual_items
+   * @annotation ["set_prop","get_prop","readable","scriptable"]
+   * 虚拟列表的数据项个数(设置了绑定函数后才有效)。
+   */
+  uint32_t virtual_items;
+
+  /**
+   * @property {uint32_t} virtual_overscan
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 虚拟列表在可见区域上下各多保留的列表项个数(缺省为2)。
+   */
+  uint32_t virtual_overscan;
+
   /*private*/
   bool_t is_over;
   widget_t* scroll_view;
   widget_t* scroll_bars[2];
+
+  list_view_bind_item_t bind_item;
+  void* bind_item_ctx;
+  list_view_get_item_height_t get_item_height;
+  void* get_item_height_ctx;
+  /*各项高度的前缀和，共virtual_items+1项，固定高度时为NULL*/
+  uint32_t* virtual_heights;
+  /*每个列表项控件当前绑定的数据项序号，-1表示未绑定*/
+  int32_t* virtual_bound;
+  uint32_t virtual_bound_size;
+  int32_t virtual_x_margin;
+  int32_t virtual_y_margin;
+  int32_t virtual_spacing;
 } list_view_t;
 
 /**
@@ -195,6 +265,95 @@ ret_t list_view_set_floating_scroll_bar(widget_t* widget, bool_t floating_scroll
  */
 widget_t* list_view_get_scroll_bar(widget_t* widget, bool_t horizon);
 
+/**
+ * @method list_view_set_bind_item
+ * 设置虚拟列表的绑定函数。设置后list_view工作在虚拟列表模式。
+ * @param {widget_t*} widget 控件对象。
+ * @param {list_view_bind_item_t} bind_item 绑定函数(为NULL时退出虚拟列表模式)。
+ * @param {void*} ctx 绑定函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t list_view_set_bind_item(widget_t* widget, list_view_bind_item_t bind_item, void* ctx);
+
+/**
+ * @method list_view_set_item_height_func
+ * 设置虚拟列表获取列表项高度的函数。不设置时，使用item\_height或default\_item\_height。
+ * @param {widget_t*} widget 控件对象。
+ * @param {list_view_get_item_height_t} get_item_height 获取列表项高度的函数。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t list_view_set_item_height_func(widget_t* widget, list_view_get_item_height_t get_item_height,
+                                     void* ctx);
+
+/**
+ * @method list_view_set_virtual_items
+ * 设置虚拟列表的数据项个数。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget 控件对象。
+ * @param {uint32_t} virtual_items 数据项个数。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t list_view_set_virtual_items(widget_t* widget, uint32_t virtual_items);
+
+/**
+ * @method list_view_set_virtual_overscan
+ * 设置虚拟列表在可见区域上下各多保留的列表项个数。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget 控件对象。
+ * @param {uint32_t} virtual_overscan 列表项个数。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t list_view_set_virtual_overscan(widget_t* widget, uint32_t virtual_overscan);
+
+/**
+ * @method list_view_reload_virtual_items
+ * 数据变化后，重新计算虚拟列表各项的高度，并重新绑定可见的列表项。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget 控件对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t list_view_reload_virtual_items(widget_t* widget);
+
+/**
+ * @method list_view_get_virtual_item_index
+ * 获取虚拟列表中控件当前对应的数据项序号。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget 控件对象。
+ * @param {widget_t*} item 列表项控件或者它的子控件。
+ *
+ * @return {int32_t} 返回数据项序号，失败返回-1。
+ */
+int32_t list_view_get_virtual_item_index(widget_t* widget, widget_t* item);
+
+/**
+ * @method list_view_is_virtual
+ * 是否工作在虚拟列表模式。
+ * @param {widget_t*} widget 控件对象。
+ *
+ * @return {bool_t} 返回TRUE表示是，否则表示不是。
+ */
+bool_t list_view_is_virtual(widget_t* widget);
+
+/**
+ * @method list_view_layout_virtual_items
+ * 计算虚拟列表的高度，并布局可见的列表项(供children_layouter_list_view使用)。
+ * @annotation ["private"]
+ * @param {widget_t*} widget 控件对象。
+ * @param {int32_t} x_margin 左右边距。
+ * @param {int32_t} y_margin 上下边距。
+ * @param {int32_t} spacing 列表项的间距。
+ *
+ * @return {int32_t} 返回虚拟高度。
+ */
+int32_t list_view_layout_virtual_items(widget_t* widget, int32_t x_margin, int32_t y_margin,
+                                       int32_t spacing);
+
 /**
  * @method list_view_cast
  * 转换为list_view对象(供脚本语言使用)。
@@ -218,6 +377,8 @@ ret_t list_view_reinit(widget_t* widget);
 #define LIST_VIEW(widget) ((list_view_t*)(list_view_cast(WIDGET(widget))))
 
 #define LIST_VIEW_PROP_FLOATING_SCROLL_BAR "floating_scroll_bar"
+#define LIST_VIEW_PROP_VIRTUAL_ITEMS "virtual_items"
+#define LIST_VIEW_PROP_VIRTUAL_OVERSCAN "virtual_overscan"
 
 /*public for subclass and runtime type check*/
 TK_EXTERN_VTABLE(list_view);
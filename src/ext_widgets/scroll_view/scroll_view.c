@@ -385,6 +385,8 @@ static ret_t scroll_view_notify_scrolled(scroll_view_t* scroll_view) {
     scroll_view->on_scroll(widget, scroll_view->xoffset, scroll_view->yoffset);
   }
   widget_dispatch_simple_event(widget, EVT_SCROLL);
+  /*滚出可见范围的图片不再解码*/
+  widget_cancel_load_image_async_invisible(widget);
 
   return RET_OK;
 }
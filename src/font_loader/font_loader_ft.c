@@ -9,6 +9,7 @@
 #include "tkc/utils.h"
 #include "base/types_def.h"
 #include "base/glyph_cache.h"
+#include "base/glyph_atlas.h"
 #include "font_loader/font_loader_ft.h"
 
 #ifdef WITH_FT_FONT
@@ -35,6 +36,7 @@ typedef struct _font_ft_t {
   font_t base;
   ft_fontinfo ft_font;
   glyph_cache_t cache;
+  glyph_atlas_t* atlas;
   bool_t mono;
 } font_ft_t;
 
@@ -59,6 +61,36 @@ static ret_t glyph_ft_destory(glyph_ft_t* g) {
   return RET_OK;
 }
 
+static ret_t font_ft_add_glyph_to_atlas(font_ft_t* font, wchar_t c, font_size_t font_size,
+                                        FT_GlyphSlot glyf, glyph_t* g) {
+  uint32_t y = 0;
+  glyph_ft_t* g_ft = NULL;
+  const uint8_t* src = glyf->bitmap.buffer;
+
+  if (glyf->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY || g->w == 0 || g->h == 0) {
+    return RET_NOT_IMPL;
+  }
+
+  if (glyph_atlas_alloc(font->atlas, g) != RET_OK) {
+    return RET_FAIL;
+  }
+
+  for (y = 0; y < g->h; y++) {
+    memcpy((uint8_t*)(g->data) + y * g->pitch, src, g->w);
+    src += glyf->bitmap.pitch;
+  }
+
+  g_ft = glyph_ft_create();
+  if (g_ft != NULL) {
+    g_ft->glyph = *g;
+    if (glyph_cache_add(&(font->cache), c, font_size, (glyph_t*)(g_ft)) != RET_OK) {
+      TKMEM_FREE(g_ft);
+    }
+  }
+
+  return RET_OK;
+}
+
 static bool_t font_ft_match(font_t* f, const char* name, font_size_t font_size) {
   (void)font_size;
   return (name == NULL || strcmp(name, f->name) == 0);
@@ -83,17 +115,24 @@ static ret_t font_ft_get_glyph(font_t* f, wchar_t c, font_size_t font_size, glyp
   FT_Set_Char_Size(sf->face, 0, font_size * 72, 0, 50);
   if (!FT_Load_Char(sf->face, c, flags)) {
     glyf = sf->face->glyph;
-    FT_Get_Glyph(glyf, &glyph);
 
     g->format = GLYPH_FMT_ALPHA;
     g->h = glyf->bitmap.rows;
     g->w = glyf->bitmap.width;
-    g->pitch = glyf->bitmap.pitch;
+    g->pitch = glyf->bitmap.pitch <= 0xff ? glyf->bitmap.pitch : 0;
     g->x = glyf->bitmap_left;
     g->y = -glyf->bitmap_top;
     g->data = glyf->bitmap.buffer;
     g->advance = glyf->metrics.horiAdvance / 64;
 
+    if (g->data != NULL && font->atlas != NULL) {
+      if (font_ft_add_glyph_to_atlas(font, c, font_size, glyf, g) == RET_OK) {
+        return RET_OK;
+      }
+    }
+
+    FT_Get_Glyph(glyf, &glyph);
+
     if (g->data != NULL) {
       glyph_ft_t* g_ft = glyph_ft_create();
       if (g_ft != NULL) {
@@ -151,8 +190,18 @@ static ret_t font_ft_shrink_cache(font_t* f, uint32_t cache_nr) {
   return glyph_cache_shrink(&(font->cache), cache_nr);
 }
 
+static ret_t font_ft_get_cache_stats(font_t* f, font_cache_stats_t* stats) {
+  font_ft_t* font = (font_ft_t*)f;
+
+  return glyph_cache_get_stats(&(font->cache), stats);
+}
+
 static ret_t font_ft_destroy(font_t* f) {
   font_ft_t* font = (font_ft_t*)f;
+
+  if (font->atlas != NULL) {
+    glyph_atlas_off_evict(font->atlas, &(font->cache));
+  }
   glyph_cache_deinit(&(font->cache));
 
   FT_Done_FreeType(font->ft_font.library);
@@ -195,11 +244,17 @@ static font_t* font_ft_create_ex(const char* name, const uint8_t* buff, uint32_t
   f->base.get_glyph = font_ft_get_glyph;
   f->base.get_vmetrics = font_ft_get_vmetrics;
   f->base.shrink_cache = font_ft_shrink_cache;
+  f->base.get_cache_stats = font_ft_get_cache_stats;
   f->base.desc = mono ? "mono(freetype)" : "truetype(freetype)";
 
   tk_strncpy(f->base.name, name, TK_NAME_LEN);
 
   glyph_cache_init(&(f->cache), TK_GLYPH_CACHE_NR, destroy_glyph);
+  f->atlas = glyph_atlas();
+  if (f->atlas != NULL) {
+    glyph_atlas_on_evict(f->atlas, (glyph_atlas_on_evict_t)glyph_cache_remove_by_range,
+                         &(f->cache));
+  }
 
   return &(f->base);
 }
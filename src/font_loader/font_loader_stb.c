@@ -34,12 +34,14 @@
 #define STBTT_malloc(s, u) TKMEM_ALLOC(s)
 
 #include "base/glyph_cache.h"
+#include "base/glyph_atlas.h"
 #include "stb/stb_truetype.h"
 
 typedef struct _font_stb_t {
   font_t base;
   stbtt_fontinfo stb_font;
   glyph_cache_t cache;
+  glyph_atlas_t* atlas;
   int ascent;
   int descent;
   int line_gap;
@@ -110,6 +112,45 @@ static font_vmetrics_t font_stb_get_vmetrics(font_t* f, font_size_t font_size) {
   return vmetrics;
 }
 
+static ret_t font_stb_get_glyph_with_atlas(font_stb_t* font, wchar_t c, font_size_t font_size,
+                                           float scale, glyph_t* g) {
+  int x0 = 0;
+  int y0 = 0;
+  int x1 = 0;
+  int y1 = 0;
+  int lsb = 0;
+  int advance = 0;
+  glyph_t* gg = NULL;
+  stbtt_fontinfo* sf = &(font->stb_font);
+
+  stbtt_GetCodepointBitmapBox(sf, c, scale, scale, &x0, &y0, &x1, &y1);
+  if (x1 <= x0 || y1 <= y0) {
+    return RET_NOT_FOUND;
+  }
+
+  stbtt_GetCodepointHMetrics(sf, c, &advance, &lsb);
+  g->x = x0;
+  g->y = y0;
+  g->w = x1 - x0;
+  g->h = y1 - y0;
+  g->format = GLYPH_FMT_ALPHA;
+  g->advance = tk_roundi(advance * scale);
+  g->data = NULL;
+
+  /*直接光栅化到图集中，不需要临时的缓冲区*/
+  if (glyph_atlas_alloc(font->atlas, g) != RET_OK) {
+    return RET_FAIL;
+  }
+  stbtt_MakeCodepointBitmap(sf, (unsigned char*)(g->data), g->w, g->h, g->pitch, scale, scale, c);
+
+  gg = glyph_clone(g);
+  if (gg != NULL && glyph_cache_add(&(font->cache), c, font_size, gg) != RET_OK) {
+    TKMEM_FREE(gg);
+  }
+
+  return RET_OK;
+}
+
 static ret_t font_stb_get_glyph(font_t* f, wchar_t c, font_size_t font_size, glyph_t* g) {
   int x = 0;
   int y = 0;
@@ -132,6 +173,12 @@ static ret_t font_stb_get_glyph(font_t* f, wchar_t c, font_size_t font_size, gly
     return RET_OK;
   }
 
+  if (font->atlas != NULL && !font->mono) {
+    if (font_stb_get_glyph_with_atlas(font, c, font_size, scale, g) == RET_OK) {
+      return RET_OK;
+    }
+  }
+
   bitmap = stbtt_GetCodepointBitmap(sf, 0, scale, c, &w, &h, &x, &y);
   stbtt_GetCodepointHMetrics(sf, c, &advance, &lsb);
 
@@ -141,6 +188,7 @@ static ret_t font_stb_get_glyph(font_t* f, wchar_t c, font_size_t font_size, gly
   g->h = h;
   g->format = GLYPH_FMT_ALPHA;
   g->advance = tk_roundi(advance * scale);
+  g->pitch = 0;
   g->data = NULL;
 
   if (bitmap != NULL) {
@@ -182,8 +230,18 @@ static ret_t font_stb_shrink_cache(font_t* f, uint32_t cache_nr) {
   return glyph_cache_shrink(&(font->cache), cache_nr);
 }
 
+static ret_t font_stb_get_cache_stats(font_t* f, font_cache_stats_t* stats) {
+  font_stb_t* font = (font_stb_t*)f;
+
+  return glyph_cache_get_stats(&(font->cache), stats);
+}
+
 static ret_t font_stb_destroy(font_t* f) {
   font_stb_t* font = (font_stb_t*)f;
+
+  if (font->atlas != NULL) {
+    glyph_atlas_off_evict(font->atlas, &(font->cache));
+  }
   glyph_cache_deinit(&(font->cache));
 
   TKMEM_FREE(f);
@@ -193,7 +251,10 @@ static ret_t font_stb_destroy(font_t* f) {
 
 static ret_t destroy_glyph(void* data) {
   glyph_t* g = (glyph_t*)data;
-  if (g->data != NULL) {
+  glyph_atlas_t* atlas = glyph_atlas();
+
+  /*图集中的数据随页面一起回收*/
+  if (g->data != NULL && (atlas == NULL || !glyph_atlas_has(atlas, g->data))) {
     STBTT_free(g->data, NULL);
   }
   glyph_destroy(g);
@@ -215,11 +276,18 @@ static font_t* font_stb_create_ex(const char* name, const uint8_t* buff, uint32_
   f->base.get_glyph = font_stb_get_glyph;
   f->base.get_vmetrics = font_stb_get_vmetrics;
   f->base.shrink_cache = font_stb_shrink_cache;
+  f->base.get_cache_stats = font_stb_get_cache_stats;
   f->base.desc = mono ? "mono(stb)" : "truetype(stb)";
 
   tk_strncpy(f->base.name, name, TK_NAME_LEN);
 
   glyph_cache_init(&(f->cache), TK_GLYPH_CACHE_NR, destroy_glyph);
+  f->atlas = glyph_atlas();
+  if (f->atlas != NULL) {
+    glyph_atlas_on_evict(f->atlas, (glyph_atlas_on_evict_t)glyph_cache_remove_by_range,
+                         &(f->cache));
+  }
+
   stbtt_InitFont(&(f->stb_font), buff, stbtt_GetFontOffsetForIndex(buff, 0));
   stbtt_GetFontVMetrics(&(f->stb_font), &(f->ascent), &(f->descent), &(f->line_gap));
 
@@ -20,6 +20,7 @@
  */
 
 #include "tkc/time_now.h"
+#include "tkc/platform.h"
 #include "main_loop_console.h"
 
 #include "tkc/event_source_idle.h"
@@ -101,7 +102,10 @@ static ret_t main_loop_console_step(main_loop_t* l) {
   time_out = time_now_ms();
   cost_time = (uint32_t)(time_out - time_in);
 
-  curr_expected_sleep_time = (duration > cost_time) ? (duration - cost_time) : 0;
+  /*tickless模式下不按固定帧率唤醒，由定时器和事件决定睡眠时间*/
+  if (!l->tickless) {
+    curr_expected_sleep_time = (duration > cost_time) ? (duration - cost_time) : 0;
+  }
   main_loop_set_curr_expected_sleep_time(l, curr_expected_sleep_time);
 
   return RET_OK;
@@ -121,6 +125,44 @@ static ret_t main_loop_console_run(main_loop_t* l) {
   return RET_OK;
 }
 
+static ret_t main_loop_console_wakeup(main_loop_t* l) {
+  main_loop_console_t* loop = (main_loop_console_t*)l;
+
+  if (loop->wakeup_sem != NULL) {
+    tk_semaphore_post(loop->wakeup_sem);
+  }
+
+  return RET_OK;
+}
+
+static ret_t main_loop_console_set_tickless(main_loop_t* l, bool_t tickless) {
+  main_loop_console_t* loop = (main_loop_console_t*)l;
+
+  /*关闭时不销毁，其它线程可能正在使用，reset时统一销毁*/
+  if (tickless && loop->wakeup_sem == NULL) {
+    loop->wakeup_sem = tk_semaphore_create(0, "main_loop");
+    return_value_if_fail(loop->wakeup_sem != NULL, RET_OOM);
+  }
+
+  return RET_OK;
+}
+
+static ret_t main_loop_console_wait(main_loop_t* l, uint32_t timeout) {
+  main_loop_console_t* loop = (main_loop_console_t*)l;
+
+  if (loop->dispatch_input != NULL) {
+    timeout = tk_min(timeout, TK_MAX_SLEEP_TIME);
+  }
+
+  if (loop->wakeup_sem != NULL) {
+    return tk_semaphore_wait(loop->wakeup_sem, timeout);
+  }
+
+  sleep_ms(timeout);
+
+  return RET_OK;
+}
+
 static event_source_manager_t* main_loop_console_get_event_source_manager(main_loop_t* l) {
   main_loop_console_t* loop = (main_loop_console_t*)l;
 
@@ -137,6 +179,10 @@ ret_t main_loop_console_reset(main_loop_console_t* loop) {
     tk_mutex_destroy(loop->mutex);
   }
 
+  if (loop->wakeup_sem != NULL) {
+    tk_semaphore_destroy(loop->wakeup_sem);
+  }
+
   memset(loop, 0x00, sizeof(main_loop_console_t));
 
   return RET_OK;
@@ -163,6 +209,12 @@ main_loop_console_t* main_loop_console_init(void) {
   loop->base.queue_event = main_loop_console_queue_event_mutex;
 
   loop->base.get_event_source_manager = main_loop_console_get_event_source_manager;
+  loop->base.wait = main_loop_console_wait;
+  loop->base.wakeup = main_loop_console_wakeup;
+  loop->base.set_tickless = main_loop_console_set_tickless;
+#ifdef WITH_MAIN_LOOP_TICKLESS
+  main_loop_set_tickless((main_loop_t*)loop, TRUE);
+#endif /*WITH_MAIN_LOOP_TICKLESS*/
 
   main_loop_set((main_loop_t*)loop);
 
@@ -25,6 +25,7 @@
 #include "base/idle.h"
 #include "base/timer.h"
 #include "tkc/mutex.h"
+#include "tkc/semaphore.h"
 #include "base/main_loop.h"
 #include "base/event_queue.h"
 
@@ -43,6 +44,8 @@ struct _main_loop_console_t {
 
   event_source_manager_t* event_source_manager;
   main_loop_dispatch_input_t dispatch_input;
+  /*tickless模式下用于等待和唤醒*/
+  tk_semaphore_t* wakeup_sem;
 };
 
 main_loop_console_t* main_loop_console_init(void);
@@ -628,6 +628,26 @@ ret_t main_loop_sdl2_dispatch(main_loop_simple_t* loop) {
   return ret;
 }
 
+static ret_t main_loop_sdl2_wait_input(main_loop_simple_t* loop, uint32_t timeout) {
+  SDL_WaitEventTimeout(NULL, timeout);
+
+  return RET_OK;
+}
+
+static ret_t main_loop_sdl2_wakeup(main_loop_t* l) {
+  SDL_Event event;
+
+  memset(&event, 0x00, sizeof(event));
+#ifdef AWTK_SDL3
+  event.type = SDL_EVENT_USER;
+#else
+  event.type = SDL_USEREVENT;
+#endif /*AWTK_SDL3*/
+  SDL_PushEvent(&event);
+
+  return RET_OK;
+}
+
 static ret_t main_loop_sdl2_destroy(main_loop_t* l) {
   main_loop_simple_t* loop = (main_loop_simple_t*)l;
 
@@ -647,6 +667,13 @@ main_loop_t* main_loop_init(int w, int h) {
   loop = main_loop_simple_init(w, h, NULL, NULL);
   loop->base.destroy = main_loop_sdl2_destroy;
   loop->dispatch_input = main_loop_sdl2_dispatch;
+  loop->wait_input = main_loop_sdl2_wait_input;
+  loop->base.wakeup = main_loop_sdl2_wakeup;
+  /*SDL自己等待和唤醒，不需要wakeup_sem(WITH_MAIN_LOOP_TICKLESS时基类已经创建)*/
+  if (loop->wakeup_sem != NULL) {
+    tk_semaphore_destroy(loop->wakeup_sem);
+    loop->wakeup_sem = NULL;
+  }
 #ifdef AWTK_SDL3
   SDL_SetEventEnabled(SDL_EVENT_DROP_FILE, true);
 #else
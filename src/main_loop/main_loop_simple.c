@@ -20,12 +20,15 @@
  */
 
 #include "tkc/time_now.h"
+#include "tkc/platform.h"
+#include "base/native_window.h"
 #include "main_loop/main_loop_simple.h"
 
 #include "tkc/event_source_idle.h"
 #include "tkc/event_source_timer.h"
 #include "tkc/event_source_manager_default.h"
 
+#ifndef WITH_MAIN_LOOP_LF_QUEUE
 static ret_t main_loop_simple_queue_event_mutex(main_loop_t* l, const event_queue_req_t* r) {
   ret_t ret = RET_FAIL;
   main_loop_simple_t* loop = (main_loop_simple_t*)l;
@@ -47,6 +50,111 @@ static ret_t main_loop_simple_recv_event_mutex(main_loop_t* l, event_queue_req_t
 
   return ret;
 }
+#else
+static ret_t main_loop_simple_drop_event(event_queue_req_t* r) {
+  /*释放请求携带的资源*/
+  if (r->event.type == REQ_ADD_IDLE && r->add_idle.on_destroy != NULL) {
+    r->add_idle.on_destroy(r->add_idle.on_destroy_ctx);
+  } else if (r->event.type == REQ_ADD_TIMER && r->add_timer.on_destroy != NULL) {
+    r->add_timer.on_destroy(r->add_timer.on_destroy_ctx);
+  }
+  log_debug("main loop queue is full, drop event %d\n", r->event.type);
+
+  return RET_OK;
+}
+
+static bool_t main_loop_simple_is_move_event(const event_queue_req_t* r) {
+  return r->event.type == EVT_POINTER_MOVE || r->event.type == EVT_TOUCH_MOVE;
+}
+
+static ret_t main_loop_simple_queue_event_lf(main_loop_t* l, const event_queue_req_t* r) {
+  uint64_t start = 0;
+  main_loop_simple_t* loop = (main_loop_simple_t*)l;
+
+  if (tk_lf_queue_push(loop->lf_queue, r) == RET_OK) {
+    return RET_OK;
+  }
+
+  if (loop->queue_overflow == MAIN_LOOP_QUEUE_OVERFLOW_DROP_OLDEST) {
+    event_queue_req_t old;
+    while (tk_lf_queue_push(loop->lf_queue, r) != RET_OK) {
+      if (tk_lf_queue_pop(loop->lf_queue, &old) == RET_OK) {
+        main_loop_simple_drop_event(&old);
+      }
+    }
+    return RET_OK;
+  } else if (loop->queue_overflow == MAIN_LOOP_QUEUE_OVERFLOW_COALESCE_MOVE &&
+             main_loop_simple_is_move_event(r)) {
+    return RET_OK;
+  } else if (loop->queue_overflow != MAIN_LOOP_QUEUE_OVERFLOW_BLOCK) {
+    log_warn("main loop queue is full\n");
+    return RET_FAIL;
+  }
+
+  /*UI线程等待自己取走事件会死锁*/
+  if (tk_is_ui_thread()) {
+    log_warn("main loop queue is full\n");
+    return RET_FAIL;
+  }
+
+  start = time_now_ms();
+  do {
+    if (l->tickless) {
+      main_loop_wakeup(l);
+    }
+    sleep_ms(1);
+    if (tk_lf_queue_push(loop->lf_queue, r) == RET_OK) {
+      return RET_OK;
+    }
+  } while (time_now_ms() - start < MAIN_LOOP_QUEUE_BLOCK_TIMEOUT);
+  log_warn("main loop queue is full, timeout\n");
+
+  return RET_FAIL;
+}
+
+static ret_t main_loop_simple_recv_event_lf(main_loop_t* l, event_queue_req_t* r) {
+  main_loop_simple_t* loop = (main_loop_simple_t*)l;
+
+  if (loop->batch_r >= loop->batch_nr) {
+    loop->batch_r = 0;
+    loop->batch_nr = tk_lf_queue_pop_batch(loop->lf_queue, loop->batch, ARRAY_SIZE(loop->batch));
+    if (loop->batch_nr == 0) {
+      return RET_FAIL;
+    }
+  }
+
+  memcpy(r, loop->batch + loop->batch_r++, sizeof(*r));
+
+  return RET_OK;
+}
+#endif /*WITH_MAIN_LOOP_LF_QUEUE*/
+
+ret_t main_loop_simple_set_queue_overflow(main_loop_simple_t* loop,
+                                          main_loop_queue_overflow_t overflow) {
+  return_value_if_fail(loop != NULL, RET_BAD_PARAMS);
+
+  loop->queue_overflow = overflow;
+
+  return RET_OK;
+}
+
+ret_t main_loop_simple_set_coalesce_events(main_loop_simple_t* loop, bool_t coalesce_events) {
+  return_value_if_fail(loop != NULL, RET_BAD_PARAMS);
+
+  loop->coalesce_events = coalesce_events;
+
+  return RET_OK;
+}
+
+float_t main_loop_simple_get_coalesce_ratio(main_loop_simple_t* loop) {
+  return_value_if_fail(loop != NULL, 0);
+
+  if (loop->coalesce_total == 0) {
+    return 0;
+  }
+
+  return (float_t)(loop->coalesce_merged) / (float_t)(loop->coalesce_total);
+}
 
 ret_t main_loop_post_multi_gesture_event(main_loop_t* l, multi_gesture_event_t* event) {
   event_queue_req_t r;
@@ -171,72 +279,117 @@ ret_t main_loop_post_key_event(main_loop_t* l, bool_t pressed, uint8_t key) {
   return RET_OK;
 }
 
+static ret_t main_loop_dispatch_event(main_loop_simple_t* loop, event_queue_req_t* r) {
+  widget_t* widget = loop->base.wm;
+  switch (r->event.type) {
+    case EVT_TOUCH_DOWN:
+    case EVT_TOUCH_MOVE:
+    case EVT_TOUCH_UP: {
+      widget_t* win = window_manager_get_top_window(widget);
+      event_t* e = (event_t*)(&r->touch_event);
+      widget_dispatch(win, e);
+      break;
+    }
+    case EVT_CONTEXT_MENU:
+    case EVT_POINTER_DOWN:
+    case EVT_POINTER_MOVE:
+    case EVT_POINTER_UP:
+      if (r->pointer_event.button == 0) {
+        r->pointer_event.button = 1;
+      }
+      window_manager_dispatch_input_event(widget, (event_t*)&(r->pointer_event));
+      break;
+    case EVT_WHEEL:
+      window_manager_dispatch_input_event(widget, (event_t*)&(r->wheel_event));
+      break;
+    case EVT_KEY_LONG_PRESS:
+      widget_on_keydown(widget, &(r->key_event));
+      break;
+    case EVT_KEY_DOWN:
+    case EVT_KEY_UP:
+      window_manager_dispatch_input_event(widget, (event_t*)&(r->key_event));
+      break;
+    case REQ_EXEC_IN_UI: {
+      r->exec_in_ui.info.func(&(r->exec_in_ui.info));
+      break;
+    }
+    case REQ_ADD_IDLE: {
+      uint32_t id = idle_add(r->add_idle.func, r->add_idle.e.target);
+      if (id != TK_INVALID_ID && r->add_idle.on_destroy != NULL) {
+        idle_set_on_destroy(id, r->add_idle.on_destroy, r->add_idle.on_destroy_ctx);
+      }
+    } break;
+    case REQ_ADD_TIMER: {
+      uint32_t id = timer_add(r->add_timer.func, r->add_timer.e.target, r->add_timer.duration);
+      if (id != TK_INVALID_ID && r->add_timer.on_destroy != NULL) {
+        timer_set_on_destroy(id, r->add_timer.on_destroy, r->add_timer.on_destroy_ctx);
+      }
+    } break;
+    case EVT_MULTI_GESTURE:
+      window_manager_dispatch_input_event(widget, (event_t*)&(r->multi_gesture_event));
+      break;
+    default: {
+      if (r->event.target != NULL) {
+        widget = WIDGET(r->event.target);
+      }
+      widget_dispatch(widget, &(r->event));
+      break;
+    }
+  }
+
+  return RET_OK;
+}
+
+static bool_t main_loop_simple_is_coalescable(const event_queue_req_t* r) {
+  switch (r->event.type) {
+    case EVT_POINTER_MOVE:
+    case EVT_TOUCH_MOVE:
+    case EVT_WHEEL:
+    case EVT_RESIZE:
+    case EVT_NATIVE_WINDOW_RESIZED:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
 static ret_t main_loop_dispatch_events(main_loop_simple_t* loop) {
   event_queue_req_t r;
+  event_queue_req_t pending;
+  bool_t has_pending = FALSE;
   int time_in = time_now_ms();
   int time_out = time_in;
 
+  /*同一帧内连续的move/wheel/resize事件(目标相同)合并成一个再分发*/
   while ((time_out - time_in < 20) && (main_loop_recv_event((main_loop_t*)loop, &r) == RET_OK)) {
-    widget_t* widget = loop->base.wm;
-    switch (r.event.type) {
-      case EVT_TOUCH_DOWN:
-      case EVT_TOUCH_MOVE:
-      case EVT_TOUCH_UP: {
-        widget_t* win = window_manager_get_top_window(widget);
-        event_t* e = (event_t*)(&r.touch_event);
-        widget_dispatch(win, e);
-        break;
-      }
-      case EVT_CONTEXT_MENU:
-      case EVT_POINTER_DOWN:
-      case EVT_POINTER_MOVE:
-      case EVT_POINTER_UP:
-        if (r.pointer_event.button == 0) {
-          r.pointer_event.button = 1;
+    if (loop->coalesce_events && main_loop_simple_is_coalescable(&r)) {
+      loop->coalesce_total++;
+      if (has_pending) {
+        if (event_queue_req_coalesce(&pending, &r) == RET_OK) {
+          loop->coalesce_merged++;
+        } else {
+          main_loop_dispatch_event(loop, &pending);
+          pending = r;
         }
-        window_manager_dispatch_input_event(widget, (event_t*)&(r.pointer_event));
-        break;
-      case EVT_WHEEL:
-        window_manager_dispatch_input_event(widget, (event_t*)&(r.wheel_event));
-        break;
-      case EVT_KEY_LONG_PRESS:
-        widget_on_keydown(widget, &(r.key_event));
-        break;
-      case EVT_KEY_DOWN:
-      case EVT_KEY_UP:
-        window_manager_dispatch_input_event(widget, (event_t*)&(r.key_event));
-        break;
-      case REQ_EXEC_IN_UI: {
-        r.exec_in_ui.info.func(&(r.exec_in_ui.info));
-        break;
+      } else {
+        pending = r;
+        has_pending = TRUE;
       }
-      case REQ_ADD_IDLE: {
-        uint32_t id = idle_add(r.add_idle.func, r.add_idle.e.target);
-        if (id != TK_INVALID_ID && r.add_idle.on_destroy != NULL) {
-          idle_set_on_destroy(id, r.add_idle.on_destroy, r.add_idle.on_destroy_ctx);
-        }
-      } break;
-      case REQ_ADD_TIMER: {
-        uint32_t id = timer_add(r.add_timer.func, r.add_timer.e.target, r.add_timer.duration);
-        if (id != TK_INVALID_ID && r.add_timer.on_destroy != NULL) {
-          timer_set_on_destroy(id, r.add_timer.on_destroy, r.add_timer.on_destroy_ctx);
-        }
-      } break;
-      case EVT_MULTI_GESTURE:
-        window_manager_dispatch_input_event(widget, (event_t*)&(r.multi_gesture_event));
-        break;
-      default: {
-        if (r.event.target != NULL) {
-          widget = WIDGET(r.event.target);
-        }
-        widget_dispatch(widget, &(r.event));
-        break;
+    } else {
+      if (has_pending) {
+        has_pending = FALSE;
+        main_loop_dispatch_event(loop, &pending);
       }
+      main_loop_dispatch_event(loop, &r);
     }
     time_out = time_now_ms();
     /*HANDLE OTHER EVENT*/
   }
 
+  if (has_pending) {
+    main_loop_dispatch_event(loop, &pending);
+  }
+
   return RET_OK;
 }
 
@@ -282,6 +435,49 @@ static ret_t main_loop_simple_run(main_loop_t* l) {
   return RET_OK;
 }
 
+static ret_t main_loop_simple_wakeup(main_loop_t* l) {
+  main_loop_simple_t* loop = (main_loop_simple_t*)l;
+
+  if (loop->wakeup_sem != NULL) {
+    tk_semaphore_post(loop->wakeup_sem);
+  }
+
+  return RET_OK;
+}
+
+static ret_t main_loop_simple_wait(main_loop_t* l, uint32_t timeout) {
+  main_loop_simple_t* loop = (main_loop_simple_t*)l;
+
+  if (loop->wait_input != NULL) {
+    return loop->wait_input(loop, timeout);
+  }
+
+  /*只能轮询的输入设备，按原来的频率检查*/
+  if (loop->dispatch_input != NULL) {
+    timeout = tk_min(timeout, TK_MAX_SLEEP_TIME);
+  }
+
+  if (loop->wakeup_sem != NULL) {
+    return tk_semaphore_wait(loop->wakeup_sem, timeout);
+  }
+
+  sleep_ms(timeout);
+
+  return RET_OK;
+}
+
+static ret_t main_loop_simple_set_tickless(main_loop_t* l, bool_t tickless) {
+  main_loop_simple_t* loop = (main_loop_simple_t*)l;
+
+  /*关闭时不销毁，其它线程可能正在使用，reset时统一销毁*/
+  if (tickless && loop->wait_input == NULL && loop->wakeup_sem == NULL) {
+    loop->wakeup_sem = tk_semaphore_create(0, "main_loop");
+    return_value_if_fail(loop->wakeup_sem != NULL, RET_OOM);
+  }
+
+  return RET_OK;
+}
+
 static event_source_manager_t* main_loop_simple_get_event_source_manager(main_loop_t* l) {
   main_loop_simple_t* loop = (main_loop_simple_t*)l;
 
@@ -292,12 +488,22 @@ ret_t main_loop_simple_reset(main_loop_simple_t* loop) {
   return_value_if_fail(loop != NULL, RET_BAD_PARAMS);
 
   event_source_manager_destroy(loop->event_source_manager);
-  event_queue_destroy(loop->queue);
+  if (loop->queue != NULL) {
+    event_queue_destroy(loop->queue);
+  }
+
+  if (loop->lf_queue != NULL) {
+    tk_lf_queue_destroy(loop->lf_queue);
+  }
 
   if (loop->mutex != NULL) {
     tk_mutex_destroy(loop->mutex);
   }
 
+  if (loop->wakeup_sem != NULL) {
+    tk_semaphore_destroy(loop->wakeup_sem);
+  }
+
   memset(loop, 0x00, sizeof(main_loop_simple_t));
 
   return RET_OK;
@@ -317,24 +523,41 @@ main_loop_simple_t* main_loop_simple_init(int w, int h, main_loop_queue_event_t
   loop->base.wm = window_manager();
   return_value_if_fail(loop->base.wm != NULL, NULL);
 
-  loop->queue = event_queue_create(MAIN_LOOP_QUEUE_SIZE);
-  return_value_if_fail(loop->queue != NULL, NULL);
-
   loop->base.run = main_loop_simple_run;
   loop->base.step = main_loop_simple_step;
   loop->base.destroy = (main_loop_destroy_t)main_loop_simple_reset;
+#ifndef WITHOUT_MAIN_LOOP_COALESCE_EVENTS
+  loop->coalesce_events = TRUE;
+#endif /*WITHOUT_MAIN_LOOP_COALESCE_EVENTS*/
 
   if (recv_event != NULL && queue_event != NULL) {
+    loop->queue = event_queue_create(MAIN_LOOP_QUEUE_SIZE);
+    return_value_if_fail(loop->queue != NULL, NULL);
     loop->base.recv_event = recv_event;
     loop->base.queue_event = queue_event;
   } else {
+#ifdef WITH_MAIN_LOOP_LF_QUEUE
+    loop->lf_queue = tk_lf_queue_create(sizeof(event_queue_req_t), MAIN_LOOP_QUEUE_SIZE);
+    return_value_if_fail(loop->lf_queue != NULL, NULL);
+    loop->base.recv_event = main_loop_simple_recv_event_lf;
+    loop->base.queue_event = main_loop_simple_queue_event_lf;
+#else
+    loop->queue = event_queue_create(MAIN_LOOP_QUEUE_SIZE);
+    return_value_if_fail(loop->queue != NULL, NULL);
     loop->mutex = tk_mutex_create();
     return_value_if_fail(loop->mutex != NULL, NULL);
     loop->base.recv_event = main_loop_simple_recv_event_mutex;
     loop->base.queue_event = main_loop_simple_queue_event_mutex;
+#endif /*WITH_MAIN_LOOP_LF_QUEUE*/
   }
 
   loop->base.get_event_source_manager = main_loop_simple_get_event_source_manager;
+  loop->base.wait = main_loop_simple_wait;
+  loop->base.wakeup = main_loop_simple_wakeup;
+  loop->base.set_tickless = main_loop_simple_set_tickless;
+#ifdef WITH_MAIN_LOOP_TICKLESS
+  main_loop_set_tickless((main_loop_t*)loop, TRUE);
+#endif /*WITH_MAIN_LOOP_TICKLESS*/
 
   window_manager_post_init(loop->base.wm, w, h);
   main_loop_set((main_loop_t*)loop);
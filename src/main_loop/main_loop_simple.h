@@ -25,6 +25,8 @@
 #include "base/idle.h"
 #include "base/timer.h"
 #include "tkc/mutex.h"
+#include "tkc/lf_queue.h"
+#include "tkc/semaphore.h"
 #include "base/main_loop.h"
 #include "base/event_queue.h"
 #include "base/font_manager.h"
@@ -32,6 +34,52 @@
 
 BEGIN_C_DECLS
 
+#ifndef MAIN_LOOP_QUEUE_SIZE
+#define MAIN_LOOP_QUEUE_SIZE 20
+#endif /*MAIN_LOOP_QUEUE_SIZE*/
+
+#if defined(TK_IS_PC) && !defined(WITH_MAIN_LOOP_LF_QUEUE) && !defined(WITHOUT_MAIN_LOOP_LF_QUEUE)
+#define WITH_MAIN_LOOP_LF_QUEUE 1
+#endif /*TK_IS_PC*/
+
+#ifndef MAIN_LOOP_QUEUE_BATCH_SIZE
+#define MAIN_LOOP_QUEUE_BATCH_SIZE 8
+#endif /*MAIN_LOOP_QUEUE_BATCH_SIZE*/
+
+#ifndef MAIN_LOOP_QUEUE_BLOCK_TIMEOUT
+#define MAIN_LOOP_QUEUE_BLOCK_TIMEOUT 1000
+#endif /*MAIN_LOOP_QUEUE_BLOCK_TIMEOUT*/
+
+/**
+ * @enum main_loop_queue_overflow_t
+ * @prefix MAIN_LOOP_QUEUE_OVERFLOW_
+ * 事件队列满时的处理策略(仅对无锁事件队列有效)。
+ */
+typedef enum _main_loop_queue_overflow_t {
+  /**
+   * @const MAIN_LOOP_QUEUE_OVERFLOW_FAIL
+   * 丢弃新的事件，立即返回失败(缺省，与互斥锁保护的事件队列一致)。
+   */
+  MAIN_LOOP_QUEUE_OVERFLOW_FAIL = 0,
+  /**
+   * @const MAIN_LOOP_QUEUE_OVERFLOW_BLOCK
+   * 等待UI线程取走事件(最长MAIN_LOOP_QUEUE_BLOCK_TIMEOUT毫秒)。UI线程自己投递事件时不等待，直接失败。
+   *
+   * > 投递事件的线程会被阻塞，需要显式启用。
+   */
+  MAIN_LOOP_QUEUE_OVERFLOW_BLOCK,
+  /**
+   * @const MAIN_LOOP_QUEUE_OVERFLOW_DROP_OLDEST
+   * 丢弃最早的事件。被丢弃的REQ_EXEC_IN_UI请求不会被执行。
+   */
+  MAIN_LOOP_QUEUE_OVERFLOW_DROP_OLDEST,
+  /**
+   * @const MAIN_LOOP_QUEUE_OVERFLOW_COALESCE_MOVE
+   * 丢弃新的pointer/touch move事件(最新的坐标由后续事件带过去)，其它事件按FAIL处理。
+   */
+  MAIN_LOOP_QUEUE_OVERFLOW_COALESCE_MOVE
+} main_loop_queue_overflow_t;
+
 /**
  * @class main_loop_simple_t
  * @parent main_loop_t
@@ -41,6 +89,7 @@ struct _main_loop_simple_t;
 typedef struct _main_loop_simple_t main_loop_simple_t;
 
 typedef ret_t (*main_loop_dispatch_input_t)(main_loop_simple_t* loop);
+typedef ret_t (*main_loop_wait_input_t)(main_loop_simple_t* loop, uint32_t timeout);
 
 struct _main_loop_simple_t {
   main_loop_t base;
@@ -60,6 +109,23 @@ struct _main_loop_simple_t {
   void* user4;
   event_source_manager_t* event_source_manager;
   main_loop_dispatch_input_t dispatch_input;
+  /*等待输入设备的事件(tickless模式使用)，没有提供时等待wakeup_sem*/
+  main_loop_wait_input_t wait_input;
+  tk_semaphore_t* wakeup_sem;
+
+  /*无锁事件队列(没有提供queue_event/recv_event时使用)*/
+  tk_lf_queue_t* lf_queue;
+  main_loop_queue_overflow_t queue_overflow;
+  uint32_t batch_r;
+  uint32_t batch_nr;
+  event_queue_req_t batch[MAIN_LOOP_QUEUE_BATCH_SIZE];
+
+  /*合并同一帧内连续的move/wheel/resize事件*/
+  bool_t coalesce_events;
+  /*可合并的事件总数*/
+  uint32_t coalesce_total;
+  /*被合并掉(没有单独分发)的事件数*/
+  uint32_t coalesce_merged;
 };
 
 /**
@@ -130,9 +196,39 @@ ret_t main_loop_post_touch_event(main_loop_t* l, event_type_t event_type, xy_t x
  */
 ret_t main_loop_post_multi_gesture_event(main_loop_t* l, multi_gesture_event_t* event);
 
-#ifndef MAIN_LOOP_QUEUE_SIZE
-#define MAIN_LOOP_QUEUE_SIZE 20
-#endif /*MAIN_LOOP_QUEUE_SIZE*/
+/**
+ * @method main_loop_simple_set_queue_overflow
+ * 设置事件队列满时的处理策略(仅对无锁事件队列有效)。缺省为MAIN\_LOOP\_QUEUE\_OVERFLOW\_FAIL。
+ * @param {main_loop_simple_t*} loop main_loop_simple_t对象。
+ * @param {main_loop_queue_overflow_t} overflow 处理策略。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t main_loop_simple_set_queue_overflow(main_loop_simple_t* loop,
+                                          main_loop_queue_overflow_t overflow);
+
+/**
+ * @method main_loop_simple_set_coalesce_events
+ * 设置是否合并事件。
+ *
+ * > 开启后，同一帧内连续的pointer move、touch move、wheel和resize事件，如果目标相同，
+ * > 只分发最后一个(wheel事件的dy会累加)。缺省开启，定义WITHOUT\_MAIN\_LOOP\_COALESCE\_EVENTS可关闭。
+ *
+ * @param {main_loop_simple_t*} loop main_loop_simple_t对象。
+ * @param {bool_t} coalesce_events 是否合并事件。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t main_loop_simple_set_coalesce_events(main_loop_simple_t* loop, bool_t coalesce_events);
+
+/**
+ * @method main_loop_simple_get_coalesce_ratio
+ * 获取事件合并率(被合并掉的事件数/可合并的事件总数)。
+ * @param {main_loop_simple_t*} loop main_loop_simple_t对象。
+ *
+ * @return {float_t} 返回事件合并率(0-1)。
+ */
+float_t main_loop_simple_get_coalesce_ratio(main_loop_simple_t* loop);
 
 END_C_DECLS
 
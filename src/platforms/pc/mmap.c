@@ -53,6 +53,7 @@ mmap_t* mmap_create(const char* filename, bool_t writable, bool_t shared) {
   dwDesiredAccess = writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ;
 
   map->size = size;
+  map->refcount = 1;
   map->fd = (void*)hFile;
   map->handle = (void*)handle;
   map->data = MapViewOfFile(handle, dwDesiredAccess, 0, 0, size);
@@ -88,9 +89,10 @@ error:
 
   flags = MAP_FILE | (shared ? MAP_SHARED : MAP_PRIVATE);
   map->data = mmap(NULL, size, protect, flags, fd, 0);
-  goto_error_if_fail(map->handle != MAP_FAILED);
+  goto_error_if_fail(map->data != MAP_FAILED);
 
   map->size = size;
+  map->refcount = 1;
   map->fd = tk_pointer_from_int(fd);
   return map;
 error:
@@ -104,12 +106,25 @@ error:
 #endif /*WIN32*/
 }
 
+mmap_t* mmap_ref(mmap_t* map) {
+  return_value_if_fail(map != NULL, NULL);
+
+  map->refcount++;
+
+  return map;
+}
+
 ret_t mmap_destroy(mmap_t* map) {
 #ifdef WIN32
   HANDLE fd = INVALID_HANDLE_VALUE;
   HANDLE handle = INVALID_HANDLE_VALUE;
   return_value_if_fail(map != NULL, RET_BAD_PARAMS);
 
+  if (map->refcount > 1) {
+    map->refcount--;
+    return RET_OK;
+  }
+
   fd = (HANDLE)(map->fd);
   handle = (HANDLE)(map->handle);
 
@@ -132,6 +147,12 @@ ret_t mmap_destroy(mmap_t* map) {
 #else
   int fd = 0;
   return_value_if_fail(map != NULL, RET_BAD_PARAMS);
+
+  if (map->refcount > 1) {
+    map->refcount--;
+    return RET_OK;
+  }
+
   fd = tk_pointer_to_int(map->fd);
   if (map->data != NULL) {
     munmap(map->data, map->size);
@@ -333,6 +333,12 @@ static value_t tk_atomic_fetch_add_explicit(tk_atomic_t* atomic, value_t* v,
 static value_t tk_atomic_fetch_sub_explicit(tk_atomic_t* atomic, value_t* v,
                                             tk_atomic_memory_order_t mem_order);
 
+/* PC上的GCC/Clang在C11之前的标准(如gnu99)下也提供了stdatomic.h，不需要退化为互斥锁 */
+#if !defined(TK_ATOMIC_GNUC_STDATOMIC) && defined(TK_IS_PC) && !defined(__cplusplus) && \
+    !defined(__STDC_NO_ATOMICS__) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#define TK_ATOMIC_GNUC_STDATOMIC 1
+#endif /*TK_ATOMIC_GNUC_STDATOMIC*/
+
 #if defined(WIN32) && !defined(MINGW)
 #include <winnt.h>
 
@@ -832,7 +838,9 @@ inline static value_t tk_atomic_fetch_add(tk_atomic_t* atomic, value_t* v) {
 inline static value_t tk_atomic_fetch_sub(tk_atomic_t* atomic, value_t* v) {
   return tk_atomic_fetch_sub_explicit(atomic, v, TK_ATOMIC_MEMORY_ORDER_SEQ_CST);
 }
-#elif ((__cplusplus >= 201103L) || (__STDC_VERSION__ >= 201112L)) && !defined(__STDC_NO_ATOMICS__)
+#elif (((__cplusplus >= 201103L) || (__STDC_VERSION__ >= 201112L)) && \
+       !defined(__STDC_NO_ATOMICS__)) ||                                  \
+    defined(TK_ATOMIC_GNUC_STDATOMIC)
 #ifdef __cplusplus
 #include <atomic>
 #define _Atomic(X) std::atomic<X>
@@ -135,6 +135,30 @@ uint64_t event_source_manager_get_wakeup_time(event_source_manager_t* manager) {
   return tk_min(manager->min_sleep_time, wakeup_time);
 }
 
+uint32_t event_source_manager_get_next_wakeup_time(event_source_manager_t* manager) {
+  uint32_t i = 0;
+  uint32_t t = 0;
+  uint32_t wakeup_time = 0xffff;
+  event_source_t** sources = NULL;
+  return_value_if_fail(manager != NULL, 0);
+
+  sources = (event_source_t**)(manager->sources.elms);
+  for (i = 0; i < manager->sources.size; i++) {
+    /*不知道何时需要唤醒的事件源，按原来的频率检查*/
+    if (event_source_get_fd(sources[i]) >= 0 || sources[i]->get_wakeup_time == NULL) {
+      t = manager->min_sleep_time / 1000;
+    } else {
+      t = event_source_get_wakeup_time(sources[i]);
+    }
+
+    if (t < wakeup_time) {
+      wakeup_time = t;
+    }
+  }
+
+  return wakeup_time;
+}
+
 ret_t event_source_manager_set_min_sleep_time_us(event_source_manager_t* manager,
                                                  uint32_t sleep_time) {
   return_value_if_fail(manager != NULL, RET_BAD_PARAMS);
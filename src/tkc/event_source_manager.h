@@ -82,6 +82,21 @@ ret_t event_source_manager_deinit(event_source_manager_t* manager);
  */
 uint64_t event_source_manager_get_wakeup_time(event_source_manager_t* manager);
 
+/**
+ * @method event_source_manager_get_next_wakeup_time
+ *
+ * 获取距离下次需要唤醒的时间(毫秒)，供tickless主循环使用。
+ *
+ *> 与event\_source\_manager\_get\_wakeup\_time不同，结果不受min\_sleep\_time的限制。
+ *> 有文件描述符(或者没有提供get\_wakeup\_time)的事件源只能按min\_sleep\_time轮询，存在这类事件源时不超过min\_sleep\_time。
+ *
+ * @param {event_source_manager_t*} manager event_source_manager对象。
+ *
+ * @return {uint32_t} 返回距离下次需要唤醒的时间(毫秒)，没有事件源需要唤醒时返回0xffff。
+ *
+ */
+uint32_t event_source_manager_get_next_wakeup_time(event_source_manager_t* manager);
+
 /**
  * @method event_source_manager_dispatch
  *
@@ -33,6 +33,8 @@ static tk_object_t* s_global_obj = NULL;
 static tk_object_t* s_consts_obj = NULL;
 static const fscript_hooks_t* s_hooks;
 static ret_t fscript_locals_create(fscript_t* fscript, const char* name, const value_t* v);
+static ret_t fscript_vm_exec(fscript_t* fscript, value_t* result);
+static ret_t fscript_bytecode_destroy(struct _fscript_bytecode_t* bytecode);
 
 static ret_t fscript_hook_on_init(fscript_t* fscript, const char* code) {
   const fscript_hooks_t* hooks = fscript->hooks != NULL ? fscript->hooks : s_hooks;
@@ -532,6 +534,32 @@ ret_t fscript_set_var(fscript_t* fscript, const char* name, const value_t* value
   return ret;
 }
 
+static ret_t fscript_eval_var(fscript_t* fscript, value_t* s, value_t* d) {
+  const char* name = value_id(s);
+
+  if (tk_str_start_with(name, FSCRIPT_CONSTS_PREFIX)) {
+    name += sizeof(FSCRIPT_CONSTS_PREFIX) - 1;
+    if (tk_object_get_prop(s_consts_obj, name, d) == RET_OK) {
+      value_reset(s);
+      value_copy(s, d);
+      return RET_OK;
+    }
+  }
+
+  if (fscript_get_var(fscript, name, d) != RET_OK) {
+    if (name == NULL || *name != '$') {
+      char msg[128];
+      tk_snprintf(msg, sizeof(msg) - 1, "not found var %s", name);
+      fscript_set_error(fscript, RET_NOT_FOUND, "get_var", msg);
+      value_set_str(d, value_id(s));
+    } else if (*name == '$') {
+      value_reset(d);
+    }
+  }
+
+  return RET_OK;
+}
+
 static ret_t fscript_eval_arg(fscript_t* fscript, fscript_func_call_t* iter, uint32_t i,
                               value_t* d) {
   value_t v;
@@ -567,25 +595,7 @@ static ret_t fscript_eval_arg(fscript_t* fscript, fscript_func_call_t* iter, uin
         return RET_OK;
       }
 
-      if (tk_str_start_with(name, FSCRIPT_CONSTS_PREFIX)) {
-        name += sizeof(FSCRIPT_CONSTS_PREFIX) - 1;
-        if (tk_object_get_prop(s_consts_obj, name, d) == RET_OK) {
-          value_reset(s);
-          value_copy(s, d);
-          return RET_OK;
-        }
-      }
-
-      if (fscript_get_var(fscript, name, d) != RET_OK) {
-        if (name == NULL || *name != '$') {
-          char msg[128];
-          tk_snprintf(msg, sizeof(msg) - 1, "not found var %s", name);
-          fscript_set_error(fscript, RET_NOT_FOUND, "get_var", msg);
-          value_set_str(d, value_id(s));
-        } else if (*name == '$') {
-          value_reset(d);
-        }
-      }
+      return fscript_eval_var(fscript, s, d);
     }
   } else if (s->type == VALUE_TYPE_FSCRIPT_FUNC) {
     fscript_exec_func(fscript, NULL, value_func(s), d);
@@ -884,16 +894,18 @@ ret_t fscript_exec(fscript_t* fscript, value_t* result) {
     fscript_ensure_locals_by_symbols(fscript);
 
     value_set_str(result, NULL);
-    iter = fscript->first;
-    while (iter != NULL) {
-      break_if_fail(iter->func != NULL);
-      value_reset(result);
-      break_if_fail(fscript_exec_func(fscript, NULL, iter, result) == RET_OK);
-      if (fscript->returned) {
-        fscript->returned = FALSE;
-        break;
+    if (fscript_vm_exec(fscript, result) == RET_NOT_IMPL) {
+      iter = fscript->first;
+      while (iter != NULL) {
+        break_if_fail(iter->func != NULL);
+        value_reset(result);
+        break_if_fail(fscript_exec_func(fscript, NULL, iter, result) == RET_OK);
+        if (fscript->returned) {
+          fscript->returned = FALSE;
+          break;
+        }
+        iter = iter->next;
       }
-      iter = iter->next;
     }
     fscript_hook_after_exec(fscript);
     fscript_locals_destroy(fscript);
@@ -915,6 +927,12 @@ ret_t fscript_clean(fscript_t* fscript) {
   str_reset(&(fscript->str));
   fscript_locals_destroy(fscript);
 
+  if (fscript->bytecode != NULL) {
+    fscript_bytecode_destroy(fscript->bytecode);
+    fscript->bytecode = NULL;
+  }
+  fscript->bytecode_failed = FALSE;
+
   if (fscript->symbols) {
     darray_destroy(fscript->symbols);
   }
@@ -3769,6 +3787,8 @@ ret_t fscript_get_vars(fscript_t* fscript, uint32_t filter, darray_t* result) {
   return RET_OK;
 }
 
+#include "tkc/fscript_vm.inc"
+
 double tk_expr_eval(const char* expr) {
   value_t v;
   tk_object_t* obj = NULL;
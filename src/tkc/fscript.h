@@ -111,6 +111,7 @@ ret_t fscript_parser_error_deinit(fscript_parser_error_t* error);
 
 struct _fscript_t;
 struct _fscript_hooks_t;
+struct _fscript_bytecode_t;
 typedef struct _fscript_t fscript_t;
 typedef struct _fscript_hooks_t fscript_hooks_t;
 
@@ -220,6 +221,9 @@ struct _fscript_t {
   darray_t* locals;
   /*脚本定义的函数*/
   tk_object_t* funcs_def;
+  /*编译后的字节码(首次执行时生成)*/
+  struct _fscript_bytecode_t* bytecode;
+  bool_t bytecode_failed;
 
   const fscript_hooks_t* hooks;
 
@@ -413,6 +417,19 @@ ret_t fscript_global_init(void);
  */
 ret_t fscript_set_global_object(tk_object_t* obj);
 
+/**
+ * @method fscript_set_vm_enable
+ * 设置是否启用字节码虚拟机(缺省启用)。
+ *
+ * > 启用后，脚本首次执行时编译成字节码，之后由虚拟机执行。
+ * > 设置了exec\_func回调(如调试器)时，仍然使用语法树解释执行。
+ *
+ * @param {bool_t} enable 是否启用。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t fscript_set_vm_enable(bool_t enable);
+
 /**
  * @method fscript_register_func
  * 注册全局自定义函数。
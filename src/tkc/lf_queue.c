@@ -0,0 +1,254 @@
+﻿/**
+ * File:   lf_queue.c
+ * Author: AWTK Develop Team
+ * Brief:  lock free bounded queue
+ *
+ * Copyright (c) 2026 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/mem.h"
+#include "tkc/atomic.h"
+#include "tkc/lf_queue.h"
+
+#ifndef TK_LF_QUEUE_CACHELINE_LENGTH
+#define TK_LF_QUEUE_CACHELINE_LENGTH 64
+#endif /*TK_LF_QUEUE_CACHELINE_LENGTH*/
+
+struct _tk_lf_queue_t {
+  /*避免伪共享：生产者和消费者的位置放在不同的缓存行*/
+  TK_ALIGN(tk_atomic_t w, TK_LF_QUEUE_CACHELINE_LENGTH);
+  TK_ALIGN(tk_atomic_t r, TK_LF_QUEUE_CACHELINE_LENGTH);
+
+  uint32_t capacity;
+  uint32_t elm_size;
+  uint32_t mask;
+  uint32_t cell_size;
+  uint8_t* cells;
+};
+
+/*
+ * 每个单元的序号(seq)：
+ *   seq == pos     单元空闲，可以写入位置pos。
+ *   seq == pos + 1 位置pos的数据已经就绪，可以读取。
+ * 读取后把序号设置为pos + capacity，供下一轮写入。
+ */
+
+#define TK_LF_QUEUE_CELL(q, pos) ((q)->cells + ((pos) & (q)->mask) * (q)->cell_size)
+#define TK_LF_QUEUE_CELL_SEQ(cell) ((tk_atomic_t*)(cell))
+#define TK_LF_QUEUE_CELL_DATA(cell) ((cell) + TK_ROUND_TO8(sizeof(tk_atomic_t)))
+
+static uint32_t tk_lf_queue_load(const tk_atomic_t* atomic, tk_atomic_memory_order_t order) {
+  value_t v;
+
+  tk_atomic_load_explicit(atomic, &v, order);
+
+  return value_uint32(&v);
+}
+
+static void tk_lf_queue_store(tk_atomic_t* atomic, uint32_t value,
+                              tk_atomic_memory_order_t order) {
+  value_t v;
+
+  tk_atomic_store_explicit(atomic, value_set_uint32(&v, value), order);
+}
+
+static bool_t tk_lf_queue_cas(tk_atomic_t* atomic, uint32_t expect, uint32_t desire) {
+  value_t e;
+  value_t d;
+
+  value_set_uint32(&e, expect);
+  value_set_uint32(&d, desire);
+
+  return tk_atomic_compare_exchange_weak_explicit(atomic, &e, &d, TK_ATOMIC_MEMORY_ORDER_RELAXED,
+                                                  TK_ATOMIC_MEMORY_ORDER_RELAXED);
+}
+
+tk_lf_queue_t* tk_lf_queue_create(uint32_t elm_size, uint32_t capacity) {
+  value_t v;
+  uint32_t i = 0;
+  uint32_t size = 2;
+  tk_lf_queue_t* q = NULL;
+  return_value_if_fail(elm_size > 0 && capacity > 0 && capacity <= 0x40000000, NULL);
+
+  while (size < capacity) {
+    size <<= 1;
+  }
+
+  q = TKMEM_ZALLOC(tk_lf_queue_t);
+  return_value_if_fail(q != NULL, NULL);
+
+  q->capacity = size;
+  q->mask = size - 1;
+  q->elm_size = elm_size;
+  q->cell_size = TK_ROUND_TO8(sizeof(tk_atomic_t)) + TK_ROUND_TO8(elm_size);
+  q->cells = (uint8_t*)TKMEM_ALLOC(q->cell_size * size);
+  goto_error_if_fail(q->cells != NULL);
+  memset(q->cells, 0x00, q->cell_size * size);
+
+  goto_error_if_fail(tk_atomic_init(&(q->w), value_set_uint32(&v, 0)) == RET_OK);
+  goto_error_if_fail(tk_atomic_init(&(q->r), value_set_uint32(&v, 0)) == RET_OK);
+  for (i = 0; i < size; i++) {
+    tk_atomic_t* seq = TK_LF_QUEUE_CELL_SEQ(TK_LF_QUEUE_CELL(q, i));
+    goto_error_if_fail(tk_atomic_init(seq, value_set_uint32(&v, i)) == RET_OK);
+  }
+
+  return q;
+error:
+  tk_lf_queue_destroy(q);
+  return NULL;
+}
+
+ret_t tk_lf_queue_push(tk_lf_queue_t* q, const void* elm) {
+  uint8_t* cell = NULL;
+  uint32_t pos = 0;
+  return_value_if_fail(q != NULL && elm != NULL, RET_BAD_PARAMS);
+
+  pos = tk_lf_queue_load(&(q->w), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  for (;;) {
+    int32_t diff = 0;
+    uint32_t seq = 0;
+
+    cell = TK_LF_QUEUE_CELL(q, pos);
+    seq = tk_lf_queue_load(TK_LF_QUEUE_CELL_SEQ(cell), TK_ATOMIC_MEMORY_ORDER_ACQUIRE);
+    diff = (int32_t)(seq - pos);
+
+    if (diff == 0) {
+      if (tk_lf_queue_cas(&(q->w), pos, pos + 1)) {
+        break;
+      }
+    } else if (diff < 0) {
+      /*上一轮的数据还没有被读走*/
+      return RET_FAIL;
+    }
+    pos = tk_lf_queue_load(&(q->w), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  }
+
+  memcpy(TK_LF_QUEUE_CELL_DATA(cell), elm, q->elm_size);
+  tk_lf_queue_store(TK_LF_QUEUE_CELL_SEQ(cell), pos + 1, TK_ATOMIC_MEMORY_ORDER_RELEASE);
+
+  return RET_OK;
+}
+
+uint32_t tk_lf_queue_pop_batch(tk_lf_queue_t* q, void* elms, uint32_t max_nr) {
+  uint32_t i = 0;
+  uint32_t nr = 0;
+  uint32_t pos = 0;
+  return_value_if_fail(q != NULL && max_nr > 0, 0);
+
+  pos = tk_lf_queue_load(&(q->r), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  for (;;) {
+    /*连续的就绪单元一次取走，遇到还没有写完的单元就停止*/
+    for (nr = 0; nr < max_nr && nr < q->capacity; nr++) {
+      uint8_t* cell = TK_LF_QUEUE_CELL(q, pos + nr);
+      uint32_t seq = tk_lf_queue_load(TK_LF_QUEUE_CELL_SEQ(cell), TK_ATOMIC_MEMORY_ORDER_ACQUIRE);
+
+      if (seq != pos + nr + 1) {
+        break;
+      }
+    }
+
+    if (nr == 0) {
+      uint8_t* cell = TK_LF_QUEUE_CELL(q, pos);
+      uint32_t seq = tk_lf_queue_load(TK_LF_QUEUE_CELL_SEQ(cell), TK_ATOMIC_MEMORY_ORDER_ACQUIRE);
+
+      if ((int32_t)(seq - (pos + 1)) < 0) {
+        return 0;
+      }
+    } else if (tk_lf_queue_cas(&(q->r), pos, pos + nr)) {
+      break;
+    }
+    /*被其它线程抢先读取了*/
+    pos = tk_lf_queue_load(&(q->r), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  }
+
+  for (i = 0; i < nr; i++) {
+    uint8_t* cell = TK_LF_QUEUE_CELL(q, pos + i);
+
+    if (elms != NULL) {
+      memcpy((uint8_t*)elms + i * q->elm_size, TK_LF_QUEUE_CELL_DATA(cell), q->elm_size);
+    }
+    tk_lf_queue_store(TK_LF_QUEUE_CELL_SEQ(cell), pos + i + q->capacity,
+                      TK_ATOMIC_MEMORY_ORDER_RELEASE);
+  }
+
+  return nr;
+}
+
+ret_t tk_lf_queue_pop(tk_lf_queue_t* q, void* elm) {
+  uint8_t* cell = NULL;
+  uint32_t pos = 0;
+  return_value_if_fail(q != NULL, RET_BAD_PARAMS);
+
+  pos = tk_lf_queue_load(&(q->r), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  for (;;) {
+    int32_t diff = 0;
+    uint32_t seq = 0;
+
+    cell = TK_LF_QUEUE_CELL(q, pos);
+    seq = tk_lf_queue_load(TK_LF_QUEUE_CELL_SEQ(cell), TK_ATOMIC_MEMORY_ORDER_ACQUIRE);
+    diff = (int32_t)(seq - (pos + 1));
+
+    if (diff == 0) {
+      if (tk_lf_queue_cas(&(q->r), pos, pos + 1)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return RET_FAIL;
+    }
+    pos = tk_lf_queue_load(&(q->r), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  }
+
+  if (elm != NULL) {
+    memcpy(elm, TK_LF_QUEUE_CELL_DATA(cell), q->elm_size);
+  }
+  tk_lf_queue_store(TK_LF_QUEUE_CELL_SEQ(cell), pos + q->capacity, TK_ATOMIC_MEMORY_ORDER_RELEASE);
+
+  return RET_OK;
+}
+
+uint32_t tk_lf_queue_size(tk_lf_queue_t* q) {
+  uint32_t r = 0;
+  uint32_t w = 0;
+  return_value_if_fail(q != NULL, 0);
+
+  r = tk_lf_queue_load(&(q->r), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+  w = tk_lf_queue_load(&(q->w), TK_ATOMIC_MEMORY_ORDER_RELAXED);
+
+  return (int32_t)(w - r) > 0 ? tk_min(w - r, q->capacity) : 0;
+}
+
+uint32_t tk_lf_queue_capacity(tk_lf_queue_t* q) {
+  return_value_if_fail(q != NULL, 0);
+
+  return q->capacity;
+}
+
+ret_t tk_lf_queue_destroy(tk_lf_queue_t* q) {
+  uint32_t i = 0;
+  return_value_if_fail(q != NULL, RET_BAD_PARAMS);
+
+  if (q->cells != NULL) {
+    for (i = 0; i < q->capacity; i++) {
+      tk_atomic_deinit(TK_LF_QUEUE_CELL_SEQ(TK_LF_QUEUE_CELL(q, i)));
+    }
+    TKMEM_FREE(q->cells);
+  }
+  tk_atomic_deinit(&(q->w));
+  tk_atomic_deinit(&(q->r));
+  TKMEM_FREE(q);
+
+  return RET_OK;
+}
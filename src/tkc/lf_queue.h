@@ -0,0 +1,114 @@
+﻿/**
+ * File:   lf_queue.h
+ * Author: AWTK Develop Team
+ * Brief:  lock free bounded queue
+ *
+ * Copyright (c) 2026 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#ifndef TK_LF_QUEUE_H
+#define TK_LF_QUEUE_H
+
+#include "tkc/types_def.h"
+
+BEGIN_C_DECLS
+
+/**
+ * @class tk_lf_queue_t
+ * @export none
+ * 无锁的有界队列(元素大小固定)。
+ *
+ * 每个单元带一个序号，生产者用CAS抢占写位置，写完数据后发布序号，消费者按序号判断数据是否就绪。
+ * 适用于多生产者-单消费者(MPSC)场景，pop也可以在多个线程中同时调用。
+ *
+ * > 容量会向上取整为2的幂。
+ * > 依赖tk\_atomic\_t，C语言代码需要C11或者PC上的GCC/Clang才是真正无锁的，否则每个原子变量退化为互斥锁。
+ */
+typedef struct _tk_lf_queue_t tk_lf_queue_t;
+
+/**
+ * @method tk_lf_queue_create
+ * 创建队列。
+ * @annotation ["constructor"]
+ * @param {uint32_t} elm_size 元素的大小。
+ * @param {uint32_t} capacity 容量(向上取整为2的幂)。
+ *
+ * @return {tk_lf_queue_t*} 返回队列对象。
+ */
+tk_lf_queue_t* tk_lf_queue_create(uint32_t elm_size, uint32_t capacity);
+
+/**
+ * @method tk_lf_queue_push
+ * 追加一个元素到队列尾部。
+ * @param {tk_lf_queue_t*} q 队列对象。
+ * @param {const void*} elm 元素(大小为elm_size)。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，队列满时返回RET_FAIL。
+ */
+ret_t tk_lf_queue_push(tk_lf_queue_t* q, const void* elm);
+
+/**
+ * @method tk_lf_queue_pop
+ * 从队列头部取出一个元素。
+ * @param {tk_lf_queue_t*} q 队列对象。
+ * @param {void*} elm 用于返回元素(大小为elm_size)，为NULL时丢弃该元素。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，队列空时返回RET_FAIL。
+ */
+ret_t tk_lf_queue_pop(tk_lf_queue_t* q, void* elm);
+
+/**
+ * @method tk_lf_queue_pop_batch
+ * 从队列头部一次取出多个已经就绪的元素(只需要一次CAS)。
+ * @param {tk_lf_queue_t*} q 队列对象。
+ * @param {void*} elms 用于返回元素的数组。
+ * @param {uint32_t} max_nr 最多取出的个数。
+ *
+ * @return {uint32_t} 返回取出的个数，队列空时返回0。
+ */
+uint32_t tk_lf_queue_pop_batch(tk_lf_queue_t* q, void* elms, uint32_t max_nr);
+
+/**
+ * @method tk_lf_queue_size
+ * 获取队列中元素的个数(并发访问时只是近似值)。
+ * @param {tk_lf_queue_t*} q 队列对象。
+ *
+ * @return {uint32_t} 返回元素的个数。
+ */
+uint32_t tk_lf_queue_size(tk_lf_queue_t* q);
+
+/**
+ * @method tk_lf_queue_capacity
+ * 获取队列的容量。
+ * @param {tk_lf_queue_t*} q 队列对象。
+ *
+ * @return {uint32_t} 返回容量。
+ */
+uint32_t tk_lf_queue_capacity(tk_lf_queue_t* q);
+
+/**
+ * @method tk_lf_queue_destroy
+ * 销毁队列。
+ * @annotation ["deconstructor"]
+ * @param {tk_lf_queue_t*} q 队列对象。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t tk_lf_queue_destroy(tk_lf_queue_t* q);
+
+END_C_DECLS
+
+#endif /*TK_LF_QUEUE_H*/
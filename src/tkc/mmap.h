@@ -29,6 +29,8 @@ BEGIN_C_DECLS
 /**
  * @class mmap_t
  * 把文件内容映射到内存。
+ *
+ * 有引用计数，多个对象共享同一个映射时，调用mmap\_ref增加引用，最后一次mmap\_destroy时才解除映射。
  * 
  */
 typedef struct _mmap_t {
@@ -48,6 +50,7 @@ typedef struct _mmap_t {
   /*private*/
   void* handle;
   void* fd;
+  uint32_t refcount;
 } mmap_t;
 
 /**
@@ -62,9 +65,18 @@ typedef struct _mmap_t {
  */
 mmap_t* mmap_create(const char* filename, bool_t writable, bool_t shared);
 
+/**
+ * @method mmap_ref
+ * 增加mmap的引用计数。
+ * @param {mmap_t*} mmap mmap对象。
+ *
+ * @return {mmap_t*} mmap对象本身。
+ */
+mmap_t* mmap_ref(mmap_t* mmap);
+
 /**
  * @method mmap_destroy
- * 销毁mmap。
+ * 销毁mmap(减少引用计数，为0时解除映射)。
  * @param {mmap_t*} mmap mmap对象。
  *
  * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
@@ -24,6 +24,18 @@
 #include "tkc/utils.h"
 #include "tkc/object_default.h"
 
+static uint32_t s_object_default_props_version = 0;
+
+static void object_default_props_changed(object_default_t* o) {
+  /*全局递增，对象被释放后地址被复用也不会和旧的缓存冲突，0保留为无效值*/
+  s_object_default_props_version++;
+  if (s_object_default_props_version == 0) {
+    s_object_default_props_version++;
+  }
+
+  o->props_version = s_object_default_props_version;
+}
+
 static tk_compare_t object_default_get_cmp(object_default_t* o) {
   if (o->name_case_insensitive) {
     return (tk_compare_t)named_value_icompare;
@@ -73,6 +85,8 @@ ret_t object_default_clear_props(tk_object_t* obj) {
   object_default_t* o = OBJECT_DEFAULT(obj);
   return_value_if_fail(o != NULL, RET_BAD_PARAMS);
 
+  object_default_props_changed(o);
+
   return darray_clear(&(o->props));
 }
 
@@ -97,6 +111,7 @@ static ret_t object_default_remove_prop(tk_object_t* obj, const char* name) {
 
   index = object_default_find_prop_index_by_name(obj, name);
   if (index >= 0) {
+    object_default_props_changed(o);
     return darray_remove_index(&(o->props), index);
   } else {
     return RET_NOT_FOUND;
@@ -129,6 +144,8 @@ static ret_t object_default_set_prop(tk_object_t* obj, const char* name, const v
     ret = darray_sorted_insert(&(o->props), nv, object_default_get_cmp(o), FALSE);
     if (ret != RET_OK) {
       named_value_destroy(nv);
+    } else {
+      object_default_props_changed(o);
     }
   }
 
@@ -211,6 +228,7 @@ static ret_t object_default_foreach_prop(tk_object_t* obj, tk_visit_t on_prop, v
                                          has_removed = TRUE);
     }
     if (has_removed) {
+      object_default_props_changed(o);
       darray_remove_all(&(o->props), pointer_compare, NULL);
       tk_object_notify_changed(obj);
     }
@@ -251,6 +269,7 @@ tk_object_t* object_default_clone(object_default_t* o) {
       break;
     }
   }
+  object_default_props_changed(dupo);
 
   return dup;
 }
@@ -280,6 +299,7 @@ tk_object_t* object_default_create_ex(bool_t enable_path) {
   return_value_if_fail(obj != NULL, NULL);
 
   o->enable_path = enable_path;
+  object_default_props_changed(o);
   darray_init(&(o->props), 5, (tk_destroy_t)named_value_destroy, (tk_compare_t)named_value_compare);
 
   return obj;
@@ -305,6 +325,7 @@ ret_t object_default_set_name_case_insensitive(tk_object_t* obj, bool_t name_cas
   if (o->name_case_insensitive != name_case_insensitive) {
     o->name_case_insensitive = name_case_insensitive;
 
+    object_default_props_changed(o);
     darray_sort(&(o->props), object_default_get_cmp(o));
   }
 
@@ -316,6 +337,70 @@ object_default_t* object_default_cast(tk_object_t* obj) {
   return (object_default_t*)(obj);
 }
 
+static value_t* object_default_find_prop_cached_impl(object_default_t* o, const char* name,
+                                                     uint32_t len,
+                                                     object_default_prop_cache_t* cache) {
+  value_t* value = NULL;
+  char subname[TK_OBJECT_PROP_NAME_MAX_LEN];
+
+  if (cache->obj == TK_OBJECT(o) && cache->props_version == o->props_version) {
+    return cache->value;
+  }
+
+  if (len >= sizeof(subname)) {
+    return NULL;
+  }
+  tk_memcpy(subname, name, len);
+  subname[len] = '\0';
+
+  /*和object_default_get_prop保持一致，特殊属性不缓存*/
+  if (tk_str_eq(subname, TK_OBJECT_PROP_SIZE) || tk_str_eq(subname, TK_OBJECT_PROP_DISABLE_PATH)) {
+    return NULL;
+  }
+
+  value = object_default_find_prop_by_name(TK_OBJECT(o), subname);
+  if (value != NULL) {
+    cache->obj = TK_OBJECT(o);
+    cache->value = value;
+    cache->props_version = o->props_version;
+  }
+
+  return value;
+}
+
+value_t* object_default_find_prop_cached(tk_object_t* obj, const char* path,
+                                         object_default_prop_cache_t* caches, uint32_t nr) {
+  uint32_t i = 0;
+  return_value_if_fail(path != NULL && caches != NULL, NULL);
+
+  for (i = 0; i < nr; i++) {
+    value_t* value = NULL;
+    const char* p = NULL;
+    object_default_t* o = NULL;
+
+    if (obj == NULL || obj->vt != &s_object_default_vtable) {
+      return NULL;
+    }
+
+    o = (object_default_t*)obj;
+    p = o->enable_path ? strchr(path, '.') : NULL;
+    if (p == NULL) {
+      return object_default_find_prop_cached_impl(o, path, strlen(path), caches + i);
+    }
+
+    /*子对象不存在时object_default_get_prop会按完整的名称查找，这种情况不缓存*/
+    value = object_default_find_prop_cached_impl(o, path, p - path, caches + i);
+    if (value == NULL || value->type != VALUE_TYPE_OBJECT) {
+      return NULL;
+    }
+
+    obj = value_object(value);
+    path = p + 1;
+  }
+
+  return NULL;
+}
+
 ret_t object_default_unref(tk_object_t* obj) {
   return tk_object_unref(obj);
 }
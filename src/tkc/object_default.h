@@ -69,8 +69,26 @@ typedef struct _object_default_t {
   /*设置属性值不改变属性的类型*/
   bool_t keep_prop_type;
   bool_t name_case_insensitive;
+  /*属性集合(增删/排序)变化时更新，用于判断属性缓存是否有效*/
+  uint32_t props_version;
 } object_default_t;
 
+/**
+ * @class object_default_prop_cache_t
+ * 属性查找缓存。
+ *
+ * 由调用者(如脚本中访问属性的位置)持有，记录上次查找到的属性。
+ * 对象的属性集合没有变化(没有增删属性)时，再次查找可以跳过按名称的二分查找。
+ *
+ * > 初始化为全0即可。
+ */
+typedef struct _object_default_prop_cache_t {
+  /*private*/
+  tk_object_t* obj;
+  value_t* value;
+  uint32_t props_version;
+} object_default_prop_cache_t;
+
 /**
  * @method object_default_create
  *
@@ -168,6 +186,26 @@ ret_t object_default_set_name_case_insensitive(tk_object_t* obj, bool_t name_cas
  */
 value_t* object_default_find_prop(tk_object_t* obj, tk_compare_t cmp, const void* data);
 
+/**
+ * @method object_default_find_prop_cached
+ *
+ * 按名称(或a.b.c形式的路径)查找属性，并用caches记住每一级的查找结果。
+ *
+ * > 查找规则和tk\_object\_get\_prop一致。路径中任何一级不是object\_default对象，
+ * > 或者路径的级数超过nr时返回NULL，此时调用者应该使用tk\_object\_get\_prop。
+ * > 缓存不记录名称，同一个缓存只能用于同一个路径。
+ *
+ * @param {tk_object_t*} obj 对象。
+ * @param {const char*} path 属性名或路径。
+ * @param {object_default_prop_cache_t*} caches 缓存数组，每一级一个。
+ * @param {uint32_t} nr 缓存数组的长度。
+ *
+ * @return {value_t*} 返回属性的值，找不到时返回NULL。
+ *
+ */
+value_t* object_default_find_prop_cached(tk_object_t* obj, const char* path,
+                                         object_default_prop_cache_t* caches, uint32_t nr);
+
 /**
  * @method object_default_cast
  * 转换为object_default对象。
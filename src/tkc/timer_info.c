@@ -58,13 +58,17 @@ timer_info_t* timer_info_create(timer_manager_t* tm, uint32_t id, timer_func_t o
   timer->duration = duration;
   timer->timer_info_type = timer_info_type;
 
+  timer->heap_index = -1;
   if (tm != NULL) {
     timer->id = id;
     timer->timer_manager = tm;
     timer->start = tm->get_time();
 
     if (id != TK_INVALID_ID) {
-      timer_manager_append(tm, timer);
+      if (timer_manager_append(tm, timer) != RET_OK) {
+        tk_object_unref(obj);
+        return NULL;
+      }
     } else {
       tk_object_unref(obj);
       return_value_if_fail(id != TK_INVALID_ID, NULL);
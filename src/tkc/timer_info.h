@@ -132,6 +132,10 @@ struct _timer_info_t {
   uint16_t timer_info_type;
   uint64_t last_dispatch_time;
   timer_manager_t* timer_manager;
+  /*在timer_manager最小堆中的位置，-1表示不在堆中(比如正在分发)*/
+  int32_t heap_index;
+  /*加入最小堆时计算的到期时间*/
+  uint64_t deadline;
 };
 
 /**
@@ -22,6 +22,8 @@
 #include "tkc/mem.h"
 #include "tkc/timer_manager.h"
 
+#define TIMER_MANAGER_INDEX_MIN_CAPACITY 32
+
 static timer_manager_t* s_timer_manager;
 
 timer_manager_t* timer_manager(void) {
@@ -34,6 +36,210 @@ ret_t timer_manager_set(timer_manager_t* timer_manager) {
   return RET_OK;
 }
 
+static inline uint32_t timer_manager_hash_id(uint32_t id) {
+  return id * 2654435761u;
+}
+
+static ret_t timer_manager_index_insert_nocheck(timer_manager_t* timer_manager,
+                                               timer_info_t* timer) {
+  uint32_t mask = timer_manager->index_capacity - 1;
+  uint32_t i = timer_manager_hash_id(timer->id) & mask;
+
+  while (timer_manager->index[i] != NULL) {
+    i = (i + 1) & mask;
+  }
+  timer_manager->index[i] = timer;
+
+  return RET_OK;
+}
+
+static ret_t timer_manager_index_rebuild(timer_manager_t* timer_manager, uint32_t capacity) {
+  uint32_t i = 0;
+  timer_info_t** old_index = timer_manager->index;
+  uint32_t old_capacity = timer_manager->index_capacity;
+  timer_info_t** index = TKMEM_ZALLOCN(timer_info_t*, capacity);
+  return_value_if_fail(index != NULL, RET_OOM);
+
+  timer_manager->index = index;
+  timer_manager->index_capacity = capacity;
+  for (i = 0; i < old_capacity; i++) {
+    if (old_index[i] != NULL) {
+      timer_manager_index_insert_nocheck(timer_manager, old_index[i]);
+    }
+  }
+  TKMEM_FREE(old_index);
+
+  return RET_OK;
+}
+
+static ret_t timer_manager_index_insert(timer_manager_t* timer_manager, timer_info_t* timer) {
+  if ((timer_manager->index_size + 1) * 2 > timer_manager->index_capacity) {
+    uint32_t capacity =
+        tk_max(TIMER_MANAGER_INDEX_MIN_CAPACITY, timer_manager->index_capacity * 2);
+    return_value_if_fail(timer_manager_index_rebuild(timer_manager, capacity) == RET_OK, RET_OOM);
+  }
+
+  timer_manager->index_size++;
+
+  return timer_manager_index_insert_nocheck(timer_manager, timer);
+}
+
+static timer_info_t* timer_manager_index_find(timer_manager_t* timer_manager, uint32_t id) {
+  uint32_t i = 0;
+  uint32_t mask = 0;
+
+  if (timer_manager->index == NULL) {
+    return NULL;
+  }
+
+  mask = timer_manager->index_capacity - 1;
+  for (i = timer_manager_hash_id(id) & mask; timer_manager->index[i] != NULL;
+       i = (i + 1) & mask) {
+    if (timer_manager->index[i]->id == id) {
+      return timer_manager->index[i];
+    }
+  }
+
+  return NULL;
+}
+
+static ret_t timer_manager_index_remove_at(timer_manager_t* timer_manager, uint32_t i) {
+  uint32_t j = 0;
+  uint32_t mask = timer_manager->index_capacity - 1;
+  timer_info_t** index = timer_manager->index;
+
+  /*backward shift deletion，保持探测序列连续*/
+  for (j = i;;) {
+    uint32_t k = 0;
+    j = (j + 1) & mask;
+    if (index[j] == NULL) {
+      break;
+    }
+
+    k = timer_manager_hash_id(index[j]->id) & mask;
+    if ((i <= j) ? (i < k && k <= j) : (i < k || k <= j)) {
+      continue;
+    }
+
+    index[i] = index[j];
+    i = j;
+  }
+  index[i] = NULL;
+  timer_manager->index_size--;
+
+  return RET_OK;
+}
+
+static ret_t timer_manager_index_remove(timer_manager_t* timer_manager, timer_info_t* timer) {
+  uint32_t i = 0;
+  uint32_t mask = timer_manager->index_capacity - 1;
+
+  for (i = timer_manager_hash_id(timer->id) & mask; timer_manager->index[i] != timer;
+       i = (i + 1) & mask) {
+    return_value_if_fail(timer_manager->index[i] != NULL, RET_NOT_FOUND);
+  }
+
+  return timer_manager_index_remove_at(timer_manager, i);
+}
+
+/*同一个时刻只分发一次，所以到期时间不早于上次分发的时刻加1*/
+static uint64_t timer_manager_deadline_of(timer_info_t* timer) {
+  if (timer->suspend) {
+    return UINT64_MAX;
+  }
+
+  return tk_max(timer->start + timer->duration, timer->now + 1);
+}
+
+static bool_t timer_manager_heap_less(timer_info_t* a, timer_info_t* b) {
+  if (a->deadline != b->deadline) {
+    return a->deadline < b->deadline;
+  }
+
+  return a->id < b->id;
+}
+
+static void timer_manager_heap_set(timer_manager_t* timer_manager, uint32_t i,
+                                   timer_info_t* timer) {
+  timer_manager->timers.elms[i] = timer;
+  timer->heap_index = i;
+}
+
+static void timer_manager_heap_sift_up(timer_manager_t* timer_manager, uint32_t i) {
+  void** elms = timer_manager->timers.elms;
+  timer_info_t* timer = TIMER_INFO(elms[i]);
+
+  while (i > 0) {
+    uint32_t parent = (i - 1) / 2;
+    if (!timer_manager_heap_less(timer, TIMER_INFO(elms[parent]))) {
+      break;
+    }
+    timer_manager_heap_set(timer_manager, i, TIMER_INFO(elms[parent]));
+    i = parent;
+  }
+  timer_manager_heap_set(timer_manager, i, timer);
+}
+
+static void timer_manager_heap_sift_down(timer_manager_t* timer_manager, uint32_t i) {
+  void** elms = timer_manager->timers.elms;
+  uint32_t size = timer_manager->timers.size;
+  timer_info_t* timer = TIMER_INFO(elms[i]);
+
+  while (TRUE) {
+    uint32_t child = 2 * i + 1;
+    if (child >= size) {
+      break;
+    }
+
+    if (child + 1 < size &&
+        timer_manager_heap_less(TIMER_INFO(elms[child + 1]), TIMER_INFO(elms[child]))) {
+      child++;
+    }
+
+    if (!timer_manager_heap_less(TIMER_INFO(elms[child]), timer)) {
+      break;
+    }
+    timer_manager_heap_set(timer_manager, i, TIMER_INFO(elms[child]));
+    i = child;
+  }
+  timer_manager_heap_set(timer_manager, i, timer);
+}
+
+static ret_t timer_manager_heap_push(timer_manager_t* timer_manager, timer_info_t* timer) {
+  return_value_if_fail(darray_push(&(timer_manager->timers), timer) == RET_OK, RET_OOM);
+
+  timer->deadline = timer_manager_deadline_of(timer);
+  timer_manager_heap_sift_up(timer_manager, timer_manager->timers.size - 1);
+
+  return RET_OK;
+}
+
+static ret_t timer_manager_heap_remove(timer_manager_t* timer_manager, timer_info_t* timer) {
+  uint32_t i = timer->heap_index;
+  timer_info_t* last = TIMER_INFO(darray_pop(&(timer_manager->timers)));
+
+  timer->heap_index = -1;
+  if (last != timer) {
+    timer_manager_heap_set(timer_manager, i, last);
+    timer_manager_heap_sift_up(timer_manager, i);
+    timer_manager_heap_sift_down(timer_manager, last->heap_index);
+  }
+
+  return RET_OK;
+}
+
+static ret_t timer_manager_heap_update(timer_manager_t* timer_manager, timer_info_t* timer) {
+  timer->deadline = timer_manager_deadline_of(timer);
+  timer_manager_heap_sift_up(timer_manager, timer->heap_index);
+  timer_manager_heap_sift_down(timer_manager, timer->heap_index);
+
+  return RET_OK;
+}
+
+static timer_info_t* timer_manager_heap_top(timer_manager_t* timer_manager) {
+  return timer_manager->timers.size > 0 ? TIMER_INFO(timer_manager->timers.elms[0]) : NULL;
+}
+
 timer_manager_t* timer_manager_create(timer_get_time_t get_time) {
   timer_manager_t* timer_manager = NULL;
   return_value_if_fail(get_time != NULL, NULL);
@@ -50,15 +256,42 @@ timer_manager_t* timer_manager_init(timer_manager_t* timer_manager, timer_get_ti
   timer_manager->next_timer_id = TK_INVALID_ID + 1;
   timer_manager->last_dispatch_time = get_time();
   timer_manager->get_time = get_time;
-  slist_init(&(timer_manager->timers), (tk_destroy_t)tk_object_unref, timer_info_compare_by_id);
+  timer_manager->index = NULL;
+  timer_manager->index_size = 0;
+  timer_manager->index_capacity = 0;
+  darray_init(&(timer_manager->timers), 0, NULL, NULL);
 
   return timer_manager;
 }
 
+/*从索引和堆中移除并释放定时器*/
+static ret_t timer_manager_remove_timer(timer_manager_t* timer_manager, timer_info_t* timer) {
+  if (timer->heap_index >= 0) {
+    timer_manager_heap_remove(timer_manager, timer);
+  }
+  timer_manager_index_remove(timer_manager, timer);
+  tk_object_unref((tk_object_t*)timer);
+
+  return RET_OK;
+}
+
 ret_t timer_manager_deinit(timer_manager_t* timer_manager) {
+  uint32_t i = 0;
   return_value_if_fail(timer_manager != NULL, RET_BAD_PARAMS);
 
-  slist_deinit(&(timer_manager->timers));
+  for (i = 0; i < timer_manager->index_capacity; i++) {
+    timer_info_t* timer = timer_manager->index[i];
+    if (timer != NULL) {
+      timer_manager->index[i] = NULL;
+      timer->heap_index = -1;
+      tk_object_unref((tk_object_t*)timer);
+    }
+  }
+
+  TKMEM_FREE(timer_manager->index);
+  timer_manager->index_size = 0;
+  timer_manager->index_capacity = 0;
+  darray_deinit(&(timer_manager->timers));
 
   return RET_OK;
 }
@@ -80,14 +313,21 @@ uint32_t timer_manager_get_next_timer_id(timer_manager_t* timer_manager) {
     if (next_timer_id == TK_INVALID_ID) {
       next_timer_id = timer_manager->next_timer_id++;
     }
-  } while (timer_manager_find(timer_manager, next_timer_id) != NULL);
+  } while (timer_manager_index_find(timer_manager, next_timer_id) != NULL);
   return next_timer_id;
 }
 
 ret_t timer_manager_append(timer_manager_t* timer_manager, timer_info_t* timer) {
   return_value_if_fail(timer_manager != NULL && timer != NULL, RET_BAD_PARAMS);
+  return_value_if_fail(timer_manager_index_find(timer_manager, timer->id) == NULL, RET_FOUND);
+  return_value_if_fail(timer_manager_index_insert(timer_manager, timer) == RET_OK, RET_OOM);
+
+  if (timer_manager_heap_push(timer_manager, timer) != RET_OK) {
+    timer_manager_index_remove(timer_manager, timer);
+    return RET_OOM;
+  }
 
-  return slist_append(&(timer_manager->timers), timer);
+  return RET_OK;
 }
 
 uint32_t timer_manager_add(timer_manager_t* timer_manager, timer_func_t on_timer, void* ctx,
@@ -118,7 +358,7 @@ uint32_t timer_manager_add_with_type_and_id(timer_manager_t* timer_manager, uint
   return_value_if_fail(timer_manager != NULL, TK_INVALID_ID);
 
   if (is_check_id) {
-    if (timer_manager_find(timer_manager, id) != NULL) {
+    if (timer_manager_index_find(timer_manager, id) != NULL) {
       return TK_INVALID_ID;
     }
   }
@@ -133,27 +373,70 @@ uint32_t timer_manager_add_with_type_and_id(timer_manager_t* timer_manager, uint
   return timer->id;
 }
 
+static ret_t timer_manager_remove_if(timer_manager_t* timer_manager, tk_compare_t cmp, void* ctx) {
+  uint32_t i = 0;
+  ret_t ret = RET_NOT_FOUND;
+
+  /*删除后后面的元素可能移到当前位置，所以删除后不前进*/
+  while (i < timer_manager->index_capacity) {
+    timer_info_t* timer = timer_manager->index[i];
+    if (timer != NULL && cmp(timer, ctx) == 0) {
+      if (timer->heap_index >= 0) {
+        timer_manager_heap_remove(timer_manager, timer);
+      }
+      timer_manager_index_remove_at(timer_manager, i);
+      tk_object_unref((tk_object_t*)timer);
+      ret = RET_OK;
+    } else {
+      i++;
+    }
+  }
+
+  return ret;
+}
+
 ret_t timer_manager_all_remove_by_ctx_and_type(timer_manager_t* timer_manager, uint16_t type,
                                                void* ctx) {
   timer_info_t timer;
   return_value_if_fail(timer_manager != NULL, RET_BAD_PARAMS);
 
-  return slist_remove_ex(&(timer_manager->timers), timer_info_compare_by_ctx_and_type,
-                         timer_info_init_dummy_with_ctx_and_type(&timer, type, ctx), -1);
+  return timer_manager_remove_if(timer_manager, timer_info_compare_by_ctx_and_type,
+                                 timer_info_init_dummy_with_ctx_and_type(&timer, type, ctx));
 }
 
 ret_t timer_manager_all_remove_by_ctx(timer_manager_t* timer_manager, void* ctx) {
   return_value_if_fail(timer_manager != NULL, RET_BAD_PARAMS);
 
-  return slist_remove_ex(&(timer_manager->timers), timer_info_compare_by_ctx, ctx, -1);
+  return timer_manager_remove_if(timer_manager, timer_info_compare_by_ctx, ctx);
 }
 
 ret_t timer_manager_remove(timer_manager_t* timer_manager, uint32_t timer_id) {
-  timer_info_t timer;
+  timer_info_t* timer = NULL;
   return_value_if_fail(timer_id != TK_INVALID_ID, RET_BAD_PARAMS);
   return_value_if_fail(timer_manager != NULL, RET_BAD_PARAMS);
 
-  return slist_remove(&(timer_manager->timers), timer_info_init_dummy(&timer, timer_id));
+  timer = timer_manager_index_find(timer_manager, timer_id);
+  if (timer == NULL) {
+    return RET_NOT_FOUND;
+  }
+
+  return timer_manager_remove_timer(timer_manager, timer);
+}
+
+ret_t timer_manager_update(timer_manager_t* timer_manager, uint32_t timer_id) {
+  timer_info_t* timer = NULL;
+  return_value_if_fail(timer_id != TK_INVALID_ID, RET_BAD_PARAMS);
+  return_value_if_fail(timer_manager != NULL, RET_BAD_PARAMS);
+
+  timer = timer_manager_index_find(timer_manager, timer_id);
+  return_value_if_fail(timer != NULL, RET_NOT_FOUND);
+
+  /*正在分发的定时器，分发完成后重新加入堆中*/
+  if (timer->heap_index >= 0) {
+    timer_manager_heap_update(timer_manager, timer);
+  }
+
+  return RET_OK;
 }
 
 ret_t timer_manager_reset(timer_manager_t* timer_manager, uint32_t timer_id) {
@@ -161,63 +444,58 @@ ret_t timer_manager_reset(timer_manager_t* timer_manager, uint32_t timer_id) {
   return_value_if_fail(info != NULL, RET_NOT_FOUND);
   info->start = timer_manager->get_time();
 
-  return RET_OK;
+  return timer_manager_update(timer_manager, timer_id);
 }
 
 const timer_info_t* timer_manager_find(timer_manager_t* timer_manager, uint32_t timer_id) {
-  timer_info_t timer;
   return_value_if_fail(timer_id != TK_INVALID_ID, NULL);
   return_value_if_fail(timer_manager != NULL, NULL);
 
-  return slist_find(&(timer_manager->timers), timer_info_init_dummy(&timer, timer_id));
+  return timer_manager_index_find(timer_manager, timer_id);
 }
 
-static ret_t timer_manager_dispatch_one(timer_manager_t* timer_manager, uint64_t now,
-                                        uint32_t delta_time) {
-  slist_node_t* iter = timer_manager->timers.first;
+static ret_t timer_manager_dispatch_one(timer_manager_t* timer_manager, uint64_t now) {
+  ret_t ret = RET_OK;
+  timer_info_t* timer = timer_manager_heap_top(timer_manager);
 
-  while (iter != NULL && !timer_info_is_available(TIMER_INFO(iter->data), now)) {
-    iter = iter->next;
+  if (timer == NULL || timer->deadline > now) {
+    return RET_DONE;
   }
 
-  if (iter != NULL) {
-    uint32_t diff = 0;
-    timer_info_t* timer = (timer_info_t*)tk_object_ref((tk_object_t*)(iter->data));
-    return_value_if_fail(timer != NULL, RET_BAD_PARAMS);
-
-    timer->now = now;
-    diff = (uint32_t)(now - timer->start);
-    if (!timer->suspend && timer->duration <= diff) {
-      if (timer_info_on_timer(timer, now) != RET_REPEAT) {
-        timer_manager_remove(timer_manager, timer->id);
-      } else {
-        timer->start = now;
-      }
-    }
-
-    tk_object_unref((tk_object_t*)timer);
-
+  /*start/duration/suspend可能被直接修改过，到期时间以当前的值为准*/
+  if (timer_manager_deadline_of(timer) > now) {
+    timer_manager_heap_update(timer_manager, timer);
     return RET_OK;
   }
 
-  return RET_DONE;
+  /*分发期间移出堆，嵌套的主循环不会再次分发它*/
+  timer = (timer_info_t*)tk_object_ref((tk_object_t*)timer);
+  return_value_if_fail(timer != NULL, RET_BAD_PARAMS);
+  timer_manager_heap_remove(timer_manager, timer);
+
+  ret = timer_info_on_timer(timer, now);
+  if (timer_manager_index_find(timer_manager, timer->id) == timer) {
+    if (ret != RET_REPEAT) {
+      timer_manager_remove_timer(timer_manager, timer);
+    } else {
+      timer->start = now;
+      timer_manager_heap_push(timer_manager, timer);
+    }
+  }
+
+  tk_object_unref((tk_object_t*)timer);
+
+  return RET_OK;
 }
 
 ret_t timer_manager_dispatch(timer_manager_t* timer_manager) {
   uint64_t now = 0;
-  uint32_t delta_time = 0;
   return_value_if_fail(timer_manager != NULL, RET_BAD_PARAMS);
 
   now = timer_manager->get_time();
-  delta_time = now - timer_manager->last_dispatch_time;
-
-  if (timer_manager->timers.first == NULL) {
-    timer_manager->last_dispatch_time = now;
-    return RET_OK;
-  }
-
   timer_manager->last_dispatch_time = now;
-  while (timer_manager_dispatch_one(timer_manager, now, delta_time) == RET_OK) {
+
+  while (timer_manager_dispatch_one(timer_manager, now) == RET_OK) {
     if (timer_manager->last_dispatch_time != now) {
       log_debug("abort dispatch because sub main loop\n");
     }
@@ -229,22 +507,18 @@ ret_t timer_manager_dispatch(timer_manager_t* timer_manager) {
 uint32_t timer_manager_count(timer_manager_t* timer_manager) {
   return_value_if_fail(timer_manager != NULL, 0);
 
-  return slist_size(&(timer_manager->timers));
+  return timer_manager->index_size;
 }
 
 uint64_t timer_manager_next_time(timer_manager_t* timer_manager) {
-  slist_node_t* iter = NULL;
-  uint64_t t = timer_manager->get_time() + 0xffff;
-  return_value_if_fail(timer_manager != NULL, t);
-
-  iter = timer_manager->timers.first;
-  while (iter != NULL) {
-    timer_info_t* timer = TIMER_INFO(iter->data);
-    uint32_t diff = t - timer->start;
-    if (timer->duration < diff) {
-      t = timer->start + timer->duration;
-    }
-    iter = iter->next;
+  uint64_t t = 0;
+  timer_info_t* timer = NULL;
+  return_value_if_fail(timer_manager != NULL, 0);
+
+  t = timer_manager->get_time() + 0xffff;
+  timer = timer_manager_heap_top(timer_manager);
+  if (timer != NULL && timer->deadline < t) {
+    t = timer->deadline;
   }
 
   return t;
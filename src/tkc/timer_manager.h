@@ -22,7 +22,7 @@
 #ifndef TK_TIMER_MANAGER_H
 #define TK_TIMER_MANAGER_H
 
-#include "tkc/slist.h"
+#include "tkc/darray.h"
 #include "tkc/timer_info.h"
 
 BEGIN_C_DECLS
@@ -32,13 +32,23 @@ BEGIN_C_DECLS
  * @annotation ["scriptable"]
  *
  * 定时器管理器。
+ *
+ * 定时器按到期时间保存在最小堆中，并按id建立哈希索引：
+ * 添加和删除的复杂度为O(log n)，查找和获取最近的到期时间为O(1)，
+ * 分发时只访问已经到期的定时器。
  */
 struct _timer_manager_t {
   uint32_t next_timer_id;
   uint64_t last_dispatch_time;
   timer_get_time_t get_time;
 
-  slist_t timers;
+  /*private*/
+  /*按到期时间排列的最小堆*/
+  darray_t timers;
+  /*按id索引的开放寻址哈希表*/
+  timer_info_t** index;
+  uint32_t index_capacity;
+  uint32_t index_size;
 };
 
 /**
@@ -154,6 +164,15 @@ ret_t timer_manager_all_remove_by_ctx(timer_manager_t* timer_manager, void* ctx)
  */
 ret_t timer_manager_reset(timer_manager_t* timer_manager, uint32_t timer_id);
 
+/**
+ * @method timer_manager_update
+ * 直接修改定时器的start、duration或suspend之后，调用本函数更新它的到期时间。
+ * @param {timer_manager_t*} timer_manager 定时器管理器对象。
+ * @param {uint32_t} timer_id timer_id。
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t timer_manager_update(timer_manager_t* timer_manager, uint32_t timer_id);
+
 /**
  * @method timer_manager_find
  * 查找指定ID的定时器。
@@ -185,6 +204,7 @@ uint32_t timer_manager_count(timer_manager_t* timer_manager);
 /**
  * @method timer_manager_next_time
  * 返回最近的定时器到期时间(毫秒)。
+ *> 没有定时器(或者全部被挂起)时返回当前时间加上0xffff，主循环可以据此决定睡眠的时间。
  * @param {timer_manager_t*} timer_manager 定时器管理器对象。
  *
  * @return {uint64_t} 返回最近的timer到期时间(毫秒)。
@@ -19,12 +19,25 @@
  *
  */
 
+#include "tkc/mem.h"
 #include "tkc/buffer.h"
 #include "tkc/object_array.h"
 #include "ubjson/ubjson_parser.h"
 
 #define MAX_LEVEL 10
 
+#ifndef UBJSON_PARSER_READER_BUFF_SIZE
+#define UBJSON_PARSER_READER_BUFF_SIZE 4096
+#endif /*UBJSON_PARSER_READER_BUFF_SIZE*/
+
+typedef struct _ubjson_data_reader_t {
+  data_reader_t* reader;
+  uint64_t offset;
+  uint32_t cursor;
+  uint32_t end;
+  uint8_t buff[UBJSON_PARSER_READER_BUFF_SIZE];
+} ubjson_data_reader_t;
+
 typedef struct _ubjson_parser_t {
   str_t temp;
   rbuffer_t rb;
@@ -90,10 +103,50 @@ static ret_t ubjson_parser_pop(ubjson_parser_t* parser) {
   return RET_OK;
 }
 
-static ubjson_parser_t* ubjson_parser_init(ubjson_parser_t* parser, void* data, uint32_t size,
-                                           ubjson_on_key_value_t on_key_value, void* ctx) {
+/*从data_reader中分块读取，大块数据直接读到目标缓冲区*/
+static ret_t ubjson_data_reader_read(ubjson_data_reader_t* r, void* data, uint32_t size) {
+  uint8_t* p = (uint8_t*)data;
+  bool_t has_data = FALSE;
+
+  while (size > 0) {
+    uint32_t n = 0;
+
+    if (r->cursor >= r->end) {
+      int32_t rsize = 0;
+      if (size >= sizeof(r->buff)) {
+        rsize = data_reader_read(r->reader, r->offset, p, size);
+        if (rsize == (int32_t)size) {
+          r->offset += size;
+          return RET_OK;
+        }
+        return RET_FAIL;
+      }
+
+      rsize = data_reader_read(r->reader, r->offset, r->buff, sizeof(r->buff));
+      if (rsize <= 0) {
+        return has_data ? RET_FAIL : RET_DONE;
+      }
+      r->offset += rsize;
+      r->cursor = 0;
+      r->end = rsize;
+    }
+
+    n = tk_min(size, r->end - r->cursor);
+    memcpy(p, r->buff + r->cursor, n);
+    r->cursor += n;
+    p += n;
+    size -= n;
+    has_data = TRUE;
+  }
+
+  return RET_OK;
+}
+
+static ubjson_parser_t* ubjson_parser_init_with_read(ubjson_parser_t* parser,
+                                                     ubjson_read_callback_t read, void* read_ctx,
+                                                     ubjson_on_key_value_t on_key_value,
+                                                     void* ctx) {
   str_t* temp = &(parser->temp);
-  rbuffer_t* rb = &(parser->rb);
   ubjson_reader_t* reader = &(parser->reader);
 
   memset(parser, 0x00, sizeof(ubjson_parser_t));
@@ -102,8 +155,17 @@ static ubjson_parser_t* ubjson_parser_init(ubjson_parser_t* parser, void* data,
   parser->on_key_value = on_key_value;
 
   str_init(temp, 64);
-  rbuffer_init(rb, data, size);
-  ubjson_reader_init(reader, (ubjson_read_callback_t)rbuffer_read_binary_if_has_more, rb);
+  ubjson_reader_init(reader, read, read_ctx);
+
+  return parser;
+}
+
+static ubjson_parser_t* ubjson_parser_init(ubjson_parser_t* parser, void* data, uint32_t size,
+                                           ubjson_on_key_value_t on_key_value, void* ctx) {
+  ubjson_parser_init_with_read(parser,
+                               (ubjson_read_callback_t)rbuffer_read_binary_if_has_more,
+                               &(parser->rb), on_key_value, ctx);
+  rbuffer_init(&(parser->rb), data, size);
 
   return parser;
 }
@@ -535,6 +597,24 @@ ret_t ubjson_parse(void* data, uint32_t size, ubjson_on_key_value_t on_key_value
   return RET_OK;
 }
 
+ret_t ubjson_parse_reader(data_reader_t* reader, ubjson_on_key_value_t on_key_value, void* ctx) {
+  ubjson_parser_t parser;
+  ubjson_data_reader_t* r = NULL;
+  return_value_if_fail(reader != NULL && on_key_value != NULL, RET_BAD_PARAMS);
+
+  r = TKMEM_ZALLOC(ubjson_data_reader_t);
+  return_value_if_fail(r != NULL, RET_OOM);
+
+  r->reader = reader;
+  ubjson_parser_init_with_read(&parser, (ubjson_read_callback_t)ubjson_data_reader_read, r,
+                               on_key_value, ctx);
+  ubjson_do_parse(&parser);
+  ubjson_parser_deinit(&parser);
+  TKMEM_FREE(r);
+
+  return RET_OK;
+}
+
 ret_t ubjson_dump(void* data, uint32_t size) {
   dump_ctx_t ctx = {0};
 
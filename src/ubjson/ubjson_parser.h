@@ -23,6 +23,7 @@
 #define TK_UBJSON_PARSER_H
 
 #include "tkc/object_default.h"
+#include "tkc/data_reader.h"
 #include "ubjson/ubjson_reader.h"
 
 BEGIN_C_DECLS
@@ -50,6 +51,21 @@ typedef ret_t (*ubjson_on_key_value_t)(void* ctx, const char* key, value_t* valu
  */
 ret_t ubjson_parse(void* data, uint32_t size, ubjson_on_key_value_t on_key_value, void* ctx);
 
+/**
+ * @method ubjson_parse_reader
+ * @annotation ["static"]
+ *
+ * 从data\_reader中分块读取并解析ubjson数据，遇到key/value时调用提供的回调函数。
+ * > 不需要把全部数据读到内存中。
+ *
+ * @param {data_reader_t*} reader 数据读取器。
+ * @param {ubjson_on_key_value_t} on_key_value 回调函数。
+ * @param {void*} ctx 回调函数的上下文。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t ubjson_parse_reader(data_reader_t* reader, ubjson_on_key_value_t on_key_value, void* ctx);
+
 /**
  * @method ubjson_to_object
  * @annotation ["static"]
@@ -23,7 +23,9 @@
 #include "base/enums.h"
 #include "tkc/utf8.h"
 #include "tkc/value.h"
+#include "base/style.h"
 #include "base/ui_builder.h"
+#include "base/widget_prop_atom.h"
 #include "ui_loader/ui_loader_default.h"
 #include "ui_loader/ui_binary_writer.h"
 
@@ -39,6 +41,121 @@ static ret_t ui_binary_writer_on_widget_prop(ui_builder_t* b, const char* name,
   return wbuffer_write_string(writer->wbuffer, value);
 }
 
+static uint8_t ui_binary_writer_style_type(const char* name, const char* value, int32_t* i) {
+  value_t v;
+  uint8_t type = UI_PROP_TYPE_STR;
+  const char* style_name = strchr(name, ':');
+
+  if (style_name == NULL) {
+    style_name = strchr(name, '.');
+  }
+  style_name = style_name != NULL ? style_name + 1 : name;
+
+  value_set_int(&v, 0);
+  if (style_normalize_value(style_name, value, &v) == RET_OK) {
+    if (v.type == VALUE_TYPE_INT32 || v.type == VALUE_TYPE_UINT32) {
+      *i = value_int(&v);
+      type = UI_PROP_TYPE_INT;
+    }
+  }
+  value_reset(&v);
+
+  return type;
+}
+
+/*
+ * 只转换由widget.c统一处理，并且只按value_int/value_bool读取的属性，
+ * 以及style(widget_set_style对非字符串的值只保存整数)，其它属性仍保存为字符串。
+ */
+static uint8_t ui_binary_writer_prop_type(const char* name, widget_prop_atom_t atom,
+                                          const char* value, int32_t* i) {
+  switch (atom) {
+    case WIDGET_PROP_ATOM_X:
+    case WIDGET_PROP_ATOM_Y:
+    case WIDGET_PROP_ATOM_W:
+    case WIDGET_PROP_ATOM_H:
+    case WIDGET_PROP_ATOM_OPACITY:
+    case WIDGET_PROP_ATOM_DIRTY_RECT_TOLERANCE: {
+      *i = tk_atoi(value);
+      return UI_PROP_TYPE_INT;
+    }
+    case WIDGET_PROP_ATOM_VISIBLE:
+    case WIDGET_PROP_ATOM_SENSITIVE:
+    case WIDGET_PROP_ATOM_FLOATING:
+    case WIDGET_PROP_ATOM_CACHE_AS_BITMAP:
+    case WIDGET_PROP_ATOM_FOCUSABLE:
+    case WIDGET_PROP_ATOM_WITH_FOCUS_STATE:
+    case WIDGET_PROP_ATOM_ENABLE:
+    case WIDGET_PROP_ATOM_FEEDBACK:
+    case WIDGET_PROP_ATOM_AUTO_ADJUST_SIZE:
+    case WIDGET_PROP_ATOM_STATE_FROM_PARENT_SYNC:
+    case WIDGET_PROP_ATOM_SYNC_STATE_TO_CHILDREN: {
+      *i = tk_atob(value);
+      return UI_PROP_TYPE_BOOL;
+    }
+    default: {
+      if (tk_str_start_with(name, "style:") || tk_str_start_with(name, "style.")) {
+        return ui_binary_writer_style_type(name + 6, value, i);
+      }
+      return UI_PROP_TYPE_STR;
+    }
+  }
+}
+
+static ret_t ui_binary_writer_write_prop_v2(wbuffer_t* wbuffer, const char* name, uint8_t type,
+                                            int32_t i, const char* str) {
+  widget_prop_atom_t atom = widget_prop_atom_from_name(name);
+
+  if (atom != WIDGET_PROP_ATOM_NONE) {
+    wbuffer_write_uint8(wbuffer, type | UI_PROP_FLAG_ATOM);
+    wbuffer_write_uint8(wbuffer, (uint8_t)atom);
+  } else {
+    wbuffer_write_uint8(wbuffer, type);
+    wbuffer_write_string(wbuffer, name);
+  }
+
+  switch (type) {
+    case UI_PROP_TYPE_INT: {
+      return wbuffer_write_int32(wbuffer, i);
+    }
+    case UI_PROP_TYPE_BOOL: {
+      return wbuffer_write_uint8(wbuffer, i != 0);
+    }
+    default: {
+      return wbuffer_write_string(wbuffer, str);
+    }
+  }
+}
+
+static ret_t ui_binary_writer_on_widget_prop_v2(ui_builder_t* b, const char* name,
+                                                const char* value) {
+  int32_t i = 0;
+  uint8_t type = UI_PROP_TYPE_STR;
+  ui_binary_writer_t* writer = (ui_binary_writer_t*)b;
+
+  type = ui_binary_writer_prop_type(name, widget_prop_atom_from_name(name), value, &i);
+
+  return ui_binary_writer_write_prop_v2(writer->wbuffer, name, type, i, value);
+}
+
+static ret_t ui_binary_writer_on_widget_prop_value_v2(ui_builder_t* b, const char* name,
+                                                      const value_t* value) {
+  char str[64];
+  ui_binary_writer_t* writer = (ui_binary_writer_t*)b;
+
+  if (value->type == VALUE_TYPE_BOOL) {
+    return ui_binary_writer_write_prop_v2(writer->wbuffer, name, UI_PROP_TYPE_BOOL,
+                                          value_bool(value), NULL);
+  } else if (value->type == VALUE_TYPE_INT32) {
+    return ui_binary_writer_write_prop_v2(writer->wbuffer, name, UI_PROP_TYPE_INT,
+                                          value_int(value), NULL);
+  } else if (value->type == VALUE_TYPE_STRING) {
+    return ui_binary_writer_on_widget_prop_v2(b, name, value_str(value));
+  } else {
+    return ui_binary_writer_on_widget_prop_v2(b, name, value_str_ex(value, str, sizeof(str)));
+  }
+}
+
 static ret_t ui_binary_writer_on_widget_prop_end(ui_builder_t* b) {
   ui_binary_writer_t* writer = (ui_binary_writer_t*)b;
 
@@ -52,17 +169,29 @@ static ret_t ui_binary_writer_on_widget_end(ui_builder_t* b) {
 }
 
 ui_builder_t* ui_binary_writer_init(ui_binary_writer_t* writer, wbuffer_t* wbuffer) {
+  return ui_binary_writer_init_ex(writer, wbuffer, 1);
+}
+
+ui_builder_t* ui_binary_writer_init_ex(ui_binary_writer_t* writer, wbuffer_t* wbuffer,
+                                       uint32_t version) {
   return_value_if_fail(writer != NULL && wbuffer != NULL, NULL);
+  return_value_if_fail(version == 1 || version == 2, NULL);
 
   memset(writer, 0x00, sizeof(ui_binary_writer_t));
 
   writer->wbuffer = wbuffer;
+  writer->version = version;
   writer->builder.on_widget_start = ui_binary_writer_on_widget_start;
-  writer->builder.on_widget_prop = ui_binary_writer_on_widget_prop;
+  if (version == 2) {
+    writer->builder.on_widget_prop = ui_binary_writer_on_widget_prop_v2;
+    writer->builder.on_widget_prop_value = ui_binary_writer_on_widget_prop_value_v2;
+  } else {
+    writer->builder.on_widget_prop = ui_binary_writer_on_widget_prop;
+  }
   writer->builder.on_widget_prop_end = ui_binary_writer_on_widget_prop_end;
   writer->builder.on_widget_end = ui_binary_writer_on_widget_end;
 
-  wbuffer_write_uint32(wbuffer, UI_DATA_MAGIC);
+  wbuffer_write_uint32(wbuffer, version == 2 ? UI_DATA_MAGIC_V2 : UI_DATA_MAGIC);
 
   return &(writer->builder);
 }
@@ -37,6 +37,7 @@ BEGIN_C_DECLS
 typedef struct _ui_binary_writer_t {
   ui_builder_t builder;
   wbuffer_t* wbuffer;
+  uint32_t version;
 } ui_binary_writer_t;
 
 /**
@@ -52,6 +53,25 @@ typedef struct _ui_binary_writer_t {
  */
 ui_builder_t* ui_binary_writer_init(ui_binary_writer_t* writer, wbuffer_t* wbuffer);
 
+/**
+ * @method ui_binary_writer_init_ex
+ * @annotation ["constructor"]
+ *
+ * 初始化ui\_binary\_writer对象，并指定生成数据的格式版本。
+ *
+ * > v2格式把内置属性名保存为atom，并在生成时把已知类型的属性值(如visible、opacity、
+ * 颜色和枚举类型的style)转换好，加载时不再需要解析字符串。v2格式只用于加载，
+ * 转换回XML时不保证与原来的字符串完全一致。
+ *
+ * @param {ui_binary_writer_t*} writer writer对象。
+ * @param {wbuffer_t*} wbuffer 保存结果的buffer。
+ * @param {uint32_t} version 格式版本(1或2)。
+ *
+ * @return {ui_builder_t*} 返回ui\_builder对象。
+ */
+ui_builder_t* ui_binary_writer_init_ex(ui_binary_writer_t* writer, wbuffer_t* wbuffer,
+                                       uint32_t version);
+
 END_C_DECLS
 
 #endif /*TK_UI_BINARY_WRITER_H*/
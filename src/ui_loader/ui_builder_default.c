@@ -20,13 +20,179 @@
  */
 
 #include "tkc/utf8.h"
+#include "tkc/darray.h"
 #include "base/enums.h"
 #include "base/dialog.h"
 #include "base/widget_factory.h"
 #include "base/window_manager.h"
+#include "ui_loader/ui_binary_writer.h"
 #include "ui_loader/ui_builder_default.h"
 #include "ui_loader/ui_loader_default.h"
 
+typedef struct _ui_builder_default_t {
+  ui_builder_t builder;
+
+  /*设置了lazy_children的容器*/
+  darray_t lazy_parents;
+  /*正在记录子树的控件*/
+  widget_t* lazy_widget;
+  uint32_t lazy_depth;
+  bool_t lazy_idle;
+  wbuffer_t* lazy_wbuffer;
+  ui_binary_writer_t lazy_writer;
+  /*是否有需要在空闲时创建的子树*/
+  bool_t has_lazy_idle;
+  /*是否在创建延迟的子树*/
+  bool_t replaying;
+} ui_builder_default_t;
+
+typedef struct _ui_lazy_children_t {
+  wbuffer_t wbuffer;
+  bool_t idle;
+} ui_lazy_children_t;
+
+#define UI_BUILDER_DEFAULT(b) ((ui_builder_default_t*)(b))
+
+static ret_t ui_builder_default_lazy_load(widget_t* widget, ui_lazy_children_t* lazy);
+
+static ret_t ui_lazy_children_on_destroy(void* data) {
+  emitter_item_t* item = (emitter_item_t*)data;
+  ui_lazy_children_t* lazy = (ui_lazy_children_t*)(item->ctx);
+
+  wbuffer_deinit(&(lazy->wbuffer));
+  TKMEM_FREE(lazy);
+
+  return RET_OK;
+}
+
+static ret_t ui_lazy_children_on_before_paint(void* ctx, event_t* e) {
+  ui_builder_default_lazy_load(WIDGET(e->target), (ui_lazy_children_t*)ctx);
+
+  return RET_REMOVE;
+}
+
+static emitter_item_t* ui_lazy_children_find(widget_t* widget) {
+  uint32_t i = 0;
+  uint32_t n = 0;
+
+  if (widget->emitter == NULL) {
+    return NULL;
+  }
+
+  n = emitter_size(widget->emitter);
+  for (i = 0; i < n; i++) {
+    emitter_item_t* item = emitter_get_item(widget->emitter, i);
+    if (item != NULL && item->handler == ui_lazy_children_on_before_paint && !item->pending_remove) {
+      return item;
+    }
+  }
+
+  return NULL;
+}
+
+static ret_t ui_lazy_children_on_visit(void* ctx, const void* data) {
+  widget_t* widget = WIDGET(data);
+  emitter_item_t* item = ui_lazy_children_find(widget);
+
+  if (item != NULL && ((ui_lazy_children_t*)(item->ctx))->idle) {
+    *(widget_t**)ctx = widget;
+    return RET_STOP;
+  }
+
+  return RET_OK;
+}
+
+static ret_t ui_lazy_children_on_idle(const idle_info_t* info) {
+  widget_t* widget = NULL;
+
+  widget_foreach(WIDGET(info->ctx), ui_lazy_children_on_visit, &widget);
+  if (widget == NULL) {
+    return RET_REMOVE;
+  }
+
+  ui_builder_default_load_lazy_children(widget, FALSE);
+
+  return RET_REPEAT;
+}
+
+static ret_t ui_lazy_children_on_paint_done(void* ctx, event_t* e) {
+  widget_add_idle(WIDGET(e->target), ui_lazy_children_on_idle);
+
+  return RET_REMOVE;
+}
+
+static bool_t ui_builder_default_is_lazy_parent(widget_t* widget, bool_t* idle) {
+  value_t v;
+
+  *idle = FALSE;
+  if (widget_get_prop(widget, WIDGET_PROP_LAZY_CHILDREN, &v) != RET_OK) {
+    return FALSE;
+  }
+
+  if (v.type == VALUE_TYPE_STRING && tk_str_eq(value_str(&v), "idle")) {
+    *idle = TRUE;
+    return TRUE;
+  }
+
+  return value_bool(&v);
+}
+
+static ret_t ui_builder_default_lazy_start(ui_builder_default_t* builder, widget_t* widget) {
+  bool_t idle = FALSE;
+  widget_t* parent = widget->parent;
+
+  if (builder->lazy_parents.size == 0 || parent == NULL ||
+      darray_find_index(&(builder->lazy_parents), parent) < 0) {
+    return RET_OK;
+  }
+
+  ui_builder_default_is_lazy_parent(parent, &idle);
+  builder->lazy_wbuffer = TKMEM_ZALLOC(wbuffer_t);
+  return_value_if_fail(builder->lazy_wbuffer != NULL, RET_OOM);
+
+  wbuffer_init_extendable(builder->lazy_wbuffer);
+  ui_binary_writer_init_ex(&(builder->lazy_writer), builder->lazy_wbuffer, 2);
+  builder->lazy_widget = widget;
+  builder->lazy_idle = idle;
+  builder->lazy_depth = 0;
+
+  return RET_OK;
+}
+
+static ret_t ui_builder_default_lazy_end(ui_builder_default_t* builder) {
+  widget_t* widget = builder->lazy_widget;
+  wbuffer_t* wbuffer = builder->lazy_wbuffer;
+
+  builder->lazy_widget = NULL;
+  builder->lazy_wbuffer = NULL;
+
+  /*只有magic，没有子控件*/
+  if (wbuffer->cursor > sizeof(uint32_t)) {
+    ui_lazy_children_t* lazy = TKMEM_ZALLOC(ui_lazy_children_t);
+
+    if (lazy != NULL) {
+      uint32_t id = 0;
+
+      lazy->wbuffer = *wbuffer;
+      lazy->idle = builder->lazy_idle;
+      id = widget_on(widget, EVT_BEFORE_PAINT, ui_lazy_children_on_before_paint, lazy);
+      emitter_set_on_destroy(widget->emitter, id, ui_lazy_children_on_destroy, NULL);
+      TKMEM_FREE(wbuffer);
+
+      if (lazy->idle) {
+        builder->has_lazy_idle = TRUE;
+      }
+
+      return RET_OK;
+    }
+  }
+
+  wbuffer_deinit(wbuffer);
+  TKMEM_FREE(wbuffer);
+
+  return RET_OK;
+}
+
 static ret_t ui_builder_default_on_widget_start(ui_builder_t* b, const widget_desc_t* desc) {
   const rect_t* layout = &(desc->layout);
 
@@ -37,6 +203,12 @@ static ret_t ui_builder_default_on_widget_start(ui_builder_t* b, const widget_de
   widget_t* widget = NULL;
   widget_t* parent = b->widget;
   const char* type = desc->type;
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  if (builder->lazy_widget != NULL) {
+    builder->lazy_depth++;
+    return ui_builder_on_widget_start(&(builder->lazy_writer.builder), desc);
+  }
 
   widget = widget_factory_create_widget(widget_factory(), type, parent, x, y, w, h);
   if (widget == NULL) {
@@ -54,20 +226,54 @@ static ret_t ui_builder_default_on_widget_start(ui_builder_t* b, const widget_de
   return RET_OK;
 }
 
+static ret_t ui_builder_default_on_widget_prop_value(ui_builder_t* b, const char* name,
+                                                     const value_t* value) {
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  if (builder->lazy_widget != NULL) {
+    return ui_builder_on_widget_prop_value(&(builder->lazy_writer.builder), name, value);
+  }
+
+  widget_set_prop(b->widget, name, value);
+  if (tk_str_eq(name, WIDGET_PROP_LAZY_CHILDREN)) {
+    bool_t idle = FALSE;
+    if (ui_builder_default_is_lazy_parent(b->widget, &idle)) {
+      darray_push(&(builder->lazy_parents), b->widget);
+    }
+  }
+
+  return RET_OK;
+}
+
 static ret_t ui_builder_default_on_widget_prop(ui_builder_t* b, const char* name,
                                                const char* value) {
   value_t v;
   value_set_str(&v, value);
-  widget_set_prop(b->widget, name, &v);
 
-  return RET_OK;
+  return ui_builder_default_on_widget_prop_value(b, name, &v);
 }
 
 static ret_t ui_builder_default_on_widget_prop_end(ui_builder_t* b) {
-  return RET_OK;
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  if (builder->lazy_widget != NULL) {
+    return ui_builder_on_widget_prop_end(&(builder->lazy_writer.builder));
+  }
+
+  return ui_builder_default_lazy_start(builder, b->widget);
 }
 
 static ret_t ui_builder_default_on_widget_end(ui_builder_t* b) {
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  if (builder->lazy_widget != NULL) {
+    if (builder->lazy_depth > 0) {
+      builder->lazy_depth--;
+      return ui_builder_on_widget_end(&(builder->lazy_writer.builder));
+    }
+    ui_builder_default_lazy_end(builder);
+  }
+
   if (b->widget != NULL) {
     event_t e = event_init(EVT_WIDGET_LOAD, NULL);
     widget_dispatch(b->widget, &e);
@@ -79,9 +285,38 @@ static ret_t ui_builder_default_on_widget_end(ui_builder_t* b) {
   return RET_OK;
 }
 
+static ret_t ui_builder_default_on_replay_end(ui_builder_t* b) {
+  widget_t* widget = b->root;
+  widget_t* win = widget_get_window(widget);
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  widget_layout_children(widget);
+  widget_invalidate_force(widget, NULL);
+
+  if (win != NULL) {
+    event_t e = event_init(EVT_WINDOW_LOAD, win);
+
+    WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+    widget_dispatch_recursive(iter, &e);
+    WIDGET_FOR_EACH_CHILD_END();
+  }
+
+  if (builder->has_lazy_idle) {
+    widget_add_idle(win != NULL ? win : widget, ui_lazy_children_on_idle);
+  }
+
+  return RET_OK;
+}
+
 static ret_t ui_builder_default_on_end(ui_builder_t* b) {
   ENSURE(b);
   widget_t* widget = b->root;
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  if (builder->replaying) {
+    return ui_builder_default_on_replay_end(b);
+  }
+
   if (widget != NULL) {
     widget_t* wm = window_manager();
     event_t e;
@@ -105,27 +340,78 @@ static ret_t ui_builder_default_on_end(ui_builder_t* b) {
     }
 
     widget->loading = FALSE;
+
+    if (builder->has_lazy_idle) {
+      widget_on(widget, EVT_PAINT_DONE, ui_lazy_children_on_paint_done, NULL);
+    }
   }
 
   return RET_OK;
 }
 
 static ret_t ui_builder_default_destroy(ui_builder_t* b) {
-  TKMEM_FREE(b);
+  ui_builder_default_t* builder = UI_BUILDER_DEFAULT(b);
+
+  if (builder->lazy_wbuffer != NULL) {
+    wbuffer_deinit(builder->lazy_wbuffer);
+    TKMEM_FREE(builder->lazy_wbuffer);
+  }
+  darray_deinit(&(builder->lazy_parents));
+  TKMEM_FREE(builder);
+
   return RET_OK;
 }
 
 ui_builder_t* ui_builder_default_create(const char* name) {
-  ui_builder_t* builder = TKMEM_ZALLOC(ui_builder_t);
+  ui_builder_default_t* builder = TKMEM_ZALLOC(ui_builder_default_t);
   return_value_if_fail(builder != NULL, NULL);
 
-  builder->on_widget_start = ui_builder_default_on_widget_start;
-  builder->on_widget_prop = ui_builder_default_on_widget_prop;
-  builder->on_widget_prop_end = ui_builder_default_on_widget_prop_end;
-  builder->on_widget_end = ui_builder_default_on_widget_end;
-  builder->on_end = ui_builder_default_on_end;
-  builder->destroy = ui_builder_default_destroy;
-  builder->name = name;
+  builder->builder.on_widget_start = ui_builder_default_on_widget_start;
+  builder->builder.on_widget_prop = ui_builder_default_on_widget_prop;
+  builder->builder.on_widget_prop_value = ui_builder_default_on_widget_prop_value;
+  builder->builder.on_widget_prop_end = ui_builder_default_on_widget_prop_end;
+  builder->builder.on_widget_end = ui_builder_default_on_widget_end;
+  builder->builder.on_end = ui_builder_default_on_end;
+  builder->builder.destroy = ui_builder_default_destroy;
+  builder->builder.name = name;
+  darray_init(&(builder->lazy_parents), 2, NULL, NULL);
+
+  return &(builder->builder);
+}
+
+static ret_t ui_builder_default_lazy_load(widget_t* widget, ui_lazy_children_t* lazy) {
+  bool_t idle = FALSE;
+  ui_builder_t* b = ui_builder_default_create(NULL);
+  return_value_if_fail(b != NULL, RET_OOM);
+
+  UI_BUILDER_DEFAULT(b)->replaying = TRUE;
+  b->root = widget;
+  b->widget = widget;
+  if (ui_builder_default_is_lazy_parent(widget, &idle)) {
+    darray_push(&(UI_BUILDER_DEFAULT(b)->lazy_parents), widget);
+  }
+
+  ui_loader_load(default_ui_loader(), lazy->wbuffer.data, lazy->wbuffer.cursor, b);
+  ui_builder_destroy(b);
 
-  return builder;
+  return RET_OK;
+}
+
+ret_t ui_builder_default_load_lazy_children(widget_t* widget, bool_t recursive) {
+  emitter_item_t* item = NULL;
+  return_value_if_fail(widget != NULL, RET_BAD_PARAMS);
+
+  item = ui_lazy_children_find(widget);
+  if (item != NULL) {
+    ui_builder_default_lazy_load(widget, (ui_lazy_children_t*)(item->ctx));
+    emitter_off(widget->emitter, item->id);
+  }
+
+  if (recursive) {
+    WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+    ui_builder_default_load_lazy_children(iter, TRUE);
+    WIDGET_FOR_EACH_CHILD_END();
+  }
+
+  return RET_OK;
 }
@@ -48,6 +48,20 @@ BEGIN_C_DECLS
  */
 ui_builder_t* ui_builder_default_create(const char* name);
 
+/**
+ * @method ui_builder_default_load_lazy_children
+ *
+ * 立即创建控件被延迟创建的子控件(参考WIDGET\_PROP\_LAZY\_CHILDREN)。
+ *
+ * > 延迟创建的子控件在创建前用widget\_lookup是找不到的，需要时可以先调用本函数。
+ *
+ * @param {widget_t*} widget 控件对象。
+ * @param {bool_t} recursive 是否递归处理全部子控件。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t ui_builder_default_load_lazy_children(widget_t* widget, bool_t recursive);
+
 widget_t* window_open(const char* name);
 widget_t* dialog_open(const char* name);
 widget_t* window_open_and_close(const char* name, widget_t* to_close);
@@ -21,33 +21,97 @@
 
 #include "tkc/mem.h"
 #include "tkc/buffer.h"
+#include "base/widget_prop_atom.h"
 #include "ui_loader/ui_loader_default.h"
 
+static ret_t ui_loader_load_props(rbuffer_t* rbuffer, ui_builder_t* b) {
+  const char* key = NULL;
+  const char* value = NULL;
+
+  return_value_if_fail(rbuffer_read_string(rbuffer, &key) == RET_OK, RET_BAD_PARAMS);
+  while (*key) {
+    return_value_if_fail(rbuffer_read_string(rbuffer, &value) == RET_OK, RET_BAD_PARAMS);
+    ui_builder_on_widget_prop(b, key, value);
+    return_value_if_fail(rbuffer_read_string(rbuffer, &key) == RET_OK, RET_BAD_PARAMS);
+  }
+
+  return RET_OK;
+}
+
+static ret_t ui_loader_load_props_v2(rbuffer_t* rbuffer, ui_builder_t* b) {
+  uint8_t flags = 0;
+
+  return_value_if_fail(rbuffer_read_uint8(rbuffer, &flags) == RET_OK, RET_BAD_PARAMS);
+  while (flags != 0) {
+    value_t v;
+    const char* name = NULL;
+
+    if (flags & UI_PROP_FLAG_ATOM) {
+      uint8_t atom = 0;
+      return_value_if_fail(rbuffer_read_uint8(rbuffer, &atom) == RET_OK, RET_BAD_PARAMS);
+      name = widget_prop_atom_to_name((widget_prop_atom_t)atom);
+      return_value_if_fail(name != NULL, RET_BAD_PARAMS);
+    } else {
+      return_value_if_fail(rbuffer_read_string(rbuffer, &name) == RET_OK, RET_BAD_PARAMS);
+    }
+
+    switch (flags & UI_PROP_TYPE_MASK) {
+      case UI_PROP_TYPE_INT: {
+        int32_t i = 0;
+        return_value_if_fail(rbuffer_read_int32(rbuffer, &i) == RET_OK, RET_BAD_PARAMS);
+        value_set_int(&v, i);
+        break;
+      }
+      case UI_PROP_TYPE_BOOL: {
+        uint8_t u8 = 0;
+        return_value_if_fail(rbuffer_read_uint8(rbuffer, &u8) == RET_OK, RET_BAD_PARAMS);
+        value_set_bool(&v, u8 != 0);
+        break;
+      }
+      case UI_PROP_TYPE_STR: {
+        const char* str = NULL;
+        return_value_if_fail(rbuffer_read_string(rbuffer, &str) == RET_OK, RET_BAD_PARAMS);
+        value_set_str(&v, str);
+        break;
+      }
+      default: {
+        log_warn("%s: invalid prop flags %x\n", __FUNCTION__, flags);
+        return RET_BAD_PARAMS;
+      }
+    }
+
+    ui_builder_on_widget_prop_value(b, name, &v);
+    return_value_if_fail(rbuffer_read_uint8(rbuffer, &flags) == RET_OK, RET_BAD_PARAMS);
+  }
+
+  return RET_OK;
+}
+
 ret_t ui_loader_load_default(ui_loader_t* loader, const uint8_t* data, uint32_t size,
                              ui_builder_t* b) {
   rbuffer_t rbuffer;
   widget_desc_t desc;
   uint32_t magic = 0;
+  bool_t v2 = FALSE;
   uint8_t widget_end_mark = 0;
 
   return_value_if_fail(loader != NULL && data != NULL && b != NULL, RET_BAD_PARAMS);
   return_value_if_fail(rbuffer_init(&rbuffer, data, size) != NULL, RET_BAD_PARAMS);
   return_value_if_fail(rbuffer_read_uint32(&rbuffer, &magic) == RET_OK, RET_BAD_PARAMS);
-  return_value_if_fail(magic == UI_DATA_MAGIC, RET_BAD_PARAMS);
+  return_value_if_fail(magic == UI_DATA_MAGIC || magic == UI_DATA_MAGIC_V2, RET_BAD_PARAMS);
+
+  v2 = magic == UI_DATA_MAGIC_V2;
 
   ui_builder_on_start(b);
   while ((rbuffer.cursor + sizeof(desc)) <= rbuffer.capacity) {
-    const char* key = NULL;
-    const char* value = NULL;
     return_value_if_fail(rbuffer_read_binary(&rbuffer, &desc, sizeof(desc)) == RET_OK,
                          RET_BAD_PARAMS);
     ui_builder_on_widget_start(b, &desc);
 
-    return_value_if_fail(rbuffer_read_string(&rbuffer, &key) == RET_OK, RET_BAD_PARAMS);
-    while (*key) {
-      return_value_if_fail(rbuffer_read_string(&rbuffer, &value) == RET_OK, RET_BAD_PARAMS);
-      ui_builder_on_widget_prop(b, key, value);
-      return_value_if_fail(rbuffer_read_string(&rbuffer, &key) == RET_OK, RET_BAD_PARAMS);
+    if (v2) {
+      return_value_if_fail(ui_loader_load_props_v2(&rbuffer, b) == RET_OK, RET_BAD_PARAMS);
+    } else {
+      return_value_if_fail(ui_loader_load_props(&rbuffer, b) == RET_OK, RET_BAD_PARAMS);
     }
     ui_builder_on_widget_prop_end(b);
 
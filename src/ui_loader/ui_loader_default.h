@@ -32,6 +32,14 @@ BEGIN_C_DECLS
  *
  * 二进制格式的UI资源加载器。
  *
+ * 支持两种格式：
+ *
+ * * v1(UI\_DATA\_MAGIC)：属性名和属性值都是字符串。
+ *
+ * * v2(UI\_DATA\_MAGIC\_V2)：每个属性以一个字节的标志开头，低4位为值的类型，
+ * 最高位为1时属性名为一个字节的widget\_prop\_atom\_t，否则为字符串。
+ * 标志为0表示属性结束。
+ *
  * @annotation["fake"]
  *
  */
@@ -48,6 +56,13 @@ BEGIN_C_DECLS
 
 ui_loader_t* default_ui_loader(void);
 
+/*v2格式中属性的标志*/
+#define UI_PROP_FLAG_ATOM 0x80
+#define UI_PROP_TYPE_MASK 0x0f
+#define UI_PROP_TYPE_STR 0x01
+#define UI_PROP_TYPE_INT 0x02
+#define UI_PROP_TYPE_BOOL 0x03
+
 END_C_DECLS
 
 #endif /*TK_UI_LOADER_DEFAULT_H*/
@@ -310,28 +310,38 @@ static ret_t button_get_prop(widget_t* widget, const char* name, value_t* v) {
   button_t* button = BUTTON(widget);
   return_value_if_fail(button != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_REPEAT)) {
-    value_set_int(v, button->repeat);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LONG_PRESS_TIME)) {
-    value_set_int(v, button->long_press_time);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ENABLE_LONG_PRESS)) {
-    value_set_bool(v, button->enable_long_press);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ENABLE_PREVIEW)) {
-    value_set_bool(v, button->enable_preview);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_STATE_FOR_STYLE)) {
-    if (button->is_accept_status) {
-      if (widget->visible && widget->sensitive && widget->enable) {
-        value_set_str(v, WIDGET_STATE_FOCUSED);
-        return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_REPEAT: {
+      value_set_int(v, button->repeat);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_LONG_PRESS_TIME: {
+      value_set_int(v, button->long_press_time);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ENABLE_LONG_PRESS: {
+      value_set_bool(v, button->enable_long_press);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ENABLE_PREVIEW: {
+      value_set_bool(v, button->enable_preview);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_STATE_FOR_STYLE: {
+      if (button->is_accept_status) {
+        if (widget->visible && widget->sensitive && widget->enable) {
+          value_set_str(v, WIDGET_STATE_FOCUSED);
+          return RET_OK;
+        }
       }
+      break;
     }
-  } else if (tk_str_eq(name, WIDGET_PROP_IS_ACCEPT_STATUS)) {
-    value_set_bool(v, button->is_accept_status);
-    return RET_OK;
+    case WIDGET_PROP_ATOM_IS_ACCEPT_STATUS: {
+      value_set_bool(v, button->is_accept_status);
+      return RET_OK;
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -361,17 +371,25 @@ static ret_t button_set_prop(widget_t* widget, const char* name, const value_t*
   button_t* button = BUTTON(widget);
   return_value_if_fail(button != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_REPEAT)) {
-    return button_set_repeat(widget, value_int(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_LONG_PRESS_TIME)) {
-    return button_set_long_press_time(widget, value_int(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_ENABLE_LONG_PRESS)) {
-    return button_set_enable_long_press(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_ENABLE_PREVIEW)) {
-    return button_set_enable_preview(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_IS_ACCEPT_STATUS)) {
-    button->is_accept_status = value_bool(v);
-    return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_REPEAT: {
+      return button_set_repeat(widget, value_int(v));
+    }
+    case WIDGET_PROP_ATOM_LONG_PRESS_TIME: {
+      return button_set_long_press_time(widget, value_int(v));
+    }
+    case WIDGET_PROP_ATOM_ENABLE_LONG_PRESS: {
+      return button_set_enable_long_press(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_ENABLE_PREVIEW: {
+      return button_set_enable_preview(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_IS_ACCEPT_STATUS: {
+      button->is_accept_status = value_bool(v);
+      return RET_OK;
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -423,6 +441,7 @@ static const char* const s_button_properties[] = {WIDGET_PROP_REPEAT, WIDGET_PRO
                                                   WIDGET_PROP_ENABLE_PREVIEW, NULL};
 
 TK_DECL_VTABLE(button) = {.size = sizeof(button_t),
+                          .paint_thread_safe = TRUE,
                           .type = WIDGET_TYPE_BUTTON,
                           .space_key_to_activate = TRUE,
                           .return_key_to_activate = TRUE,
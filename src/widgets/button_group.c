@@ -27,6 +27,7 @@ static ret_t button_group_on_paint_self(widget_t* widget, canvas_t* c) {
 }
 
 TK_DECL_VTABLE(button_group) = {.size = sizeof(button_group_t),
+                                .paint_thread_safe = TRUE,
                                 .type = WIDGET_TYPE_BUTTON_GROUP,
                                 .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                                 .create = button_group_create,
@@ -203,6 +203,7 @@ static ret_t radio_button_init_radio(widget_t* widget) {
 static const char* s_check_button_properties[] = {WIDGET_PROP_VALUE, NULL};
 TK_DECL_VTABLE(check_button) = {
     .inputable = TRUE,
+    .paint_thread_safe = TRUE,
     .size = sizeof(check_button_t),
     .type = WIDGET_TYPE_CHECK_BUTTON,
     .space_key_to_activate = TRUE,
@@ -220,6 +221,7 @@ TK_DECL_VTABLE(check_button) = {
 
 TK_DECL_VTABLE(radio_button) = {
     .inputable = TRUE,
+    .paint_thread_safe = TRUE,
     .size = sizeof(check_button_t),
     .type = WIDGET_TYPE_RADIO_BUTTON,
     .space_key_to_activate = TRUE,
@@ -183,6 +183,7 @@ static ret_t color_tile_init(widget_t* widget) {
 static const char* const s_color_tile_properties[] = {WIDGET_PROP_BG_COLOR,
                                                       WIDGET_PROP_BORDER_COLOR, NULL};
 TK_DECL_VTABLE(color_tile) = {.size = sizeof(color_tile_t),
+                              .paint_thread_safe = TRUE,
                               .type = WIDGET_TYPE_COLOR_TILE,
                               .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                               .create = color_tile_create,
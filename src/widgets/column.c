@@ -23,6 +23,7 @@
 #include "widgets/column.h"
 
 TK_DECL_VTABLE(column) = {.size = sizeof(column_t),
+                          .paint_thread_safe = TRUE,
                           .type = WIDGET_TYPE_COLUMN,
                           .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                           .create = column_create};
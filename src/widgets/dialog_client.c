@@ -35,6 +35,7 @@ static ret_t dialog_client_init(widget_t* widget) {
 }
 
 TK_DECL_VTABLE(dialog_client) = {.size = sizeof(dialog_client_t),
+                                 .paint_thread_safe = TRUE,
                                  .type = WIDGET_TYPE_DIALOG_CLIENT,
                                  .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                                  .create = dialog_client_create,
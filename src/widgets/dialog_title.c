@@ -37,6 +37,7 @@ static ret_t dialog_title_init(widget_t* widget) {
 }
 
 TK_DECL_VTABLE(dialog_title) = {.size = sizeof(dialog_title_t),
+                                .paint_thread_safe = TRUE,
                                 .type = WIDGET_TYPE_DIALOG_TITLE,
                                 .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                                 .create = dialog_title_create,
@@ -1339,175 +1339,204 @@ ret_t edit_get_prop(widget_t* widget, const char* name, value_t* v) {
   return_value_if_fail(edit != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
   input_type = edit->input_type;
-  if (tk_str_eq(name, WIDGET_PROP_MIN)) {
-    if (input_type == INPUT_INT) {
-      value_set_int(v, edit->min);
-    } else if (widget_has_uint_min_max(widget)) {
-      value_set_uint32(v, edit->min);
-    } else if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
-      value_set_double(v, edit->min);
-    } else {
-      return RET_NOT_FOUND;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_MIN: {
+      if (input_type == INPUT_INT) {
+        value_set_int(v, edit->min);
+      } else if (widget_has_uint_min_max(widget)) {
+        value_set_uint32(v, edit->min);
+      } else if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
+        value_set_double(v, edit->min);
+      } else {
+        return RET_NOT_FOUND;
+      }
+      return RET_OK;
     }
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX)) {
-    if (input_type == INPUT_INT) {
-      value_set_int(v, edit->max);
-    } else if (widget_has_uint_min_max(widget)) {
-      value_set_uint32(v, edit->max);
-    } else if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
-      value_set_double(v, edit->max);
-    } else {
-      return RET_NOT_FOUND;
+    case WIDGET_PROP_ATOM_MAX: {
+      if (input_type == INPUT_INT) {
+        value_set_int(v, edit->max);
+      } else if (widget_has_uint_min_max(widget)) {
+        value_set_uint32(v, edit->max);
+      } else if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
+        value_set_double(v, edit->max);
+      } else {
+        return RET_NOT_FOUND;
+      }
+      return RET_OK;
     }
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_STEP)) {
-    if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
-      value_set_float(v, edit->step);
+    case WIDGET_PROP_ATOM_STEP: {
+      if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
+        value_set_float(v, edit->step);
+        return RET_OK;
+      } else if (input_type == INPUT_INT || input_type == INPUT_UINT) {
+        value_set_double(v, edit->step);
+        return RET_OK;
+      } else {
+        return RET_NOT_FOUND;
+      }
+    }
+    case WIDGET_PROP_ATOM_INPUT_TYPE: {
+      value_set_uint32(v, input_type);
       return RET_OK;
-    } else if (input_type == INPUT_INT || input_type == INPUT_UINT) {
-      value_set_double(v, edit->step);
+    }
+    case WIDGET_PROP_ATOM_READONLY: {
+      value_set_bool(v, edit->readonly);
       return RET_OK;
-    } else {
-      return RET_NOT_FOUND;
     }
-  } else if (tk_str_eq(name, WIDGET_PROP_INPUT_TYPE)) {
-    value_set_uint32(v, input_type);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_READONLY)) {
-    value_set_bool(v, edit->readonly);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CANCELABLE)) {
-    value_set_bool(v, edit->cancelable);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_AUTO_FIX)) {
-    value_set_bool(v, edit->auto_fix);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SELECT_NONE_WHEN_FOCUSED)) {
-    value_set_bool(v, edit->select_none_when_focused);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_OPEN_IM_WHEN_FOCUSED)) {
-    value_set_bool(v, edit->open_im_when_focused);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CLOSE_IM_WHEN_BLURED)) {
-    value_set_bool(v, edit->close_im_when_blured);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LEFT_MARGIN)) {
-    uint32_t margin = 0;
-    if (widget->astyle != NULL) {
-      TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, LEFT);
+    case WIDGET_PROP_ATOM_CANCELABLE: {
+      value_set_bool(v, edit->cancelable);
+      return RET_OK;
     }
-    if (margin == 0) {
-      margin = edit->left_margin != 0 ? edit->left_margin : edit->margin;
+    case WIDGET_PROP_ATOM_AUTO_FIX: {
+      value_set_bool(v, edit->auto_fix);
+      return RET_OK;
     }
-    value_set_int(v, margin);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_RIGHT_MARGIN)) {
-    uint32_t margin = 0;
-    if (widget->astyle != NULL) {
-      TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, RIGHT);
+    case WIDGET_PROP_ATOM_SELECT_NONE_WHEN_FOCUSED: {
+      value_set_bool(v, edit->select_none_when_focused);
+      return RET_OK;
     }
-    if (margin == 0) {
-      margin = edit->right_margin != 0 ? edit->right_margin : edit->margin;
+    case WIDGET_PROP_ATOM_OPEN_IM_WHEN_FOCUSED: {
+      value_set_bool(v, edit->open_im_when_focused);
+      return RET_OK;
     }
-    value_set_int(v, margin);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_TOP_MARGIN)) {
-    uint32_t margin = 0;
-    if (widget->astyle != NULL) {
-      TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, TOP);
+    case WIDGET_PROP_ATOM_CLOSE_IM_WHEN_BLURED: {
+      value_set_bool(v, edit->close_im_when_blured);
+      return RET_OK;
     }
-    if (margin == 0) {
-      margin = edit->top_margin != 0 ? edit->top_margin : edit->margin;
+    case WIDGET_PROP_ATOM_LEFT_MARGIN: {
+      uint32_t margin = 0;
+      if (widget->astyle != NULL) {
+        TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, LEFT);
+      }
+      if (margin == 0) {
+        margin = edit->left_margin != 0 ? edit->left_margin : edit->margin;
+      }
+      value_set_int(v, margin);
+      return RET_OK;
     }
-    value_set_int(v, margin);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_BOTTOM_MARGIN)) {
-    uint32_t margin = 0;
-    if (widget->astyle != NULL) {
-      TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, BOTTOM);
+    case WIDGET_PROP_ATOM_RIGHT_MARGIN: {
+      uint32_t margin = 0;
+      if (widget->astyle != NULL) {
+        TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, RIGHT);
+      }
+      if (margin == 0) {
+        margin = edit->right_margin != 0 ? edit->right_margin : edit->margin;
+      }
+      value_set_int(v, margin);
+      return RET_OK;
     }
-    if (margin == 0) {
-      margin = edit->bottom_margin != 0 ? edit->bottom_margin : edit->margin;
+    case WIDGET_PROP_ATOM_TOP_MARGIN: {
+      uint32_t margin = 0;
+      if (widget->astyle != NULL) {
+        TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, TOP);
+      }
+      if (margin == 0) {
+        margin = edit->top_margin != 0 ? edit->top_margin : edit->margin;
+      }
+      value_set_int(v, margin);
+      return RET_OK;
     }
-    value_set_int(v, margin);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_PASSWORD_VISIBLE)) {
-    value_set_bool(v, edit->password_visible);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ACTION_TEXT)) {
-    value_set_str(v, edit->action_text);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_TIPS)) {
-    value_set_str(v, edit->tips);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_TR_TIPS)) {
-    value_set_str(v, edit->tr_tips);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_KEYBOARD)) {
-    value_set_str(v, edit->keyboard);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_FOCUSABLE)) {
-    value_set_bool(v, !(edit->readonly));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_VALUE)) {
-    switch (edit->input_type) {
-      case INPUT_INT: {
-        int32_t n = edit_get_int(widget);
-        value_set_int32(v, n);
-        break;
+    case WIDGET_PROP_ATOM_BOTTOM_MARGIN: {
+      uint32_t margin = 0;
+      if (widget->astyle != NULL) {
+        TEXT_EDIT_GET_STYLE_MARGIN(widget->astyle, margin, BOTTOM);
       }
-      case INPUT_UINT: {
-        uint32_t n = (uint32_t)edit_get_int64(widget);
-        value_set_uint32(v, n);
-        break;
+      if (margin == 0) {
+        margin = edit->bottom_margin != 0 ? edit->bottom_margin : edit->margin;
       }
-      case INPUT_FLOAT:
-      case INPUT_UFLOAT: {
-        double d = edit_get_double(widget);
-        value_set_double(v, d);
-        break;
+      value_set_int(v, margin);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_PASSWORD_VISIBLE: {
+      value_set_bool(v, edit->password_visible);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ACTION_TEXT: {
+      value_set_str(v, edit->action_text);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_TIPS: {
+      value_set_str(v, edit->tips);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_TR_TIPS: {
+      value_set_str(v, edit->tr_tips);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_KEYBOARD: {
+      value_set_str(v, edit->keyboard);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_FOCUSABLE: {
+      value_set_bool(v, !(edit->readonly));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_VALUE: {
+      switch (edit->input_type) {
+        case INPUT_INT: {
+          int32_t n = edit_get_int(widget);
+          value_set_int32(v, n);
+          break;
+        }
+        case INPUT_UINT: {
+          uint32_t n = (uint32_t)edit_get_int64(widget);
+          value_set_uint32(v, n);
+          break;
+        }
+        case INPUT_FLOAT:
+        case INPUT_UFLOAT: {
+          double d = edit_get_double(widget);
+          value_set_double(v, d);
+          break;
+        }
+        default: {
+          value_set_wstr(v, widget->text.str);
+        }
       }
-      default: {
-        value_set_wstr(v, widget->text.str);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_CARET_X: {
+      text_edit_state_t state;
+      text_edit_get_state(edit->model, &state);
+      value_set_int(v, state.caret.x);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_CARET_Y: {
+      text_edit_state_t state;
+      text_edit_get_state(edit->model, &state);
+      value_set_int(v, state.caret.y);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_LINE_HEIGHT: {
+      text_edit_state_t state;
+      text_edit_get_state(edit->model, &state);
+      value_set_int(v, state.line_height);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_INPUTING: {
+      input_method_t* im = input_method();
+      bool_t inputing = (im != NULL && im->widget == widget) || edit->is_key_inputing;
+      /* 当控件没有父集窗口或者父集窗口没有打开的时候，通过 focused 来判断是否正在输入 */
+      if (!inputing && !widget_is_window_opened(widget)) {
+        inputing = widget->focused;
       }
+      value_set_bool(v, inputing);
+      return RET_OK;
     }
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CARET_X)) {
-    text_edit_state_t state;
-    text_edit_get_state(edit->model, &state);
-    value_set_int(v, state.caret.x);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CARET_Y)) {
-    text_edit_state_t state;
-    text_edit_get_state(edit->model, &state);
-    value_set_int(v, state.caret.y);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LINE_HEIGHT)) {
-    text_edit_state_t state;
-    text_edit_get_state(edit->model, &state);
-    value_set_int(v, state.line_height);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_INPUTING)) {
-    input_method_t* im = input_method();
-    bool_t inputing = (im != NULL && im->widget == widget) || edit->is_key_inputing;
-    /* 当控件没有父集窗口或者父集窗口没有打开的时候，通过 focused 来判断是否正在输入 */
-    if (!inputing && !widget_is_window_opened(widget)) {
-      inputing = widget->focused;
+    case WIDGET_PROP_ATOM_VALIDATOR: {
+      value_set_str(v, edit->validator);
+      return RET_OK;
+    }
+    default: {
+      if (tk_str_eq(name, EDIT_PROP_FOCUS_NEXT_WHEN_ENTER)) {
+        value_set_bool(v, edit->focus_next_when_enter);
+        return RET_OK;
+      } else if (tk_str_eq(name, EDIT_PROP_SCROLL_TO_BEGIN_ON_BLUR)) {
+        value_set_bool(v, edit->scroll_to_begin_on_blur);
+        return RET_OK;
+      }
+      break;
     }
-    value_set_bool(v, inputing);
-
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_VALIDATOR)) {
-    value_set_str(v, edit->validator);
-
-    return RET_OK;
-  } else if (tk_str_eq(name, EDIT_PROP_FOCUS_NEXT_WHEN_ENTER)) {
-    value_set_bool(v, edit->focus_next_when_enter);
-    return RET_OK;
-  } else if (tk_str_eq(name, EDIT_PROP_SCROLL_TO_BEGIN_ON_BLUR)) {
-    value_set_bool(v, edit->scroll_to_begin_on_blur);
-    return RET_OK;
   }
 
   return RET_NOT_FOUND;
@@ -1554,107 +1583,137 @@ ret_t edit_set_prop(widget_t* widget, const char* name, const value_t* v) {
   return_value_if_fail(edit != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
   input_type = edit->input_type;
-  if (tk_str_eq(name, WIDGET_PROP_MIN)) {
-    if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
-      edit->min = value_double(v);
-    } else {
-      edit->min = value_int(v);
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_MIN: {
+      if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
+        edit->min = value_double(v);
+      } else {
+        edit->min = value_int(v);
+      }
+      edit_check_valid_value(widget);
+      edit_update_status(widget);
+      return RET_OK;
     }
-    edit_check_valid_value(widget);
-    edit_update_status(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX)) {
-    if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
-      edit->max = value_double(v);
-    } else {
-      edit->max = value_int64(v);
+    case WIDGET_PROP_ATOM_MAX: {
+      if (input_type == INPUT_FLOAT || input_type == INPUT_UFLOAT) {
+        edit->max = value_double(v);
+      } else {
+        edit->max = value_int64(v);
+      }
+      edit_check_valid_value(widget);
+      edit_update_status(widget);
+      return RET_OK;
     }
-    edit_check_valid_value(widget);
-    edit_update_status(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_STEP)) {
-    edit->step = value_double(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_INPUT_TYPE)) {
-    if (v->type == VALUE_TYPE_STRING) {
-      const key_type_value_t* kv = input_type_find(value_str(v));
-      if (kv != NULL) {
-        input_type = (input_type_t)(kv->value);
+    case WIDGET_PROP_ATOM_STEP: {
+      edit->step = value_double(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_INPUT_TYPE: {
+      if (v->type == VALUE_TYPE_STRING) {
+        const key_type_value_t* kv = input_type_find(value_str(v));
+        if (kv != NULL) {
+          input_type = (input_type_t)(kv->value);
+        }
+      } else {
+        input_type = (input_type_t)value_int(v);
       }
-    } else {
-      input_type = (input_type_t)value_int(v);
+      edit_set_input_type(widget, input_type);
+      return RET_OK;
     }
-    edit_set_input_type(widget, input_type);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_READONLY)) {
-    edit->readonly = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CANCELABLE)) {
-    edit->cancelable = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_AUTO_FIX)) {
-    edit->auto_fix = value_bool(v);
-    if (edit->auto_fix) {
-      edit_check_valid_value(widget);
+    case WIDGET_PROP_ATOM_READONLY: {
+      edit->readonly = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_CANCELABLE: {
+      edit->cancelable = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_AUTO_FIX: {
+      edit->auto_fix = value_bool(v);
+      if (edit->auto_fix) {
+        edit_check_valid_value(widget);
+      }
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SELECT_NONE_WHEN_FOCUSED: {
+      edit->select_none_when_focused = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_OPEN_IM_WHEN_FOCUSED: {
+      edit->open_im_when_focused = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_CLOSE_IM_WHEN_BLURED: {
+      edit->close_im_when_blured = value_bool(v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_MARGIN: {
+      edit->margin = value_int(v);
+      edit_reset_layout(widget);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_LEFT_MARGIN: {
+      edit->left_margin = value_int(v);
+      edit_reset_layout(widget);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_RIGHT_MARGIN: {
+      edit->right_margin = value_int(v);
+      edit_reset_layout(widget);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_TOP_MARGIN: {
+      edit->top_margin = value_int(v);
+      edit_reset_layout(widget);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_BOTTOM_MARGIN: {
+      edit->bottom_margin = value_int(v);
+      edit_reset_layout(widget);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_PASSWORD_VISIBLE: {
+      edit_set_password_visible(widget, value_bool(v));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_FOCUS:
+    case WIDGET_PROP_ATOM_FOCUSED: {
+      edit_set_focus(widget, value_bool(v));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ACTION_TEXT: {
+      edit_set_action_text(widget, value_str(v));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_TIPS: {
+      edit_set_tips(widget, value_str(v));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_TR_TIPS: {
+      edit_set_tr_tips(widget, value_str(v));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_KEYBOARD: {
+      edit_set_keyboard(widget, value_str(v));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_VALUE:
+    case WIDGET_PROP_ATOM_TEXT: {
+      edit_set_text(widget, v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_VALIDATOR: {
+      edit_set_validator(widget, value_str(v));
+      return RET_OK;
+    }
+    default: {
+      if (tk_str_eq(name, EDIT_PROP_FOCUS_NEXT_WHEN_ENTER)) {
+        return edit_set_focus_next_when_enter(widget, value_bool(v));
+      } else if (tk_str_eq(name, EDIT_PROP_SCROLL_TO_BEGIN_ON_BLUR)) {
+        return edit_set_scroll_to_begin_on_blur(widget, value_bool(v));
+      }
+      break;
     }
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SELECT_NONE_WHEN_FOCUSED)) {
-    edit->select_none_when_focused = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_OPEN_IM_WHEN_FOCUSED)) {
-    edit->open_im_when_focused = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_CLOSE_IM_WHEN_BLURED)) {
-    edit->close_im_when_blured = value_bool(v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MARGIN)) {
-    edit->margin = value_int(v);
-    edit_reset_layout(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LEFT_MARGIN)) {
-    edit->left_margin = value_int(v);
-    edit_reset_layout(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_RIGHT_MARGIN)) {
-    edit->right_margin = value_int(v);
-    edit_reset_layout(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_TOP_MARGIN)) {
-    edit->top_margin = value_int(v);
-    edit_reset_layout(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_BOTTOM_MARGIN)) {
-    edit->bottom_margin = value_int(v);
-    edit_reset_layout(widget);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_PASSWORD_VISIBLE)) {
-    edit_set_password_visible(widget, value_bool(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_FOCUS) || tk_str_eq(name, WIDGET_PROP_FOCUSED)) {
-    edit_set_focus(widget, value_bool(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ACTION_TEXT)) {
-    edit_set_action_text(widget, value_str(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_TIPS)) {
-    edit_set_tips(widget, value_str(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_TR_TIPS)) {
-    edit_set_tr_tips(widget, value_str(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_KEYBOARD)) {
-    edit_set_keyboard(widget, value_str(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_VALUE) || tk_str_eq(name, WIDGET_PROP_TEXT)) {
-    edit_set_text(widget, v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_VALIDATOR)) {
-    edit_set_validator(widget, value_str(v));
-    return RET_OK;
-  } else if (tk_str_eq(name, EDIT_PROP_FOCUS_NEXT_WHEN_ENTER)) {
-    return edit_set_focus_next_when_enter(widget, value_bool(v));
-  } else if (tk_str_eq(name, EDIT_PROP_SCROLL_TO_BEGIN_ON_BLUR)) {
-    return edit_set_scroll_to_begin_on_blur(widget, value_bool(v));
   }
 
   edit_update_status(widget);
@@ -420,6 +420,7 @@ static ret_t grid_init(widget_t* widget) {
 }
 
 TK_DECL_VTABLE(grid) = {.size = sizeof(grid_t),
+                        .paint_thread_safe = TRUE,
                         .type = WIDGET_TYPE_GRID,
                         .clone_properties = s_grid_properties,
                         .persistent_properties = s_grid_properties,
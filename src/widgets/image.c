@@ -25,6 +25,16 @@
 #include "tkc/utils.h"
 #include "base/image_manager.h"
 
+static ret_t image_load_image(widget_t* widget, const char* name, bitmap_t* bitmap) {
+  image_t* image = IMAGE(widget);
+
+  if (image->async_load) {
+    return widget_load_image_async(widget, name, bitmap, 0);
+  } else {
+    return widget_load_image(widget, name, bitmap);
+  }
+}
+
 static ret_t image_on_paint_self(widget_t* widget, canvas_t* c) {
   rect_t dst;
   bitmap_t bitmap;
@@ -40,7 +50,7 @@ static ret_t image_on_paint_self(widget_t* widget, canvas_t* c) {
 
   do {
     break_if_fail(image_base->image != NULL);
-    if (widget_load_image(widget, image_base->image, &bitmap) == RET_OK) {
+    if (image_load_image(widget, image_base->image, &bitmap) == RET_OK) {
       const char* region = strrchr(image_base->image, '#');
 
       if (vg != NULL) {
@@ -81,30 +91,43 @@ static ret_t image_get_prop(widget_t* widget, const char* name, value_t* v) {
   image_t* image = IMAGE(widget);
   return_value_if_fail(image != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_DRAW_TYPE)) {
-    value_set_int(v, image->draw_type);
-    return RET_OK;
-  } else {
-    return image_base_get_prop(widget, name, v);
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_DRAW_TYPE: {
+      value_set_int(v, image->draw_type);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ASYNC_LOAD: {
+      value_set_bool(v, image->async_load);
+      return RET_OK;
+    }
+    default: {
+      return image_base_get_prop(widget, name, v);
+    }
   }
 }
 
 static ret_t image_set_prop(widget_t* widget, const char* name, const value_t* v) {
   return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_DRAW_TYPE)) {
-    if (v->type == VALUE_TYPE_STRING) {
-      const key_type_value_t* kv = image_draw_type_find(value_str(v));
-      if (kv != NULL) {
-        return image_set_draw_type(widget, (image_draw_type_t)(kv->value));
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_DRAW_TYPE: {
+      if (v->type == VALUE_TYPE_STRING) {
+        const key_type_value_t* kv = image_draw_type_find(value_str(v));
+        if (kv != NULL) {
+          return image_set_draw_type(widget, (image_draw_type_t)(kv->value));
+        }
+      } else {
+        return image_set_draw_type(widget, (image_draw_type_t)value_int(v));
       }
-    } else {
-      return image_set_draw_type(widget, (image_draw_type_t)value_int(v));
-    }
 
-    return RET_OK;
-  } else {
-    return image_base_set_prop(widget, name, v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ASYNC_LOAD: {
+      return image_set_async_load(widget, value_bool(v));
+    }
+    default: {
+      return image_base_set_prop(widget, name, v);
+    }
   }
 }
 
@@ -112,7 +135,8 @@ static const char* const s_image_properties[] = {WIDGET_PROP_IMAGE,      WIDGET_
                                                  WIDGET_PROP_SCALE_X,    WIDGET_PROP_SCALE_Y,
                                                  WIDGET_PROP_ANCHOR_X,   WIDGET_PROP_ANCHOR_Y,
                                                  WIDGET_PROP_ROTATION,   WIDGET_PROP_CLICKABLE,
-                                                 WIDGET_PROP_SELECTABLE, NULL};
+                                                 WIDGET_PROP_SELECTABLE, WIDGET_PROP_ASYNC_LOAD,
+                                                 NULL};
 
 static ret_t image_on_copy(widget_t* widget, widget_t* other) {
   image_t* image = IMAGE(widget);
@@ -121,6 +145,7 @@ static ret_t image_on_copy(widget_t* widget, widget_t* other) {
 
   image_base_on_copy(widget, other);
   image->draw_type = image_other->draw_type;
+  image->async_load = image_other->async_load;
 
   return RET_OK;
 }
@@ -135,6 +160,7 @@ static ret_t image_init(widget_t* widget) {
 }
 
 TK_DECL_VTABLE(image) = {.size = sizeof(image_t),
+                         .paint_thread_safe = TRUE,
                          .type = WIDGET_TYPE_IMAGE,
                          .space_key_to_activate = TRUE,
                          .return_key_to_activate = TRUE,
@@ -158,6 +184,7 @@ widget_t* image_create(widget_t* parent, xy_t x, xy_t y, wh_t w, wh_t h) {
 }
 
 TK_DECL_VTABLE(icon) = {.size = sizeof(image_t),
+                        .paint_thread_safe = TRUE,
                         .type = WIDGET_TYPE_ICON,
                         .space_key_to_activate = TRUE,
                         .return_key_to_activate = TRUE,
@@ -189,6 +216,18 @@ ret_t image_set_draw_type(widget_t* widget, image_draw_type_t draw_type) {
   return widget_invalidate(widget, NULL);
 }
 
+ret_t image_set_async_load(widget_t* widget, bool_t async_load) {
+  image_t* image = IMAGE(widget);
+  return_value_if_fail(image != NULL, RET_BAD_PARAMS);
+
+  image->async_load = async_load;
+  if (!async_load) {
+    widget_cancel_load_image_async(widget);
+  }
+
+  return RET_OK;
+}
+
 widget_t* image_cast(widget_t* widget) {
   return_value_if_fail(WIDGET_IS_INSTANCE_OF(widget, image) || WIDGET_IS_INSTANCE_OF(widget, icon),
                        NULL);
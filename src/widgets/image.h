@@ -66,6 +66,8 @@ BEGIN_C_DECLS
  * > 需要用widget\_set\_image设置图片名称。
  * >
  * > 可以用image\_set\_draw\_type设置图片的绘制方式。
+ * >
+ * > 可以用image\_set\_async\_load设置在后台线程中解码图片。
  *
  * > 绘制方式请参考[image\_draw\_type\_t](image_draw_type_t.md)
  *
@@ -99,6 +101,15 @@ typedef struct _image_t {
    * 图片的绘制方式(仅在没有旋转和缩放时生效)。
    */
   image_draw_type_t draw_type;
+
+  /**
+   * @property {bool_t} async_load
+   * @annotation ["set_prop","get_prop","readable","persitent","design","scriptable"]
+   * 是否在后台线程中异步解码图片(缺省FALSE)。
+   *
+   * > 解码完成前只绘制背景，适合图片较多的画廊等界面。
+   */
+  bool_t async_load;
 } image_t;
 
 /**
@@ -140,6 +151,17 @@ widget_t* icon_create(widget_t* parent, xy_t x, xy_t y, wh_t w, wh_t h);
  */
 ret_t image_set_draw_type(widget_t* widget, image_draw_type_t draw_type);
 
+/**
+ * @method image_set_async_load
+ * 设置是否在后台线程中异步解码图片。
+ * @annotation ["scriptable"]
+ * @param {widget_t*} widget image对象。
+ * @param {bool_t}  async_load 是否异步解码图片。
+ *
+ * @return {ret_t} 返回RET_OK表示成功，否则表示失败。
+ */
+ret_t image_set_async_load(widget_t* widget, bool_t async_load);
+
 /**
  * @method image_cast
  * 转换为image对象(供脚本语言使用)。
@@ -190,24 +190,33 @@ static ret_t label_get_prop(widget_t* widget, const char* name, value_t* v) {
   label_t* label = LABEL(widget);
   return_value_if_fail(label != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_VALUE)) {
-    value_set_wstr(v, widget->text.str);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LENGTH)) {
-    value_set_int(v, label->length);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX_W)) {
-    value_set_int(v, label->max_w);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LINE_WRAP)) {
-    value_set_bool(v, label->line_wrap);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_WORD_WRAP)) {
-    value_set_bool(v, label->word_wrap);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_ELLIPSES)) {
-    value_set_bool(v, label->ellipses);
-    return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_VALUE: {
+      value_set_wstr(v, widget->text.str);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_LENGTH: {
+      value_set_int(v, label->length);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_MAX_W: {
+      value_set_int(v, label->max_w);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_LINE_WRAP: {
+      value_set_bool(v, label->line_wrap);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_WORD_WRAP: {
+      value_set_bool(v, label->word_wrap);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_ELLIPSES: {
+      value_set_bool(v, label->ellipses);
+      return RET_OK;
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -219,19 +228,29 @@ static ret_t label_set_prop(widget_t* widget, const char* name, const value_t* v
   if (widget->auto_adjust_size) {
     widget_set_need_relayout(widget);
   }
-  if (tk_str_eq(name, WIDGET_PROP_VALUE) || tk_str_eq(name, WIDGET_PROP_TEXT)) {
-    wstr_from_value(&(widget->text), v);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_LENGTH)) {
-    return label_set_length(widget, tk_roundi(value_float(v)));
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX_W)) {
-    return label_set_max_w(widget, value_int(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_LINE_WRAP)) {
-    return label_set_line_wrap(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_WORD_WRAP)) {
-    return label_set_word_wrap(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_ELLIPSES)) {
-    return label_set_ellipses(widget, value_bool(v));
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_VALUE:
+    case WIDGET_PROP_ATOM_TEXT: {
+      wstr_from_value(&(widget->text), v);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_LENGTH: {
+      return label_set_length(widget, tk_roundi(value_float(v)));
+    }
+    case WIDGET_PROP_ATOM_MAX_W: {
+      return label_set_max_w(widget, value_int(v));
+    }
+    case WIDGET_PROP_ATOM_LINE_WRAP: {
+      return label_set_line_wrap(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_WORD_WRAP: {
+      return label_set_word_wrap(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_ELLIPSES: {
+      return label_set_ellipses(widget, value_bool(v));
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -362,6 +381,7 @@ static const char* const s_label_properties[] = {WIDGET_PROP_LENGTH,   WIDGET_PR
                                                  WIDGET_PROP_ELLIPSES, NULL};
 
 TK_DECL_VTABLE(label) = {.size = sizeof(label_t),
+                         .paint_thread_safe = TRUE,
                          .type = WIDGET_TYPE_LABEL,
                          .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                          .clone_properties = s_label_properties,
@@ -181,24 +181,33 @@ static ret_t progress_bar_get_prop(widget_t* widget, const char* name, value_t*
   progress_bar_t* progress_bar = PROGRESS_BAR(widget);
   return_value_if_fail(progress_bar != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_VALUE)) {
-    value_set_float(v, progress_bar->value);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX)) {
-    value_set_float(v, progress_bar->max);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_FORMAT)) {
-    value_set_str(v, progress_bar->format);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_VERTICAL)) {
-    value_set_bool(v, progress_bar->vertical);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_SHOW_TEXT)) {
-    value_set_bool(v, progress_bar->show_text);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_REVERSE)) {
-    value_set_bool(v, progress_bar->reverse);
-    return RET_OK;
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_VALUE: {
+      value_set_float(v, progress_bar->value);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_MAX: {
+      value_set_float(v, progress_bar->max);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_FORMAT: {
+      value_set_str(v, progress_bar->format);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_VERTICAL: {
+      value_set_bool(v, progress_bar->vertical);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_SHOW_TEXT: {
+      value_set_bool(v, progress_bar->show_text);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_REVERSE: {
+      value_set_bool(v, progress_bar->reverse);
+      return RET_OK;
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -207,18 +216,27 @@ static ret_t progress_bar_get_prop(widget_t* widget, const char* name, value_t*
 static ret_t progress_bar_set_prop(widget_t* widget, const char* name, const value_t* v) {
   return_value_if_fail(widget != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_VALUE)) {
-    return progress_bar_set_value(widget, value_float(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX)) {
-    return progress_bar_set_max(widget, value_float(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_FORMAT)) {
-    return progress_bar_set_format(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_VERTICAL)) {
-    return progress_bar_set_vertical(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_SHOW_TEXT)) {
-    return progress_bar_set_show_text(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_REVERSE)) {
-    return progress_bar_set_reverse(widget, value_bool(v));
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_VALUE: {
+      return progress_bar_set_value(widget, value_float(v));
+    }
+    case WIDGET_PROP_ATOM_MAX: {
+      return progress_bar_set_max(widget, value_float(v));
+    }
+    case WIDGET_PROP_ATOM_FORMAT: {
+      return progress_bar_set_format(widget, value_str(v));
+    }
+    case WIDGET_PROP_ATOM_VERTICAL: {
+      return progress_bar_set_vertical(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_SHOW_TEXT: {
+      return progress_bar_set_show_text(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_REVERSE: {
+      return progress_bar_set_reverse(widget, value_bool(v));
+    }
+    default:
+      break;
   }
 
   return RET_NOT_FOUND;
@@ -240,6 +258,7 @@ static const char* s_progress_bar_clone_properties[] = {WIDGET_PROP_VALUE,     W
                                                         WIDGET_PROP_FORMAT,    WIDGET_PROP_VERTICAL,
                                                         WIDGET_PROP_SHOW_TEXT, NULL};
 TK_DECL_VTABLE(progress_bar) = {.size = sizeof(progress_bar_t),
+                                .paint_thread_safe = TRUE,
                                 .type = WIDGET_TYPE_PROGRESS_BAR,
                                 .clone_properties = s_progress_bar_clone_properties,
                                 .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
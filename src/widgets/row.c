@@ -23,6 +23,7 @@
 #include "widgets/row.h"
 
 TK_DECL_VTABLE(row) = {.size = sizeof(row_t),
+                       .paint_thread_safe = TRUE,
                        .type = WIDGET_TYPE_ROW,
                        .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                        .create = row_create};
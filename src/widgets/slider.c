@@ -728,25 +728,49 @@ static ret_t slider_get_prop(widget_t* widget, const char* name, value_t* v) {
   slider_t* slider = SLIDER(widget);
   return_value_if_fail(slider != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_VALUE)) {
-    value_set_double(v, slider->value);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_VERTICAL)) {
-    value_set_bool(v, slider->vertical);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MIN)) {
-    value_set_double(v, slider->min);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX)) {
-    value_set_double(v, slider->max);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_STEP)) {
-    value_set_double(v, slider->step);
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_BAR_SIZE)) {
-    value_set_uint32(v, slider->bar_size);
-    return RET_OK;
-  } else if (tk_str_eq(name, SLIDER_PROP_DRAGGER_SIZE)) {
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_VALUE: {
+      value_set_double(v, slider->value);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_VERTICAL: {
+      value_set_bool(v, slider->vertical);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_MIN: {
+      value_set_double(v, slider->min);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_MAX: {
+      value_set_double(v, slider->max);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_STEP: {
+      value_set_double(v, slider->step);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_BAR_SIZE: {
+      value_set_uint32(v, slider->bar_size);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_INPUTING: {
+      value_set_bool(v, slider->dragging);
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_DIRTY_RECT: {
+      value_set_rect(v, slider_get_dirty_rect(widget));
+      return RET_OK;
+    }
+    case WIDGET_PROP_ATOM_DRAG_THRESHOLD: {
+      value_set_uint32(v, slider->drag_threshold);
+      return RET_OK;
+    }
+    default:
+      break;
+  }
+
+  /*控件私有属性不在原子表中*/
+  if (tk_str_eq(name, SLIDER_PROP_DRAGGER_SIZE)) {
     value_set_uint32(v, slider->dragger_size);
     return RET_OK;
   } else if (tk_str_eq(name, SLIDER_PROP_DRAGGER_ADAPT_TO_ICON)) {
@@ -755,18 +779,9 @@ static ret_t slider_get_prop(widget_t* widget, const char* name, value_t* v) {
   } else if (tk_str_eq(name, SLIDER_PROP_SLIDE_WITH_BAR)) {
     value_set_bool(v, slider->slide_with_bar);
     return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_INPUTING)) {
-    value_set_bool(v, slider->dragging);
-    return RET_OK;
   } else if (tk_str_eq(name, SLIDER_PROP_SLIDE_LINE_CAP)) {
     value_set_str(v, slider->line_cap);
     return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_DIRTY_RECT)) {
-    value_set_rect(v, slider_get_dirty_rect(widget));
-    return RET_OK;
-  } else if (tk_str_eq(name, WIDGET_PROP_DRAG_THRESHOLD)) {
-    value_set_uint32(v, slider->drag_threshold);
-    return RET_OK;
   }
 
   return RET_NOT_FOUND;
@@ -776,19 +791,34 @@ static ret_t slider_set_prop(widget_t* widget, const char* name, const value_t*
   slider_t* slider = SLIDER(widget);
   return_value_if_fail(slider != NULL && name != NULL && v != NULL, RET_BAD_PARAMS);
 
-  if (tk_str_eq(name, WIDGET_PROP_VALUE)) {
-    return slider_set_value(widget, value_double(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_VERTICAL)) {
-    return slider_set_vertical(widget, value_bool(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_MIN)) {
-    return slider_set_min(widget, value_double(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_MAX)) {
-    return slider_set_max(widget, value_double(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_STEP)) {
-    return slider_set_step(widget, value_double(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_BAR_SIZE)) {
-    return slider_set_bar_size(widget, value_uint32(v));
-  } else if (tk_str_eq(name, SLIDER_PROP_DRAGGER_SIZE)) {
+  switch (widget_prop_atom_from_name(name)) {
+    case WIDGET_PROP_ATOM_VALUE: {
+      return slider_set_value(widget, value_double(v));
+    }
+    case WIDGET_PROP_ATOM_VERTICAL: {
+      return slider_set_vertical(widget, value_bool(v));
+    }
+    case WIDGET_PROP_ATOM_MIN: {
+      return slider_set_min(widget, value_double(v));
+    }
+    case WIDGET_PROP_ATOM_MAX: {
+      return slider_set_max(widget, value_double(v));
+    }
+    case WIDGET_PROP_ATOM_STEP: {
+      return slider_set_step(widget, value_double(v));
+    }
+    case WIDGET_PROP_ATOM_BAR_SIZE: {
+      return slider_set_bar_size(widget, value_uint32(v));
+    }
+    case WIDGET_PROP_ATOM_DRAG_THRESHOLD: {
+      return slider_set_drag_threshold(widget, value_uint32(v));
+    }
+    default:
+      break;
+  }
+
+  /*控件私有属性不在原子表中*/
+  if (tk_str_eq(name, SLIDER_PROP_DRAGGER_SIZE)) {
     slider->dragger_size = value_uint32(v);
     slider->auto_get_dragger_size = slider->dragger_size == 0;
     return RET_OK;
@@ -800,8 +830,6 @@ static ret_t slider_set_prop(widget_t* widget, const char* name, const value_t*
     return RET_OK;
   } else if (tk_str_eq(name, SLIDER_PROP_SLIDE_LINE_CAP)) {
     return slider_set_line_cap(widget, value_str(v));
-  } else if (tk_str_eq(name, WIDGET_PROP_DRAG_THRESHOLD)) {
-    return slider_set_drag_threshold(widget, value_uint32(v));
   }
 
   return RET_NOT_FOUND;
@@ -54,6 +54,7 @@ static ret_t view_on_destroy(widget_t* widget) {
 }
 
 TK_DECL_VTABLE(view) = {.size = sizeof(view_t),
+                        .paint_thread_safe = TRUE,
                         .type = WIDGET_TYPE_VIEW,
                         .get_parent_vt = TK_GET_PARENT_VTABLE(widget),
                         .set_prop = view_set_prop,
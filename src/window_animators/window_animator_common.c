@@ -48,7 +48,7 @@ ret_t window_animator_to_bottom_draw_curr(window_animator_t* wa) {
 #else
   int32_t y = -win->h * (1 - percent);
   canvas_translate(c, 0, y);
-  widget_paint(win, c);
+  widget_paint_with_display_list(win, c);
   canvas_untranslate(c, 0, y);
   return RET_OK;
 #endif /*WITHOUT_WINDOW_ANIMATOR_CACHE*/
@@ -73,7 +73,7 @@ ret_t window_animator_to_top_draw_curr(window_animator_t* wa) {
 #else
   int32_t y = win->h * (1 - percent);
   canvas_translate(c, 0, y);
-  widget_paint(win, c);
+  widget_paint_with_display_list(win, c);
   canvas_untranslate(c, 0, y);
   return RET_OK;
 #endif /*WITHOUT_WINDOW_ANIMATOR_CACHE*/
@@ -99,7 +99,7 @@ ret_t window_animator_to_left_draw_curr(window_animator_t* wa) {
   int32_t x = -win->w * (1 - percent);
 
   canvas_translate(c, x, 0);
-  widget_paint(win, c);
+  widget_paint_with_display_list(win, c);
   canvas_untranslate(c, x, 0);
   return RET_OK;
 #endif /*WITHOUT_WINDOW_ANIMATOR_CACHE*/
@@ -124,7 +124,7 @@ ret_t window_animator_to_right_draw_curr(window_animator_t* wa) {
   int32_t x = win->w * (1 - percent);
 
   canvas_translate(c, x, 0);
-  widget_paint(win, c);
+  widget_paint_with_display_list(win, c);
   canvas_untranslate(c, x, 0);
   return RET_OK;
 #endif /*WITHOUT_WINDOW_ANIMATOR_CACHE*/
@@ -134,6 +134,22 @@ static ret_t window_animator_update_percent(window_animator_t* wa);
 static ret_t window_animator_draw_prev_window(window_animator_t* wa);
 static ret_t window_animator_draw_curr_window(window_animator_t* wa);
 
+/*动画期间录制的绘制命令只在动画中回放，结束后释放，否则会一直占用内存(包括复制的字模)*/
+static ret_t window_animator_release_display_lists(window_animator_t* wa) {
+  widget_t* wm = wa->prev_win != NULL ? wa->prev_win->parent : NULL;
+
+  if (wm != NULL) {
+    WIDGET_FOR_EACH_CHILD_BEGIN(wm, iter, i)
+    if (iter->display_list != NULL) {
+      display_list_destroy(iter->display_list);
+      iter->display_list = NULL;
+    }
+    WIDGET_FOR_EACH_CHILD_END()
+  }
+
+  return RET_OK;
+}
+
 static ret_t window_animator_open_destroy(window_animator_t* wa) {
 #ifndef WITHOUT_WINDOW_ANIMATOR_CACHE
   if (wa->dialog_highlighter == NULL) {
@@ -178,6 +194,7 @@ ret_t window_animator_update(window_animator_t* wa, uint64_t time_ms) {
 ret_t window_animator_destroy(window_animator_t* wa) {
   return_value_if_fail(wa != NULL, RET_FAIL);
 
+  window_animator_release_display_lists(wa);
   if (wa->open) {
     return window_animator_open_destroy(wa);
   } else {
@@ -326,7 +343,7 @@ ret_t window_animator_overlap_default_draw_prev(window_animator_t* wa) {
     start = TRUE;
   }
   if (start && !widget_get_prop_bool(iter, WIDGET_PROP_ALWAYS_ON_TOP, FALSE)) {
-    widget_paint(iter, c);
+    widget_paint_with_display_list(iter, c);
   }
   WIDGET_FOR_EACH_CHILD_END()
 #endif /*WITHOUT_WINDOW_ANIMATOR_CACHE*/
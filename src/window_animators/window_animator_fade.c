@@ -36,7 +36,7 @@ static ret_t window_animator_fade_draw_curr(window_animator_t* wa) {
 #else
   lcd_set_global_alpha(c->lcd, global_alpha);
 
-  ret = widget_paint(win, c);
+  ret = widget_paint_with_display_list(win, c);
 #endif /*WITHOUT_WINDOW_ANIMATOR_CACHE*/
   lcd_set_global_alpha(c->lcd, 0xff);
   return ret;
@@ -74,7 +74,7 @@ static ret_t window_animator_htranslate_draw_prev(window_animator_t* wa) {
     start = TRUE;
   }
   if (start && !widget_get_prop_bool(iter, WIDGET_PROP_ALWAYS_ON_TOP, FALSE)) {
-    widget_paint(iter, c);
+    widget_paint_with_display_list(iter, c);
   }
   WIDGET_FOR_EACH_CHILD_END()
   canvas_untranslate(c, -x, 0);
@@ -95,7 +95,7 @@ static ret_t window_animator_htranslate_draw_curr(window_animator_t* wa) {
   return lcd_draw_image(c->lcd, &(wa->curr_img), rectf_scale(&src, wa->ratio), &dst);
 #else
   canvas_translate(c, x, 0);
-  widget_paint(win, c);
+  widget_paint_with_display_list(win, c);
   canvas_untranslate(c, x, 0);
 
   return RET_OK;
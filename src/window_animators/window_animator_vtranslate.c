@@ -94,7 +94,7 @@ static ret_t window_animator_vtranslate_draw_prev(window_animator_t* wa) {
     }
     if (i == wav->real_prev_win_index) {
       canvas_translate(c, 0, -y);
-      widget_paint(iter, c);
+      widget_paint_with_display_list(iter, c);
       canvas_untranslate(c, 0, -y);
       continue;
     }
@@ -148,7 +148,7 @@ static ret_t window_animator_vtranslate_draw_curr(window_animator_t* wa) {
 #else
   y = win->h * (1 - percent);
   canvas_translate(c, 0, y);
-  widget_paint(win, c);
+  widget_paint_with_display_list(win, c);
   canvas_untranslate(c, 0, y);
 
   return RET_OK;
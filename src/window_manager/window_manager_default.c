@@ -2053,6 +2053,7 @@ static const widget_vtable_t s_window_manager_vtable = {
     .size = sizeof(window_manager_t),
     .type = WIDGET_TYPE_WINDOW_MANAGER,
     .is_window_manager = TRUE,
+    .paint_thread_safe = TRUE,
     .set_prop = window_manager_default_set_prop,
     .get_prop = window_manager_default_get_prop,
     .on_event = window_manager_default_on_event,
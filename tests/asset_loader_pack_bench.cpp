@@ -0,0 +1,184 @@
+﻿#include "awtk.h"
+#include "tkc/fs.h"
+#include "tkc/time_now.h"
+#include "base/assets_manifest.h"
+#include "base/asset_loader_pack.h"
+
+#define BENCH_PACK "bench_assets.pack"
+#define BENCH_PROCS 4
+
+#if defined(LINUX) && defined(WITH_ASSET_LOADER_PACK)
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/*从/proc中读取内存统计(KB)*/
+static uint32_t proc_read_kb(const char* filename, const char* key) {
+  char line[256];
+  uint32_t value = 0;
+  uint32_t key_len = strlen(key);
+  FILE* fp = fopen(filename, "r");
+
+  if (fp != NULL) {
+    while (fgets(line, sizeof(line), fp) != NULL) {
+      if (strncmp(line, key, key_len) == 0) {
+        value = tk_atoi(line + key_len);
+        break;
+      }
+    }
+    fclose(fp);
+  }
+
+  return value;
+}
+
+typedef struct _bench_result_t {
+  uint64_t load_us;
+  uint32_t bytes;
+  uint32_t rss_anon;
+  uint32_t rss_file;
+  uint32_t pss;
+} bench_result_t;
+
+static volatile uint32_t s_sum = 0;
+
+/*加载全部资源并访问全部页面(模拟使用)，资源一直保持引用*/
+static void bench_load_all(asset_loader_t* loader, assets_manifest_t* index, const char* assets_dir,
+                           bench_result_t* r, darray_t* infos) {
+  uint32_t i = 0;
+  uint32_t sum = 0;
+  char path[MAX_PATH + 1];
+  uint64_t start = time_now_us();
+
+  for (i = 0; i < index->nr; i++) {
+    uint32_t k = 0;
+    asset_info_t* info = NULL;
+    const char* name = index->names + index->entries[i].name;
+
+    path_build(path, MAX_PATH, assets_dir, name, NULL);
+    info = asset_loader_load(loader, ASSET_TYPE_DATA, ASSET_TYPE_DATA_BIN, path, name);
+    if (info != NULL) {
+      for (k = 0; k < info->size; k += 64) {
+        sum += info->data[k];
+      }
+      r->bytes += info->size;
+      darray_push(infos, info);
+    }
+  }
+
+  r->load_us = time_now_us() - start;
+  s_sum += sum;
+}
+
+static void bench_child(bool_t pack, assets_manifest_t* index, const char* assets_dir, int ready,
+                        int go, int out) {
+  char c = 0;
+  darray_t infos;
+  bench_result_t r;
+  asset_loader_t* loader = pack ? asset_loader_pack_create(BENCH_PACK) : asset_loader_create();
+
+  memset(&r, 0x00, sizeof(r));
+  darray_init(&infos, 1024, (tk_destroy_t)asset_info_unref, NULL);
+  bench_load_all(loader, index, assets_dir, &r, &infos);
+
+  /*等全部进程加载完成后再统计，这样PSS能反映共享的页面*/
+  (void)!write(ready, &c, 1);
+  (void)!read(go, &c, 1);
+
+  r.rss_anon = proc_read_kb("/proc/self/status", "RssAnon:");
+  r.rss_file = proc_read_kb("/proc/self/status", "RssFile:");
+  r.pss = proc_read_kb("/proc/self/smaps_rollup", "Pss:");
+  (void)!write(out, &r, sizeof(r));
+
+  darray_deinit(&infos);
+  asset_loader_destroy(loader);
+}
+
+static void bench_run(bool_t pack, assets_manifest_t* index, const char* assets_dir) {
+  char c = 0;
+  uint32_t i = 0;
+  int ready[2];
+  int go[2];
+  int out[2];
+  bench_result_t r;
+  bench_result_t total;
+
+  memset(&total, 0x00, sizeof(total));
+  (void)!pipe(ready);
+  (void)!pipe(go);
+  (void)!pipe(out);
+
+  for (i = 0; i < BENCH_PROCS; i++) {
+    if (fork() == 0) {
+      bench_child(pack, index, assets_dir, ready[1], go[0], out[1]);
+      _exit(0);
+    }
+  }
+
+  for (i = 0; i < BENCH_PROCS; i++) {
+    (void)!read(ready[0], &c, 1);
+  }
+  for (i = 0; i < BENCH_PROCS; i++) {
+    (void)!write(go[1], &c, 1);
+  }
+
+  for (i = 0; i < BENCH_PROCS; i++) {
+    (void)!read(out[0], &r, sizeof(r));
+    total.load_us += r.load_us;
+    total.rss_anon += r.rss_anon;
+    total.rss_file += r.rss_file;
+    total.pss += r.pss;
+    total.bytes = r.bytes;
+    wait(NULL);
+  }
+
+  close(ready[0]), close(ready[1]);
+  close(go[0]), close(go[1]);
+  close(out[0]), close(out[1]);
+
+  log_info("%-5s %u files %6.2fMB  load: %6.2fms  RssAnon: %6uKB  RssFile: %6uKB  Pss: %6uKB\n",
+           pack ? "pack" : "files", index->nr, total.bytes / 1048576.0,
+           total.load_us / 1000.0 / BENCH_PROCS, total.rss_anon / BENCH_PROCS,
+           total.rss_file / BENCH_PROCS, total.pss / BENCH_PROCS);
+}
+
+int main(int argc, char* argv[]) {
+  wbuffer_t wb;
+  uint32_t i = 0;
+  char dir[MAX_PATH + 1];
+  assets_manifest_t* index = NULL;
+
+  tk_init(320, 480, APP_CONSOLE, NULL, "./");
+  path_build(dir, MAX_PATH, assets_manager_get_res_root(assets_manager()), "assets", NULL);
+
+  wbuffer_init_extendable(&wb);
+  assets_manifest_build(dir, &wb);
+  index = assets_manifest_create(wb.data, wb.cursor);
+  wbuffer_deinit(&wb);
+  asset_loader_pack_save(dir, BENCH_PACK);
+
+#ifdef LOAD_ASSET_WITH_MMAP
+  log_info("LOAD_ASSET_WITH_MMAP: views into the pack\n");
+#else
+  log_info("no LOAD_ASSET_WITH_MMAP: data copied from the pack\n");
+#endif /*LOAD_ASSET_WITH_MMAP*/
+  log_info("per process average of %d processes:\n", BENCH_PROCS);
+
+  /*第一轮预热page cache*/
+  for (i = 0; i < 2; i++) {
+    bench_run(FALSE, index, dir);
+    bench_run(TRUE, index, dir);
+  }
+
+  assets_manifest_destroy(index);
+  file_remove(BENCH_PACK);
+  tk_exit();
+
+  return 0;
+}
+#else
+int main(int argc, char* argv[]) {
+  log_info("only supported on linux with WITH_ASSET_LOADER_PACK\n");
+  return 0;
+}
+#endif /*LINUX*/
@@ -0,0 +1,123 @@
+﻿#include "tkc/fs.h"
+#include "tkc/mem.h"
+#include "tkc/path.h"
+#include "base/assets_manager.h"
+#include "base/asset_loader_pack.h"
+#include "gtest/gtest.h"
+
+#define PACK_FILE "test_assets.pack"
+
+static asset_loader_t* create_pack(void) {
+  char dir[MAX_PATH + 1];
+  path_build(dir, MAX_PATH, assets_manager_get_res_root(assets_manager()), "assets", NULL);
+
+  if (asset_loader_pack_save(dir, PACK_FILE) != RET_OK) {
+    return NULL;
+  }
+
+  return asset_loader_pack_create(PACK_FILE);
+}
+
+static void check_same_as_file(const asset_info_t* info, const char* filename) {
+  uint32_t size = 0;
+  void* data = file_read(filename, &size);
+
+  ASSERT_TRUE(data != NULL);
+  ASSERT_EQ(info->size, size);
+  ASSERT_EQ(memcmp(info->data, data, size), 0);
+  ASSERT_EQ(info->data[size], 0);
+  TKMEM_FREE(data);
+}
+
+TEST(AssetLoaderPack, basic) {
+  asset_info_t* info = NULL;
+  asset_loader_t* loader = create_pack();
+  const char* res_root = assets_manager_get_res_root(assets_manager());
+  char path[MAX_PATH + 1];
+  ASSERT_TRUE(loader != NULL);
+
+  path_build(path, MAX_PATH, res_root, "assets/default/raw/fonts/default.ttf", NULL);
+  ASSERT_TRUE(asset_loader_exist(loader, path));
+  info = asset_loader_load(loader, ASSET_TYPE_FONT, ASSET_TYPE_FONT_TTF, path, "default");
+  ASSERT_TRUE(info != NULL);
+  ASSERT_STREQ(asset_info_get_name(info), "default");
+  check_same_as_file(info, "res/assets/default/raw/fonts/default.ttf");
+  asset_info_destroy(info);
+
+  info = asset_loader_load(loader, ASSET_TYPE_UI, ASSET_TYPE_UI_BIN,
+                           "assets/default/raw/ui/main.bin", "main");
+  ASSERT_TRUE(info != NULL);
+  check_same_as_file(info, "res/assets/default/raw/ui/main.bin");
+  asset_info_destroy(info);
+
+  ASSERT_FALSE(asset_loader_exist(loader, "assets/default/raw/ui/not_exist.bin"));
+  ASSERT_TRUE(asset_loader_load(loader, ASSET_TYPE_UI, ASSET_TYPE_UI_BIN,
+                                "assets/default/raw/ui/not_exist.bin", "not_exist") == NULL);
+
+  asset_loader_destroy(loader);
+  file_remove(PACK_FILE);
+}
+
+TEST(AssetLoaderPack, assets_manager) {
+  asset_info_t* info = NULL;
+  const asset_info_t* font = NULL;
+  assets_manager_t* am = assets_manager_create(10);
+
+  assets_manager_set_res_root(am, assets_manager_get_res_root(assets_manager()));
+  assets_manager_set_loader(am, create_pack());
+
+  info = assets_manager_load(am, ASSET_TYPE_IMAGE, "china");
+  ASSERT_TRUE(info != NULL);
+  ASSERT_EQ(info->subtype, ASSET_TYPE_IMAGE_BSVG);
+  asset_info_unref(info);
+
+  info = assets_manager_load(am, ASSET_TYPE_STYLE, "default");
+  ASSERT_TRUE(info != NULL);
+  asset_info_unref(info);
+
+  font = assets_manager_ref(am, ASSET_TYPE_FONT, "default");
+  ASSERT_TRUE(font != NULL);
+
+  /*资源持有映射的引用，加载器销毁后仍然有效。*/
+  assets_manager_set_loader(am, asset_loader_create());
+  file_remove(PACK_FILE);
+  check_same_as_file(font, "res/assets/default/raw/fonts/default.ttf");
+  assets_manager_unref(am, font);
+
+  assets_manager_destroy(am);
+}
+
+TEST(AssetLoaderPack, invalid) {
+  const char* str = "not a pack";
+
+  ASSERT_TRUE(asset_loader_pack_create("not_exist.pack") == NULL);
+  file_write(PACK_FILE, str, strlen(str));
+  ASSERT_TRUE(asset_loader_pack_create(PACK_FILE) == NULL);
+  file_remove(PACK_FILE);
+}
+
+TEST(AssetLoaderPack, no_terminator) {
+  uint32_t size = 0;
+  uint8_t* data = NULL;
+  asset_loader_t* loader = create_pack();
+  ASSERT_TRUE(loader != NULL);
+  asset_loader_destroy(loader);
+
+  data = (uint8_t*)file_read(PACK_FILE, &size);
+  ASSERT_TRUE(data != NULL);
+  ASSERT_EQ(data[size - 1], 0);
+
+  /*去掉末尾的'\0'后，最后一个资源不再以'\0'结束*/
+  while (size > 0 && data[size - 1] == 0) {
+    size--;
+  }
+  file_write(PACK_FILE, data, size);
+  ASSERT_TRUE(asset_loader_pack_create(PACK_FILE) == NULL);
+
+  data[size] = 'x';
+  file_write(PACK_FILE, data, size + 1);
+  ASSERT_TRUE(asset_loader_pack_create(PACK_FILE) == NULL);
+
+  TKMEM_FREE(data);
+  file_remove(PACK_FILE);
+}
@@ -0,0 +1,136 @@
+﻿#include "awtk.h"
+#include "tkc/time_now.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "base/assets_manifest.h"
+
+#define BENCH_W 800
+#define BENCH_H 480
+#define BENCH_NR 5
+
+/*统计访问文件系统的次数(每次load/exist都要打开或stat一个文件)*/
+typedef struct _probe_loader_t {
+  asset_loader_t loader;
+  asset_loader_t* real;
+  uint32_t probes;
+  uint32_t failed;
+} probe_loader_t;
+
+static asset_info_t* probe_loader_load(asset_loader_t* loader, uint16_t type, uint16_t subtype,
+                                       const char* path, const char* name) {
+  probe_loader_t* l = (probe_loader_t*)loader;
+  asset_info_t* info = asset_loader_load(l->real, type, subtype, path, name);
+
+  l->probes++;
+  l->failed += info == NULL ? 1 : 0;
+
+  return info;
+}
+
+static bool_t probe_loader_exist(asset_loader_t* loader, const char* path) {
+  probe_loader_t* l = (probe_loader_t*)loader;
+  bool_t exist = asset_loader_exist(l->real, path);
+
+  l->probes++;
+  l->failed += exist ? 0 : 1;
+
+  return exist;
+}
+
+static ret_t probe_loader_destroy(asset_loader_t* loader) {
+  probe_loader_t* l = (probe_loader_t*)loader;
+  asset_loader_destroy(l->real);
+  TKMEM_FREE(l);
+  return RET_OK;
+}
+
+static const asset_loader_vtable_t s_probe_loader_vtable = {
+    probe_loader_load, probe_loader_exist, probe_loader_destroy};
+
+static assets_manifest_t* bench_manifest(assets_manager_t* am) {
+  wbuffer_t wb;
+  char dir[MAX_PATH + 1];
+  assets_manifest_t* manifest = NULL;
+
+  wbuffer_init_extendable(&wb);
+  path_build(dir, MAX_PATH, assets_manager_get_res_root(am), "assets", NULL);
+  if (assets_manifest_build(dir, &wb) == RET_OK) {
+    manifest = assets_manifest_create(wb.data, wb.cursor);
+  }
+  wbuffer_deinit(&wb);
+
+  return manifest;
+}
+
+/*打开窗口并绘制第一帧，返回耗时(微秒)*/
+static uint64_t bench_open(canvas_t* c, const char* name) {
+  uint64_t start = 0;
+  widget_t* win = NULL;
+
+  image_manager_unload_all(image_manager());
+  assets_manager_clear_all_cache(assets_manager());
+
+  start = time_now_us();
+  win = ui_loader_load_widget(name);
+  widget_move_resize(win, 0, 0, BENCH_W, BENCH_H);
+  widget_layout(win);
+  canvas_begin_frame(c, NULL, LCD_DRAW_OFFLINE);
+  widget_paint(win, c);
+  canvas_end_frame(c);
+  start = time_now_us() - start;
+
+  widget_destroy(win);
+  idle_dispatch();
+
+  return start;
+}
+
+int main(int argc, char* argv[]) {
+  canvas_t c;
+  uint32_t i = 0;
+  lcd_t* lcd = NULL;
+  probe_loader_t* loader = NULL;
+  assets_manager_t* am = NULL;
+  const char* names[] = {"main", "basic", "images", "edit", "list_view", "slide_menu", "keyboard"};
+
+  tk_init(BENCH_W, BENCH_H, APP_CONSOLE, NULL, "./");
+  tk_init_assets();
+
+  am = assets_manager();
+  loader = TKMEM_ZALLOC(probe_loader_t);
+  loader->loader.vt = &s_probe_loader_vtable;
+  loader->real = asset_loader_create();
+  assets_manager_set_loader(am, ASSET_LOADER(loader));
+
+  lcd = lcd_mem_bgra8888_create(BENCH_W, BENCH_H, TRUE);
+  canvas_init(&c, lcd, font_manager());
+
+  for (i = 0; i < ARRAY_SIZE(names); i++) {
+    uint32_t k = 0;
+    uint32_t probes[2] = {0, 0};
+    uint32_t failed[2] = {0, 0};
+    uint64_t t[2] = {UINT64_MAX, UINT64_MAX};
+
+    /*交替运行两种方式，取最小值*/
+    for (k = 0; k < BENCH_NR; k++) {
+      assets_manager_set_manifest(am, NULL);
+      loader->probes = loader->failed = 0;
+      t[0] = tk_min(t[0], bench_open(&c, names[i]));
+      probes[0] = loader->probes;
+      failed[0] = loader->failed;
+
+      assets_manager_set_manifest(am, bench_manifest(am));
+      loader->probes = loader->failed = 0;
+      t[1] = tk_min(t[1], bench_open(&c, names[i]));
+      probes[1] = loader->probes;
+      failed[1] = loader->failed;
+    }
+
+    log_info("%-10s probes: %3u(failed %3u) -> %3u(failed %u)  open: %5.2fms -> %5.2fms\n",
+             names[i], probes[0], failed[0], probes[1], failed[1], t[0] / 1000.0, t[1] / 1000.0);
+  }
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  tk_exit();
+
+  return 0;
+}
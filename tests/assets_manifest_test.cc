@@ -0,0 +1,183 @@
+﻿#include "tkc/fs.h"
+#include "tkc/mem.h"
+#include "tkc/path.h"
+#include "tkc/utils.h"
+#include "base/assets_manager.h"
+#include "base/assets_manifest.h"
+#include "gtest/gtest.h"
+
+typedef struct _probe_loader_t {
+  asset_loader_t loader;
+  asset_loader_t* real;
+  uint32_t probes;
+} probe_loader_t;
+
+static asset_info_t* probe_loader_load(asset_loader_t* loader, uint16_t type, uint16_t subtype,
+                                       const char* path, const char* name) {
+  probe_loader_t* l = (probe_loader_t*)loader;
+  l->probes++;
+  return asset_loader_load(l->real, type, subtype, path, name);
+}
+
+static bool_t probe_loader_exist(asset_loader_t* loader, const char* path) {
+  probe_loader_t* l = (probe_loader_t*)loader;
+  l->probes++;
+  return asset_loader_exist(l->real, path);
+}
+
+static ret_t probe_loader_destroy(asset_loader_t* loader) {
+  probe_loader_t* l = (probe_loader_t*)loader;
+  asset_loader_destroy(l->real);
+  TKMEM_FREE(l);
+  return RET_OK;
+}
+
+static const asset_loader_vtable_t s_probe_loader_vtable = {
+    probe_loader_load, probe_loader_exist, probe_loader_destroy};
+
+static probe_loader_t* probe_loader_create(void) {
+  probe_loader_t* l = TKMEM_ZALLOC(probe_loader_t);
+  l->loader.vt = &s_probe_loader_vtable;
+  l->real = asset_loader_create();
+  return l;
+}
+
+static assets_manifest_t* manifest_of(const char* dir) {
+  wbuffer_t wb;
+  assets_manifest_t* manifest = NULL;
+
+  wbuffer_init_extendable(&wb);
+  if (assets_manifest_build(dir, &wb) == RET_OK) {
+    manifest = assets_manifest_create(wb.data, wb.cursor);
+  }
+  wbuffer_deinit(&wb);
+
+  return manifest;
+}
+
+static assets_manifest_t* res_manifest(assets_manager_t* am) {
+  char dir[MAX_PATH + 1];
+  path_build(dir, MAX_PATH, assets_manager_get_res_root(am), "assets", NULL);
+
+  return manifest_of(dir);
+}
+
+TEST(AssetsManifest, basic) {
+  assets_manager_t* am = assets_manager_create(10);
+  assets_manifest_t* manifest = res_manifest(am);
+  const assets_manifest_entry_t* entry = NULL;
+
+  ASSERT_TRUE(manifest != NULL);
+  ASSERT_TRUE(manifest->nr > 0);
+
+  entry = assets_manifest_find(manifest, "default/raw/fonts/default.ttf");
+  ASSERT_TRUE(entry != NULL);
+  ASSERT_EQ(entry->size, (uint32_t)file_get_size("res/assets/default/raw/fonts/default.ttf"));
+
+  ASSERT_TRUE(assets_manifest_has(manifest, "default/raw/images/x1/earth.png"));
+  ASSERT_TRUE(assets_manifest_has(manifest, "default\\raw\\images\\x1\\earth.png"));
+  ASSERT_FALSE(assets_manifest_has(manifest, "default/raw/images/x1/not_exist.png"));
+  ASSERT_FALSE(assets_manifest_has(manifest, "default/raw/images/x1"));
+  ASSERT_FALSE(assets_manifest_has(manifest, ASSETS_MANIFEST_FILENAME));
+
+  assets_manifest_destroy(manifest);
+  assets_manager_destroy(am);
+}
+
+TEST(AssetsManifest, invalid) {
+  uint32_t data[4] = {ASSETS_MANIFEST_MAGIC, ASSETS_MANIFEST_VERSION, 1, 1};
+
+  ASSERT_TRUE(assets_manifest_create((const uint8_t*)data, sizeof(data)) == NULL);
+  data[0] = 0;
+  data[2] = 0;
+  ASSERT_TRUE(assets_manifest_create((const uint8_t*)data, sizeof(data)) == NULL);
+  ASSERT_TRUE(assets_manifest_create(NULL, 0) == NULL);
+}
+
+TEST(AssetsManifest, probes) {
+  asset_info_t* info = NULL;
+  assets_manager_t* am = assets_manager_create(10);
+  probe_loader_t* loader = probe_loader_create();
+  uint32_t probes = 0;
+
+  assets_manager_set_loader(am, ASSET_LOADER(loader));
+  assets_manager_set_manifest(am, NULL);
+
+  info = assets_manager_load(am, ASSET_TYPE_IMAGE, "china");
+  ASSERT_TRUE(info != NULL);
+  asset_info_unref(info);
+  probes = loader->probes;
+  ASSERT_TRUE(probes > 1);
+
+  loader->probes = 0;
+  assets_manager_set_manifest(am, res_manifest(am));
+  info = assets_manager_load(am, ASSET_TYPE_IMAGE, "china");
+  ASSERT_TRUE(info != NULL);
+  ASSERT_EQ(info->subtype, ASSET_TYPE_IMAGE_BSVG);
+  asset_info_unref(info);
+  ASSERT_EQ(loader->probes, 1u);
+
+  loader->probes = 0;
+  info = assets_manager_load(am, ASSET_TYPE_IMAGE, "1");
+  ASSERT_TRUE(info != NULL);
+  ASSERT_EQ(info->subtype, ASSET_TYPE_IMAGE_JPG);
+  asset_info_unref(info);
+  ASSERT_EQ(loader->probes, 1u);
+
+  loader->probes = 0;
+  info = assets_manager_load(am, ASSET_TYPE_FONT, "default");
+  ASSERT_TRUE(info != NULL);
+  asset_info_unref(info);
+  ASSERT_EQ(loader->probes, 1u);
+
+  loader->probes = 0;
+  ASSERT_TRUE(assets_manager_load(am, ASSET_TYPE_IMAGE, "not_exist") == NULL);
+  ASSERT_EQ(loader->probes, 0u);
+
+  assets_manager_destroy(am);
+}
+
+TEST(AssetsManifest, stale) {
+  char dir[MAX_PATH + 1];
+  assets_manager_t* am = assets_manager_create(10);
+
+  /*清单中没有的资源不再访问文件系统*/
+  path_build(dir, MAX_PATH, assets_manager_get_res_root(am), "assets", "default", "raw", NULL);
+  assets_manager_set_manifest(am, manifest_of(dir));
+  ASSERT_TRUE(assets_manager_load(am, ASSET_TYPE_IMAGE, "earth") == NULL);
+
+  assets_manager_set_manifest(am, NULL);
+  asset_info_t* info = assets_manager_load(am, ASSET_TYPE_IMAGE, "earth");
+  ASSERT_TRUE(info != NULL);
+  asset_info_unref(info);
+
+  assets_manager_destroy(am);
+}
+
+TEST(AssetsManifest, auto_load) {
+  char dir[MAX_PATH + 1];
+  char filename[MAX_PATH + 1];
+  asset_info_t* info = NULL;
+  assets_manager_t* am = assets_manager_create(10);
+  probe_loader_t* loader = probe_loader_create();
+
+  path_build(dir, MAX_PATH, assets_manager_get_res_root(am), "assets", NULL);
+  path_build(filename, MAX_PATH, dir, ASSETS_MANIFEST_FILENAME, NULL);
+  ASSERT_EQ(assets_manifest_save(dir, filename), RET_OK);
+
+  assets_manager_set_loader(am, ASSET_LOADER(loader));
+  info = assets_manager_load(am, ASSET_TYPE_IMAGE, "china");
+  fs_remove_file(os_fs(), filename);
+  ASSERT_TRUE(info != NULL);
+  asset_info_unref(info);
+  ASSERT_STREQ(am->manifest_dir, dir);
+  ASSERT_TRUE(am->manifest != NULL);
+  /*读取清单一次，加载图片一次*/
+  ASSERT_EQ(loader->probes, 2u);
+
+  ASSERT_EQ(assets_manager_reload_manifest(am), RET_OK);
+  ASSERT_TRUE(am->manifest == NULL);
+  ASSERT_TRUE(am->manifest_dir == NULL);
+
+  assets_manager_destroy(am);
+}
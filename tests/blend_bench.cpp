@@ -0,0 +1,98 @@
+﻿#include "tkc/utils.h"
+#include "tkc/platform.h"
+#include "tkc/time_now.h"
+#include "base/bitmap.h"
+#include "blend/image_g2d.h"
+#include "blend/blend_simd.h"
+
+#define BENCH_W 1280
+#define BENCH_H 800
+#define BENCH_NR 20
+
+typedef ret_t (*bench_func_t)(bitmap_t* dst, bitmap_t* src, uint8_t alpha);
+
+static void bench_init_bitmap(bitmap_t* b, uint32_t seed) {
+  uint32_t i = 0;
+  uint32_t size = b->line_length * b->h;
+  uint8_t* data = bitmap_lock_buffer_for_write(b);
+
+  for (i = 0; i < size; i++) {
+    seed = seed * 1103515245 + 12345;
+    data[i] = (uint8_t)(seed >> 16);
+    if (b->format != BITMAP_FMT_BGR565 && (i % 4) == 3) {
+      /*framebuffer是不透明的，图片的alpha随机*/
+      data[i] = seed == 0 ? 0 : 0xff;
+    }
+  }
+  bitmap_unlock_buffer(b);
+}
+
+static ret_t bench_blend(bitmap_t* dst, bitmap_t* src, uint8_t alpha) {
+  rectf_t r = {0, 0, (float_t)(dst->w), (float_t)(dst->h)};
+
+  return image_blend(dst, src, &r, &r, alpha);
+}
+
+static ret_t bench_fill(bitmap_t* dst, bitmap_t* src, uint8_t alpha) {
+  rect_t r = rect_init(0, 0, dst->w, dst->h);
+
+  return image_fill(dst, &r, color_init(0x20, 0x40, 0x80, alpha));
+}
+
+static double bench_run(bench_func_t func, bitmap_t* dst, bitmap_t* src, uint8_t alpha) {
+  uint32_t i = 0;
+  uint64_t start = time_now_us();
+
+  for (i = 0; i < BENCH_NR; i++) {
+    func(dst, src, alpha);
+  }
+
+  return (double)(dst->w * dst->h) * BENCH_NR / (double)(time_now_us() - start + 1);
+}
+
+static void bench(const char* name, bench_func_t func, bitmap_format_t dfmt,
+                  bitmap_format_t sfmt, uint8_t alpha) {
+  double scalar = 0;
+  double simd = 0;
+  bitmap_t* dst = bitmap_create_ex(BENCH_W, BENCH_H, 0, dfmt);
+  bitmap_t* src = bitmap_create_ex(BENCH_W, BENCH_H, 0, sfmt);
+
+  bench_init_bitmap(src, 1);
+  bench_init_bitmap(dst, 2);
+  if (sfmt != BITMAP_FMT_BGR565) {
+    /*源图片带随机alpha*/
+    uint32_t i = 0;
+    uint8_t* data = bitmap_lock_buffer_for_write(src);
+    for (i = 3; i < src->line_length * src->h; i += 4) {
+      data[i] = (uint8_t)(i * 7);
+    }
+    bitmap_unlock_buffer(src);
+  }
+
+  blend_simd_set_enable(FALSE);
+  scalar = bench_run(func, dst, src, alpha);
+  blend_simd_set_enable(TRUE);
+  simd = bench_run(func, dst, src, alpha);
+
+  log_info("%-28s alpha=0x%02x scalar=%8.1f Mpix/s simd=%8.1f Mpix/s x%.2f\n", name, alpha,
+           scalar, simd, simd / scalar);
+
+  bitmap_destroy(dst);
+  bitmap_destroy(src);
+}
+
+int main(int argc, char* argv[]) {
+  platform_prepare();
+
+  log_info("simd: %s\n", blend_simd_is_enabled() ? "yes" : "no");
+  bench("rgba8888 -> bgra8888", bench_blend, BITMAP_FMT_BGRA8888, BITMAP_FMT_RGBA8888, 0xff);
+  bench("rgba8888 -> bgra8888", bench_blend, BITMAP_FMT_BGRA8888, BITMAP_FMT_RGBA8888, 0x80);
+  bench("bgra8888 -> bgr565", bench_blend, BITMAP_FMT_BGR565, BITMAP_FMT_BGRA8888, 0xff);
+  bench("bgra8888 -> bgr565", bench_blend, BITMAP_FMT_BGR565, BITMAP_FMT_BGRA8888, 0x80);
+  bench("bgr565 -> bgr565", bench_blend, BITMAP_FMT_BGR565, BITMAP_FMT_BGR565, 0x80);
+  bench("fill bgra8888", bench_fill, BITMAP_FMT_BGRA8888, BITMAP_FMT_BGRA8888, 0x80);
+  bench("fill rgba8888", bench_fill, BITMAP_FMT_RGBA8888, BITMAP_FMT_RGBA8888, 0x80);
+  bench("fill bgr565", bench_fill, BITMAP_FMT_BGR565, BITMAP_FMT_BGR565, 0x80);
+
+  return 0;
+}
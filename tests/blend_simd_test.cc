@@ -0,0 +1,104 @@
+﻿#include "base/pixel.h"
+#include "tkc/color.h"
+#include "base/bitmap.h"
+#include "blend/image_g2d.h"
+#include "blend/blend_simd.h"
+#include "gtest/gtest.h"
+
+static void blend_simd_random_fill(bitmap_t* b, uint32_t seed, bool_t opaque) {
+  uint32_t i = 0;
+  uint32_t size = b->line_length * b->h;
+  uint8_t* data = bitmap_lock_buffer_for_write(b);
+
+  for (i = 0; i < size; i++) {
+    seed = seed * 1103515245 + 12345;
+    data[i] = (uint8_t)(seed >> 16);
+    if (opaque && b->format != BITMAP_FMT_BGR565 && (i % 4) == 3) {
+      /*大部分不透明，少量半透明，覆盖向量化函数回退到标量函数的情况*/
+      data[i] = (seed >> 8) % 16 == 0 ? data[i] : 0xff;
+    }
+  }
+  bitmap_unlock_buffer(b);
+}
+
+static bool_t blend_simd_same(bitmap_t* a, bitmap_t* b) {
+  bool_t ret = FALSE;
+  uint8_t* pa = bitmap_lock_buffer_for_read(a);
+  uint8_t* pb = bitmap_lock_buffer_for_read(b);
+
+  ret = memcmp(pa, pb, a->line_length * a->h) == 0;
+  bitmap_unlock_buffer(a);
+  bitmap_unlock_buffer(b);
+
+  return ret;
+}
+
+static void test_blend_simd(bitmap_format_t dfmt, bitmap_format_t sfmt, uint8_t alpha) {
+  uint32_t w = 37;
+  uint32_t h = 5;
+  rectf_t r = {3, 1, 29, 4};
+  bitmap_t* src = bitmap_create_ex(w, h, 0, sfmt);
+  bitmap_t* d1 = bitmap_create_ex(w, h, 0, dfmt);
+  bitmap_t* d2 = bitmap_create_ex(w, h, 0, dfmt);
+
+  blend_simd_random_fill(src, 1, FALSE);
+  blend_simd_random_fill(d1, 2, TRUE);
+  blend_simd_random_fill(d2, 2, TRUE);
+
+  blend_simd_set_enable(FALSE);
+  ASSERT_EQ(image_blend(d1, src, &r, &r, alpha), RET_OK);
+  blend_simd_set_enable(TRUE);
+  ASSERT_EQ(image_blend(d2, src, &r, &r, alpha), RET_OK);
+  ASSERT_TRUE(blend_simd_same(d1, d2));
+
+  bitmap_destroy(src);
+  bitmap_destroy(d1);
+  bitmap_destroy(d2);
+}
+
+static void test_fill_simd(bitmap_format_t fmt, color_t c) {
+  uint32_t w = 41;
+  uint32_t h = 4;
+  rect_t r = rect_init(1, 1, 39, 3);
+  bitmap_t* d1 = bitmap_create_ex(w, h, 0, fmt);
+  bitmap_t* d2 = bitmap_create_ex(w, h, 0, fmt);
+
+  blend_simd_random_fill(d1, 3, TRUE);
+  blend_simd_random_fill(d2, 3, TRUE);
+
+  blend_simd_set_enable(FALSE);
+  ASSERT_EQ(image_fill(d1, &r, c), RET_OK);
+  blend_simd_set_enable(TRUE);
+  ASSERT_EQ(image_fill(d2, &r, c), RET_OK);
+  ASSERT_TRUE(blend_simd_same(d1, d2));
+
+  bitmap_destroy(d1);
+  bitmap_destroy(d2);
+}
+
+TEST(BlendSimd, blend) {
+  uint32_t i = 0;
+  uint8_t alphas[] = {0xff, 0xf8, 0x80, 0x09};
+
+  for (i = 0; i < ARRAY_SIZE(alphas); i++) {
+    test_blend_simd(BITMAP_FMT_BGRA8888, BITMAP_FMT_RGBA8888, alphas[i]);
+    test_blend_simd(BITMAP_FMT_BGRA8888, BITMAP_FMT_BGRA8888, alphas[i]);
+    test_blend_simd(BITMAP_FMT_RGBA8888, BITMAP_FMT_RGBA8888, alphas[i]);
+    test_blend_simd(BITMAP_FMT_RGBA8888, BITMAP_FMT_BGRA8888, alphas[i]);
+    test_blend_simd(BITMAP_FMT_BGR565, BITMAP_FMT_BGRA8888, alphas[i]);
+    test_blend_simd(BITMAP_FMT_BGR565, BITMAP_FMT_RGBA8888, alphas[i]);
+    test_blend_simd(BITMAP_FMT_BGR565, BITMAP_FMT_BGR565, alphas[i]);
+  }
+}
+
+TEST(BlendSimd, fill) {
+  uint32_t i = 0;
+  color_t colors[] = {color_init(0x20, 0x30, 0x40, 0x20), color_init(0xff, 0xff, 0xff, 0xf8),
+                      color_init(0, 0, 0, 0x80), color_init(0x12, 0xfe, 0x80, 0x01)};
+
+  for (i = 0; i < ARRAY_SIZE(colors); i++) {
+    test_fill_simd(BITMAP_FMT_BGRA8888, colors[i]);
+    test_fill_simd(BITMAP_FMT_RGBA8888, colors[i]);
+    test_fill_simd(BITMAP_FMT_BGR565, colors[i]);
+  }
+}
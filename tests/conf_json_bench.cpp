@@ -0,0 +1,232 @@
+﻿#include "awtk.h"
+#include "tkc/fs.h"
+#include "tkc/time_now.h"
+#include "tkc/data_reader_file.h"
+#include "ubjson/ubjson_writer.h"
+#include "ubjson/ubjson_parser.h"
+#include "conf_io/conf_json.h"
+#include "conf_io/conf_ubjson.h"
+#include "conf_io/conf_json_parser.h"
+
+#define BENCH_JSON "bench_conf.json"
+#define BENCH_UBJSON "bench_conf.ubj"
+#define BENCH_ITEMS 40000
+#define BENCH_TIMES 5
+
+#ifdef LINUX
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+typedef enum _bench_mode_t {
+  BENCH_JSON_LEGACY = 0,
+  BENCH_JSON_STREAM,
+  BENCH_JSON_SAX,
+  BENCH_UBJSON_LEGACY,
+  BENCH_UBJSON_STREAM,
+  BENCH_UBJSON_SAX,
+  BENCH_MODE_NR
+} bench_mode_t;
+
+static const char* s_mode_names[BENCH_MODE_NR] = {
+    "json    legacy(read all + heap dom)", "json    stream(reader + arena dom)",
+    "json    sax(reader, no dom)",        "ubjson  legacy(read all + heap dom)",
+    "ubjson  stream(reader + arena dom)", "ubjson  sax(reader, no dom)"};
+
+typedef struct _bench_result_t {
+  uint64_t load_us;
+  uint64_t destroy_us;
+  uint32_t peak_kb;
+  uint32_t tokens;
+} bench_result_t;
+
+/*从/proc/self/status中读取内存统计(KB)*/
+static uint32_t proc_read_kb(const char* key) {
+  char line[256];
+  uint32_t value = 0;
+  uint32_t key_len = strlen(key);
+  FILE* fp = fopen("/proc/self/status", "r");
+
+  if (fp != NULL) {
+    while (fgets(line, sizeof(line), fp) != NULL) {
+      if (strncmp(line, key, key_len) == 0) {
+        value = tk_atoi(line + key_len);
+        break;
+      }
+    }
+    fclose(fp);
+  }
+
+  return value;
+}
+
+/*把VmHWM(峰值RSS)重置为当前的RSS*/
+static void proc_reset_peak(void) {
+  FILE* fp = fopen("/proc/self/clear_refs", "w");
+
+  if (fp != NULL) {
+    fputs("5", fp);
+    fclose(fp);
+  }
+}
+
+static ret_t bench_on_token(void* ctx, const void* data) {
+  (*(uint32_t*)ctx)++;
+
+  return RET_OK;
+}
+
+static ret_t bench_on_key_value(void* ctx, const char* key, value_t* v) {
+  (*(uint32_t*)ctx)++;
+
+  return RET_OK;
+}
+
+static void bench_run_once(bench_mode_t mode, bench_result_t* r) {
+  uint32_t size = 0;
+  void* data = NULL;
+  conf_doc_t* doc = NULL;
+  tk_object_t* obj = NULL;
+  data_reader_t* reader = NULL;
+  uint64_t start = time_now_us();
+
+  switch (mode) {
+    case BENCH_JSON_LEGACY: {
+      data = file_read(BENCH_JSON, &size);
+      doc = conf_doc_load_json((const char*)data, size);
+      TKMEM_FREE(data);
+      break;
+    }
+    case BENCH_JSON_STREAM: {
+      reader = data_reader_file_create(BENCH_JSON);
+      doc = conf_doc_load_json_reader(reader);
+      data_reader_destroy(reader);
+      break;
+    }
+    case BENCH_JSON_SAX: {
+      reader = data_reader_file_create(BENCH_JSON);
+      conf_json_parse(reader, bench_on_token, &(r->tokens));
+      data_reader_destroy(reader);
+      break;
+    }
+    case BENCH_UBJSON_LEGACY: {
+      data = file_read(BENCH_UBJSON, &size);
+      doc = conf_doc_load_ubjson(data, size);
+      TKMEM_FREE(data);
+      break;
+    }
+    case BENCH_UBJSON_STREAM: {
+      obj = conf_ubjson_load("file://" BENCH_UBJSON, FALSE);
+      break;
+    }
+    default: {
+      reader = data_reader_file_create(BENCH_UBJSON);
+      ubjson_parse_reader(reader, bench_on_key_value, &(r->tokens));
+      data_reader_destroy(reader);
+      break;
+    }
+  }
+  r->load_us += time_now_us() - start;
+
+  start = time_now_us();
+  if (doc != NULL) {
+    conf_doc_destroy(doc);
+  }
+  TK_OBJECT_UNREF(obj);
+  r->destroy_us += time_now_us() - start;
+}
+
+/*在子进程中运行，保证每种方式的内存峰值互不影响*/
+static void bench_run(bench_mode_t mode, uint32_t file_size) {
+  int out[2];
+  bench_result_t r;
+
+  (void)!pipe(out);
+  if (fork() == 0) {
+    uint32_t i = 0;
+    uint32_t base = 0;
+
+    memset(&r, 0x00, sizeof(r));
+    proc_reset_peak();
+    base = proc_read_kb("VmHWM:");
+    bench_run_once(mode, &r);
+    r.peak_kb = proc_read_kb("VmHWM:") - base;
+
+    for (i = 1; i < BENCH_TIMES; i++) {
+      bench_run_once(mode, &r);
+    }
+    (void)!write(out[1], &r, sizeof(r));
+    _exit(0);
+  }
+
+  (void)!read(out[0], &r, sizeof(r));
+  wait(NULL);
+  close(out[0]), close(out[1]);
+
+  log_info("%-36s %8.2fMB/s  load: %8.2fms  destroy: %7.2fms  peak: %7uKB\n",
+           s_mode_names[mode], file_size * (double)BENCH_TIMES / r.load_us,
+           r.load_us / 1000.0 / BENCH_TIMES, r.destroy_us / 1000.0 / BENCH_TIMES, r.peak_kb);
+}
+
+static void bench_gen_files(void) {
+  str_t str;
+  wbuffer_t wb;
+  uint32_t i = 0;
+  char buff[512];
+  ubjson_writer_t ub;
+  conf_doc_t* doc = NULL;
+
+  str_init(&str, 1024 * 1024);
+  str_append(&str, "{\n  \"version\": 1,\n  \"items\": [\n");
+  for (i = 0; i < BENCH_ITEMS; i++) {
+    tk_snprintf(buff, sizeof(buff),
+                "    {\"id\": %u, \"name\": \"item %u\", \"price\": %u.%02u, \"enabled\": %s, "
+                "\"tags\": [\"tag%u\", \"group%u\"], \"description\": \"the description of "
+                "item %u, long enough to be stored out of line\"}%s\n",
+                i, i, i / 100, i % 100, i % 2 ? "true" : "false", i % 7, i % 13, i,
+                i + 1 < BENCH_ITEMS ? "," : "");
+    str_append(&str, buff);
+  }
+  str_append(&str, "  ]\n}\n");
+  file_write(BENCH_JSON, str.str, str.size);
+
+  doc = conf_doc_load_json(str.str, str.size);
+  wbuffer_init_extendable(&wb);
+  ubjson_writer_init(&ub, (ubjson_write_callback_t)wbuffer_write_binary, &wb);
+  conf_doc_save_ubjson(doc, &ub);
+  file_write(BENCH_UBJSON, wb.data, wb.cursor);
+
+  log_info("json: %.2fMB  ubjson: %.2fMB  items: %u  times: %u\n", str.size / 1048576.0,
+           wb.cursor / 1048576.0, BENCH_ITEMS, BENCH_TIMES);
+
+  wbuffer_deinit(&wb);
+  conf_doc_destroy(doc);
+  str_reset(&str);
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t i = 0;
+  int32_t json_size = 0;
+  int32_t ubjson_size = 0;
+
+  tk_init(320, 480, APP_CONSOLE, NULL, "./");
+  bench_gen_files();
+  json_size = file_get_size(BENCH_JSON);
+  ubjson_size = file_get_size(BENCH_UBJSON);
+
+  for (i = 0; i < BENCH_MODE_NR; i++) {
+    bench_run((bench_mode_t)i, i < BENCH_UBJSON_LEGACY ? json_size : ubjson_size);
+  }
+
+  file_remove(BENCH_JSON);
+  file_remove(BENCH_UBJSON);
+  tk_exit();
+
+  return 0;
+}
+#else
+int main(int argc, char* argv[]) {
+  log_info("only supported on linux\n");
+  return 0;
+}
+#endif /*LINUX*/
@@ -0,0 +1,235 @@
+﻿#include "gtest/gtest.h"
+#include "tkc/utils.h"
+#include "tkc/data_reader_mem.h"
+#include "tkc/data_reader_factory.h"
+#include "conf_io/conf_json.h"
+#include "conf_io/conf_json_parser.h"
+
+#include <string>
+
+using std::string;
+
+static data_reader_t* create_reader(const string& data) {
+  char url[MAX_PATH + 1] = {0};
+  data_reader_mem_build_url(data.c_str(), data.size(), url);
+
+  return data_reader_factory_create_reader(data_reader_factory(), url);
+}
+
+static ret_t on_token_dump(void* ctx, const void* data) {
+  string* log = (string*)ctx;
+  conf_json_parser_t* parser = (conf_json_parser_t*)data;
+  char buff[64] = {0};
+
+  switch (parser->token) {
+    case CONF_JSON_TOKEN_OBJECT_BEGIN: {
+      *log += "{";
+      break;
+    }
+    case CONF_JSON_TOKEN_OBJECT_END: {
+      *log += "}";
+      break;
+    }
+    case CONF_JSON_TOKEN_ARRAY_BEGIN: {
+      *log += "[";
+      break;
+    }
+    case CONF_JSON_TOKEN_ARRAY_END: {
+      *log += "]";
+      break;
+    }
+    default: {
+      const char* str = value_str_ex(&(parser->value), buff, sizeof(buff) - 1);
+      *log += str != NULL ? str : "null";
+      break;
+    }
+  }
+
+  if (parser->name != NULL) {
+    *log += string("@") + parser->name;
+  }
+  tk_snprintf(buff, sizeof(buff), "#%u:%u;", parser->index, parser->level);
+  *log += buff;
+
+  return RET_OK;
+}
+
+static string parse_to_string(const string& data) {
+  string log;
+  data_reader_t* reader = create_reader(data);
+
+  EXPECT_EQ(conf_json_parse(reader, on_token_dump, &log), RET_OK);
+  data_reader_destroy(reader);
+
+  return log;
+}
+
+static string doc_to_json(conf_doc_t* doc) {
+  str_t str;
+  string ret;
+
+  str_init(&str, 100);
+  conf_doc_save_json(doc, &str);
+  ret = str.str;
+  str_reset(&str);
+
+  return ret;
+}
+
+TEST(ConfJsonParser, tokens) {
+  ASSERT_EQ(parse_to_string("{\"a\":1, \"b\":[true, false, null], \"c\":{\"d\":\"str\"}}"),
+            "{#0:0;1@a#0:1;[@b#1:1;true#0:2;false#1:2;null#2:2;]#0:1;"
+            "{@c#2:1;str@d#0:2;}#0:1;}#0:0;");
+  ASSERT_EQ(parse_to_string("[[1,2],[]]"), "[#0:0;[#0:1;1#0:2;2#1:2;]#0:1;[#1:1;]#0:1;]#0:0;");
+  ASSERT_EQ(parse_to_string("  123  "), "123#0:0;");
+  ASSERT_EQ(parse_to_string(""), "");
+}
+
+TEST(ConfJsonParser, values) {
+  conf_json_parser_t* parser = NULL;
+  string data = "[1, -2, 1.5, 2E3, 5000000000, \"a\\\"b\\n\", \"a\\tb\"]";
+  data_reader_t* reader = create_reader(data);
+
+  parser = conf_json_parser_create(reader);
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(parser->token, CONF_JSON_TOKEN_ARRAY_BEGIN);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(parser->value.type, VALUE_TYPE_INT32);
+  ASSERT_EQ(value_int(&(parser->value)), 1);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(value_int(&(parser->value)), -2);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(parser->value.type, VALUE_TYPE_DOUBLE);
+  ASSERT_EQ(value_double(&(parser->value)), 1.5);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(value_double(&(parser->value)), 2000);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(parser->value.type, VALUE_TYPE_INT64);
+  ASSERT_EQ(value_int64(&(parser->value)), 5000000000LL);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_STREQ(value_str(&(parser->value)), "a\"b\n");
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_STREQ(value_str(&(parser->value)), "a\tb");
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(parser->token, CONF_JSON_TOKEN_ARRAY_END);
+  ASSERT_EQ(conf_json_parser_next(parser), RET_EOS);
+  ASSERT_EQ(conf_json_parser_next(parser), RET_EOS);
+
+  conf_json_parser_destroy(parser);
+  data_reader_destroy(reader);
+}
+
+TEST(ConfJsonParser, comments) {
+  ASSERT_EQ(parse_to_string("/*c*/{//c\n\"a\"/*c*/:/*c*/1/*c*/,//c\n\"b\":2,}//c"),
+            "{#0:0;1@a#0:1;2@b#1:1;}#0:0;");
+}
+
+TEST(ConfJsonParser, error) {
+  string log;
+  string data = "{\"a\":[1,2";
+  data_reader_t* reader = create_reader(data);
+
+  ASSERT_NE(conf_json_parse(reader, on_token_dump, &log), RET_OK);
+  ASSERT_EQ(log, "{#0:0;[@a#0:1;1#0:2;2#1:2;");
+  data_reader_destroy(reader);
+}
+
+static ret_t on_token_stop(void* ctx, const void* data) {
+  conf_json_parser_t* parser = (conf_json_parser_t*)data;
+
+  if (parser->token == CONF_JSON_TOKEN_VALUE && tk_str_eq(parser->name, "id")) {
+    *(int32_t*)ctx = value_int(&(parser->value));
+    return RET_STOP;
+  }
+
+  return RET_OK;
+}
+
+TEST(ConfJsonParser, stop) {
+  int32_t id = 0;
+  string data = "{\"name\":\"awtk\", \"id\":100, \"list\":[1,2,3]}";
+  data_reader_t* reader = create_reader(data);
+
+  ASSERT_EQ(conf_json_parse(reader, on_token_stop, &id), RET_OK);
+  ASSERT_EQ(id, 100);
+  data_reader_destroy(reader);
+}
+
+TEST(ConfJsonParser, chunks) {
+  uint32_t i = 0;
+  string data = "{";
+  string log;
+
+  /*让字符串和转义字符跨越读取缓冲区的边界*/
+  for (i = 0; i < 300; i++) {
+    char name[32];
+    tk_snprintf(name, sizeof(name), "%s\"key%u\":", i > 0 ? "," : "", i);
+    data += name;
+    data += "\"" + string(i % 37, 'x') + "\\\"" + string(i % 11, 'y') + "\"";
+  }
+  data += "}";
+  ASSERT_GT(data.size(), (size_t)CONF_JSON_PARSER_BUFF_SIZE * 2);
+
+  data_reader_t* reader = create_reader(data);
+  conf_json_parser_t* parser = conf_json_parser_create(reader);
+
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  for (i = 0; i < 300; i++) {
+    char name[32];
+    string expected = string(i % 37, 'x') + "\"" + string(i % 11, 'y');
+
+    tk_snprintf(name, sizeof(name), "key%u", i);
+    ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+    ASSERT_STREQ(parser->name, name);
+    ASSERT_EQ(parser->index, i);
+    ASSERT_EQ(expected, value_str(&(parser->value)));
+  }
+  ASSERT_EQ(conf_json_parser_next(parser), RET_OK);
+  ASSERT_EQ(parser->token, CONF_JSON_TOKEN_OBJECT_END);
+  ASSERT_EQ(conf_json_parser_next(parser), RET_EOS);
+
+  conf_json_parser_destroy(parser);
+  data_reader_destroy(reader);
+}
+
+TEST(ConfJsonParser, load_reader) {
+  value_t v;
+  string data =
+      "//comment\n{\"name\":\"a long string stored in the arena\", \"tom\":{\"age\":100, "
+      "\"weight\":60.5, \"tags\":[\"a\", \"b\", [1, 2], {\"x\":true}], \"empty\":[]}, "
+      "\"nil\":null, \"obj\":{}}";
+  data_reader_t* reader = create_reader(data);
+  conf_doc_t* legacy = conf_doc_load_json(data.c_str(), data.size());
+  conf_doc_t* doc = conf_doc_load_json_reader(reader);
+
+  ASSERT_TRUE(doc != NULL);
+  ASSERT_EQ(doc_to_json(doc), doc_to_json(legacy));
+
+  ASSERT_STREQ(conf_doc_get_str(doc, "name", NULL), "a long string stored in the arena");
+  ASSERT_EQ(conf_doc_get(doc, "tom.tags.[2].[1]", &v), RET_OK);
+  ASSERT_EQ(value_int(&v), 2);
+  ASSERT_EQ(conf_doc_get(doc, "tom.tags.[3].x", &v), RET_OK);
+  ASSERT_EQ(value_bool(&v), TRUE);
+
+  /*加载后的文档可以正常修改*/
+  value_set_str(&v, "another long string allocated from heap");
+  ASSERT_EQ(conf_doc_set(doc, "name", &v), RET_OK);
+  ASSERT_EQ(conf_doc_set(doc, "tom.city", &v), RET_OK);
+  ASSERT_EQ(conf_doc_remove(doc, "tom.tags"), RET_OK);
+  ASSERT_STREQ(conf_doc_get_str(doc, "name", NULL), "another long string allocated from heap");
+  ASSERT_STREQ(conf_doc_get_str(doc, "tom.city", NULL),
+               "another long string allocated from heap");
+  ASSERT_NE(conf_doc_get(doc, "tom.tags.[0]", &v), RET_OK);
+
+  conf_doc_destroy(doc);
+  conf_doc_destroy(legacy);
+  data_reader_destroy(reader);
+}
@@ -484,3 +484,63 @@ TEST(ConfNode, foreach_path) {
   TK_OBJECT_UNREF(data);
   str_destroy(str);
 }
+
+TEST(ConfNode, arena) {
+  value_t v;
+  uint32_t i = 0;
+  char name[64];
+  char big[1001];
+  conf_node_t* node = NULL;
+  conf_doc_t* doc = conf_doc_create_with_arena(256);
+
+  memset(big, 'x', sizeof(big) - 1);
+  big[sizeof(big) - 1] = '\0';
+  doc->root = conf_doc_create_node(doc, CONF_NODE_ROOT_NAME);
+
+  for (i = 0; i < 100; i++) {
+    tk_snprintf(name, sizeof(name), "a_long_node_name_in_arena_%u", i);
+    node = conf_doc_create_node(doc, name);
+    ASSERT_TRUE(node->is_arena_node);
+    ASSERT_TRUE(node->is_arena_name);
+    conf_doc_append_child(doc, doc->root, node);
+
+    tk_snprintf(name, sizeof(name), "a long string value in arena %u", i);
+    value_set_str(&v, i % 10 == 0 ? big : name);
+    ASSERT_EQ(conf_doc_set_node_value(doc, node, &v), RET_OK);
+    ASSERT_TRUE(node->is_arena_value);
+  }
+
+  tk_snprintf(name, sizeof(name), "a long string value in arena %u", 99);
+  ASSERT_STREQ(conf_doc_get_str(doc, "a_long_node_name_in_arena_99", NULL), name);
+  ASSERT_STREQ(conf_doc_get_str(doc, "a_long_node_name_in_arena_90", NULL), big);
+
+  /*用自身的值重新设置*/
+  node = conf_node_find_child(doc->root, "a_long_node_name_in_arena_1");
+  value_set_str(&v, node->value.str);
+  ASSERT_EQ(conf_doc_set_node_value(doc, node, &v), RET_OK);
+  ASSERT_STREQ(conf_node_get_value_str(node, NULL), "a long string value in arena 1");
+
+  /*值从arena改为堆*/
+  value_set_int(&v, 123);
+  ASSERT_EQ(conf_node_set_value(node, &v), RET_OK);
+  ASSERT_FALSE(node->is_arena_value);
+  value_set_str(&v, "a long string value in heap memory");
+  ASSERT_EQ(conf_node_set_value(node, &v), RET_OK);
+  ASSERT_FALSE(node->is_arena_value);
+
+  ASSERT_EQ(conf_doc_remove(doc, "a_long_node_name_in_arena_2"), RET_OK);
+  ASSERT_NE(conf_doc_get(doc, "a_long_node_name_in_arena_2", &v), RET_OK);
+
+  ASSERT_EQ(conf_doc_stop_arena(doc), RET_OK);
+  node = conf_doc_create_node(doc, "a_long_node_name_in_heap");
+  ASSERT_FALSE(node->is_arena_node);
+  ASSERT_FALSE(node->is_arena_name);
+  conf_doc_append_child(doc, doc->root, node);
+  value_set_str(&v, "a long string value in heap memory");
+  ASSERT_EQ(conf_doc_set_node_value(doc, node, &v), RET_OK);
+  ASSERT_FALSE(node->is_arena_value);
+  ASSERT_STREQ(conf_doc_get_str(doc, "a_long_node_name_in_heap", NULL),
+               "a long string value in heap memory");
+
+  conf_doc_destroy(doc);
+}
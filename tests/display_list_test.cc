@@ -0,0 +1,239 @@
+﻿#include "base/canvas.h"
+#include "base/display_list.h"
+#include "base/font_manager.h"
+#include "widgets/view.h"
+#include "base/window.h"
+#include "base/window_animator.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "gtest/gtest.h"
+
+#define DL_W 320
+#define DL_H 240
+
+static uint32_t s_dl_paint_count = 0;
+
+static ret_t display_list_test_on_paint(void* ctx, event_t* e) {
+  bitmap_t img;
+  uint32_t i = 0;
+  canvas_t* c = paint_event_cast(e)->c;
+  widget_t* widget = WIDGET(e->target);
+  point_t points[] = {{1, 1}, {3, 3}, {5, 5}};
+
+  s_dl_paint_count++;
+  canvas_set_fill_color(c, color_init(0x20, 0x40, 0x80, 0xff));
+  canvas_fill_rect(c, 0, 0, widget->w, widget->h);
+  canvas_set_stroke_color(c, color_init(0xff, 0, 0, 0xff));
+  canvas_stroke_rect(c, 2, 2, widget->w - 4, widget->h - 4);
+  canvas_draw_points(c, points, ARRAY_SIZE(points));
+
+  if (image_manager_get_bitmap(image_manager(), "checked", &img) == RET_OK) {
+    rect_t src = rect_init(0, 0, img.w, img.h);
+
+    for (i = 0; i < 5; i++) {
+      rect_t dst = rect_init(i * 30, 20 + i * 10, img.w * 2, img.h * 2);
+      canvas_draw_image(c, &img, &src, &dst);
+    }
+  }
+
+  canvas_set_global_alpha(c, 0x80);
+  canvas_set_text_color(c, color_init(0xff, 0xff, 0xff, 0xff));
+  canvas_set_font(c, NULL, 14);
+  for (i = 0; i < 4; i++) {
+    canvas_draw_utf8(c, "Hello AWTK 1234567890", 10, 60 + i * 16);
+  }
+  canvas_set_global_alpha(c, 0xff);
+
+  return RET_OK;
+}
+
+static ret_t display_list_test_on_paint_vg(void* ctx, event_t* e) {
+  canvas_t* c = paint_event_cast(e)->c;
+  vgcanvas_t* vg = canvas_get_vgcanvas(c);
+
+  s_dl_paint_count++;
+  canvas_set_fill_color(c, color_init(0x80, 0x40, 0x20, 0xff));
+  canvas_fill_rect(c, 10, 10, 50, 50);
+  (void)vg;
+
+  return RET_OK;
+}
+
+static widget_t* display_list_test_create(event_func_t on_paint) {
+  widget_t* win = view_create(NULL, 20, 10, 200, 160);
+  widget_t* view = view_create(win, 10, 10, 180, 140);
+
+  widget_on(view, EVT_PAINT, on_paint, NULL);
+
+  return win;
+}
+
+TEST(DisplayList, basic) {
+  canvas_t c;
+  rect_t r = rect_init(0, 0, 100, 100);
+  lcd_t* lcd = lcd_mem_bgra8888_create(DL_W, DL_H, TRUE);
+  display_list_t* dl = display_list_create();
+
+  canvas_init(&c, lcd, font_manager());
+  ASSERT_EQ(dl->dirty, TRUE);
+  ASSERT_EQ(dl->valid, FALSE);
+  ASSERT_EQ(display_list_is_supported(&c), TRUE);
+  ASSERT_EQ(display_list_is_recording(&c), FALSE);
+
+  ASSERT_EQ(display_list_begin_record(dl, &c, &r), RET_OK);
+  ASSERT_EQ(display_list_is_recording(&c), TRUE);
+  ASSERT_EQ(display_list_is_supported(&c), FALSE);
+  canvas_set_fill_color(&c, color_init(0xff, 0, 0, 0xff));
+  canvas_fill_rect(&c, 0, 0, 10, 10);
+  ASSERT_EQ(display_list_end_record(dl), RET_OK);
+  ASSERT_EQ(c.lcd == lcd, true);
+  ASSERT_EQ(dl->valid, TRUE);
+  ASSERT_EQ(dl->dirty, FALSE);
+  /*3个初始颜色+设置颜色+填充矩形*/
+  ASSERT_EQ(dl->nr, 5u);
+  ASSERT_EQ(dl->size > 0, true);
+
+  ASSERT_EQ(display_list_invalidate(dl), RET_OK);
+  ASSERT_EQ(dl->dirty, TRUE);
+
+  /*比lcd大的区域不能录制*/
+  r = rect_init(0, 0, DL_W + 1, DL_H);
+  ASSERT_EQ(display_list_begin_record(dl, &c, &r), RET_NOT_IMPL);
+
+  /*用到vgcanvas时不能回放*/
+  r = rect_init(0, 0, 100, 100);
+  ASSERT_EQ(display_list_begin_record(dl, &c, &r), RET_OK);
+  canvas_get_vgcanvas(&c);
+  ASSERT_EQ(display_list_end_record(dl), RET_FAIL);
+  ASSERT_EQ(dl->valid, FALSE);
+  ASSERT_EQ(dl->nr, 0u);
+
+  display_list_destroy(dl);
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+}
+
+TEST(DisplayList, replay) {
+  canvas_t c1;
+  canvas_t c2;
+  lcd_t* lcd1 = lcd_mem_bgra8888_create(DL_W, DL_H, TRUE);
+  lcd_t* lcd2 = lcd_mem_bgra8888_create(DL_W, DL_H, TRUE);
+  widget_t* win = display_list_test_create(display_list_test_on_paint);
+  uint8_t* fb1 = ((lcd_mem_t*)lcd1)->offline_fb;
+  uint8_t* fb2 = ((lcd_mem_t*)lcd2)->offline_fb;
+
+  canvas_init(&c1, lcd1, font_manager());
+  canvas_init(&c2, lcd2, font_manager());
+
+  /*第一次绘制时录制*/
+  s_dl_paint_count = 0;
+  canvas_begin_frame(&c1, NULL, LCD_DRAW_OFFLINE);
+  canvas_begin_frame(&c2, NULL, LCD_DRAW_OFFLINE);
+  ASSERT_EQ(widget_paint(win, &c1), RET_OK);
+  ASSERT_EQ(widget_paint_with_display_list(win, &c2), RET_OK);
+  ASSERT_EQ(s_dl_paint_count, 2u);
+  ASSERT_EQ(win->display_list != NULL, true);
+  ASSERT_EQ(win->display_list->valid, TRUE);
+  ASSERT_EQ(memcmp(fb1, fb2, DL_W * DL_H * 4), 0);
+
+  /*平移后回放，不再调用控件的绘制函数*/
+  memset(fb1, 0x00, DL_W * DL_H * 4);
+  memset(fb2, 0x00, DL_W * DL_H * 4);
+  canvas_translate(&c1, 73, -25);
+  canvas_translate(&c2, 73, -25);
+  widget_paint(win, &c1);
+  widget_paint_with_display_list(win, &c2);
+  ASSERT_EQ(s_dl_paint_count, 3u);
+  ASSERT_EQ(memcmp(fb1, fb2, DL_W * DL_H * 4), 0);
+  canvas_untranslate(&c1, 73, -25);
+  canvas_untranslate(&c2, 73, -25);
+
+  /*子控件失效后重新录制*/
+  widget_invalidate(widget_get_child(win, 0), NULL);
+  ASSERT_EQ(win->display_list->dirty, TRUE);
+  widget_paint_with_display_list(win, &c2);
+  ASSERT_EQ(s_dl_paint_count, 4u);
+  ASSERT_EQ(win->display_list->dirty, FALSE);
+
+  /*属性变化后重新录制*/
+  widget_set_prop_int(win, "tag", 1);
+  ASSERT_EQ(win->display_list->dirty, TRUE);
+
+  canvas_end_frame(&c1);
+  canvas_end_frame(&c2);
+
+  widget_destroy(win);
+  canvas_reset(&c1);
+  canvas_reset(&c2);
+  lcd_destroy(lcd1);
+  lcd_destroy(lcd2);
+}
+
+TEST(DisplayList, fallback) {
+  canvas_t c1;
+  canvas_t c2;
+  lcd_t* lcd1 = lcd_mem_bgra8888_create(DL_W, DL_H, TRUE);
+  lcd_t* lcd2 = lcd_mem_bgra8888_create(DL_W, DL_H, TRUE);
+  widget_t* win = display_list_test_create(display_list_test_on_paint_vg);
+  uint8_t* fb1 = ((lcd_mem_t*)lcd1)->offline_fb;
+  uint8_t* fb2 = ((lcd_mem_t*)lcd2)->offline_fb;
+
+  canvas_init(&c1, lcd1, font_manager());
+  canvas_init(&c2, lcd2, font_manager());
+  canvas_begin_frame(&c1, NULL, LCD_DRAW_OFFLINE);
+  canvas_begin_frame(&c2, NULL, LCD_DRAW_OFFLINE);
+
+  /*不能回放时直接绘制，在失效之前不再尝试录制*/
+  s_dl_paint_count = 0;
+  widget_paint(win, &c1);
+  widget_paint_with_display_list(win, &c2);
+  ASSERT_EQ(s_dl_paint_count, 3u);
+  ASSERT_EQ(win->display_list->valid, FALSE);
+  ASSERT_EQ(memcmp(fb1, fb2, DL_W * DL_H * 4), 0);
+
+  widget_paint_with_display_list(win, &c2);
+  ASSERT_EQ(s_dl_paint_count, 4u);
+
+  canvas_end_frame(&c1);
+  canvas_end_frame(&c2);
+
+  widget_destroy(win);
+  canvas_reset(&c1);
+  canvas_reset(&c2);
+  lcd_destroy(lcd1);
+  lcd_destroy(lcd2);
+}
+
+TEST(DisplayList, window_animator_release) {
+  canvas_t c;
+  window_animator_t* wa = NULL;
+  window_animator_vtable_t vt;
+  lcd_t* lcd = lcd_mem_bgra8888_create(DL_W, DL_H, TRUE);
+  widget_t* prev = window_create(NULL, 0, 0, DL_W, DL_H);
+  widget_t* curr = window_create(NULL, 0, 0, DL_W, DL_H);
+
+  canvas_init(&c, lcd, font_manager());
+  canvas_begin_frame(&c, NULL, LCD_DRAW_OFFLINE);
+  ASSERT_EQ(widget_paint_with_display_list(prev, &c), RET_OK);
+  ASSERT_EQ(widget_paint_with_display_list(curr, &c), RET_OK);
+  canvas_end_frame(&c);
+  ASSERT_EQ(prev->display_list != NULL, true);
+  ASSERT_EQ(curr->display_list != NULL, true);
+
+  /*动画结束后释放录制的绘制命令*/
+  memset(&vt, 0x00, sizeof(vt));
+  vt.type = "test";
+  vt.size = sizeof(window_animator_t);
+  wa = window_animator_create(TRUE, &vt);
+  ASSERT_EQ(wa != NULL, true);
+  wa->prev_win = prev;
+  wa->curr_win = curr;
+  ASSERT_EQ(window_animator_destroy(wa), RET_OK);
+  ASSERT_EQ(prev->display_list == NULL, true);
+  ASSERT_EQ(curr->display_list == NULL, true);
+
+  widget_destroy(curr);
+  widget_destroy(prev);
+  idle_dispatch();
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+}
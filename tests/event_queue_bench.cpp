@@ -0,0 +1,125 @@
+﻿#include "tkc/mutex.h"
+#include "tkc/utils.h"
+#include "tkc/thread.h"
+#include "tkc/platform.h"
+#include "tkc/time_now.h"
+#include "tkc/lf_queue.h"
+#include "base/event_queue.h"
+
+#define BENCH_QUEUE_SIZE 64
+#define BENCH_ITEMS 200000
+#define BENCH_MAX_PRODUCERS 8
+
+typedef struct _bench_queue_t {
+  bool_t lock_free;
+  tk_mutex_t* mutex;
+  event_queue_t* queue;
+  tk_lf_queue_t* lf_queue;
+  uint32_t full_nr;
+} bench_queue_t;
+
+static ret_t bench_queue_send(bench_queue_t* q, const event_queue_req_t* r) {
+  ret_t ret = RET_OK;
+
+  if (q->lock_free) {
+    return tk_lf_queue_push(q->lf_queue, r);
+  }
+
+  tk_mutex_lock(q->mutex);
+  ret = event_queue_send(q->queue, r);
+  tk_mutex_unlock(q->mutex);
+
+  return ret;
+}
+
+static uint32_t bench_queue_recv(bench_queue_t* q, event_queue_req_t* r, uint32_t max_nr) {
+  uint32_t nr = 0;
+
+  if (q->lock_free) {
+    return tk_lf_queue_pop_batch(q->lf_queue, r, max_nr);
+  }
+
+  tk_mutex_lock(q->mutex);
+  while (nr < max_nr && event_queue_recv(q->queue, r + nr) == RET_OK) {
+    nr++;
+  }
+  tk_mutex_unlock(q->mutex);
+
+  return nr;
+}
+
+static void* bench_producer(void* args) {
+  uint32_t i = 0;
+  event_queue_req_t r;
+  bench_queue_t* q = (bench_queue_t*)args;
+
+  memset(&r, 0x00, sizeof(r));
+  r.event.type = REQ_EXEC_IN_UI;
+  for (i = 0; i < BENCH_ITEMS; i++) {
+    while (bench_queue_send(q, &r) != RET_OK) {
+      q->full_nr++;
+      sleep_ms(0);
+    }
+  }
+
+  return NULL;
+}
+
+static double bench_run(bool_t lock_free, uint32_t producers) {
+  uint32_t i = 0;
+  uint32_t nr = 0;
+  uint64_t start = 0;
+  bench_queue_t q;
+  event_queue_req_t r[8];
+  tk_thread_t* threads[BENCH_MAX_PRODUCERS];
+
+  memset(&q, 0x00, sizeof(q));
+  q.lock_free = lock_free;
+  if (lock_free) {
+    q.lf_queue = tk_lf_queue_create(sizeof(event_queue_req_t), BENCH_QUEUE_SIZE);
+  } else {
+    q.mutex = tk_mutex_create();
+    q.queue = event_queue_create(BENCH_QUEUE_SIZE);
+  }
+
+  start = time_now_us();
+  for (i = 0; i < producers; i++) {
+    threads[i] = tk_thread_create(bench_producer, &q);
+    tk_thread_start(threads[i]);
+  }
+
+  /*模拟UI线程：批量取出事件*/
+  while (nr < producers * BENCH_ITEMS) {
+    nr += bench_queue_recv(&q, r, ARRAY_SIZE(r));
+  }
+
+  for (i = 0; i < producers; i++) {
+    tk_thread_join(threads[i]);
+    tk_thread_destroy(threads[i]);
+  }
+
+  if (lock_free) {
+    tk_lf_queue_destroy(q.lf_queue);
+  } else {
+    event_queue_destroy(q.queue);
+    tk_mutex_destroy(q.mutex);
+  }
+
+  return (double)nr / (double)(time_now_us() - start + 1);
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t producers = 0;
+
+  platform_prepare();
+
+  for (producers = 1; producers <= BENCH_MAX_PRODUCERS; producers *= 2) {
+    double mutex = bench_run(FALSE, producers);
+    double lf = bench_run(TRUE, producers);
+
+    log_info("producers=%u mutex=%6.2f Mevents/s lock_free=%6.2f Mevents/s x%.2f\n", producers,
+             mutex, lf, lf / mutex);
+  }
+
+  return 0;
+}
@@ -51,3 +51,56 @@ TEST(EventQueue, basic) {
 
   event_queue_destroy(q);
 }
+
+TEST(EventQueue, coalesce) {
+  event_queue_req_t last;
+  event_queue_req_t r;
+  void* target = &last;
+
+  memset(&last, 0x00, sizeof(last));
+  memset(&r, 0x00, sizeof(r));
+
+  last.pointer_event.e.type = EVT_POINTER_MOVE;
+  last.pointer_event.x = 1;
+  last.pointer_event.y = 2;
+  r = last;
+  r.pointer_event.x = 10;
+  r.pointer_event.y = 20;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_OK);
+  ASSERT_EQ(last.pointer_event.x, 10);
+  ASSERT_EQ(last.pointer_event.y, 20);
+
+  r.pointer_event.pressed = TRUE;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_FAIL);
+  r.pointer_event.pressed = FALSE;
+  r.pointer_event.e.target = target;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_FAIL);
+  r.pointer_event.e.target = NULL;
+  r.pointer_event.e.type = EVT_POINTER_UP;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_FAIL);
+
+  memset(&last, 0x00, sizeof(last));
+  last.wheel_event.e.type = EVT_WHEEL;
+  last.wheel_event.dy = 12;
+  r = last;
+  r.wheel_event.dy = 24;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_OK);
+  ASSERT_EQ(last.wheel_event.dy, 36);
+  r.wheel_event.ctrl = TRUE;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_FAIL);
+
+  memset(&last, 0x00, sizeof(last));
+  last.touch_event.e.type = EVT_TOUCH_MOVE;
+  last.touch_event.finger_id = 1;
+  r = last;
+  r.touch_event.x = 0.5f;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_OK);
+  ASSERT_EQ(last.touch_event.x, 0.5f);
+  r.touch_event.finger_id = 2;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_FAIL);
+
+  memset(&last, 0x00, sizeof(last));
+  last.event.type = EVT_KEY_DOWN;
+  r = last;
+  ASSERT_EQ(event_queue_req_coalesce(&last, &r), RET_FAIL);
+}
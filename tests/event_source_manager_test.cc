@@ -42,3 +42,46 @@ TEST(EventSourceManager, tag) {
   event_source_manager_destroy(manager);
   idle_manager_destroy(tm);
 }
+
+static uint64_t s_esm_now = 0;
+static uint64_t event_source_manager_test_get_time(void) {
+  return s_esm_now;
+}
+
+static ret_t event_source_manager_test_on_timer(const timer_info_t* info) {
+  return RET_REPEAT;
+}
+
+static ret_t event_source_manager_test_on_idle(const idle_info_t* info) {
+  return RET_OK;
+}
+
+TEST(EventSourceManager, next_wakeup_time) {
+  idle_manager_t* im = idle_manager_create();
+  timer_manager_t* tm = timer_manager_create(event_source_manager_test_get_time);
+  event_source_manager_t* manager = event_source_manager_default_create();
+  event_source_t* idle_source = event_source_idle_create(im);
+  event_source_t* timer_source = event_source_timer_create(tm);
+
+  ASSERT_EQ(event_source_manager_get_next_wakeup_time(manager), 0xffffu);
+  ASSERT_EQ(event_source_manager_add(manager, idle_source), RET_OK);
+  ASSERT_EQ(event_source_manager_add(manager, timer_source), RET_OK);
+
+  /*不受min_sleep_time的限制*/
+  ASSERT_EQ(event_source_manager_get_next_wakeup_time(manager), 0xffffu);
+  timer_manager_add(tm, event_source_manager_test_on_timer, NULL, 500);
+  ASSERT_EQ(event_source_manager_get_next_wakeup_time(manager), 500u);
+  s_esm_now = 200;
+  ASSERT_EQ(event_source_manager_get_next_wakeup_time(manager), 300u);
+
+  idle_manager_add(im, event_source_manager_test_on_idle, NULL);
+  ASSERT_EQ(event_source_manager_get_next_wakeup_time(manager), 0u);
+  idle_manager_dispatch(im);
+  ASSERT_EQ(event_source_manager_get_next_wakeup_time(manager), 300u);
+
+  tk_object_unref(TK_OBJECT(idle_source));
+  tk_object_unref(TK_OBJECT(timer_source));
+  event_source_manager_destroy(manager);
+  timer_manager_destroy(tm);
+  idle_manager_destroy(im);
+}
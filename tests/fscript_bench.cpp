@@ -0,0 +1,83 @@
+﻿#include "tkc/utils.h"
+#include "tkc/platform.h"
+#include "tkc/time_now.h"
+#include "tkc/fscript.h"
+#include "tkc/object_default.h"
+
+#define BENCH_NR 2000
+
+static const char* s_bench_scripts[] = {
+    "var s = 0; for(var i = 0; i < 100; i = i + 1) {s = s + i * 2 - 1}; s",
+    "var s = 0; repeat_times(100) {s = s + a}; s",
+    "var s = ''; repeat(i, 0, 20, 1) {s = s + name}; s",
+    "var s = 0; var i = 0; while(i < 100) {i = i + 1; if(i % 3 == 0) {continue}; s = s + 1}; s",
+    "var r = 0; repeat_times(50) {if(a < 5) {r = 1} else if(a < 20) {r = 2} else {r = 3}}; r",
+    "var s = 0; repeat_times(50) {s = s + abs(0 - a) + min(a, 3) + RET_FAIL}; s",
+    "var s = 0; repeat_times(100) {s = s + cfg.com.baudrate + cfg.com.data_bits + z}; s",
+};
+
+static double bench_run(tk_object_t* obj, const char* code) {
+  uint32_t i = 0;
+  value_t v;
+  uint64_t start = 0;
+  fscript_t* fscript = fscript_create(obj, code);
+
+  start = time_now_us();
+  for (i = 0; i < BENCH_NR; i++) {
+    fscript_exec(fscript, &v);
+    value_reset(&v);
+  }
+  fscript_destroy(fscript);
+
+  return (double)BENCH_NR * 1000000 / (double)(time_now_us() - start + 1);
+}
+
+static void bench(tk_object_t* obj, const char* code) {
+  double tree = 0;
+  double vm = 0;
+
+  fscript_set_vm_enable(FALSE);
+  tree = bench_run(obj, code);
+  fscript_set_vm_enable(TRUE);
+  vm = bench_run(obj, code);
+
+  log_info("tree=%9.1f/s vm=%9.1f/s x%.2f %s\n", tree, vm, vm / tree, code);
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t i = 0;
+  tk_object_t* obj = NULL;
+  tk_object_t* cfg = NULL;
+  tk_object_t* com = NULL;
+
+  platform_prepare();
+  fscript_global_init();
+
+  obj = object_default_create();
+  tk_object_set_prop_int(obj, "a", 10);
+  tk_object_set_prop_str(obj, "name", "awtk");
+  for (i = 0; i < 26; i++) {
+    char name[8];
+    tk_snprintf(name, sizeof(name), "%c%c", 'a' + i, 'a' + i);
+    tk_object_set_prop_int(obj, name, i);
+  }
+  tk_object_set_prop_int(obj, "z", 1);
+
+  cfg = object_default_create();
+  com = object_default_create();
+  tk_object_set_prop_int(com, "baudrate", 115200);
+  tk_object_set_prop_int(com, "data_bits", 8);
+  tk_object_set_prop_object(cfg, "com", com);
+  tk_object_set_prop_object(obj, "cfg", cfg);
+
+  for (i = 0; i < ARRAY_SIZE(s_bench_scripts); i++) {
+    bench(obj, s_bench_scripts[i]);
+  }
+
+  TK_OBJECT_UNREF(com);
+  TK_OBJECT_UNREF(cfg);
+  TK_OBJECT_UNREF(obj);
+  fscript_global_deinit();
+
+  return 0;
+}
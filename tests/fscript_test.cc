@@ -3184,6 +3184,7 @@ TEST(FScript, hooks) {
   ASSERT_EQ(s_global_hooks_test.exec_func, TRUE);
   ASSERT_EQ(s_global_hooks_test.set_var, TRUE);
 
+  fscript_set_hooks(NULL);
   value_reset(&v);
   TK_OBJECT_UNREF(obj);
 }
@@ -3330,6 +3331,108 @@ TEST(FScript, consts) {
   TK_OBJECT_UNREF(obj);
 }
 
+static void fscript_test_vm(tk_object_t* obj, const char* code) {
+  value_t v1;
+  value_t v2;
+  char buff1[64];
+  char buff2[64];
+  fscript_t* fscript = fscript_create(obj, code);
+  ASSERT_TRUE(fscript != NULL);
+
+  fscript_set_vm_enable(FALSE);
+  value_set_int(&v1, 0);
+  ASSERT_EQ(fscript_exec(fscript, &v1), RET_OK);
+  ASSERT_TRUE(fscript->bytecode == NULL);
+
+  fscript_set_vm_enable(TRUE);
+  value_set_int(&v2, 0);
+  ASSERT_EQ(fscript_exec(fscript, &v2), RET_OK);
+  ASSERT_TRUE(fscript->bytecode != NULL) << code;
+
+  ASSERT_EQ(v1.type, v2.type) << code;
+  ASSERT_STREQ(value_str_ex(&v1, buff1, sizeof(buff1)), value_str_ex(&v2, buff2, sizeof(buff2)))
+      << code;
+
+  value_reset(&v1);
+  value_reset(&v2);
+  fscript_destroy(fscript);
+}
+
+TEST(FScript, vm) {
+  tk_object_t* obj = object_default_create();
+  tk_object_set_prop_int(obj, "a", 10);
+  tk_object_set_prop_str(obj, "name", "awtk");
+
+  fscript_test_vm(obj, "1+2*3");
+  fscript_test_vm(obj, "a * 2 + 1");
+  fscript_test_vm(obj, "name + '-' + a");
+  fscript_test_vm(obj, "var b = a; b = b + 1; b");
+  fscript_test_vm(obj, "RET_FAIL + fconsts.PI");
+  fscript_test_vm(obj, "a > 5 ? 'big' : 'small'");
+  fscript_test_vm(obj, "if(a < 5) {1} else if(a < 20) {2} else {3}");
+  fscript_test_vm(obj, "var i = 0; var s = 0; while(i < 10) {i = i + 1; s = s + i}; s");
+  fscript_test_vm(obj, "var i = 0; until(i >= 10) {i = i + 1; if(i == 5) {break}}; i");
+  fscript_test_vm(obj,
+                  "var s = 0; for(var i = 0; i < 10; i = i + 1) {if(i % 2 == 0) {continue}; "
+                  "s = s + i}; s");
+  fscript_test_vm(obj, "var s = 0; repeat(i, 0, 10, 2) {s = s + i}; s");
+  fscript_test_vm(obj, "var s = 0; repeat_times(5) {s = s + 2}; s");
+  fscript_test_vm(obj, "var s = 0; repeat_times(3) {repeat_times(4) {s = s + 1; break}}; s");
+  fscript_test_vm(obj, "var i = 0; while(true) {i = i + 1; if(i > 3) {return i * 10}}; 0");
+  fscript_test_vm(obj, "function add(x, y) {return x + y}; add(a, 2)");
+  fscript_test_vm(obj, "var s = 0; while(s < 3) {s = foo(s)}; function foo(x) {return x + 1}; s");
+  fscript_test_vm(obj, "set(c, 3); c + a");
+  fscript_test_vm(obj, "unset(c); var_exists('c')");
+  fscript_test_vm(obj, "$not_exist");
+  fscript_test_vm(obj, "");
+
+  TK_OBJECT_UNREF(obj);
+}
+
+TEST(FScript, vm_var_cache) {
+  value_t v;
+  tk_object_t* obj = object_default_create();
+  tk_object_t* sub = object_default_create();
+  fscript_t* fscript = NULL;
+
+  tk_object_set_prop_int(obj, "a", 1);
+  tk_object_set_prop_int(sub, "x", 10);
+  tk_object_set_prop_object(obj, "sub", sub);
+  fscript = fscript_create(obj, "var s = 0; repeat_times(3) {s = s + a + sub.x + global.g}; s");
+  ASSERT_TRUE(fscript != NULL);
+  tk_object_set_prop_int(fscript_get_global_object(), "g", 100);
+
+  ASSERT_EQ(fscript_exec(fscript, &v), RET_OK);
+  ASSERT_EQ(value_int(&v), 333);
+
+  /*修改属性值*/
+  tk_object_set_prop_int(obj, "a", 2);
+  tk_object_set_prop_int(sub, "x", 20);
+  ASSERT_EQ(fscript_exec(fscript, &v), RET_OK);
+  ASSERT_EQ(value_int(&v), 366);
+
+  /*增删属性*/
+  tk_object_set_prop_int(obj, "0", 0);
+  tk_object_remove_prop(sub, "x");
+  tk_object_set_prop_int(sub, "w", 0);
+  tk_object_set_prop_int(sub, "x", 30);
+  ASSERT_EQ(fscript_exec(fscript, &v), RET_OK);
+  ASSERT_EQ(value_int(&v), 396);
+
+  /*替换子对象*/
+  TK_OBJECT_UNREF(sub);
+  sub = object_default_create();
+  tk_object_set_prop_int(sub, "x", 40);
+  tk_object_set_prop_object(obj, "sub", sub);
+  ASSERT_EQ(fscript_exec(fscript, &v), RET_OK);
+  ASSERT_EQ(value_int(&v), 426);
+
+  tk_object_remove_prop(fscript_get_global_object(), "g");
+  fscript_destroy(fscript);
+  TK_OBJECT_UNREF(sub);
+  TK_OBJECT_UNREF(obj);
+}
+
 TEST(FScript, levelize) {
   value_t v;
   tk_object_t* obj = object_default_create();
@@ -0,0 +1,75 @@
+﻿#include "base/glyph_atlas.h"
+#include "base/glyph_cache.h"
+#include "gtest/gtest.h"
+
+static glyph_t glyph_init_size(uint16_t w, uint16_t h) {
+  glyph_t g;
+
+  memset(&g, 0x00, sizeof(g));
+  g.w = w;
+  g.h = h;
+  g.format = GLYPH_FMT_ALPHA;
+
+  return g;
+}
+
+TEST(GlyphAtlas, basic) {
+  glyph_t g1 = glyph_init_size(10, 12);
+  glyph_t g2 = glyph_init_size(20, 10);
+  glyph_atlas_t* atlas = glyph_atlas_create(64, 64, 2);
+
+  ASSERT_EQ(glyph_atlas_alloc(atlas, &g1), RET_OK);
+  ASSERT_EQ(g1.pitch, 64);
+  ASSERT_EQ(glyph_atlas_has(atlas, g1.data), TRUE);
+  ASSERT_EQ(atlas->pages_nr, 1u);
+
+  /*高度相近的字模放在同一个shelf*/
+  ASSERT_EQ(glyph_atlas_alloc(atlas, &g2), RET_OK);
+  ASSERT_EQ(g2.data, g1.data + 10);
+  ASSERT_EQ(glyph_atlas_get_page(atlas, 0)->data, g1.data);
+
+  /*比页面大的字模不能放进图集*/
+  g1 = glyph_init_size(65, 10);
+  ASSERT_EQ(glyph_atlas_alloc(atlas, &g1), RET_NOT_FOUND);
+  ASSERT_EQ(glyph_atlas_has(atlas, (const uint8_t*)&g1), FALSE);
+
+  glyph_atlas_destroy(atlas);
+}
+
+TEST(GlyphAtlas, evict) {
+  uint32_t i = 0;
+  glyph_t g;
+  glyph_cache_t cache;
+  glyph_atlas_t* atlas = glyph_atlas_create(32, 32, 2);
+
+  glyph_cache_init(&cache, 100, (tk_destroy_t)glyph_destroy);
+  glyph_atlas_on_evict(atlas, (glyph_atlas_on_evict_t)glyph_cache_remove_by_range, &cache);
+
+  /*每页可以放4个16x16的字模*/
+  for (i = 0; i < 8; i++) {
+    g = glyph_init_size(16, 16);
+    ASSERT_EQ(glyph_atlas_alloc(atlas, &g), RET_OK);
+    ASSERT_EQ(glyph_cache_add(&cache, i, 16, glyph_clone(&g)), RET_OK);
+  }
+  ASSERT_EQ(atlas->pages_nr, 2u);
+  ASSERT_EQ(atlas->evictions, 0u);
+  ASSERT_EQ(cache.size, 8u);
+
+  /*回收最早的页面，引用该页面的字模从cache中删除*/
+  g = glyph_init_size(16, 16);
+  ASSERT_EQ(glyph_atlas_alloc(atlas, &g), RET_OK);
+  ASSERT_EQ(atlas->evictions, 1u);
+  ASSERT_EQ(cache.size, 4u);
+  ASSERT_EQ(g.data, glyph_atlas_get_page(atlas, 0)->data);
+  for (i = 0; i < 8; i++) {
+    glyph_t r;
+    ASSERT_EQ(glyph_cache_lookup(&cache, i, 16, &r), i < 4 ? RET_NOT_FOUND : RET_OK);
+  }
+
+  glyph_atlas_off_evict(atlas, &cache);
+  glyph_atlas_reset(atlas);
+  ASSERT_EQ(cache.size, 4u);
+
+  glyph_cache_deinit(&cache);
+  glyph_atlas_destroy(atlas);
+}
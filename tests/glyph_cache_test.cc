@@ -55,3 +55,71 @@ TEST(GlyphCache, shrink) {
 
   glyph_cache_deinit(c);
 }
+
+TEST(GlyphCache, lru) {
+  uint16_t i = 0;
+  uint16_t size = 10;
+  uint16_t nr = 8;
+  glyph_cache_t cache;
+  glyph_t g;
+  glyph_cache_t* c = glyph_cache_init(&cache, nr, (tk_destroy_t)glyph_destroy);
+
+  memset(&g, 0x00, sizeof(g));
+  for (i = 0; i < nr; i++) {
+    ASSERT_EQ(glyph_cache_add(c, i, size, glyph_clone(&g)), RET_OK);
+  }
+
+  /*访问0，则1成为最久没用的*/
+  ASSERT_EQ(glyph_cache_lookup(c, 0, size, &g), RET_OK);
+  ASSERT_EQ(glyph_cache_add(c, 100, size, glyph_clone(&g)), RET_OK);
+  ASSERT_EQ(glyph_cache_lookup(c, 0, size, &g), RET_OK);
+  ASSERT_EQ(glyph_cache_lookup(c, 1, size, &g), RET_NOT_FOUND);
+  ASSERT_EQ(glyph_cache_lookup(c, 100, size, &g), RET_OK);
+
+  ASSERT_EQ(glyph_cache_add(c, 101, size, glyph_clone(&g)), RET_OK);
+  ASSERT_EQ(glyph_cache_lookup(c, 2, size, &g), RET_NOT_FOUND);
+  for (i = 3; i < nr; i++) {
+    ASSERT_EQ(glyph_cache_lookup(c, i, size, &g), RET_OK);
+  }
+
+  /*相同的code，不同的size*/
+  ASSERT_EQ(glyph_cache_lookup(c, 0, size + 1, &g), RET_NOT_FOUND);
+
+  glyph_cache_deinit(c);
+}
+
+TEST(GlyphCache, stats) {
+  uint16_t i = 0;
+  uint16_t size = 10;
+  uint16_t nr = 16;
+  glyph_cache_t cache;
+  glyph_t g;
+  font_cache_stats_t stats;
+  glyph_cache_t* c = glyph_cache_init(&cache, nr, (tk_destroy_t)glyph_destroy);
+
+  memset(&g, 0x00, sizeof(g));
+  for (i = 0; i < nr * 2; i++) {
+    ASSERT_EQ(glyph_cache_lookup(c, i, size, &g), RET_NOT_FOUND);
+    ASSERT_EQ(glyph_cache_add(c, i, size, glyph_clone(&g)), RET_OK);
+    ASSERT_EQ(glyph_cache_lookup(c, i, size, &g), RET_OK);
+  }
+
+  memset(&stats, 0x00, sizeof(stats));
+  ASSERT_EQ(glyph_cache_get_stats(c, &stats), RET_OK);
+  ASSERT_EQ(stats.size, (uint32_t)nr);
+  ASSERT_EQ(stats.capacity, (uint32_t)nr);
+  ASSERT_EQ(stats.hits, (uint32_t)(nr * 2));
+  ASSERT_EQ(stats.misses, (uint32_t)(nr * 2));
+  ASSERT_EQ(stats.evictions, (uint32_t)nr);
+
+  /*shrink之后索引仍然有效*/
+  ASSERT_EQ(glyph_cache_shrink(c, nr / 2), RET_OK);
+  for (i = 0; i < nr * 2; i++) {
+    ret_t ret = glyph_cache_lookup(c, i, size, &g);
+    ASSERT_EQ(ret, i >= (nr * 2 - nr / 2) ? RET_OK : RET_NOT_FOUND);
+  }
+  ASSERT_EQ(glyph_cache_add(c, 1000, size, glyph_clone(&g)), RET_OK);
+  ASSERT_EQ(glyph_cache_lookup(c, 1000, size, &g), RET_OK);
+
+  glyph_cache_deinit(c);
+}
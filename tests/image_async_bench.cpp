@@ -0,0 +1,155 @@
+#include "awtk.h"
+#include "tkc/buffer.h"
+#include "tkc/time_now.h"
+#include "tkc/platform.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "scroll_view/scroll_view.h"
+
+#define STB_IMAGE_WRITE_STATIC 1
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb/stb_image_write.h"
+
+#define BENCH_W 480
+#define BENCH_H 800
+#define BENCH_COLS 4
+#define BENCH_IMAGES 60
+#define BENCH_IMAGE_W 480
+#define BENCH_IMAGE_H 360
+#define BENCH_MAX_FRAMES 1000
+#define BENCH_FRAME_MS 16
+
+static void bench_write_png(void* ctx, void* data, int size) {
+  wbuffer_write_binary((wbuffer_t*)ctx, data, size);
+}
+
+/*生成带噪声的渐变图片，让解码时间接近真实照片*/
+static ret_t bench_add_image(const char* name, uint32_t seed) {
+  uint32_t x = 0;
+  uint32_t y = 0;
+  wbuffer_t wb;
+  uint32_t rand = seed * 2654435761u + 1;
+  uint8_t* pixels = (uint8_t*)TKMEM_ALLOC(BENCH_IMAGE_W * BENCH_IMAGE_H * 3);
+  return_value_if_fail(pixels != NULL, RET_OOM);
+
+  for (y = 0; y < BENCH_IMAGE_H; y++) {
+    uint8_t* p = pixels + y * BENCH_IMAGE_W * 3;
+    for (x = 0; x < BENCH_IMAGE_W; x++) {
+      rand = rand * 1103515245u + 12345u;
+      p[0] = (uint8_t)(x + seed * 13 + ((rand >> 16) & 0x0f));
+      p[1] = (uint8_t)(y + seed * 7 + ((rand >> 20) & 0x0f));
+      p[2] = (uint8_t)(x + y + ((rand >> 24) & 0x0f));
+      p += 3;
+    }
+  }
+
+  wbuffer_init_extendable(&wb);
+  stbi_write_png_to_func(bench_write_png, &wb, BENCH_IMAGE_W, BENCH_IMAGE_H, 3, pixels,
+                         BENCH_IMAGE_W * 3);
+  assets_manager_add_data(assets_manager(), name, ASSET_TYPE_IMAGE, ASSET_TYPE_IMAGE_PNG, wb.data,
+                          wb.cursor);
+  wbuffer_deinit(&wb);
+  TKMEM_FREE(pixels);
+
+  return RET_OK;
+}
+
+static widget_t* bench_create_gallery(const char* prefix, bool_t async_load) {
+  uint32_t i = 0;
+  char name[TK_NAME_LEN + 1];
+  wh_t w = BENCH_W / BENCH_COLS;
+  wh_t h = w * 3 / 4;
+  widget_t* gallery = scroll_view_create(NULL, 0, 0, BENCH_W, BENCH_H);
+
+  scroll_view_set_virtual_h(gallery, (BENCH_IMAGES / BENCH_COLS) * h);
+  for (i = 0; i < BENCH_IMAGES; i++) {
+    widget_t* image = image_create(gallery, (i % BENCH_COLS) * w, (i / BENCH_COLS) * h, w, h);
+
+    tk_snprintf(name, sizeof(name), "%s%u", prefix, i);
+    image_base_set_image(image, name);
+    image_set_draw_type(image, IMAGE_DRAW_SCALE_AUTO);
+    image_set_async_load(image, async_load);
+  }
+
+  return gallery;
+}
+
+static uint32_t bench_count_loaded(const char* prefix, uint32_t nr) {
+  uint32_t i = 0;
+  uint32_t loaded = 0;
+  char name[TK_NAME_LEN + 1];
+
+  for (i = 0; i < nr; i++) {
+    bitmap_t bitmap;
+    tk_snprintf(name, sizeof(name), "%s%u", prefix, i);
+    if (image_manager_lookup(image_manager(), name, &bitmap) == RET_OK) {
+      loaded++;
+    }
+  }
+
+  return loaded;
+}
+
+/*打开画廊，按60fps的节奏绘制，直到第一屏的图片全部显示出来*/
+static void bench_open(canvas_t* c, const char* prefix, bool_t async_load) {
+  uint32_t i = 0;
+  uint64_t longest = 0;
+  uint64_t start = time_now_us();
+  uint32_t visible = (BENCH_H / (BENCH_W / BENCH_COLS * 3 / 4) + 1) * BENCH_COLS;
+  widget_t* gallery = bench_create_gallery(prefix, async_load);
+
+  for (i = 0; i < BENCH_MAX_FRAMES; i++) {
+    uint64_t frame_start = time_now_us();
+    uint64_t cost = 0;
+
+    main_loop_step(main_loop());
+    canvas_begin_frame(c, NULL, LCD_DRAW_OFFLINE);
+    widget_paint(gallery, c);
+    canvas_end_frame(c);
+
+    cost = time_now_us() - frame_start;
+    longest = tk_max(longest, cost);
+    if (bench_count_loaded(prefix, visible) == visible) {
+      break;
+    }
+
+    if (cost < BENCH_FRAME_MS * 1000) {
+      sleep_ms(BENCH_FRAME_MS - cost / 1000);
+    }
+  }
+
+  log_info("%-6s visible=%u frames=%-4u longest_frame=%8.2fms all_visible_loaded=%8.2fms\n",
+           async_load ? "async" : "sync", visible, i + 1, longest / 1000.0,
+           (time_now_us() - start) / 1000.0);
+
+  widget_destroy(gallery);
+  idle_dispatch();
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t i = 0;
+  canvas_t c;
+  lcd_t* lcd = NULL;
+  char name[TK_NAME_LEN + 1];
+
+  tk_init(BENCH_W, BENCH_H, APP_CONSOLE, NULL, "./");
+  tk_init_assets();
+
+  for (i = 0; i < BENCH_IMAGES; i++) {
+    tk_snprintf(name, sizeof(name), "bench_sync%u", i);
+    bench_add_image(name, i);
+    tk_snprintf(name, sizeof(name), "bench_async%u", i);
+    bench_add_image(name, i);
+  }
+
+  lcd = lcd_mem_bgra8888_create(BENCH_W, BENCH_H, TRUE);
+  canvas_init(&c, lcd, font_manager());
+
+  bench_open(&c, "bench_sync", FALSE);
+  bench_open(&c, "bench_async", TRUE);
+
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  tk_exit();
+
+  return 0;
+}
@@ -0,0 +1,117 @@
+#include "awtk.h"
+#include "tkc/fs.h"
+#include "tkc/buffer.h"
+#include "tkc/time_now.h"
+#include "base/image_disk_cache.h"
+
+#define STB_IMAGE_WRITE_STATIC 1
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb/stb_image_write.h"
+
+#define BENCH_IMAGES 40
+#define BENCH_IMAGE_W 480
+#define BENCH_IMAGE_H 360
+#define BENCH_CACHE_DIR "image_disk_cache_bench"
+#define BENCH_CACHE_SIZE 64 * 1024 * 1024
+
+static void bench_write_png(void* ctx, void* data, int size) {
+  wbuffer_write_binary((wbuffer_t*)ctx, data, size);
+}
+
+/*生成带噪声的渐变图片，让解码时间接近真实照片*/
+static ret_t bench_add_image(const char* name, uint32_t seed) {
+  uint32_t x = 0;
+  uint32_t y = 0;
+  wbuffer_t wb;
+  uint32_t rand = seed * 2654435761u + 1;
+  uint8_t* pixels = (uint8_t*)TKMEM_ALLOC(BENCH_IMAGE_W * BENCH_IMAGE_H * 4);
+  return_value_if_fail(pixels != NULL, RET_OOM);
+
+  for (y = 0; y < BENCH_IMAGE_H; y++) {
+    uint8_t* p = pixels + y * BENCH_IMAGE_W * 4;
+    for (x = 0; x < BENCH_IMAGE_W; x++) {
+      rand = rand * 1103515245u + 12345u;
+      p[0] = (uint8_t)(x + seed * 13 + ((rand >> 16) & 0x0f));
+      p[1] = (uint8_t)(y + seed * 7 + ((rand >> 20) & 0x0f));
+      p[2] = (uint8_t)(x + y + ((rand >> 24) & 0x0f));
+      p[3] = (uint8_t)(0x80 + (x & 0x7f));
+      p += 4;
+    }
+  }
+
+  wbuffer_init_extendable(&wb);
+  stbi_write_png_to_func(bench_write_png, &wb, BENCH_IMAGE_W, BENCH_IMAGE_H, 4, pixels,
+                         BENCH_IMAGE_W * 4);
+  assets_manager_add_data(assets_manager(), name, ASSET_TYPE_IMAGE, ASSET_TYPE_IMAGE_PNG, wb.data,
+                          wb.cursor);
+  wbuffer_deinit(&wb);
+  TKMEM_FREE(pixels);
+
+  return RET_OK;
+}
+
+/*模拟启动时加载全部图片，返回耗时(us)*/
+static uint64_t bench_start(const char* label, bool_t with_cache) {
+  uint32_t i = 0;
+  uint64_t cost = 0;
+  uint64_t start = 0;
+  uint32_t checksum = 0;
+  char name[TK_NAME_LEN + 1];
+  image_disk_cache_t* cache = NULL;
+  image_manager_t* imm = image_manager_create();
+
+  start = time_now_us();
+  if (with_cache) {
+    cache = image_disk_cache_create(BENCH_CACHE_DIR, BENCH_CACHE_SIZE);
+    image_manager_set_disk_cache(imm, cache);
+  }
+
+  for (i = 0; i < BENCH_IMAGES; i++) {
+    bitmap_t image;
+    uint8_t* data = NULL;
+
+    tk_snprintf(name, sizeof(name), "bench%u", i);
+    if (image_manager_get_bitmap(imm, name, &image) == RET_OK) {
+      /*第一次绘制时会访问全部像素*/
+      uint32_t y = 0;
+      uint32_t line_length = bitmap_get_physical_line_length(&image);
+      data = bitmap_lock_buffer_for_read(&image);
+      for (y = 0; y < image.h; y++) {
+        checksum += data[y * line_length + (y % image.w) * 4];
+      }
+      bitmap_unlock_buffer(&image);
+    }
+  }
+  cost = time_now_us() - start;
+
+  log_info("%-24s images=%u total=%8.2fms per_image=%6.2fms hits=%u misses=%u (%u)\n", label,
+           BENCH_IMAGES, cost / 1000.0, cost / 1000.0 / BENCH_IMAGES,
+           cache != NULL ? cache->hits : 0, cache != NULL ? cache->misses : 0, checksum);
+  image_manager_destroy(imm);
+
+  return cost;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t i = 0;
+  char name[TK_NAME_LEN + 1];
+
+  tk_init(320, 480, APP_CONSOLE, NULL, "./");
+  tk_init_assets();
+
+  for (i = 0; i < BENCH_IMAGES; i++) {
+    tk_snprintf(name, sizeof(name), "bench%u", i);
+    bench_add_image(name, i);
+  }
+
+  fs_remove_dir_r(os_fs(), BENCH_CACHE_DIR);
+  bench_start("decode (no cache)", FALSE);
+  bench_start("first start (save)", TRUE);
+  bench_start("second start (mmap)", TRUE);
+  bench_start("third start (mmap)", TRUE);
+  fs_remove_dir_r(os_fs(), BENCH_CACHE_DIR);
+
+  tk_exit();
+
+  return 0;
+}
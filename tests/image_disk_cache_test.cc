@@ -0,0 +1,272 @@
+﻿#include "tkc/fs.h"
+#include "tkc/mem.h"
+#include "tkc/path.h"
+#include "tkc/utils.h"
+#include "base/image_manager.h"
+#include "base/image_disk_cache.h"
+#include "base/assets_manager.h"
+#include "image_loader/image_loader_stb.h"
+#include "gtest/gtest.h"
+
+#ifdef WITH_IMAGE_DISK_CACHE
+
+#define CACHE_DIR "image_disk_cache_test"
+#define IMAGES_DIR "res/assets/default/raw/images/x1/"
+
+static asset_info_t* load_asset(const char* name, const char* filename, uint16_t subtype) {
+  uint32_t size = 0;
+  asset_info_t* info = NULL;
+  void* data = file_read(filename, &size);
+  return_value_if_fail(data != NULL, NULL);
+
+  info = asset_info_create(ASSET_TYPE_IMAGE, subtype, name, size);
+  if (info != NULL) {
+    memcpy(info->data, data, size);
+  }
+  TKMEM_FREE(data);
+
+  return info;
+}
+
+static void check_same_image(bitmap_t* a, bitmap_t* b) {
+  uint32_t y = 0;
+  uint8_t* da = NULL;
+  uint8_t* db = NULL;
+  uint32_t line_length = 0;
+
+  ASSERT_EQ(a->w, b->w);
+  ASSERT_EQ(a->h, b->h);
+  ASSERT_EQ(a->format, b->format);
+  ASSERT_EQ(a->flags, b->flags);
+  ASSERT_EQ(bitmap_get_physical_height(a), bitmap_get_physical_height(b));
+
+  da = bitmap_lock_buffer_for_read(a);
+  db = bitmap_lock_buffer_for_read(b);
+  line_length = a->w * bitmap_get_bpp(a);
+  for (y = 0; y < bitmap_get_physical_height(a); y++) {
+    ASSERT_EQ(memcmp(da + y * bitmap_get_physical_line_length(a),
+                     db + y * bitmap_get_physical_line_length(b), line_length),
+              0);
+  }
+  bitmap_unlock_buffer(a);
+  bitmap_unlock_buffer(b);
+}
+
+static void check_round_trip(image_disk_cache_t* cache, asset_info_t* info, bool_t mapped) {
+  bitmap_t image;
+  bitmap_t cached;
+  mmap_t* map = NULL;
+
+  ASSERT_EQ(image_disk_cache_load(cache, info, NULL, &cached, &map), RET_NOT_FOUND);
+  ASSERT_EQ(image_loader_load_image(info, &image), RET_OK);
+  ASSERT_EQ(image_disk_cache_save(cache, info, NULL, &image), RET_OK);
+
+  ASSERT_EQ(image_disk_cache_load(cache, info, NULL, &cached, &map), RET_OK);
+  ASSERT_EQ(map != NULL, mapped);
+  check_same_image(&image, &cached);
+
+  bitmap_destroy(&cached);
+  if (map != NULL) {
+    mmap_destroy(map);
+  }
+  bitmap_destroy(&image);
+}
+
+TEST(ImageDiskCache, basic) {
+  image_disk_cache_t* cache = NULL;
+  asset_info_t* small = load_asset("checked", IMAGES_DIR "checked.png", ASSET_TYPE_IMAGE_PNG);
+  asset_info_t* big = load_asset("gauge_bg", IMAGES_DIR "gauge_bg.png", ASSET_TYPE_IMAGE_PNG);
+
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  ASSERT_TRUE(cache != NULL);
+  ASSERT_EQ(cache->size, 0u);
+
+  check_round_trip(cache, small, FALSE);
+  check_round_trip(cache, big, TRUE);
+  ASSERT_EQ(cache->entries.size, 2u);
+  ASSERT_EQ(cache->hits, 2u);
+  ASSERT_EQ(cache->misses, 2u);
+
+  ASSERT_EQ(image_disk_cache_clear(cache), RET_OK);
+  ASSERT_EQ(cache->size, 0u);
+  ASSERT_EQ(cache->entries.size, 0u);
+
+  image_disk_cache_destroy(cache);
+  asset_info_destroy(small);
+  asset_info_destroy(big);
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+}
+
+TEST(ImageDiskCache, not_cacheable) {
+  bitmap_t image;
+  mmap_t* map = NULL;
+  image_disk_cache_t* cache = NULL;
+  asset_info_t* gif = load_asset("bee", IMAGES_DIR "bee.gif", ASSET_TYPE_IMAGE_GIF);
+
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  ASSERT_EQ(image_loader_load_image(gif, &image), RET_OK);
+  ASSERT_NE(image_disk_cache_save(cache, gif, NULL, &image), RET_OK);
+  ASSERT_EQ(image_disk_cache_load(cache, gif, NULL, &image, &map), RET_NOT_FOUND);
+  ASSERT_EQ(cache->size, 0u);
+
+  bitmap_destroy(&image);
+  image_disk_cache_destroy(cache);
+  asset_info_destroy(gif);
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+}
+
+TEST(ImageDiskCache, source_changed) {
+  bitmap_t image;
+  mmap_t* map = NULL;
+  image_disk_cache_t* cache = NULL;
+  asset_info_t* v1 = load_asset("check", IMAGES_DIR "checked.png", ASSET_TYPE_IMAGE_PNG);
+  asset_info_t* v2 = load_asset("check", IMAGES_DIR "unchecked.png", ASSET_TYPE_IMAGE_PNG);
+
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  ASSERT_EQ(image_loader_load_image(v1, &image), RET_OK);
+  ASSERT_EQ(image_disk_cache_save(cache, v1, NULL, &image), RET_OK);
+  bitmap_destroy(&image);
+  ASSERT_EQ(cache->entries.size, 1u);
+
+  /*图片更新后旧的缓存不再命中，并被删除*/
+  ASSERT_EQ(image_disk_cache_load(cache, v2, NULL, &image, &map), RET_NOT_FOUND);
+  ASSERT_EQ(cache->entries.size, 0u);
+  ASSERT_EQ(cache->size, 0u);
+
+  check_round_trip(cache, v2, FALSE);
+  ASSERT_EQ(image_disk_cache_load(cache, v1, NULL, &image, &map), RET_NOT_FOUND);
+  ASSERT_EQ(cache->entries.size, 0u);
+
+  image_disk_cache_destroy(cache);
+  asset_info_destroy(v1);
+  asset_info_destroy(v2);
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+}
+
+TEST(ImageDiskCache, variant) {
+  bitmap_t image;
+  mmap_t* map = NULL;
+  image_disk_cache_t* cache = NULL;
+  asset_info_t* v1 = load_asset("check", IMAGES_DIR "checked.png", ASSET_TYPE_IMAGE_PNG);
+  asset_info_t* v2 = load_asset("check", IMAGES_DIR "unchecked.png", ASSET_TYPE_IMAGE_PNG);
+
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  ASSERT_EQ(image_loader_load_image(v1, &image), RET_OK);
+  ASSERT_EQ(image_disk_cache_save(cache, v1, "default@1", &image), RET_OK);
+  bitmap_destroy(&image);
+
+  /*其它主题或屏幕密度下的同名图片不会删除这个变体的缓存*/
+  ASSERT_EQ(image_disk_cache_load(cache, v2, "dark@1", &image, &map), RET_NOT_FOUND);
+  ASSERT_EQ(image_disk_cache_load(cache, v2, "default@2", &image, &map), RET_NOT_FOUND);
+  ASSERT_EQ(cache->entries.size, 1u);
+
+  ASSERT_EQ(image_loader_load_image(v2, &image), RET_OK);
+  ASSERT_EQ(image_disk_cache_save(cache, v2, "dark@1", &image), RET_OK);
+  bitmap_destroy(&image);
+  ASSERT_EQ(cache->entries.size, 2u);
+
+  ASSERT_EQ(image_disk_cache_load(cache, v1, "default@1", &image, &map), RET_OK);
+  bitmap_destroy(&image);
+  if (map != NULL) {
+    mmap_destroy(map);
+  }
+  ASSERT_EQ(image_disk_cache_load(cache, v2, "dark@1", &image, &map), RET_OK);
+  bitmap_destroy(&image);
+  if (map != NULL) {
+    mmap_destroy(map);
+  }
+
+  image_disk_cache_destroy(cache);
+  asset_info_destroy(v1);
+  asset_info_destroy(v2);
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+}
+
+TEST(ImageDiskCache, lru) {
+  uint32_t i = 0;
+  bitmap_t image;
+  mmap_t* map = NULL;
+  uint32_t size = 0;
+  image_disk_cache_t* cache = NULL;
+  asset_info_t* infos[3];
+  const char* files[3] = {IMAGES_DIR "checked.png", IMAGES_DIR "unchecked.png",
+                          IMAGES_DIR "radio_checked.png"};
+
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  for (i = 0; i < ARRAY_SIZE(infos); i++) {
+    char name[32];
+    tk_snprintf(name, sizeof(name), "lru%u", i);
+    infos[i] = load_asset(name, files[i], ASSET_TYPE_IMAGE_PNG);
+    ASSERT_EQ(image_loader_load_image(infos[i], &image), RET_OK);
+    ASSERT_EQ(image_disk_cache_save(cache, infos[i], NULL, &image), RET_OK);
+    bitmap_destroy(&image);
+  }
+  ASSERT_EQ(cache->entries.size, 3u);
+  size = cache->size;
+
+  /*使用lru0之后，lru1是最久没有使用的*/
+  ASSERT_EQ(image_disk_cache_load(cache, infos[0], NULL, &image, &map), RET_OK);
+  bitmap_destroy(&image);
+  ASSERT_EQ(image_disk_cache_set_max_size(cache, size - 1), RET_OK);
+  ASSERT_EQ(cache->entries.size, 2u);
+  ASSERT_EQ(image_disk_cache_load(cache, infos[1], NULL, &image, &map), RET_NOT_FOUND);
+
+  /*使用顺序在重新创建后仍然有效*/
+  image_disk_cache_destroy(cache);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  ASSERT_EQ(cache->entries.size, 2u);
+  ASSERT_EQ(image_disk_cache_set_max_size(cache, cache->size - 1), RET_OK);
+  ASSERT_EQ(cache->entries.size, 1u);
+  ASSERT_EQ(image_disk_cache_load(cache, infos[2], NULL, &image, &map), RET_NOT_FOUND);
+  ASSERT_EQ(image_disk_cache_load(cache, infos[0], NULL, &image, &map), RET_OK);
+  bitmap_destroy(&image);
+
+  image_disk_cache_destroy(cache);
+  for (i = 0; i < ARRAY_SIZE(infos); i++) {
+    asset_info_destroy(infos[i]);
+  }
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+}
+
+static ret_t on_image_loaded(void* ctx, event_t* e) {
+  *(ret_t*)ctx = done_event_cast(e)->result;
+
+  return RET_OK;
+}
+
+TEST(ImageDiskCache, image_manager) {
+  bitmap_t image;
+  ret_t result = RET_FAIL;
+  image_disk_cache_t* cache = NULL;
+  image_manager_t* imm = image_manager_create();
+
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+  cache = image_disk_cache_create(CACHE_DIR, 16 * 1024 * 1024);
+  ASSERT_EQ(image_manager_set_disk_cache(imm, cache), RET_OK);
+  ASSERT_EQ(image_manager_get_bitmap(imm, "gauge_bg", &image), RET_OK);
+  ASSERT_EQ(cache->misses, 1u);
+  ASSERT_EQ(cache->entries.size, 1u);
+
+  /*内存中的缓存被淘汰后，从磁盘缓存加载*/
+  ASSERT_EQ(image_manager_unload_all(imm), RET_OK);
+  ASSERT_EQ(image_manager_get_bitmap(imm, "gauge_bg", &image), RET_OK);
+  ASSERT_EQ(cache->hits, 1u);
+  ASSERT_EQ(image_manager_unload_all(imm), RET_OK);
+
+  ASSERT_EQ(image_manager_get_bitmap_async(imm, "gauge_bg", &image, 0, on_image_loaded, &result),
+            RET_BUSY);
+  ASSERT_EQ(image_manager_dispatch_async(imm, TRUE), RET_OK);
+  ASSERT_EQ(result, RET_OK);
+  ASSERT_EQ(cache->hits, 2u);
+  ASSERT_EQ(image_manager_lookup(imm, "gauge_bg", &image), RET_OK);
+
+  image_manager_destroy(imm);
+  fs_remove_dir_r(os_fs(), CACHE_DIR);
+}
+
+#endif /*WITH_IMAGE_DISK_CACHE*/
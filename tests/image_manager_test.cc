@@ -145,6 +145,80 @@ TEST(ImageManager, limit) {
   ASSERT_EQ(imm->images.size, 1u);
 }
 
+TEST(ImageManager, lru) {
+  str_t str;
+  bitmap_t b;
+  bitmap_t bmp;
+  const char* names[] = {"a", "b", "c", "d"};
+  image_manager_t* imm = image_manager_create();
+
+  for (uint32_t i = 0; i < ARRAY_SIZE(names); i++) {
+    memset(&b, 0x00, sizeof(b));
+    bitmap_init(&b, 10, 10, BITMAP_FMT_RGBA8888, NULL);
+    if (i == 3) {
+      image_manager_set_max_mem_size_of_cached_images(imm, 2 * bitmap_get_mem_size(&b));
+    }
+    ASSERT_EQ(image_manager_add(imm, names[i], &b), RET_OK);
+    if (i == 2) {
+      ASSERT_EQ(image_manager_lookup(imm, "a", &bmp), RET_OK);
+    }
+  }
+
+  ASSERT_EQ(imm->images.size, 2u);
+  ASSERT_EQ(imm->evictions, 2u);
+  ASSERT_EQ(image_manager_lookup(imm, "a", &bmp), RET_OK);
+  ASSERT_EQ(image_manager_lookup(imm, "d", &bmp), RET_OK);
+  ASSERT_EQ(image_manager_lookup(imm, "b", &bmp), RET_NOT_FOUND);
+  ASSERT_EQ(image_manager_lookup(imm, "c", &bmp), RET_NOT_FOUND);
+
+  str_init(&str, 100);
+  ASSERT_EQ(image_manager_dump(imm, &str), RET_OK);
+  ASSERT_EQ(strstr(str.str, "a: w=10 h=10") != NULL, true);
+  ASSERT_EQ(strstr(str.str, "hits=2") != NULL, true);
+  ASSERT_EQ(strstr(str.str, "total: nr=2") != NULL, true);
+  ASSERT_EQ(strstr(str.str, "evictions=2") != NULL, true);
+  str_reset(&str);
+
+  ASSERT_EQ(image_manager_unload_bitmap_by_name(imm, "a"), RET_OK);
+  ASSERT_EQ(image_manager_lookup(imm, "a", &bmp), RET_NOT_FOUND);
+  ASSERT_EQ(image_manager_lookup(imm, "d", &bmp), RET_OK);
+  ASSERT_EQ(imm->images.size, 1u);
+
+  image_manager_destroy(imm);
+}
+
+TEST(ImageManager, index) {
+  char name[32];
+  bitmap_t b;
+  bitmap_t bmp;
+  image_manager_t* imm = image_manager_create();
+
+  for (uint32_t i = 0; i < 200; i++) {
+    memset(&b, 0x00, sizeof(b));
+    b.w = i + 1;
+    b.h = 1;
+    tk_snprintf(name, sizeof(name), "img%u", i);
+    ASSERT_EQ(image_manager_add(imm, name, &b), RET_OK);
+  }
+
+  for (uint32_t i = 0; i < 200; i += 3) {
+    tk_snprintf(name, sizeof(name), "img%u", i);
+    ASSERT_EQ(image_manager_unload_bitmap_by_name(imm, name), RET_OK);
+  }
+
+  for (uint32_t i = 0; i < 200; i++) {
+    tk_snprintf(name, sizeof(name), "img%u", i);
+    if (i % 3 == 0) {
+      ASSERT_EQ(image_manager_lookup(imm, name, &bmp), RET_NOT_FOUND);
+    } else {
+      ASSERT_EQ(image_manager_lookup(imm, name, &bmp), RET_OK);
+      ASSERT_EQ(bmp.w, i + 1);
+    }
+  }
+
+  image_manager_destroy(imm);
+}
+
 TEST(ImageManager, images_managers1) {
   bitmap_t bmp;
   assets_managers_set_applet_res_root("./tests/applets");
@@ -162,3 +236,77 @@ TEST(ImageManager, images_managers2) {
 
   image_managers_unref(imm);
 }
+
+typedef struct _async_ctx_t {
+  int32_t done;
+  ret_t result;
+} async_ctx_t;
+
+static ret_t on_async_done(void* ctx, event_t* e) {
+  async_ctx_t* actx = (async_ctx_t*)ctx;
+
+  actx->done++;
+  actx->result = done_event_cast(e)->result;
+
+  return RET_OK;
+}
+
+TEST(ImageManager, async) {
+  bitmap_t bmp;
+  async_ctx_t actx = {0, RET_FAIL};
+  image_manager_t* imm = image_manager_create();
+
+  ASSERT_EQ(image_manager_get_bitmap_async(imm, "ani1", &bmp, 0, on_async_done, &actx), RET_BUSY);
+  ASSERT_EQ(image_manager_get_bitmap_async(imm, "ani1", &bmp, 1, on_async_done, &actx), RET_BUSY);
+  ASSERT_EQ(image_manager_dispatch_async(imm, TRUE), RET_OK);
+  ASSERT_EQ(actx.done, 1);
+  ASSERT_EQ(actx.result, RET_OK);
+
+  ASSERT_EQ(image_manager_lookup(imm, "ani1", &bmp), RET_OK);
+  ASSERT_EQ(image_manager_get_bitmap_async(imm, "ani1", &bmp, 0, on_async_done, &actx), RET_OK);
+  ASSERT_EQ(bmp.w > 0 && bmp.h > 0, true);
+  ASSERT_EQ(actx.done, 1);
+
+  ASSERT_EQ(image_manager_get_bitmap_async(imm, "not found", &bmp, 0, on_async_done, &actx),
+            RET_NOT_FOUND);
+
+  image_manager_destroy(imm);
+}
+
+TEST(ImageManager, async_cancel) {
+  bitmap_t bmp;
+  char name[32];
+  async_ctx_t actx = {0, RET_FAIL};
+  async_ctx_t other = {0, RET_FAIL};
+  image_manager_t* imm = image_manager_create();
+
+  for (uint32_t i = 1; i <= 9; i++) {
+    tk_snprintf(name, sizeof(name), "ani%u", i);
+    ASSERT_EQ(image_manager_get_bitmap_async(imm, name, &bmp, i, on_async_done, &actx), RET_BUSY);
+  }
+  ASSERT_EQ(image_manager_get_bitmap_async(imm, "ania", &bmp, 0, on_async_done, &other), RET_BUSY);
+
+  ASSERT_EQ(image_manager_cancel_async(imm, NULL, &actx), RET_OK);
+  ASSERT_EQ(image_manager_dispatch_async(imm, TRUE), RET_OK);
+  ASSERT_EQ(actx.done, 0);
+  ASSERT_EQ(other.done, 1);
+  ASSERT_EQ(other.result, RET_OK);
+  ASSERT_EQ(image_manager_lookup(imm, "ania", &bmp), RET_OK);
+
+  image_manager_destroy(imm);
+}
+
+TEST(ImageManager, async_destroy) {
+  bitmap_t bmp;
+  char name[32];
+  async_ctx_t actx = {0, RET_FAIL};
+  image_manager_t* imm = image_manager_create();
+
+  for (uint32_t i = 1; i <= 9; i++) {
+    tk_snprintf(name, sizeof(name), "ani%u", i);
+    ASSERT_EQ(image_manager_get_bitmap_async(imm, name, &bmp, 0, on_async_done, &actx), RET_BUSY);
+  }
+
+  image_manager_destroy(imm);
+  ASSERT_EQ(actx.done, 0);
+}
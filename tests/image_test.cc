@@ -112,6 +112,35 @@ TEST(Image, animator2) {
   widget_destroy((w));
 }
 
+TEST(Image, async_load) {
+  bitmap_t bmp;
+  image_manager_t* imm = image_manager();
+  uint32_t max_mem_size = imm->max_mem_size_of_cached_images;
+  widget_t* img = image_create(NULL, 0, 0, 100, 100);
+  widget_t* img2 = image_create(NULL, 0, 0, 100, 100);
+
+  ASSERT_EQ(widget_get_prop_bool(img, WIDGET_PROP_ASYNC_LOAD, TRUE), FALSE);
+  ASSERT_EQ(widget_set_prop_bool(img, WIDGET_PROP_ASYNC_LOAD, TRUE), RET_OK);
+  ASSERT_EQ(IMAGE(img)->async_load, TRUE);
+  ASSERT_EQ(widget_get_prop_bool(img, WIDGET_PROP_ASYNC_LOAD, FALSE), TRUE);
+
+  image_manager_set_max_mem_size_of_cached_images(imm, 0);
+  image_manager_unload_bitmap_by_name(imm, "anib");
+  image_manager_unload_bitmap_by_name(imm, "anic");
+  ASSERT_EQ(widget_load_image_async(img, "anib", &bmp, 0), RET_BUSY);
+  ASSERT_EQ(widget_load_image_async(img2, "anic", &bmp, 0), RET_BUSY);
+  widget_destroy(img2);
+
+  img->dirty = FALSE;
+  ASSERT_EQ(image_manager_dispatch_async(imm, TRUE), RET_OK);
+  ASSERT_EQ(img->dirty, TRUE);
+  ASSERT_EQ(widget_load_image_async(img, "anib", &bmp, 0), RET_OK);
+  ASSERT_EQ(bmp.w > 0, true);
+
+  widget_destroy(img);
+  image_manager_set_max_mem_size_of_cached_images(imm, max_mem_size);
+}
+
 TEST(Image, cast) {
   widget_t* w = image_create(NULL, 0, 0, 400, 300);
 
@@ -0,0 +1,205 @@
+﻿#include "base/canvas.h"
+#include "base/layer_cache.h"
+#include "base/image_manager.h"
+#include "base/font_manager.h"
+#include "base/native_window.h"
+#include "base/window_manager.h"
+#include "widgets/view.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "gtest/gtest.h"
+
+static uint32_t s_layer_paint_count = 0;
+
+static ret_t layer_cache_test_on_paint(void* ctx, event_t* e) {
+  canvas_t* c = paint_event_cast(e)->c;
+  widget_t* widget = WIDGET(e->target);
+
+  s_layer_paint_count++;
+  canvas_set_fill_color(c, color_init(0x20, 0x40, 0x80, 0xff));
+  canvas_fill_rect(c, 0, 0, widget->w, widget->h);
+
+  return RET_OK;
+}
+
+/*离线画布需要窗口管理器的原生窗口，这里提供一个只返回测试画布的原生窗口*/
+static canvas_t* s_layer_canvas = NULL;
+
+static canvas_t* layer_cache_test_get_canvas(native_window_t* win) {
+  return s_layer_canvas;
+}
+
+static const struct layer_cache_test_native_window_vtable_t : native_window_vtable_t {
+  layer_cache_test_native_window_vtable_t() {
+    type = "layer_cache_test";
+    get_canvas = layer_cache_test_get_canvas;
+  }
+} s_layer_native_window_vtable;
+
+static const struct layer_cache_test_object_vtable_t : object_vtable_t {
+  layer_cache_test_object_vtable_t() {
+    type = "layer_cache_test";
+    desc = "layer_cache_test";
+    size = sizeof(native_window_t);
+  }
+} s_layer_object_vtable;
+
+static native_window_t* layer_cache_test_attach(canvas_t* c) {
+  native_window_t* nw = NATIVE_WINDOW(tk_object_create(&s_layer_object_vtable));
+
+  nw->vt = &s_layer_native_window_vtable;
+  s_layer_canvas = c;
+  widget_set_prop_pointer(window_manager(), WIDGET_PROP_NATIVE_WINDOW, nw);
+
+  return nw;
+}
+
+static void layer_cache_test_detach(native_window_t* nw) {
+  widget_set_prop_pointer(window_manager(), WIDGET_PROP_NATIVE_WINDOW, NULL);
+  s_layer_canvas = NULL;
+  TK_OBJECT_UNREF(nw);
+}
+
+static widget_t* layer_cache_test_create(void) {
+  widget_t* win = view_create(NULL, 0, 0, 320, 240);
+  widget_t* panel = view_create(win, 20, 10, 100, 80);
+  widget_t* child = view_create(panel, 10, 10, 20, 20);
+
+  widget_set_name(panel, "panel");
+  widget_set_name(child, "child");
+  widget_on(panel, EVT_PAINT, layer_cache_test_on_paint, NULL);
+
+  return win;
+}
+
+TEST(LayerCache, prop) {
+  value_t v;
+  widget_t* win = layer_cache_test_create();
+  widget_t* panel = widget_lookup(win, "panel", TRUE);
+
+  ASSERT_EQ(panel->cache_as_bitmap, FALSE);
+  ASSERT_EQ(widget_set_prop_bool(panel, WIDGET_PROP_CACHE_AS_BITMAP, TRUE), RET_OK);
+  ASSERT_EQ(panel->cache_as_bitmap, TRUE);
+  ASSERT_EQ(widget_get_prop(panel, WIDGET_PROP_CACHE_AS_BITMAP, &v), RET_OK);
+  ASSERT_EQ(value_bool(&v), TRUE);
+
+  ASSERT_EQ(widget_set_cache_as_bitmap(panel, FALSE), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(panel, WIDGET_PROP_CACHE_AS_BITMAP, TRUE), FALSE);
+
+  widget_destroy(win);
+}
+
+TEST(LayerCache, paint) {
+  canvas_t c;
+  layer_cache_t* cache = layer_cache_create();
+  lcd_t* lcd = lcd_mem_bgra8888_create(320, 240, TRUE);
+  widget_t* win = layer_cache_test_create();
+  widget_t* panel = widget_lookup(win, "panel", TRUE);
+  widget_t* child = widget_lookup(win, "child", TRUE);
+
+  native_window_t* nw = NULL;
+
+  canvas_init(&c, lcd, font_manager());
+  canvas_begin_frame(&c, NULL, LCD_DRAW_OFFLINE);
+
+  /*没有原生窗口时不能创建离线画布，返回RET_NOT_IMPL，由调用者直接绘制*/
+  s_layer_paint_count = 0;
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_NOT_IMPL);
+  ASSERT_EQ(s_layer_paint_count, 0u);
+
+#ifndef WITH_GPU
+  nw = layer_cache_test_attach(&c);
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_OK);
+  ASSERT_EQ(cache->misses, 1u);
+  ASSERT_EQ(s_layer_paint_count, 1u);
+  ASSERT_EQ(cache->mem_size > 0, TRUE);
+
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_OK);
+  ASSERT_EQ(cache->hits, 1u);
+  ASSERT_EQ(s_layer_paint_count, 1u);
+
+  ASSERT_EQ(layer_cache_invalidate(cache, child), RET_OK);
+  ASSERT_EQ(layer_cache_invalidate(cache, panel), RET_OK);
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_OK);
+  ASSERT_EQ(cache->misses, 2u);
+  ASSERT_EQ(s_layer_paint_count, 2u);
+  layer_cache_test_detach(nw);
+#else
+  (void)nw;
+  (void)child;
+#endif /*WITH_GPU*/
+
+  ASSERT_EQ(layer_cache_remove(cache, panel), RET_OK);
+  ASSERT_EQ(layer_cache_remove(cache, panel), RET_NOT_FOUND);
+  ASSERT_EQ(cache->mem_size, 0u);
+  ASSERT_EQ(image_manager()->reserved_mem_size, 0u);
+
+  canvas_end_frame(&c);
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  layer_cache_destroy(cache);
+  widget_destroy(win);
+}
+
+TEST(LayerCache, budget) {
+  canvas_t c;
+  layer_cache_t* cache = layer_cache_create();
+  lcd_t* lcd = lcd_mem_bgra8888_create(320, 240, TRUE);
+  widget_t* win = layer_cache_test_create();
+  widget_t* panel = widget_lookup(win, "panel", TRUE);
+  uint32_t max_mem_size = image_manager()->max_mem_size_of_cached_images;
+  native_window_t* nw = NULL;
+
+  canvas_init(&c, lcd, font_manager());
+  canvas_begin_frame(&c, NULL, LCD_DRAW_OFFLINE);
+#ifndef WITH_GPU
+  nw = layer_cache_test_attach(&c);
+#endif /*WITH_GPU*/
+
+  /*超出共用的内存上限时不缓存*/
+  image_manager_set_max_mem_size_of_cached_images(image_manager(), 100);
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_NOT_IMPL);
+  ASSERT_EQ(cache->mem_size, 0u);
+
+  /*尺寸变化后释放了旧的位图，但新的位图放不下时，不再占用图片缓存的内存*/
+#ifndef WITH_GPU
+  image_manager_set_max_mem_size_of_cached_images(image_manager(), 100 * 80 * 4);
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_OK);
+  ASSERT_EQ(image_manager()->reserved_mem_size, cache->mem_size);
+  ASSERT_EQ(cache->mem_size > 0, true);
+  widget_resize(panel, 200, 80);
+  ASSERT_EQ(layer_cache_paint(cache, panel, &c), RET_NOT_IMPL);
+  ASSERT_EQ(cache->mem_size, 0u);
+  ASSERT_EQ(image_manager()->reserved_mem_size, 0u);
+  layer_cache_test_detach(nw);
+#else
+  (void)nw;
+#endif /*WITH_GPU*/
+  image_manager_set_max_mem_size_of_cached_images(image_manager(), max_mem_size);
+
+  canvas_end_frame(&c);
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  layer_cache_destroy(cache);
+  widget_destroy(win);
+}
+
+TEST(LayerCache, widget) {
+  canvas_t c;
+  lcd_t* lcd = lcd_mem_bgra8888_create(320, 240, TRUE);
+  widget_t* win = layer_cache_test_create();
+  widget_t* panel = widget_lookup(win, "panel", TRUE);
+
+  canvas_init(&c, lcd, font_manager());
+  widget_set_cache_as_bitmap(panel, TRUE);
+
+  /*无论是否能够缓存，控件都要被绘制*/
+  s_layer_paint_count = 0;
+  canvas_begin_frame(&c, NULL, LCD_DRAW_OFFLINE);
+  ASSERT_EQ(widget_paint(win, &c), RET_OK);
+  canvas_end_frame(&c);
+  ASSERT_EQ(s_layer_paint_count, 1u);
+
+  widget_destroy(win);
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+}
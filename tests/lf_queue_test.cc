@@ -0,0 +1,131 @@
+﻿#include "gtest/gtest.h"
+#include "tkc/thread.h"
+#include "tkc/platform.h"
+#include "tkc/lf_queue.h"
+
+TEST(LfQueue, basic) {
+  uint32_t i = 0;
+  uint32_t v = 0;
+  tk_lf_queue_t* q = tk_lf_queue_create(sizeof(uint32_t), 5);
+
+  ASSERT_TRUE(q != NULL);
+  ASSERT_EQ(tk_lf_queue_capacity(q), 8u);
+  ASSERT_EQ(tk_lf_queue_size(q), 0u);
+  ASSERT_EQ(tk_lf_queue_pop(q, &v), RET_FAIL);
+
+  /*多轮写满再读空，检查序号回绕*/
+  for (uint32_t round = 0; round < 3; round++) {
+    for (i = 0; i < tk_lf_queue_capacity(q); i++) {
+      v = round * 100 + i;
+      ASSERT_EQ(tk_lf_queue_push(q, &v), RET_OK);
+    }
+    ASSERT_EQ(tk_lf_queue_size(q), tk_lf_queue_capacity(q));
+    ASSERT_EQ(tk_lf_queue_push(q, &v), RET_FAIL);
+
+    for (i = 0; i < tk_lf_queue_capacity(q); i++) {
+      ASSERT_EQ(tk_lf_queue_pop(q, &v), RET_OK);
+      ASSERT_EQ(v, round * 100 + i);
+    }
+    ASSERT_EQ(tk_lf_queue_pop(q, &v), RET_FAIL);
+  }
+
+  v = 1;
+  ASSERT_EQ(tk_lf_queue_push(q, &v), RET_OK);
+  ASSERT_EQ(tk_lf_queue_pop(q, NULL), RET_OK);
+  ASSERT_EQ(tk_lf_queue_size(q), 0u);
+
+  tk_lf_queue_destroy(q);
+}
+
+TEST(LfQueue, batch) {
+  uint32_t i = 0;
+  uint32_t v = 0;
+  uint32_t out[16];
+  tk_lf_queue_t* q = tk_lf_queue_create(sizeof(uint32_t), 8);
+
+  ASSERT_EQ(tk_lf_queue_pop_batch(q, out, ARRAY_SIZE(out)), 0u);
+  for (i = 0; i < 6; i++) {
+    ASSERT_EQ(tk_lf_queue_push(q, &i), RET_OK);
+  }
+
+  ASSERT_EQ(tk_lf_queue_pop_batch(q, out, 4), 4u);
+  for (i = 0; i < 4; i++) {
+    ASSERT_EQ(out[i], i);
+  }
+
+  /*跨越数组末尾*/
+  for (i = 6; i < 12; i++) {
+    ASSERT_EQ(tk_lf_queue_push(q, &i), RET_OK);
+  }
+  ASSERT_EQ(tk_lf_queue_push(q, &i), RET_FAIL);
+  ASSERT_EQ(tk_lf_queue_pop_batch(q, out, ARRAY_SIZE(out)), 8u);
+  for (i = 0; i < 8; i++) {
+    ASSERT_EQ(out[i], i + 4);
+  }
+  ASSERT_EQ(tk_lf_queue_pop(q, &v), RET_FAIL);
+
+  tk_lf_queue_destroy(q);
+}
+
+#define LF_QUEUE_PRODUCERS 4
+#define LF_QUEUE_ITEMS 20000
+
+typedef struct _lf_queue_producer_t {
+  tk_lf_queue_t* q;
+  uint32_t id;
+} lf_queue_producer_t;
+
+static void* lf_queue_producer(void* args) {
+  uint32_t i = 0;
+  lf_queue_producer_t* p = (lf_queue_producer_t*)args;
+
+  for (i = 0; i < LF_QUEUE_ITEMS; i++) {
+    uint32_t v = (p->id << 24) | i;
+    while (tk_lf_queue_push(p->q, &v) != RET_OK) {
+      sleep_ms(0);
+    }
+  }
+
+  return NULL;
+}
+
+TEST(LfQueue, mpsc) {
+  uint32_t i = 0;
+  uint32_t nr = 0;
+  uint32_t out[8];
+  uint32_t next[LF_QUEUE_PRODUCERS];
+  tk_thread_t* threads[LF_QUEUE_PRODUCERS];
+  lf_queue_producer_t producers[LF_QUEUE_PRODUCERS];
+  tk_lf_queue_t* q = tk_lf_queue_create(sizeof(uint32_t), 64);
+
+  for (i = 0; i < LF_QUEUE_PRODUCERS; i++) {
+    next[i] = 0;
+    producers[i].q = q;
+    producers[i].id = i;
+    threads[i] = tk_thread_create(lf_queue_producer, producers + i);
+    tk_thread_start(threads[i]);
+  }
+
+  /*每个生产者的数据必须按顺序到达，且不丢失不重复*/
+  while (nr < LF_QUEUE_PRODUCERS * LF_QUEUE_ITEMS) {
+    uint32_t k = 0;
+    uint32_t n = tk_lf_queue_pop_batch(q, out, ARRAY_SIZE(out));
+
+    for (k = 0; k < n; k++) {
+      uint32_t id = out[k] >> 24;
+      ASSERT_TRUE(id < LF_QUEUE_PRODUCERS);
+      ASSERT_EQ(out[k] & 0xffffff, next[id]);
+      next[id]++;
+    }
+    nr += n;
+  }
+
+  for (i = 0; i < LF_QUEUE_PRODUCERS; i++) {
+    tk_thread_join(threads[i]);
+    tk_thread_destroy(threads[i]);
+    ASSERT_EQ(next[i], (uint32_t)LF_QUEUE_ITEMS);
+  }
+  ASSERT_EQ(tk_lf_queue_size(q), 0u);
+
+  tk_lf_queue_destroy(q);
+}
@@ -0,0 +1,95 @@
+#include "awtk.h"
+#include "tkc/time_now.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "scroll_view/list_view.h"
+#include "scroll_view/scroll_view.h"
+
+#define BENCH_W 480
+#define BENCH_H 800
+#define BENCH_FRAMES 2000
+#define BENCH_ITEM_H 30
+#define BENCH_VIRTUAL_ITEMS 1000000
+#define BENCH_REAL_ITEMS 10000
+
+static ret_t bench_bind_item(void* ctx, widget_t* widget, widget_t* item, uint32_t index) {
+  char text[32];
+
+  tk_snprintf(text, sizeof(text), "row %u", index);
+
+  return widget_set_text_utf8(item, text);
+}
+
+static widget_t* bench_create(uint32_t nr, bool_t virtual_mode) {
+  uint32_t i = 0;
+  widget_t* widget = list_view_create(NULL, 0, 0, BENCH_W, BENCH_H);
+  widget_t* scroll_view = scroll_view_create(widget, 0, 0, BENCH_W, BENCH_H);
+
+  list_view_set_item_height(widget, BENCH_ITEM_H);
+  if (virtual_mode) {
+    label_create(scroll_view, 0, 0, 0, 0);
+    list_view_set_bind_item(widget, bench_bind_item, NULL);
+    list_view_set_virtual_items(widget, nr);
+  } else {
+    for (i = 0; i < nr; i++) {
+      bench_bind_item(NULL, widget, label_create(scroll_view, 0, 0, 0, 0), i);
+    }
+  }
+  widget_layout_children(widget);
+
+  return widget;
+}
+
+/*每帧滚动一段距离并绘制，返回每帧的平均耗时(毫秒)*/
+static double bench_scroll(canvas_t* c, widget_t* widget, uint32_t nr) {
+  uint32_t i = 0;
+  uint64_t start = time_now_us();
+  widget_t* scroll_view = LIST_VIEW(widget)->scroll_view;
+  int32_t range = nr * BENCH_ITEM_H - BENCH_H;
+
+  for (i = 0; i < BENCH_FRAMES; i++) {
+    /*大部分是连续的小步滚动，每100帧跳转到一个远处的位置*/
+    int32_t offset = (i % 100) ? (i * 37) : (int32_t)(((uint64_t)i * 7919 * BENCH_ITEM_H) % range);
+
+    scroll_view_set_offset(scroll_view, 0, offset % range);
+    canvas_begin_frame(c, NULL, LCD_DRAW_OFFLINE);
+    widget_paint(widget, c);
+    canvas_end_frame(c);
+  }
+
+  return (double)(time_now_us() - start) / BENCH_FRAMES / 1000.0;
+}
+
+static void bench_run(canvas_t* c, uint32_t nr, bool_t virtual_mode) {
+  uint64_t start = time_now_us();
+  widget_t* widget = bench_create(nr, virtual_mode);
+  double create = (double)(time_now_us() - start) / 1000.0;
+  double frame = bench_scroll(c, widget, nr);
+
+  log_info("%-8s items=%-8u widgets=%-6d create=%8.2fms frame=%.3fms\n",
+           virtual_mode ? "virtual" : "real", nr,
+           widget_count_children(LIST_VIEW(widget)->scroll_view), create, frame);
+
+  widget_destroy(widget);
+  idle_dispatch();
+}
+
+int main(int argc, char* argv[]) {
+  canvas_t c;
+  lcd_t* lcd = NULL;
+
+  tk_init(BENCH_W, BENCH_H, APP_CONSOLE, NULL, "./");
+  tk_init_assets();
+
+  lcd = lcd_mem_bgra8888_create(BENCH_W, BENCH_H, TRUE);
+  canvas_init(&c, lcd, font_manager());
+
+  bench_run(&c, BENCH_REAL_ITEMS, FALSE);
+  bench_run(&c, BENCH_REAL_ITEMS, TRUE);
+  bench_run(&c, BENCH_VIRTUAL_ITEMS, TRUE);
+
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  tk_exit();
+
+  return 0;
+}
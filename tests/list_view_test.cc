@@ -1,4 +1,5 @@
 ﻿#include "scroll_view/list_view.h"
+#include "scroll_view/scroll_view.h"
 #include "base/canvas.h"
 #include "base/widget.h"
 #include "base/layout.h"
@@ -37,3 +38,148 @@ TEST(ListView, cast) {
 
   widget_destroy(w);
 }
+
+static ret_t list_view_test_bind_item(void* ctx, widget_t* widget, widget_t* item,
+                                      uint32_t index) {
+  char text[32];
+  uint32_t* binds = (uint32_t*)ctx;
+
+  *binds += 1;
+  tk_snprintf(text, sizeof(text), "%u", index);
+
+  return widget_set_name(item, text);
+}
+
+static int32_t list_view_test_get_item_height(void* ctx, widget_t* widget, uint32_t index) {
+  return 20 + (index % 3) * 10;
+}
+
+static widget_t* list_view_test_find_item(widget_t* scroll_view, uint32_t index) {
+  char name[32];
+  widget_t* item = NULL;
+
+  tk_snprintf(name, sizeof(name), "%u", index);
+  item = widget_child(scroll_view, name);
+
+  return (item != NULL && item->visible) ? item : NULL;
+}
+
+TEST(ListView, virtual_items) {
+  uint32_t binds = 0;
+  widget_t* widget = list_view_create(NULL, 0, 0, 200, 300);
+  widget_t* scroll_view = scroll_view_create(widget, 0, 0, 200, 300);
+  scroll_view_t* sv = SCROLL_VIEW(scroll_view);
+  widget_t* item = NULL;
+
+  list_view_set_item_height(widget, 30);
+  ASSERT_EQ(list_view_set_bind_item(widget, list_view_test_bind_item, &binds), RET_OK);
+  ASSERT_EQ(list_view_is_virtual(widget), TRUE);
+  ASSERT_EQ(widget_set_prop_int(widget, LIST_VIEW_PROP_VIRTUAL_ITEMS, 1000000), RET_OK);
+  ASSERT_EQ(widget_get_prop_int(widget, LIST_VIEW_PROP_VIRTUAL_ITEMS, 0), 1000000);
+  widget_layout_children(widget);
+
+  /*只创建可见区域加上overscan的列表项*/
+  ASSERT_EQ(sv->virtual_h, 30000000);
+  ASSERT_EQ(widget_count_children(scroll_view), 10 + 2);
+  item = list_view_test_find_item(scroll_view, 0);
+  ASSERT_TRUE(item != NULL);
+  ASSERT_EQ(item->y, 0);
+  ASSERT_EQ(item->w, 200);
+  ASSERT_EQ(item->h, 30);
+  ASSERT_EQ(list_view_get_virtual_item_index(widget, item), 0);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 11) != NULL);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 12) == NULL);
+
+  /*滚动后回收列表项*/
+  binds = 0;
+  scroll_view_set_offset(scroll_view, 0, 500000 * 30);
+  widget_layout_children(widget);
+  ASSERT_EQ(widget_count_children(scroll_view), 10 + 4);
+  item = list_view_test_find_item(scroll_view, 500000);
+  ASSERT_TRUE(item != NULL);
+  ASSERT_EQ(item->y, 500000 * 30);
+  ASSERT_EQ(list_view_get_virtual_item_index(widget, item), 500000);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 499998) != NULL);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 500011) != NULL);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 0) == NULL);
+  ASSERT_EQ(binds, 10 + 4);
+
+  /*小步滚动只重新绑定新进入的列表项*/
+  binds = 0;
+  scroll_view_set_offset(scroll_view, 0, 500001 * 30);
+  widget_layout_children(widget);
+  ASSERT_EQ(binds, 1);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 500012) != NULL);
+
+  /*数据项减少*/
+  ASSERT_EQ(list_view_set_virtual_items(widget, 3), RET_OK);
+  ASSERT_EQ(sv->virtual_h, 90);
+  ASSERT_EQ(sv->yoffset, 0);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 2) != NULL);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 3) == NULL);
+
+  widget_destroy(widget);
+}
+
+TEST(ListView, virtual_items_layouter_item_height) {
+  uint32_t binds = 0;
+  widget_t* widget = list_view_create(NULL, 0, 0, 200, 300);
+  widget_t* scroll_view = scroll_view_create(widget, 0, 0, 200, 300);
+  scroll_view_t* sv = SCROLL_VIEW(scroll_view);
+  widget_t* item = NULL;
+
+  /*list_view没有设置item_height时，使用children_layout中的item_height*/
+  widget_set_children_layout(scroll_view, "list_view(item_height=40,y_margin=5)");
+  list_view_set_bind_item(widget, list_view_test_bind_item, &binds);
+  list_view_set_virtual_items(widget, 100);
+  widget_layout_children(widget);
+  ASSERT_EQ(sv->virtual_h, 100 * 40 + 2 * 5);
+  item = list_view_test_find_item(scroll_view, 1);
+  ASSERT_TRUE(item != NULL);
+  ASSERT_EQ(item->y, 5 + 40);
+  ASSERT_EQ(item->h, 40);
+
+  widget_set_children_layout(scroll_view, "list_view(default_item_height=25)");
+  widget_layout_children(widget);
+  ASSERT_EQ(sv->virtual_h, 100 * 25);
+
+  /*list_view的item_height优先*/
+  list_view_set_item_height(widget, 30);
+  widget_layout_children(widget);
+  ASSERT_EQ(sv->virtual_h, 100 * 30);
+
+  widget_destroy(widget);
+}
+
+TEST(ListView, virtual_items_var_height) {
+  uint32_t binds = 0;
+  widget_t* widget = list_view_create(NULL, 0, 0, 200, 300);
+  widget_t* scroll_view = scroll_view_create(widget, 0, 0, 200, 300);
+  scroll_view_t* sv = SCROLL_VIEW(scroll_view);
+  widget_t* item = NULL;
+
+  widget_set_children_layout(scroll_view, "list_view(y_margin=5,spacing=2)");
+  list_view_set_item_height_func(widget, list_view_test_get_item_height, NULL);
+  list_view_set_bind_item(widget, list_view_test_bind_item, &binds);
+  list_view_set_virtual_items(widget, 3000);
+  widget_layout_children(widget);
+
+  /*每3项的高度为20+30+40，加上间距和边距*/
+  ASSERT_EQ(sv->virtual_h, 1000 * 90 + 2999 * 2 + 2 * 5);
+
+  item = list_view_test_find_item(scroll_view, 4);
+  ASSERT_TRUE(item != NULL);
+  ASSERT_EQ(item->y, 5 + 90 + 20 + 4 * 2);
+  ASSERT_EQ(item->h, 30);
+
+  scroll_view_set_offset(scroll_view, 0, 5 + 2000 / 3 * 90 + 2000 * 2 + 1);
+  widget_layout_children(widget);
+  item = list_view_test_find_item(scroll_view, 1998);
+  ASSERT_TRUE(item != NULL);
+  ASSERT_EQ(item->y, 5 + 666 * 90 + 1998 * 2);
+  ASSERT_EQ(item->h, 20);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 1996) != NULL);
+  ASSERT_TRUE(list_view_test_find_item(scroll_view, 1995) == NULL);
+
+  widget_destroy(widget);
+}
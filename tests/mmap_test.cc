@@ -28,3 +28,15 @@ TEST(MMap, write) {
 
   file_remove(filename);
 }
+
+TEST(MMap, ref) {
+  const char* str = "test";
+  const char* filename = "test.bin";
+  file_write(filename, str, strlen(str));
+  mmap_t* map = mmap_create(filename, FALSE, FALSE);
+  ASSERT_EQ(mmap_ref(map), map);
+  ASSERT_EQ(mmap_destroy(map), RET_OK);
+  ASSERT_EQ(memcmp(map->data, str, strlen(str)) == 0, TRUE);
+  ASSERT_EQ(mmap_destroy(map), RET_OK);
+  file_remove(filename);
+}
@@ -950,3 +950,49 @@ TEST(ObjectDefault, foreach_object) {
   TK_OBJECT_UNREF(com2);
   TK_OBJECT_UNREF(root);
 }
+
+TEST(ObjectDefault, find_prop_cached) {
+  value_t* v = NULL;
+  object_default_prop_cache_t caches[2];
+  tk_object_t* obj = object_default_create();
+  tk_object_t* sub = object_default_create();
+
+  memset(caches, 0x00, sizeof(caches));
+  tk_object_set_prop_int(obj, "b", 2);
+  tk_object_set_prop_int(obj, "c", 3);
+  v = object_default_find_prop_cached(obj, "b", caches, 1);
+  ASSERT_EQ(value_int(v), 2);
+  ASSERT_EQ(caches[0].value, v);
+
+  /*属性值变化不影响缓存*/
+  tk_object_set_prop_int(obj, "b", 20);
+  ASSERT_EQ(object_default_find_prop_cached(obj, "b", caches, 1), v);
+  ASSERT_EQ(value_int(v), 20);
+
+  /*增删属性后重新查找*/
+  tk_object_set_prop_int(obj, "a", 1);
+  v = object_default_find_prop_cached(obj, "b", caches, 1);
+  ASSERT_EQ(value_int(v), 20);
+  tk_object_remove_prop(obj, "a");
+  v = object_default_find_prop_cached(obj, "b", caches, 1);
+  ASSERT_EQ(value_int(v), 20);
+  tk_object_remove_prop(obj, "b");
+  ASSERT_TRUE(object_default_find_prop_cached(obj, "b", caches, 1) == NULL);
+  ASSERT_TRUE(object_default_find_prop_cached(obj, TK_OBJECT_PROP_SIZE, caches, 1) == NULL);
+
+  /*路径*/
+  memset(caches, 0x00, sizeof(caches));
+  tk_object_set_prop_int(sub, "x", 100);
+  tk_object_set_prop_object(obj, "sub", sub);
+  v = object_default_find_prop_cached(obj, "sub.x", caches, 2);
+  ASSERT_EQ(value_int(v), 100);
+  ASSERT_TRUE(object_default_find_prop_cached(obj, "sub.x", caches, 1) == NULL);
+  tk_object_set_prop_int(obj, "sub", 1);
+  ASSERT_TRUE(object_default_find_prop_cached(obj, "sub.x", caches, 2) == NULL);
+
+  memset(caches, 0x00, sizeof(caches));
+  ASSERT_TRUE(object_default_find_prop_cached(obj, "c.x", caches, 2) == NULL);
+
+  TK_OBJECT_UNREF(sub);
+  TK_OBJECT_UNREF(obj);
+}
@@ -0,0 +1,111 @@
+﻿#include "awtk.h"
+#include "tkc/time_now.h"
+#include "base/widget_vtable.h"
+#include "base/tile_painter.h"
+#include "lcd/lcd_mem_bgra8888.h"
+
+#define BENCH_W 1280
+#define BENCH_H 800
+#define BENCH_NR 30
+
+static bitmap_t* s_image = NULL;
+
+static ret_t bench_on_paint(widget_t* widget, canvas_t* c) {
+  uint32_t i = 0;
+  uint32_t j = 0;
+  rect_t src = rect_init(0, 0, s_image->w, s_image->h);
+
+  canvas_set_fill_color(c, color_init(0x20, 0x40, 0x80, 0xff));
+  canvas_fill_rect(c, 0, 0, widget->w, widget->h);
+
+  /*模拟一个图标和文字较多的界面：半透明的卡片、图标和标签*/
+  for (i = 0; i < BENCH_H / 100; i++) {
+    for (j = 0; j < BENCH_W / 160; j++) {
+      xy_t x = j * 160 + 8;
+      xy_t y = i * 100 + 8;
+      rect_t dst = rect_init(x + 8, y + 8, s_image->w, s_image->h);
+
+      canvas_set_fill_color(c, color_init(0xf0, 0xf0, 0xf0, 0xc0));
+      canvas_fill_rect(c, x, y, 144, 84);
+      canvas_draw_image(c, s_image, &src, &dst);
+      canvas_set_text_color(c, color_init(0x10, 0x10, 0x10, 0xff));
+      canvas_set_font(c, NULL, 18);
+      canvas_draw_utf8(c, "AWTK Label", x + 76, y + 30);
+    }
+  }
+
+  return RET_OK;
+}
+
+static bitmap_t* bench_create_image(void) {
+  uint32_t i = 0;
+  bitmap_t* b = bitmap_create_ex(64, 64, 0, BITMAP_FMT_RGBA8888);
+  uint8_t* data = bitmap_lock_buffer_for_write(b);
+
+  for (i = 0; i < b->line_length * b->h; i++) {
+    data[i] = (uint8_t)(i * 7);
+  }
+  bitmap_unlock_buffer(b);
+
+  return b;
+}
+
+static double bench_run(canvas_t* c, widget_t* widget, uint32_t threads) {
+  uint32_t i = 0;
+  uint64_t start = 0;
+  rect_t r = rect_init(0, 0, BENCH_W, BENCH_H);
+  tile_painter_t* painter = threads > 1 ? tile_painter_create(threads) : NULL;
+
+  for (i = 0; i <= BENCH_NR; i++) {
+    if (i == 1) {
+      /*第一帧用于加载字体和创建条带*/
+      start = time_now_us();
+    }
+
+    canvas_begin_frame(c, NULL, LCD_DRAW_OFFLINE);
+    if (painter == NULL || tile_painter_paint(painter, widget, c, &r, bench_on_paint) != RET_OK) {
+      widget_paint_with_clip(widget, &r, c, bench_on_paint);
+    }
+    canvas_end_frame(c);
+  }
+
+  if (painter != NULL) {
+    tile_painter_destroy(painter);
+  }
+
+  return (double)(time_now_us() - start) / BENCH_NR / 1000.0;
+}
+
+int main(int argc, char* argv[]) {
+  canvas_t c;
+  uint32_t i = 0;
+  double base = 0;
+  uint32_t threads[] = {1, 2, 4};
+  lcd_t* lcd = NULL;
+  widget_t* widget = NULL;
+
+  tk_init(BENCH_W, BENCH_H, APP_CONSOLE, NULL, "./");
+  tk_init_assets();
+
+  lcd = lcd_mem_bgra8888_create(BENCH_W, BENCH_H, TRUE);
+  widget = view_create(NULL, 0, 0, BENCH_W, BENCH_H);
+  s_image = bench_create_image();
+  canvas_init(&c, lcd, font_manager());
+
+  for (i = 0; i < ARRAY_SIZE(threads); i++) {
+    double ms = bench_run(&c, widget, threads[i]);
+
+    if (i == 0) {
+      base = ms;
+    }
+    log_info("threads=%u frame=%.2fms x%.2f\n", threads[i], ms, base / ms);
+  }
+
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  bitmap_destroy(s_image);
+  widget_destroy(widget);
+  tk_exit();
+
+  return 0;
+}
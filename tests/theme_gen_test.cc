@@ -4,6 +4,7 @@
 #include "gtest/gtest.h"
 #include "base/style_factory.h"
 #include "base/theme_xml.h"
+#include "base/theme_default.h"
 #include <stdlib.h>
 
 #include <string>
@@ -449,3 +450,122 @@ TEST(ThemeGen, bool) {
   style_destroy(s);
   theme_destroy(theme);
 }
+
+TEST(ThemeGen, style_ids) {
+  uint16_t i = 0;
+  const char* name = NULL;
+
+  for (i = 0; (name = style_data_id_to_name(i)) != NULL; i++) {
+    ASSERT_EQ(style_data_name_to_id(name), i);
+  }
+
+  ASSERT_EQ(i > 40, true);
+  ASSERT_EQ(style_data_name_to_id("not_a_style"), STYLE_DATA_ID_UNKNOWN);
+  ASSERT_EQ(style_data_name_to_id(STYLE_ID_BG_COLOR), 0);
+}
+
+TEST(ThemeGen, v1_v2) {
+  uint32_t i = 0;
+  uint32_t size1 = 0;
+  uint32_t size2 = 0;
+  const char* types[] = {WIDGET_TYPE_BUTTON, WIDGET_TYPE_LABEL, "not_exist"};
+  const char* names[] = {TK_DEFAULT_STYLE, "red", "blue", "none"};
+  const char* states[] = {WIDGET_STATE_NORMAL, WIDGET_STATE_PRESSED, WIDGET_STATE_OVER};
+  const char* props[] = {STYLE_ID_BG_COLOR, STYLE_ID_FONT_SIZE, STYLE_ID_FONT_NAME,
+                         STYLE_ID_MARGIN,   "x_custom",         "a_custom"};
+  const char* str =
+      "<button>\
+      <style name=\"default\" font_size=\"18\" x_custom=\"1\">\
+      <normal bg_color=\"#112233\" a_custom=\"abc\" margin=\"-2\"/>\
+      <pressed bg_color=\"#223344\" font_name=\"sans\"/></style>\
+      <style name=\"red\"><normal bg_color=\"red\"/><over margin=\"3\"/></style>\
+      <style name=\"red\"><normal bg_color=\"blue\"/></style></button>\
+      <label><style name=\"blue\"><normal bg_color=\"blue\" font_size=\"20\"/></style>\
+      <style><normal text_color=\"red\"/></style></label>";
+  uint8_t* data1 = theme_xml_gen_ex(str, &size1, THEME_VERSION_1);
+  uint8_t* data2 = theme_xml_gen_ex(str, &size2, THEME_VERSION_2);
+  theme_t* theme1 = theme_default_create_ex(data1, TRUE);
+  theme_t* theme2 = theme_default_create_ex(data2, TRUE);
+
+  ASSERT_EQ(((const theme_header_t*)data1)->version, (uint32_t)THEME_VERSION_1);
+  ASSERT_EQ(((const theme_header_t*)data2)->version, (uint32_t)THEME_VERSION_2);
+
+  for (i = 0; i < ARRAY_SIZE(types) * ARRAY_SIZE(names) * ARRAY_SIZE(states); i++) {
+    uint32_t k = 0;
+    const char* type = types[i % ARRAY_SIZE(types)];
+    const char* name = names[(i / ARRAY_SIZE(types)) % ARRAY_SIZE(names)];
+    const char* state = states[i / (ARRAY_SIZE(types) * ARRAY_SIZE(names))];
+    const uint8_t* s1 = theme_find_style(theme1, type, name, state);
+    const uint8_t* s2 = theme_find_style(theme2, type, name, state);
+
+    ASSERT_EQ(s1 == NULL, s2 == NULL);
+    for (k = 0; s1 != NULL && k < ARRAY_SIZE(props); k++) {
+      ASSERT_EQ(style_data_get_int(s1, props[k], -100), style_data_get_int(s2, props[k], -100));
+      ASSERT_EQ(style_data_get_uint(s1, props[k], 100), style_data_get_uint(s2, props[k], 100));
+      ASSERT_STREQ(style_data_get_str(s1, props[k], "none"),
+                   style_data_get_str(s2, props[k], "none"));
+    }
+  }
+
+  ASSERT_EQ(style_data_get_uint(theme_find_style(theme2, WIDGET_TYPE_BUTTON, "red",
+                                                 WIDGET_STATE_NORMAL),
+                                STYLE_ID_BG_COLOR, 0),
+            0xff0000ffu);
+  ASSERT_STREQ(style_data_get_str(theme_find_style(theme2, WIDGET_TYPE_BUTTON, TK_DEFAULT_STYLE,
+                                                   WIDGET_STATE_NORMAL),
+                                  "a_custom", NULL),
+               "abc");
+
+  theme_destroy(theme1);
+  theme_destroy(theme2);
+}
+
+TEST(ThemeGen, snapshot) {
+  theme_t* theme = NULL;
+  const style_snapshot_t* snapshot = NULL;
+  const char* str =
+      "<widget><style><normal text_color=\"#000000\" font_size=\"12\" margin=\"4\" "
+      "margin_left=\"6\" round_radius=\"5\" round_radius_top_left=\"8\" icon=\"earth\"/>"
+      "<pressed text_color=\"red\" border=\"top\"/></style></widget>";
+  style_t* s = style_factory_create_style(NULL, theme_get_style_type(theme));
+
+  theme = theme_xml_create(str);
+  ASSERT_EQ(style_set_style_data(s,
+                                 theme_find_style(theme, WIDGET_TYPE_NONE, TK_DEFAULT_STYLE,
+                                                  WIDGET_STATE_NORMAL),
+                                 WIDGET_STATE_NORMAL),
+            RET_OK);
+
+  snapshot = style_get_snapshot(s);
+  ASSERT_EQ(snapshot->valid, TRUE);
+  ASSERT_EQ(snapshot->flags & STYLE_SNAPSHOT_HAS_TEXT_COLOR,
+            (uint32_t)STYLE_SNAPSHOT_HAS_TEXT_COLOR);
+  ASSERT_EQ(snapshot->text_color.color, 0xff000000u);
+  ASSERT_EQ(STYLE_SNAPSHOT_GET(snapshot, font_size, STYLE_SNAPSHOT_HAS_FONT_SIZE, 18), 12);
+  ASSERT_EQ(STYLE_SNAPSHOT_GET(snapshot, margin, STYLE_SNAPSHOT_HAS_MARGIN, 2), 4);
+  ASSERT_EQ(STYLE_SNAPSHOT_GET(snapshot, margin_left, STYLE_SNAPSHOT_HAS_MARGIN_LEFT, 4), 6);
+  ASSERT_EQ(STYLE_SNAPSHOT_GET(snapshot, margin_top, STYLE_SNAPSHOT_HAS_MARGIN_TOP, 4), 4);
+  ASSERT_EQ(snapshot->radius_tl, 8u);
+  ASSERT_EQ(snapshot->radius_br, 5u);
+  ASSERT_EQ(snapshot->border, (int32_t)BORDER_ALL);
+  ASSERT_EQ(snapshot->border_width, 1u);
+  ASSERT_EQ(snapshot->spacer, 2);
+  ASSERT_STREQ(snapshot->icon, "earth");
+  ASSERT_EQ(snapshot->font_name == NULL, true);
+
+  ASSERT_EQ(style_set_style_data(s,
+                                 theme_find_style(theme, WIDGET_TYPE_NONE, TK_DEFAULT_STYLE,
+                                                  WIDGET_STATE_PRESSED),
+                                 WIDGET_STATE_PRESSED),
+            RET_OK);
+  snapshot = style_get_snapshot(s);
+  ASSERT_EQ(snapshot->text_color.color, 0xff0000ffu);
+  ASSERT_EQ(snapshot->border, (int32_t)BORDER_TOP);
+  ASSERT_EQ(snapshot->flags & STYLE_SNAPSHOT_HAS_FONT_SIZE, 0u);
+  ASSERT_EQ(snapshot->icon == NULL, true);
+
+  ASSERT_EQ(style_get_snapshot(NULL)->border, (int32_t)BORDER_ALL);
+
+  style_destroy(s);
+  theme_destroy(theme);
+}
@@ -0,0 +1,183 @@
+﻿#include "base/canvas.h"
+#include "base/tile_painter.h"
+#include "base/font_manager.h"
+#include "widgets/view.h"
+#include "widgets/label.h"
+#include "widgets/image.h"
+#include "widgets/button.h"
+#include "svg_image/svg_image.h"
+#include "rich_text/rich_text.h"
+#include "base/widget_vtable.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "gtest/gtest.h"
+
+#define TP_W 320
+#define TP_H 240
+
+static bitmap_t* s_tp_image = NULL;
+
+static ret_t tile_painter_test_on_paint(widget_t* widget, canvas_t* c) {
+  uint32_t i = 0;
+  rect_t src = rect_init(0, 0, s_tp_image->w, s_tp_image->h);
+
+  canvas_set_fill_color(c, color_init(0x20, 0x40, 0x80, 0xff));
+  canvas_fill_rect(c, 0, 0, widget->w, widget->h);
+
+  for (i = 0; i < 20; i++) {
+    rect_t dst = rect_init(i * 13, i * 11, 64, 48);
+
+    canvas_set_fill_color(c, color_init(i * 12, 0xff - i * 12, 0x80, 0x80 + i));
+    canvas_fill_rect(c, i * 15, i * 9, 80, 60);
+    canvas_draw_image(c, s_tp_image, &src, &dst);
+  }
+
+  canvas_set_text_color(c, color_init(0xff, 0xff, 0xff, 0xff));
+  canvas_set_font(c, NULL, 20);
+  for (i = 0; i < 10; i++) {
+    canvas_draw_utf8(c, "Hello AWTK 1234567890", 10, i * 23);
+  }
+
+  return RET_OK;
+}
+
+static bitmap_t* tile_painter_test_create_image(void) {
+  uint32_t i = 0;
+  bitmap_t* b = bitmap_create_ex(64, 48, 0, BITMAP_FMT_RGBA8888);
+  uint8_t* data = bitmap_lock_buffer_for_write(b);
+
+  for (i = 0; i < b->line_length * b->h; i++) {
+    data[i] = (uint8_t)(i * 7);
+  }
+  bitmap_unlock_buffer(b);
+
+  return b;
+}
+
+TEST(TilePainter, basic) {
+  tile_painter_t* painter = tile_painter_create(4);
+
+  ASSERT_EQ(tile_painter_create(1) == NULL, true);
+  ASSERT_EQ(painter->threads, 4u);
+  ASSERT_EQ(tile_painter_set_min_pixels(painter, 100), RET_OK);
+  ASSERT_EQ(painter->min_pixels, 100u);
+
+  /*不在并行绘制时，加锁什么也不做*/
+  ASSERT_EQ(tile_painter_is_painting(), FALSE);
+  ASSERT_EQ(tile_painter_lock(), RET_OK);
+  ASSERT_EQ(tile_painter_unlock(), RET_OK);
+
+  ASSERT_EQ(tile_painter_destroy(painter), RET_OK);
+}
+
+TEST(TilePainter, paint) {
+  canvas_t c1;
+  canvas_t c2;
+  rect_t r = rect_init(0, 0, TP_W, TP_H);
+  lcd_t* lcd1 = lcd_mem_bgra8888_create(TP_W, TP_H, TRUE);
+  lcd_t* lcd2 = lcd_mem_bgra8888_create(TP_W, TP_H, TRUE);
+  widget_t* view = view_create(NULL, 0, 0, TP_W, TP_H);
+  tile_painter_t* painter = tile_painter_create(4);
+
+  s_tp_image = tile_painter_test_create_image();
+  canvas_init(&c1, lcd1, font_manager());
+  canvas_init(&c2, lcd2, font_manager());
+
+  canvas_begin_frame(&c1, NULL, LCD_DRAW_OFFLINE);
+  widget_paint_with_clip(view, &r, &c1, tile_painter_test_on_paint);
+  canvas_end_frame(&c1);
+
+  canvas_begin_frame(&c2, NULL, LCD_DRAW_OFFLINE);
+#ifdef WITH_GPU
+  ASSERT_EQ(tile_painter_paint(painter, view, &c2, &r, tile_painter_test_on_paint), RET_NOT_IMPL);
+#else
+  /*区域太小时不并行绘制*/
+  tile_painter_set_min_pixels(painter, TP_W * TP_H + 1);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c2, &r, tile_painter_test_on_paint), RET_NOT_IMPL);
+
+  tile_painter_set_min_pixels(painter, 0);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c2, &r, tile_painter_test_on_paint), RET_OK);
+  ASSERT_EQ(tile_painter_is_painting(), FALSE);
+  ASSERT_EQ(memcmp(((lcd_mem_t*)lcd1)->offline_fb, ((lcd_mem_t*)lcd2)->offline_fb,
+                   TP_W * TP_H * 4),
+            0);
+
+  /*第二帧复用条带的canvas*/
+  memset(((lcd_mem_t*)lcd2)->offline_fb, 0x00, TP_W * TP_H * 4);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c2, &r, tile_painter_test_on_paint), RET_OK);
+  ASSERT_EQ(memcmp(((lcd_mem_t*)lcd1)->offline_fb, ((lcd_mem_t*)lcd2)->offline_fb,
+                   TP_W * TP_H * 4),
+            0);
+#endif /*WITH_GPU*/
+  canvas_end_frame(&c2);
+
+  tile_painter_destroy(painter);
+  widget_destroy(view);
+  bitmap_destroy(s_tp_image);
+  canvas_reset(&c1);
+  canvas_reset(&c2);
+  lcd_destroy(lcd1);
+  lcd_destroy(lcd2);
+}
+
+static ret_t tile_painter_test_on_before_paint(void* ctx, event_t* e) {
+  return RET_OK;
+}
+
+TEST(TilePainter, fallback) {
+  canvas_t c;
+  widget_t* w = NULL;
+  rect_t r = rect_init(0, 0, TP_W, TP_H);
+  lcd_t* lcd = lcd_mem_bgra8888_create(TP_W, TP_H, TRUE);
+  widget_t* view = view_create(NULL, 0, 0, TP_W, TP_H);
+  tile_painter_t* painter = tile_painter_create(4);
+
+  canvas_init(&c, lcd, font_manager());
+  tile_painter_set_min_pixels(painter, 0);
+  label_create(view, 0, 0, TP_W, 30);
+  button_create(view, 0, 40, TP_W, 30);
+  image_create(view, 0, 80, TP_W, 30);
+
+  canvas_begin_frame(&c, NULL, LCD_DRAW_OFFLINE);
+#ifndef WITH_GPU
+  /*只有已审核的控件时并行绘制，绘制后清除dirty标志*/
+  widget_invalidate_force(widget_get_child(view, 0), NULL);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_OK);
+  ASSERT_EQ(widget_get_child(view, 0)->dirty, FALSE);
+#endif /*WITH_GPU*/
+
+  /*svg_image在绘制时使用离线画布*/
+  w = svg_image_create(view, 0, 120, 100, 100);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_NOT_IMPL);
+  widget_set_visible(w, FALSE);
+#ifndef WITH_GPU
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_OK);
+#endif /*WITH_GPU*/
+  widget_destroy(w);
+
+  /*rich_text在绘制时创建排版节点*/
+  w = rich_text_create(view, 0, 120, 100, 100);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_NOT_IMPL);
+  widget_destroy(w);
+
+  /*异步加载的图片在绘制时提交解码任务*/
+  w = image_create(view, 0, 120, 100, 100);
+  widget_set_prop_bool(w, WIDGET_PROP_ASYNC_LOAD, TRUE);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_NOT_IMPL);
+  widget_set_prop_bool(w, WIDGET_PROP_ASYNC_LOAD, FALSE);
+#ifndef WITH_GPU
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_OK);
+#endif /*WITH_GPU*/
+
+  /*有绘制事件的处理函数(包括懒加载的子控件)*/
+  widget_on(w, EVT_BEFORE_PAINT, tile_painter_test_on_before_paint, NULL);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_NOT_IMPL);
+  widget_off_by_func(w, EVT_BEFORE_PAINT, tile_painter_test_on_before_paint, NULL);
+  widget_on(view, EVT_PAINT, tile_painter_test_on_before_paint, NULL);
+  ASSERT_EQ(tile_painter_paint(painter, view, &c, &r, widget_paint), RET_NOT_IMPL);
+  canvas_end_frame(&c);
+
+  tile_painter_destroy(painter);
+  widget_destroy(view);
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+}
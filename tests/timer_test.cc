@@ -277,6 +277,121 @@ TEST(Timer, id) {
   timer_manager_destroy(tm);
 }
 
+static uint64_t s_last_fired = 0;
+static bool_t s_fired_in_order = TRUE;
+
+static ret_t timer_check_order(const timer_info_t* timer) {
+  uint64_t deadline = timer->start + timer->duration;
+
+  if (deadline < s_last_fired) {
+    s_fired_in_order = FALSE;
+  }
+  s_last_fired = deadline;
+  s_run_num++;
+
+  return RET_OK;
+}
+
+TEST(Timer, heap) {
+  uint32_t i = 0;
+  uint32_t n = 0;
+  uint32_t ids[1000];
+  timer_set_time(0);
+  timer_manager_t* tm = timer_manager_create(timer_get_time);
+
+  for (i = 0; i < ARRAY_SIZE(ids); i++) {
+    ids[i] = timer_manager_add(tm, timer_check_order, NULL, (i * 7919) % 997 + 1);
+  }
+  ASSERT_EQ(timer_manager_next_time(tm), 1u);
+
+  for (i = 0; i < ARRAY_SIZE(ids); i += 3) {
+    ASSERT_EQ(timer_manager_remove(tm, ids[i]), RET_OK);
+    ASSERT_EQ(timer_manager_find(tm, ids[i]) == NULL, true);
+    n++;
+  }
+  ASSERT_EQ(timer_manager_count(tm), ARRAY_SIZE(ids) - n);
+
+  for (i = 1; i < ARRAY_SIZE(ids); i++) {
+    if (i % 3 != 0) {
+      ASSERT_EQ(timer_manager_find(tm, ids[i])->id, ids[i]);
+    }
+  }
+
+  s_run_num = 0;
+  s_last_fired = 0;
+  s_fired_in_order = TRUE;
+  for (i = 0; i <= 1000; i += 10) {
+    timer_set_time(i);
+    ASSERT_EQ(timer_manager_dispatch(tm), RET_OK);
+    ASSERT_EQ(timer_manager_next_time(tm) > i, true);
+  }
+  ASSERT_EQ(s_fired_in_order, TRUE);
+  ASSERT_EQ(s_run_num, ARRAY_SIZE(ids) - n);
+  ASSERT_EQ(timer_manager_count(tm), 0u);
+
+  timer_manager_destroy(tm);
+}
+
+TEST(Timer, next_time) {
+  uint32_t id = 0;
+  timer_manager_t* s_timer_manager = timer_manager();
+  timer_set_time(0);
+  timer_manager_t* tm = timer_manager_create(timer_get_time);
+
+  timer_manager_set(tm);
+  ASSERT_EQ(timer_manager_next_time(tm), 0xffffu);
+
+  id = timer_manager_add(tm, timer_repeat, NULL, 500);
+  timer_manager_add(tm, timer_repeat, NULL, 800);
+  ASSERT_EQ(timer_manager_next_time(tm), 500u);
+
+  ASSERT_EQ(timer_modify(id, 100), RET_OK);
+  ASSERT_EQ(timer_manager_next_time(tm), 100u);
+
+  /*挂起的定时器不影响下次唤醒的时间*/
+  ASSERT_EQ(timer_suspend(id), RET_OK);
+  ASSERT_EQ(timer_manager_next_time(tm), 800u);
+  ASSERT_EQ(timer_resume(id), RET_OK);
+  ASSERT_EQ(timer_manager_next_time(tm), 100u);
+
+  /*duration为0的定时器每次分发只执行一次*/
+  timer_clear_log();
+  timer_set_time(50);
+  timer_manager_add(tm, timer_repeat, NULL, 0);
+  ASSERT_EQ(timer_manager_next_time(tm), 50u);
+  ASSERT_EQ(timer_manager_dispatch(tm), RET_OK);
+  ASSERT_EQ(s_log, "r:");
+  ASSERT_EQ(timer_manager_next_time(tm), 51u);
+
+  timer_manager_set(s_timer_manager);
+  timer_manager_destroy(tm);
+}
+
+static ret_t timer_remove_all_in_timer(const timer_info_t* timer) {
+  s_log += "ra:";
+  timer_manager_all_remove_by_ctx(timer->timer_manager, timer->ctx);
+
+  return RET_REPEAT;
+}
+
+TEST(Timer, removeAllInTimer) {
+  timer_set_time(0);
+  timer_manager_t* tm = timer_manager_create(timer_get_time);
+
+  timer_manager_add(tm, timer_remove_all_in_timer, tm, 100);
+  timer_manager_add(tm, timer_repeat, tm, 100);
+  timer_manager_add(tm, timer_repeat, tm, 200);
+  timer_manager_add(tm, timer_repeat, NULL, 100);
+
+  timer_clear_log();
+  timer_set_time(100);
+  ASSERT_EQ(timer_manager_dispatch(tm), RET_OK);
+  ASSERT_EQ(timer_manager_count(tm), 1u);
+  ASSERT_EQ(s_log, "ra:r:");
+
+  timer_manager_destroy(tm);
+}
+
 static ret_t timer_repeat_times(const timer_info_t* info) {
   int32_t* repeat_times = (int32_t*)(info->ctx);
   if (*repeat_times > 0) {
@@ -0,0 +1,134 @@
+#include "awtk.h"
+#include "tkc/str.h"
+#include "tkc/time_now.h"
+#include "lcd/lcd_mem_bgra8888.h"
+#include "ui_loader/ui_loader_xml.h"
+#include "ui_loader/ui_binary_writer.h"
+#include "ui_loader/ui_builder_default.h"
+#include "ui_loader/ui_loader_default.h"
+
+#define BENCH_W 800
+#define BENCH_H 480
+#define BENCH_NR 10
+#define BENCH_PAGES_NR 40
+#define BENCH_ITEMS_NR 100
+
+/*生成一个多页面的界面：每页有若干按钮和标签，共约 4000 个控件*/
+static void bench_gen_xml(str_t* str, bool_t lazy) {
+  uint32_t i = 0;
+  uint32_t j = 0;
+  char buff[256];
+
+  str_append(str, "<window name=\"bench\">");
+  str_append(str, lazy ? "<pages x=\"0\" y=\"0\" w=\"100%\" h=\"100%\" lazy_children=\"true\">"
+                       : "<pages x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">");
+  for (i = 0; i < BENCH_PAGES_NR; i++) {
+    str_append(str, "<view x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">");
+    for (j = 0; j < BENCH_ITEMS_NR; j++) {
+      const char* type = (j % 2) ? "label" : "button";
+      tk_snprintf(buff, sizeof(buff),
+                  "<%s name=\"w%u_%u\" x=\"%u\" y=\"%u\" w=\"76\" h=\"44\" text=\"item %u\"/>",
+                  type, i, j, (j % 10) * 80, (j / 10) * 48, j);
+      str_append(str, buff);
+    }
+    str_append(str, "</view>");
+  }
+  str_append(str, "</pages></window>");
+}
+
+static ret_t bench_compile(bool_t lazy, wbuffer_t* wbuffer) {
+  str_t str;
+  ret_t ret = RET_OK;
+  ui_binary_writer_t writer;
+  ui_builder_t* builder = ui_binary_writer_init_ex(&writer, wbuffer, 2);
+
+  str_init(&str, 1024 * 1024);
+  bench_gen_xml(&str, lazy);
+  ret = ui_loader_load(xml_ui_loader(), (const uint8_t*)str.str, str.size, builder);
+  str_reset(&str);
+
+  return ret;
+}
+
+static widget_t* bench_build(wbuffer_t* wbuffer) {
+  widget_t* root = NULL;
+  ui_builder_t* builder = ui_builder_default_create("bench");
+
+  ui_loader_load(default_ui_loader(), wbuffer->data, wbuffer->cursor, builder);
+  root = builder->root;
+  ui_builder_destroy(builder);
+  widget_move_resize(root, 0, 0, BENCH_W, BENCH_H);
+  widget_layout(root);
+
+  return root;
+}
+
+static void bench_paint(canvas_t* c, widget_t* widget) {
+  canvas_begin_frame(c, NULL, LCD_DRAW_OFFLINE);
+  widget_paint(widget, c);
+  canvas_end_frame(c);
+}
+
+/*build: 构建耗时；paint: 首帧耗时；full: 把延迟的子控件全部构建完的额外耗时(微秒)*/
+static void bench_run(canvas_t* c, wbuffer_t* wbuffer, uint64_t* build, uint64_t* paint,
+                      uint64_t* full) {
+  uint64_t start = time_now_us();
+  widget_t* root = bench_build(wbuffer);
+
+  *build = time_now_us() - start;
+  bench_paint(c, root);
+  *paint = time_now_us() - start;
+
+  start = time_now_us();
+  ui_builder_default_load_lazy_children(root, TRUE);
+  *full = time_now_us() - start;
+
+  widget_destroy(root);
+  idle_dispatch();
+}
+
+/*交替运行两种方式，取最小值，减少其它因素的干扰*/
+int main(int argc, char* argv[]) {
+  canvas_t c;
+  uint32_t i = 0;
+  lcd_t* lcd = NULL;
+  wbuffer_t wbuffer1;
+  wbuffer_t wbuffer2;
+  uint64_t min[2][3];
+
+  tk_init(BENCH_W, BENCH_H, APP_CONSOLE, NULL, "./");
+  tk_init_assets();
+
+  lcd = lcd_mem_bgra8888_create(BENCH_W, BENCH_H, TRUE);
+  canvas_init(&c, lcd, font_manager());
+
+  wbuffer_init_extendable(&wbuffer1);
+  wbuffer_init_extendable(&wbuffer2);
+  bench_compile(FALSE, &wbuffer1);
+  bench_compile(TRUE, &wbuffer2);
+
+  memset(min, 0xff, sizeof(min));
+  for (i = 0; i < BENCH_NR; i++) {
+    uint32_t k = 0;
+    uint64_t t[2][3];
+
+    bench_run(&c, &wbuffer1, t[0], t[0] + 1, t[0] + 2);
+    bench_run(&c, &wbuffer2, t[1], t[1] + 1, t[1] + 2);
+    for (k = 0; k < 3; k++) {
+      min[0][k] = tk_min(min[0][k], t[0][k]);
+      min[1][k] = tk_min(min[1][k], t[1][k]);
+    }
+  }
+
+  log_info("eager: build=%.2fms first_paint=%.2fms\n", min[0][0] / 1000.0, min[0][1] / 1000.0);
+  log_info("lazy:  build=%.2fms first_paint=%.2fms rest=%.2fms x%.2f\n", min[1][0] / 1000.0,
+           min[1][1] / 1000.0, min[1][2] / 1000.0, (double)min[0][1] / min[1][1]);
+
+  wbuffer_deinit(&wbuffer1);
+  wbuffer_deinit(&wbuffer2);
+  canvas_reset(&c);
+  lcd_destroy(lcd);
+  tk_exit();
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+﻿#include "awtk.h"
+#include "tkc/fs.h"
+#include "tkc/path.h"
+#include "tkc/time_now.h"
+#include "ui_loader/ui_loader_xml.h"
+#include "ui_loader/ui_binary_writer.h"
+#include "ui_loader/ui_builder_default.h"
+#include "ui_loader/ui_loader_default.h"
+
+#define BENCH_NR 20
+#define BENCH_FILES_NR 50
+#define BENCH_UI_DIR "design/default/ui"
+
+typedef struct _ui_file_t {
+  char name[MAX_PATH + 1];
+  int32_t size;
+} ui_file_t;
+
+static ui_file_t s_files[512];
+static uint32_t s_files_nr = 0;
+
+static int ui_file_cmp(const void* a, const void* b) {
+  return ((const ui_file_t*)b)->size - ((const ui_file_t*)a)->size;
+}
+
+static ret_t ui_files_load(const char* dir_name) {
+  fs_item_t item;
+  fs_dir_t* dir = fs_open_dir(os_fs(), dir_name);
+  return_value_if_fail(dir != NULL, RET_FAIL);
+
+  while (fs_dir_read(dir, &item) == RET_OK && s_files_nr < ARRAY_SIZE(s_files)) {
+    if (item.is_reg_file && tk_str_end_with(item.name, ".xml")) {
+      ui_file_t* iter = s_files + s_files_nr++;
+      path_build(iter->name, MAX_PATH, dir_name, item.name, NULL);
+      iter->size = file_get_size(iter->name);
+    }
+  }
+  fs_dir_close(dir);
+
+  qsort(s_files, s_files_nr, sizeof(ui_file_t), ui_file_cmp);
+
+  return RET_OK;
+}
+
+static ret_t ui_compile(const char* xml, uint32_t size, uint32_t version, wbuffer_t* wbuffer) {
+  ui_binary_writer_t writer;
+  ui_builder_t* builder = ui_binary_writer_init_ex(&writer, wbuffer, version);
+
+  return ui_loader_load(xml_ui_loader(), (const uint8_t*)xml, size, builder);
+}
+
+static uint64_t bench_open(const char* name, wbuffer_t* wbuffer) {
+  uint64_t start = time_now_us();
+  ui_builder_t* builder = ui_builder_default_create(name);
+
+  ui_loader_load(default_ui_loader(), wbuffer->data, wbuffer->cursor, builder);
+  start = time_now_us() - start;
+
+  if (builder->root != NULL) {
+    widget_destroy(builder->root);
+  }
+  ui_builder_destroy(builder);
+
+  return start;
+}
+
+/*交替加载两种格式，取最小值，减少其它因素的干扰*/
+static void bench(const char* name, wbuffer_t* wbuffer1, wbuffer_t* wbuffer2, double* t1,
+                  double* t2) {
+  uint32_t i = 0;
+  uint64_t min1 = 0xffffffff;
+  uint64_t min2 = 0xffffffff;
+
+  for (i = 0; i < BENCH_NR; i++) {
+    min1 = tk_min(min1, bench_open(name, wbuffer1));
+    min2 = tk_min(min2, bench_open(name, wbuffer2));
+  }
+
+  *t1 = min1;
+  *t2 = min2;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t i = 0;
+  double total1 = 0;
+  double total2 = 0;
+
+  tk_init(800, 480, APP_CONSOLE, NULL, "./");
+
+  ui_files_load(argc > 1 ? argv[1] : BENCH_UI_DIR);
+  for (i = 0; i < s_files_nr && i < BENCH_FILES_NR; i++) {
+    uint32_t size = 0;
+    wbuffer_t wbuffer1;
+    wbuffer_t wbuffer2;
+    const char* name = s_files[i].name;
+    char* xml = (char*)file_read(name, &size);
+
+    wbuffer_init_extendable(&wbuffer1);
+    wbuffer_init_extendable(&wbuffer2);
+    if (xml != NULL && ui_compile(xml, size, 1, &wbuffer1) == RET_OK &&
+        ui_compile(xml, size, 2, &wbuffer2) == RET_OK) {
+      double t1 = 0;
+      double t2 = 0;
+
+      bench(name, &wbuffer1, &wbuffer2, &t1, &t2);
+      total1 += t1;
+      total2 += t2;
+      log_info("%-48s v1=%6uB %8.1fus v2=%6uB %8.1fus\n", name, wbuffer1.cursor, t1,
+               wbuffer2.cursor, t2);
+    }
+    wbuffer_deinit(&wbuffer1);
+    wbuffer_deinit(&wbuffer2);
+    TKMEM_FREE(xml);
+  }
+
+  log_info("total v1=%.1fus v2=%.1fus x%.2f\n", total1, total2, total1 / total2);
+  tk_exit();
+
+  return 0;
+}
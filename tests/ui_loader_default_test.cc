@@ -1,4 +1,5 @@
 ﻿#include "base/dialog.h"
+#include "tkc/color_parser.h"
 #include "ui_loader/ui_builder_default.h"
 #include "ui_loader/ui_binary_writer.h"
 #include "ui_loader/ui_loader_default.h"
@@ -140,3 +141,69 @@ TEST(UILoader, ext) {
   widget_destroy(builder->root);
   ui_builder_destroy(builder);
 }
+
+TEST(UILoader, v2) {
+  uint8_t data[1024];
+  uint8_t data1[1024];
+  wbuffer_t wbuffer;
+  wbuffer_t wbuffer1;
+  color_t trans = color_init(0, 0, 0, 0);
+  widget_t* ok = NULL;
+  widget_desc_t desc;
+  ui_binary_writer_t ui_binary_writer;
+  ui_binary_writer_t ui_binary_writer1;
+  ui_loader_t* loader = default_ui_loader();
+  ui_builder_t* builder = ui_builder_default_create("");
+  ui_builder_t* writer = ui_binary_writer_init_ex(
+      &ui_binary_writer, wbuffer_init(&wbuffer, data, sizeof(data)), 2);
+  ui_builder_t* writer1 =
+      ui_binary_writer_init(&ui_binary_writer1, wbuffer_init(&wbuffer1, data1, sizeof(data1)));
+  ui_builder_t* writers[] = {writer, writer1};
+  uint32_t i = 0;
+
+  memset(&desc, 0x00, sizeof(desc));
+  for (i = 0; i < ARRAY_SIZE(writers); i++) {
+    INIT_DESC("group_box", 0, 0, 100, 200);
+    ASSERT_EQ(ui_builder_on_widget_start(writers[i], &desc), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop_end(writers[i]), RET_OK);
+
+    INIT_DESC("button", 10, 20, 30, 40);
+    ASSERT_EQ(ui_builder_on_widget_start(writers[i], &desc), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "text", "123"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "name", "ok"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "visible", "false"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "opacity", "128"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "custom", "456"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "style:normal:text_color", "red"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "style:normal:text_align_h", "left"),
+              RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop(writers[i], "style.normal:bg_image", "bg"), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_prop_end(writers[i]), RET_OK);
+    ASSERT_EQ(ui_builder_on_widget_end(writers[i]), RET_OK);
+
+    ASSERT_EQ(ui_builder_on_widget_end(writers[i]), RET_OK);
+  }
+  ASSERT_EQ(*(uint32_t*)(wbuffer.data), (uint32_t)UI_DATA_MAGIC_V2);
+  ASSERT_LT(wbuffer.cursor, wbuffer1.cursor);
+
+  ASSERT_EQ(ui_loader_load(loader, wbuffer.data, wbuffer.cursor, builder), RET_OK);
+  ASSERT_EQ(tk_str_eq(widget_get_type(builder->root), WIDGET_TYPE_GROUP_BOX), TRUE);
+  ASSERT_EQ(widget_count_children(builder->root), 1);
+
+  ok = widget_lookup(builder->root, "ok", TRUE);
+  ASSERT_EQ(ok != NULL, true);
+  ASSERT_EQ(ok->x, 10);
+  ASSERT_EQ(ok->h, 40);
+  ASSERT_EQ(ok->visible, FALSE);
+  ASSERT_EQ(ok->opacity, 128);
+  ASSERT_EQ(wcscmp(ok->text.str, L"123"), 0);
+  ASSERT_STREQ(widget_get_prop_str(ok, "custom", NULL), "456");
+
+  ASSERT_EQ(style_get_color(ok->astyle, STYLE_ID_TEXT_COLOR, trans).color,
+            color_parse("red").color);
+  ASSERT_EQ(style_get_int(ok->astyle, STYLE_ID_TEXT_ALIGN_H, -1), ALIGN_H_LEFT);
+  ASSERT_STREQ(style_get_str(ok->astyle, STYLE_ID_BG_IMAGE, NULL), "bg");
+
+  widget_destroy(builder->root);
+  ui_builder_destroy(builder);
+}
@@ -478,3 +478,119 @@ TEST(UILoaderXML, self_layout_with_pixel_xywh) {
   widget_destroy(builder->root);
   ui_builder_destroy(builder);
 }
+
+TEST(UILoaderXML, lazy_children) {
+  paint_event_t e;
+  widget_t* p1 = NULL;
+  widget_t* p2 = NULL;
+  ui_loader_t* loader = xml_ui_loader();
+  ui_builder_t* builder = ui_builder_default_create("");
+  const char* str =
+      "<window x=\"0\" y=\"0\" w=\"400\" h=\"300\">\
+      <pages name=\"pages\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\" lazy_children=\"true\">\
+      <view name=\"p1\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">\
+      <button name=\"b1\" x=\"0\" y=\"0\" w=\"80\" h=\"30\" text=\"ok\"/>\
+      <view name=\"v1\" x=\"0\" y=\"30\" w=\"100%\" h=\"-30\">\
+      <label name=\"l1\" x=\"0\" y=\"0\" w=\"50%\" h=\"30\" visible=\"false\"/>\
+      </view>\
+      </view>\
+      <view name=\"p2\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">\
+      <label name=\"l2\" x=\"0\" y=\"0\" w=\"80\" h=\"30\" text=\"hello\"/>\
+      </view>\
+      <view name=\"p3\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\"/>\
+      </pages>\
+      <label name=\"outside\" x=\"0\" y=\"0\" w=\"80\" h=\"30\"/>\
+      </window>";
+
+  ASSERT_EQ(ui_loader_load(loader, (const uint8_t*)str, strlen(str), builder), RET_OK);
+
+  p1 = widget_lookup(builder->root, "p1", TRUE);
+  p2 = widget_lookup(builder->root, "p2", TRUE);
+  ASSERT_TRUE(p1 != NULL && p2 != NULL);
+  ASSERT_TRUE(widget_lookup(builder->root, "p3", TRUE) != NULL);
+  ASSERT_TRUE(widget_lookup(builder->root, "outside", TRUE) != NULL);
+  ASSERT_EQ(widget_count_children(p1), 0);
+  ASSERT_EQ(widget_count_children(p2), 0);
+  ASSERT_TRUE(widget_lookup(builder->root, "b1", TRUE) == NULL);
+
+  widget_dispatch(p1, paint_event_init(&e, EVT_BEFORE_PAINT, p1, NULL));
+  ASSERT_EQ(widget_count_children(p1), 2);
+  ASSERT_TRUE(widget_lookup(p1, "b1", TRUE) != NULL);
+  ASSERT_EQ(widget_lookup(p1, "l1", TRUE)->parent, widget_lookup(p1, "v1", TRUE));
+  ASSERT_EQ(widget_lookup(p1, "l1", TRUE)->visible, FALSE);
+  ASSERT_EQ(widget_lookup(p1, "l1", TRUE)->w, p1->w / 2);
+  ASSERT_EQ(widget_count_children(p2), 0);
+
+  widget_dispatch(p1, paint_event_init(&e, EVT_BEFORE_PAINT, p1, NULL));
+  ASSERT_EQ(widget_count_children(p1), 2);
+
+  ASSERT_EQ(ui_builder_default_load_lazy_children(builder->root, TRUE), RET_OK);
+  ASSERT_EQ(widget_count_children(p2), 1);
+  ASSERT_EQ(wcscmp(widget_lookup(p2, "l2", TRUE)->text.str, L"hello"), 0);
+
+  widget_destroy(builder->root);
+  ui_builder_destroy(builder);
+}
+
+TEST(UILoaderXML, lazy_children_idle) {
+  paint_event_t e;
+  uint32_t i = 0;
+  widget_t* p2 = NULL;
+  ui_loader_t* loader = xml_ui_loader();
+  ui_builder_t* builder = ui_builder_default_create("");
+  const char* str =
+      "<window x=\"0\" y=\"0\" w=\"400\" h=\"300\">\
+      <slide_view name=\"slide\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\" lazy_children=\"idle\">\
+      <view name=\"p1\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">\
+      <button name=\"b1\" x=\"0\" y=\"0\" w=\"80\" h=\"30\" text=\"ok\"/>\
+      </view>\
+      <view name=\"p2\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">\
+      <pages name=\"inner\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\" lazy_children=\"idle\">\
+      <view name=\"q1\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">\
+      <label name=\"l2\" x=\"0\" y=\"0\" w=\"80\" h=\"30\" text=\"hello\"/>\
+      </view>\
+      </pages>\
+      </view>\
+      </slide_view>\
+      </window>";
+
+  ASSERT_EQ(ui_loader_load(loader, (const uint8_t*)str, strlen(str), builder), RET_OK);
+  p2 = widget_lookup(builder->root, "p2", TRUE);
+  ASSERT_TRUE(p2 != NULL);
+  ASSERT_EQ(widget_count_children(p2), 0);
+
+  /*第一次绘制之后才开始在空闲时创建*/
+  idle_dispatch();
+  ASSERT_EQ(widget_count_children(p2), 0);
+  widget_dispatch(builder->root, paint_event_init(&e, EVT_PAINT_DONE, builder->root, NULL));
+
+  for (i = 0; i < 10 && widget_lookup(builder->root, "l2", TRUE) == NULL; i++) {
+    idle_dispatch();
+  }
+  ASSERT_TRUE(widget_lookup(builder->root, "b1", TRUE) != NULL);
+  ASSERT_TRUE(widget_lookup(builder->root, "l2", TRUE) != NULL);
+  ASSERT_EQ(widget_lookup(builder->root, "inner", TRUE)->parent, p2);
+
+  widget_destroy(builder->root);
+  ui_builder_destroy(builder);
+}
+
+TEST(UILoaderXML, lazy_children_destroy) {
+  ui_loader_t* loader = xml_ui_loader();
+  ui_builder_t* builder = ui_builder_default_create("");
+  const char* str =
+      "<window x=\"0\" y=\"0\" w=\"400\" h=\"300\">\
+      <scroll_view name=\"sv\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\" lazy_children=\"idle\">\
+      <view name=\"p1\" x=\"0\" y=\"0\" w=\"100%\" h=\"100%\">\
+      <button name=\"b1\" x=\"0\" y=\"0\" w=\"80\" h=\"30\" text=\"ok\"/>\
+      </view>\
+      </scroll_view>\
+      </window>";
+
+  ASSERT_EQ(ui_loader_load(loader, (const uint8_t*)str, strlen(str), builder), RET_OK);
+  ASSERT_TRUE(widget_lookup(builder->root, "b1", TRUE) == NULL);
+
+  widget_destroy(builder->root);
+  ui_builder_destroy(builder);
+  idle_dispatch();
+}
@@ -0,0 +1,110 @@
+﻿#include "awtk.h"
+#include "tkc/time_now.h"
+#include "base/window_base.h"
+
+#define BENCH_NR 2000
+#define BENCH_DEPTH 6
+#define BENCH_FANOUT 4
+#define BENCH_ROWS 500
+
+static uint32_t s_widgets_nr = 0;
+
+static void build_tree(widget_t* parent, uint32_t depth) {
+  uint32_t i = 0;
+
+  for (i = 0; i < BENCH_FANOUT; i++) {
+    char name[32];
+    widget_t* iter = view_create(parent, 0, 0, 10, 10);
+
+    tk_snprintf(name, sizeof(name), "w%u", s_widgets_nr++);
+    widget_set_name(iter, name);
+    if (depth > 1) {
+      build_tree(iter, depth - 1);
+    }
+  }
+}
+
+static double bench_run(widget_t* win, const char* name) {
+  uint32_t i = 0;
+  uint64_t start = time_now_us();
+
+  for (i = 0; i < BENCH_NR; i++) {
+    widget_lookup(win, name, TRUE);
+  }
+
+  return (double)(time_now_us() - start) / BENCH_NR;
+}
+
+/*列表的每一行都有一个名为title的label，从行开始查找*/
+static void bench_duplicate(void) {
+  uint32_t i = 0;
+  double linear = 0;
+  double indexed = 0;
+  widget_t* row = NULL;
+  widget_t* win = window_create(NULL, 0, 0, 320, 480);
+
+  for (i = 0; i < BENCH_ROWS; i++) {
+    widget_t* iter = view_create(win, 0, 0, 10, 10);
+    widget_set_name(label_create(iter, 0, 0, 10, 10), "title");
+    widget_set_name(label_create(iter, 0, 0, 10, 10), "value");
+  }
+  row = widget_get_child(win, BENCH_ROWS / 2);
+
+  window_base_set_name_index(win, FALSE);
+  linear = bench_run(row, "title");
+  window_base_set_name_index(win, TRUE);
+  indexed = bench_run(row, "title");
+  log_info("row/title linear=%9.3fus indexed=%9.3fus x%.1f\n", linear, indexed, linear / indexed);
+
+  window_base_set_name_index(win, FALSE);
+  linear = bench_run(win, "title");
+  window_base_set_name_index(win, TRUE);
+  indexed = bench_run(win, "title");
+  log_info("win/title linear=%9.3fus indexed=%9.3fus x%.1f\n", linear, indexed, linear / indexed);
+
+  widget_destroy(win);
+}
+
+static void bench(widget_t* win, const char* name) {
+  double linear = 0;
+  double indexed = 0;
+
+  window_base_set_name_index(win, FALSE);
+  linear = bench_run(win, name);
+  window_base_set_name_index(win, TRUE);
+  indexed = bench_run(win, name);
+
+  log_info("%-8s linear=%9.3fus indexed=%9.3fus x%.1f\n", name, linear, indexed,
+           linear / indexed);
+}
+
+int main(int argc, char* argv[]) {
+  char name[32];
+  uint64_t start = 0;
+  widget_t* win = NULL;
+
+  tk_init(320, 480, APP_CONSOLE, NULL, "./");
+
+  win = window_create(NULL, 0, 0, 320, 480);
+  start = time_now_us();
+  build_tree(win, BENCH_DEPTH);
+  log_info("build %u widgets: %uus\n", s_widgets_nr, (uint32_t)(time_now_us() - start));
+
+  window_base_set_name_index(win, FALSE);
+  start = time_now_us();
+  window_base_set_name_index(win, TRUE);
+  log_info("build name index: %uus\n", (uint32_t)(time_now_us() - start));
+
+  bench(win, "w0");
+  tk_snprintf(name, sizeof(name), "w%u", s_widgets_nr / 2);
+  bench(win, name);
+  tk_snprintf(name, sizeof(name), "w%u", s_widgets_nr - 1);
+  bench(win, name);
+  bench(win, "none");
+
+  widget_destroy(win);
+  bench_duplicate();
+  tk_exit();
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+﻿#include "gtest/gtest.h"
+#include "base/window.h"
+#include "widgets/view.h"
+#include "widgets/label.h"
+#include "base/window_base.h"
+
+static widget_t* lookup_linear(widget_t* win, widget_t* widget, const char* name,
+                               bool_t recursive) {
+  widget_t* ret = NULL;
+
+  window_base_set_name_index(win, FALSE);
+  ret = widget_lookup(widget, name, recursive);
+  window_base_set_name_index(win, TRUE);
+
+  return ret;
+}
+
+static void check_lookup(widget_t* win, widget_t* widget, const char* name) {
+  ASSERT_EQ(widget_lookup(widget, name, TRUE), lookup_linear(win, widget, name, TRUE));
+  ASSERT_EQ(widget_lookup(widget, name, FALSE), lookup_linear(win, widget, name, FALSE));
+}
+
+TEST(WidgetNameIndex, basic) {
+  widget_t* win = window_create(NULL, 0, 0, 400, 300);
+  widget_t* v1 = view_create(win, 0, 0, 100, 100);
+  widget_t* v2 = view_create(win, 0, 0, 100, 100);
+  widget_t* a = label_create(v1, 0, 0, 10, 10);
+  widget_t* b = label_create(v2, 0, 0, 10, 10);
+
+  widget_set_name(v1, "v1");
+  widget_set_name(v2, "v2");
+  widget_set_name(a, "a");
+  widget_set_name(b, "b");
+  ASSERT_EQ(widget_set_prop_bool(win, WIDGET_PROP_NAME_INDEX, TRUE), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(win, WIDGET_PROP_NAME_INDEX, FALSE), TRUE);
+  ASSERT_EQ(WINDOW_BASE(win)->widget_names->size, 4u);
+
+  ASSERT_EQ(widget_lookup(win, "a", TRUE), a);
+  ASSERT_EQ(widget_lookup(win, "a", FALSE), (widget_t*)NULL);
+  ASSERT_EQ(widget_lookup(win, "v2", FALSE), v2);
+  ASSERT_EQ(widget_child(v2, "b"), b);
+  ASSERT_EQ(widget_lookup(v1, "b", TRUE), (widget_t*)NULL);
+  ASSERT_EQ(widget_lookup(win, "none", TRUE), (widget_t*)NULL);
+
+  widget_set_name(a, "aa");
+  ASSERT_EQ(widget_lookup(win, "a", TRUE), (widget_t*)NULL);
+  ASSERT_EQ(widget_lookup(win, "aa", TRUE), a);
+
+  widget_t* c = label_create(NULL, 0, 0, 10, 10);
+  widget_set_name(c, "c");
+  widget_add_child(v2, c);
+  ASSERT_EQ(widget_lookup(win, "c", TRUE), c);
+  ASSERT_EQ(WINDOW_BASE(win)->widget_names->size, 5u);
+
+  widget_remove_child(v2, c);
+  ASSERT_EQ(widget_lookup(win, "c", TRUE), (widget_t*)NULL);
+  widget_destroy(c);
+
+  widget_destroy(v2);
+  ASSERT_EQ(widget_lookup(win, "b", TRUE), (widget_t*)NULL);
+  ASSERT_EQ(widget_lookup(win, "v2", TRUE), (widget_t*)NULL);
+  ASSERT_EQ(WINDOW_BASE(win)->widget_names->size, 2u);
+
+  widget_destroy(win);
+  idle_dispatch();
+}
+
+TEST(WidgetNameIndex, duplicate) {
+  uint32_t i = 0;
+  uint32_t j = 0;
+  widget_t* win = window_create(NULL, 0, 0, 400, 300);
+
+  window_base_set_name_index(win, TRUE);
+  for (i = 0; i < 5; i++) {
+    widget_t* v = view_create(win, 0, 0, 100, 100);
+    widget_set_name(v, i % 2 ? "item" : "view");
+    for (j = 0; j < 3; j++) {
+      widget_t* l = label_create(v, 0, 0, 10, 10);
+      widget_t* ll = label_create(l, 0, 0, 10, 10);
+      widget_set_name(l, j == 1 ? "title" : "item");
+      widget_set_name(ll, "title");
+    }
+  }
+
+  check_lookup(win, win, "item");
+  check_lookup(win, win, "title");
+  check_lookup(win, win, "view");
+  check_lookup(win, widget_get_child(win, 3), "title");
+  check_lookup(win, widget_get_child(win, 3), "item");
+
+  widget_restack(widget_get_child(win, 0), 4);
+  check_lookup(win, win, "item");
+  check_lookup(win, win, "view");
+
+  /*同名控件太多时由调用者遍历*/
+  widget_t* found = NULL;
+  widget_name_index_t* index = WINDOW_BASE(win)->widget_names;
+  ASSERT_EQ(widget_name_index_lookup(index, win, "title", TRUE, &found), RET_FAIL);
+  ASSERT_EQ(widget_name_index_lookup(index, win, "view", TRUE, &found), RET_OK);
+  ASSERT_EQ(found, widget_lookup(win, "view", TRUE));
+  ASSERT_EQ(widget_name_index_lookup(index, win, "none", TRUE, &found), RET_NOT_FOUND);
+  ASSERT_EQ(found, (widget_t*)NULL);
+
+  widget_destroy(win);
+  idle_dispatch();
+}
@@ -0,0 +1,150 @@
+﻿#include "gtest/gtest.h"
+#include "base/window.h"
+#include "widgets/edit.h"
+#include "widgets/label.h"
+#include "widgets/image.h"
+#include "widgets/button.h"
+#include "widgets/slider.h"
+#include "widgets/progress_bar.h"
+#include "base/widget_prop_atom.h"
+
+TEST(WidgetPropAtom, name) {
+  uint32_t i = 0;
+
+  for (i = WIDGET_PROP_ATOM_NONE + 1; i < WIDGET_PROP_ATOM_NR; i++) {
+    const char* name = widget_prop_atom_to_name((widget_prop_atom_t)i);
+    char buff[64];
+
+    ASSERT_TRUE(name != NULL);
+    ASSERT_EQ(widget_prop_atom_from_name(name), (widget_prop_atom_t)i);
+
+    /*非常量字符串也能找到*/
+    tk_strncpy(buff, name, sizeof(buff) - 1);
+    ASSERT_EQ(widget_prop_atom_from_name(buff), (widget_prop_atom_t)i);
+  }
+
+  ASSERT_EQ(widget_prop_atom_from_name(WIDGET_PROP_TEXT), WIDGET_PROP_ATOM_TEXT);
+  ASSERT_EQ(widget_prop_atom_from_name("not_a_prop"), WIDGET_PROP_ATOM_NONE);
+  ASSERT_EQ(widget_prop_atom_from_name(""), WIDGET_PROP_ATOM_NONE);
+  ASSERT_EQ(widget_prop_atom_from_name(NULL), WIDGET_PROP_ATOM_NONE);
+  ASSERT_TRUE(widget_prop_atom_to_name(WIDGET_PROP_ATOM_NONE) == NULL);
+  ASSERT_TRUE(widget_prop_atom_to_name(WIDGET_PROP_ATOM_NR) == NULL);
+}
+
+TEST(WidgetPropAtom, widget) {
+  value_t v;
+  widget_t* win = window_create(NULL, 0, 0, 400, 300);
+  widget_t* label = label_create(win, 10, 20, 30, 40);
+
+  value_set_int(&v, 12);
+  ASSERT_EQ(widget_set_prop_atom(label, WIDGET_PROP_ATOM_X, &v), RET_OK);
+  ASSERT_EQ(label->x, 12);
+  ASSERT_EQ(widget_get_prop_atom(label, WIDGET_PROP_ATOM_Y, &v), RET_OK);
+  ASSERT_EQ(value_int(&v), 20);
+
+  value_set_str(&v, "hello");
+  ASSERT_EQ(widget_set_prop_atom(label, WIDGET_PROP_ATOM_TEXT, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_atom(label, WIDGET_PROP_ATOM_TEXT, &v), RET_OK);
+  ASSERT_EQ(wcscmp(value_wstr(&v), L"hello"), 0);
+
+  value_set_str(&v, "ok");
+  ASSERT_EQ(widget_set_prop_atom(label, WIDGET_PROP_ATOM_NAME, &v), RET_OK);
+  ASSERT_STREQ(label->name, "ok");
+  ASSERT_EQ(widget_get_prop_atom(label, WIDGET_PROP_ATOM_NAME, &v), RET_OK);
+  ASSERT_STREQ(value_str(&v), "ok");
+
+  ASSERT_EQ(widget_set_prop_atom(label, WIDGET_PROP_ATOM_NONE, &v), RET_BAD_PARAMS);
+  ASSERT_EQ(widget_get_prop_atom(label, WIDGET_PROP_ATOM_NR, &v), RET_BAD_PARAMS);
+
+  widget_destroy(win);
+}
+
+TEST(WidgetPropAtom, edit) {
+  value_t v;
+  value_t v1;
+  widget_t* win = window_create(NULL, 0, 0, 400, 300);
+  widget_t* e = edit_create(win, 10, 20, 30, 40);
+
+  value_set_int(&v, 5);
+  ASSERT_EQ(widget_set_prop_atom(e, WIDGET_PROP_ATOM_LEFT_MARGIN, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop(e, WIDGET_PROP_LEFT_MARGIN, &v1), RET_OK);
+  ASSERT_EQ(value_int(&v1), 5);
+
+  value_set_int(&v, 100);
+  ASSERT_EQ(widget_set_prop(e, WIDGET_PROP_MAX, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_atom(e, WIDGET_PROP_ATOM_MAX, &v1), RET_OK);
+  ASSERT_EQ(value_int(&v1), 100);
+
+  value_set_bool(&v, TRUE);
+  ASSERT_EQ(widget_set_prop_atom(e, WIDGET_PROP_ATOM_READONLY, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(e, WIDGET_PROP_READONLY, FALSE), TRUE);
+
+  /*非内置属性仍走字符串*/
+  ASSERT_EQ(widget_set_prop_bool(e, EDIT_PROP_FOCUS_NEXT_WHEN_ENTER, TRUE), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(e, EDIT_PROP_FOCUS_NEXT_WHEN_ENTER, FALSE), TRUE);
+
+  widget_destroy(win);
+}
+
+TEST(WidgetPropAtom, append_only) {
+  uint32_t i = 0;
+  /*原子会写入UI二进制文件，已有的原子和名称不能改变*/
+  static const char* const s_names[] = {NULL, "x", "y", "w", "h", "opacity", "visible", "sensitive",
+      "floating", "cache_as_bitmap", "focusable", "focused", "focus", "with_focus_state",
+      "dirty_rect_tolerance", "dirty_rect", "style", "state", "state_for_style", "enable",
+      "feedback", "auto_adjust_size", "name", "type", "text", "tr_text", "value", "animation",
+      "self_layout", "children_layout", "layout", "layout_w", "layout_h", "pointer_cursor",
+      "state_from_parent_sync", "sync_state_to_children", "loading", "exec", "grab_keys", "min",
+      "max", "step", "input_type", "readonly", "cancelable", "auto_fix", "select_none_when_focused",
+      "open_im_when_focused", "close_im_when_blured", "margin", "left_margin", "right_margin",
+      "top_margin", "bottom_margin", "password_visible", "action_text", "tips", "tr_tips",
+      "keyboard", "caret_x", "caret_y", "line_height", "inputing", "validator", "item_width",
+      "item_height", "default_item_height", "auto_hide_scroll_bar", "row", "repeat",
+      "long_press_time", "enable_long_press", "enable_preview", "is_accept_status", "length",
+      "max_w", "line_wrap", "word_wrap", "ellipses", "vertical", "bar_size", "drag_threshold",
+      "format", "show_text", "reverse", "draw_type", "async_load", "image", "scale_x", "scale_y",
+      "anchor_x", "anchor_y", "rotation", "selectable", "selected", "clickable"};
+
+  ASSERT_EQ(ARRAY_SIZE(s_names), (size_t)WIDGET_PROP_ATOM_NR);
+  for (i = WIDGET_PROP_ATOM_NONE + 1; i < WIDGET_PROP_ATOM_NR; i++) {
+    ASSERT_STREQ(widget_prop_atom_to_name((widget_prop_atom_t)i), s_names[i]);
+  }
+}
+
+TEST(WidgetPropAtom, widgets) {
+  value_t v;
+  widget_t* win = window_create(NULL, 0, 0, 400, 300);
+  widget_t* b = button_create(win, 0, 0, 30, 40);
+  widget_t* l = label_create(win, 0, 0, 30, 40);
+  widget_t* s = slider_create(win, 0, 0, 30, 40);
+  widget_t* p = progress_bar_create(win, 0, 0, 30, 40);
+  widget_t* img = image_create(win, 0, 0, 30, 40);
+
+  value_set_int(&v, 300);
+  ASSERT_EQ(widget_set_prop_atom(b, WIDGET_PROP_ATOM_REPEAT, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_int(b, WIDGET_PROP_REPEAT, 0), 300);
+
+  value_set_bool(&v, TRUE);
+  ASSERT_EQ(widget_set_prop_atom(l, WIDGET_PROP_ATOM_LINE_WRAP, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(l, WIDGET_PROP_LINE_WRAP, FALSE), TRUE);
+
+  value_set_int(&v, 7);
+  ASSERT_EQ(widget_set_prop_atom(s, WIDGET_PROP_ATOM_DRAG_THRESHOLD, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_int(s, WIDGET_PROP_DRAG_THRESHOLD, 0), 7);
+  /*控件私有属性仍走字符串*/
+  ASSERT_EQ(widget_set_prop_int(s, SLIDER_PROP_DRAGGER_SIZE, 9), RET_OK);
+  ASSERT_EQ(widget_get_prop_int(s, SLIDER_PROP_DRAGGER_SIZE, 0), 9);
+
+  value_set_str(&v, "%d%%");
+  ASSERT_EQ(widget_set_prop_atom(p, WIDGET_PROP_ATOM_FORMAT, &v), RET_OK);
+  ASSERT_STREQ(widget_get_prop_str(p, WIDGET_PROP_FORMAT, NULL), "%d%%");
+
+  value_set_str(&v, "earth");
+  ASSERT_EQ(widget_set_prop_atom(img, WIDGET_PROP_ATOM_IMAGE, &v), RET_OK);
+  ASSERT_STREQ(widget_get_prop_str(img, WIDGET_PROP_IMAGE, NULL), "earth");
+  value_set_bool(&v, TRUE);
+  ASSERT_EQ(widget_set_prop_atom(img, WIDGET_PROP_ATOM_ASYNC_LOAD, &v), RET_OK);
+  ASSERT_EQ(widget_get_prop_bool(img, WIDGET_PROP_ASYNC_LOAD, FALSE), TRUE);
+
+  widget_destroy(win);
+}
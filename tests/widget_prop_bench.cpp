@@ -0,0 +1,67 @@
+﻿#include "awtk.h"
+#include "tkc/time_now.h"
+
+#define BENCH_NR 200000
+
+typedef ret_t (*bench_func_t)(widget_t* widget, uint32_t i);
+
+static ret_t bench_get_str(widget_t* widget, uint32_t i) {
+  value_t v;
+  static const char* s_names[] = {WIDGET_PROP_X, WIDGET_PROP_VISIBLE, WIDGET_PROP_MAX,
+                                  WIDGET_PROP_READONLY};
+
+  return widget_get_prop(widget, s_names[i % ARRAY_SIZE(s_names)], &v);
+}
+
+static ret_t bench_get_atom(widget_t* widget, uint32_t i) {
+  value_t v;
+  static const widget_prop_atom_t s_atoms[] = {WIDGET_PROP_ATOM_X, WIDGET_PROP_ATOM_VISIBLE,
+                                               WIDGET_PROP_ATOM_MAX, WIDGET_PROP_ATOM_READONLY};
+
+  return widget_get_prop_atom(widget, s_atoms[i % ARRAY_SIZE(s_atoms)], &v);
+}
+
+static ret_t bench_set_str(widget_t* widget, uint32_t i) {
+  value_t v;
+  value_set_int(&v, i % 100);
+
+  return widget_set_prop(widget, WIDGET_PROP_LEFT_MARGIN, &v);
+}
+
+static ret_t bench_set_atom(widget_t* widget, uint32_t i) {
+  value_t v;
+  value_set_int(&v, i % 100);
+
+  return widget_set_prop_atom(widget, WIDGET_PROP_ATOM_LEFT_MARGIN, &v);
+}
+
+static double bench_run(widget_t* widget, bench_func_t func) {
+  uint32_t i = 0;
+  uint64_t start = time_now_us();
+
+  for (i = 0; i < BENCH_NR; i++) {
+    func(widget, i);
+  }
+
+  return (double)(time_now_us() - start) * 1000 / BENCH_NR;
+}
+
+int main(int argc, char* argv[]) {
+  widget_t* win = NULL;
+  widget_t* edit = NULL;
+
+  tk_init(320, 480, APP_CONSOLE, NULL, "./");
+
+  win = window_create(NULL, 0, 0, 320, 480);
+  edit = edit_create(win, 0, 0, 100, 30);
+
+  log_info("get string=%7.1fns atom=%7.1fns\n", bench_run(edit, bench_get_str),
+           bench_run(edit, bench_get_atom));
+  log_info("set string=%7.1fns atom=%7.1fns\n", bench_run(edit, bench_set_str),
+           bench_run(edit, bench_set_atom));
+
+  widget_destroy(win);
+  tk_exit();
+
+  return 0;
+}
@@ -156,12 +156,71 @@ TEST(Widget, basic2) {
   ASSERT_EQ(strcmp(widget_get_prop_str(w, WIDGET_PROP_NAME, ""), "name"), 0);
 
   ASSERT_EQ(widget_set_prop_str(w, WIDGET_PROP_POINTER_CURSOR, "cursor"), RET_OK);
-  ASSERT_EQ(strcmp(w->pointer_cursor, "cursor"), 0);
+  ASSERT_EQ(strcmp(w->extra->pointer_cursor, "cursor"), 0);
   ASSERT_EQ(strcmp(widget_get_prop_str(w, WIDGET_PROP_POINTER_CURSOR, ""), "cursor"), 0);
 
   widget_destroy(w);
 }
 
+TEST(Widget, extra) {
+  widget_t* w = button_create(NULL, 0, 0, 0, 0);
+
+  ASSERT_EQ(w->extra == NULL, true);
+  ASSERT_EQ(widget_get_prop_str(w, WIDGET_PROP_ANIMATION, NULL) == NULL, true);
+  ASSERT_EQ(widget_get_prop_int(w, "custom", 0), 0);
+  ASSERT_EQ(w->extra == NULL, true);
+
+  ASSERT_EQ(widget_set_prop_int(w, "custom", 123), RET_OK);
+  ASSERT_EQ(w->extra != NULL, true);
+  ASSERT_EQ(w->extra->custom_props != NULL, true);
+  ASSERT_EQ(widget_get_prop_int(w, "custom", 0), 123);
+
+  ASSERT_EQ(widget_set_animation(w, "opacity(to=0)"), RET_OK);
+  ASSERT_STREQ(w->extra->animation, "opacity(to=0)");
+  ASSERT_STREQ(widget_get_prop_str(w, WIDGET_PROP_ANIMATION, NULL), "opacity(to=0)");
+
+  widget_destroy(w);
+}
+
+TEST(Widget, bit_flags) {
+  widget_t* w = button_create(NULL, 0, 0, 0, 0);
+  widget_t* clone = NULL;
+
+  /*标志是1位的位域，非0的值(如flags & 0x2)也要当作TRUE*/
+  ASSERT_EQ(widget_set_enable(w, FALSE), RET_OK);
+  ASSERT_EQ(widget_set_enable(w, 2), RET_OK);
+  ASSERT_EQ(w->enable, TRUE);
+  ASSERT_EQ(widget_set_visible(w, FALSE), RET_OK);
+  ASSERT_EQ(widget_set_visible(w, 2), RET_OK);
+  ASSERT_EQ(w->visible, TRUE);
+  ASSERT_EQ(widget_set_visible_only(w, 2), RET_OK);
+  ASSERT_EQ(w->visible, TRUE);
+  ASSERT_EQ(widget_set_sensitive(w, 2), RET_OK);
+  ASSERT_EQ(w->sensitive, TRUE);
+  ASSERT_EQ(widget_set_feedback(w, 2), RET_OK);
+  ASSERT_EQ(w->feedback, TRUE);
+  ASSERT_EQ(widget_set_floating(w, 2), RET_OK);
+  ASSERT_EQ(w->floating, TRUE);
+  ASSERT_EQ(widget_set_focusable(w, 2), RET_OK);
+  ASSERT_EQ(w->focusable, TRUE);
+  ASSERT_EQ(widget_set_auto_adjust_size(w, 2), RET_OK);
+  ASSERT_EQ(w->auto_adjust_size, TRUE);
+  ASSERT_EQ(widget_set_sync_state_to_children(w, 2), RET_OK);
+  ASSERT_EQ(w->sync_state_to_children, TRUE);
+  ASSERT_EQ(widget_set_state_from_parent_sync(w, 2), RET_OK);
+  ASSERT_EQ(w->state_from_parent_sync, TRUE);
+
+  clone = widget_clone(w, NULL);
+  ASSERT_EQ(clone->enable, TRUE);
+  ASSERT_EQ(clone->visible, TRUE);
+  ASSERT_EQ(clone->floating, TRUE);
+  ASSERT_EQ(clone->focusable, TRUE);
+  ASSERT_EQ(clone->state_from_parent_sync, TRUE);
+
+  widget_destroy(clone);
+  widget_destroy(w);
+}
+
 TEST(Widget, props) {
   value_t v1;
   value_t v2;
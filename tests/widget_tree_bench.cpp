@@ -0,0 +1,79 @@
+﻿#include "awtk.h"
+#include "tkc/time_now.h"
+
+#define BENCH_NR 50
+#define BENCH_DEPTH 8
+#define BENCH_FANOUT 4
+
+static uint32_t s_widgets_nr = 0;
+
+static void build_tree(widget_t* parent, uint32_t depth) {
+  uint32_t i = 0;
+
+  for (i = 0; i < BENCH_FANOUT; i++) {
+    widget_t* iter = view_create(parent, i * 10, i * 10, 10, 10);
+
+    s_widgets_nr++;
+    if (depth > 1) {
+      build_tree(iter, depth - 1);
+    }
+  }
+}
+
+/*模拟绘制/布局时的遍历：只访问几何信息、标志和子控件*/
+static uint32_t walk(widget_t* widget) {
+  uint32_t sum = widget->x + widget->y + widget->w + widget->h;
+
+  if (!widget->visible || widget->floating || widget->destroying) {
+    return sum;
+  }
+
+  WIDGET_FOR_EACH_CHILD_BEGIN(widget, iter, i)
+  sum += walk(iter);
+  WIDGET_FOR_EACH_CHILD_END();
+
+  return sum;
+}
+
+static ret_t on_visit(void* ctx, const void* data) {
+  widget_t* widget = WIDGET(data);
+  uint32_t* sum = (uint32_t*)ctx;
+
+  if (widget->visible && widget->enable && !widget->dirty) {
+    *sum += widget->w;
+  }
+
+  return RET_OK;
+}
+
+int main(int argc, char* argv[]) {
+  uint32_t i = 0;
+  uint32_t sum = 0;
+  uint64_t start = 0;
+  widget_t* win = NULL;
+
+  tk_init(320, 480, APP_CONSOLE, NULL, "./");
+
+  win = window_create(NULL, 0, 0, 320, 480);
+  start = time_now_us();
+  build_tree(win, BENCH_DEPTH);
+  log_info("build %u widgets: %uus\n", s_widgets_nr, (uint32_t)(time_now_us() - start));
+  log_info("sizeof(widget_t)=%u\n", (uint32_t)sizeof(widget_t));
+
+  start = time_now_us();
+  for (i = 0; i < BENCH_NR; i++) {
+    sum += walk(win);
+  }
+  log_info("walk: %.3fms\n", (double)(time_now_us() - start) / BENCH_NR / 1000);
+
+  start = time_now_us();
+  for (i = 0; i < BENCH_NR; i++) {
+    widget_foreach(win, on_visit, &sum);
+  }
+  log_info("foreach: %.3fms (%u)\n", (double)(time_now_us() - start) / BENCH_NR / 1000, sum);
+
+  widget_destroy(win);
+  tk_exit();
+
+  return 0;
+}
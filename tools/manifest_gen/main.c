@@ -0,0 +1,79 @@
+/**
+ * File:   main.c
+ * Author: AWTK Develop Team
+ * Brief:  generate assets manifest or asset pack
+ *
+ * Copyright (c) 2018 - 2026 Guangzhou ZHIYUAN Electronics Co.,Ltd.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * License file for more details.
+ *
+ */
+
+/**
+ * History:
+ * ================================================================
+ * 2026-10-18 AWTK Develop Team created
+ *
+ */
+
+#include "tkc/fs.h"
+#include "tkc/path.h"
+#include "tkc/utils.h"
+#include "tkc/platform.h"
+#include "common/utils.h"
+#include "base/assets_manifest.h"
+#include "base/asset_loader_pack.h"
+
+int wmain(int argc, wchar_t* argv[]) {
+  ret_t ret = RET_OK;
+  str_t assets_dir;
+  str_t out_file;
+  bool_t pack = FALSE;
+  char filename[MAX_PATH + 1];
+  platform_prepare();
+
+  if (argc > 1 && tk_wstr_eq(argv[1], L"-p")) {
+    pack = TRUE;
+    argc--;
+    argv++;
+  }
+
+  if (argc < 2 || (pack && argc < 3)) {
+    printf("Usage: manifestgen assets_dir [out_filename]\n");
+    printf("       manifestgen -p assets_dir pack_filename\n");
+    return 0;
+  }
+
+  str_init(&assets_dir, 0);
+  str_init(&out_file, 0);
+  str_from_wstr(&assets_dir, argv[1]);
+
+  if (argc > 2) {
+    str_from_wstr(&out_file, argv[2]);
+    tk_strncpy(filename, out_file.str, MAX_PATH);
+  } else {
+    path_build(filename, MAX_PATH, assets_dir.str, ASSETS_MANIFEST_FILENAME, NULL);
+  }
+
+  if (pack) {
+    ret = asset_loader_pack_save(assets_dir.str, filename);
+  } else {
+    ret = assets_manifest_save(assets_dir.str, filename);
+  }
+
+  if (ret != RET_OK) {
+    GEN_ERROR(filename);
+  } else {
+    printf("done\n");
+  }
+
+  str_reset(&assets_dir);
+  str_reset(&out_file);
+
+  return 0;
+}
+
+#include "common/main.inc"
@@ -29,6 +29,8 @@
 #include "ui_loader/ui_binary_writer.h"
 #include "ui_loader/ui_loader_xml.h"
 
+static uint32_t s_ui_data_version = 1;
+
 static ret_t gen_one(const char* in_filename, const char* out_filename, bool_t output_bin,
                      const char* res_name, const char* theme_name) {
   ret_t ret = RET_OK;
@@ -40,7 +42,8 @@ static ret_t gen_one(const char* in_filename, const char* out_filename, bool_t o
     ui_binary_writer_t ui_binary_writer;
     ui_loader_t* loader = xml_ui_loader();
     ui_builder_t* builder =
-        ui_binary_writer_init(&ui_binary_writer, wbuffer_init_extendable(&wbuffer));
+        ui_binary_writer_init_ex(&ui_binary_writer, wbuffer_init_extendable(&wbuffer),
+                                 s_ui_data_version);
     builder->name = in_filename;
     str_init(&s, 0);
     do {
@@ -217,8 +220,10 @@ int wmain(int argc, wchar_t* argv[]) {
   platform_prepare();
 
   if (argc < 3) {
-    printf("Usage: %S in_filename out_filename [bin] [res_name] [theme] [src_filename] \n",
-           argv[0]);
+    printf(
+        "Usage: %S in_filename out_filename [bin|data|bin_v2|data_v2] [res_name] [theme] "
+        "[src_filename] \n",
+        argv[0]);
 
     return 0;
   }
@@ -250,9 +255,12 @@ int wmain(int argc, wchar_t* argv[]) {
     str_from_wstr(&_output_type, argv[3]);
     str_trim(&_output_type, " ");
     output_type = _output_type.str;
-    if (tk_str_eq(output_type, "bin")) {
+    if (tk_str_eq(output_type, "bin") || tk_str_eq(output_type, "bin_v2")) {
       output_bin = TRUE;
     }
+    if (tk_str_end_with(output_type, "_v2")) {
+      s_ui_data_version = 2;
+    }
   }
 
   str_init(&_res_name, 0);